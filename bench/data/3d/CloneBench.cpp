@@ -0,0 +1,133 @@
+/**
+ * @file   bench/data/3d/CloneBench.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ *
+ * Compares Polyhedron::clone with a clone that looks up the copies
+ * in std::map, as clone did before it used the slots of the elements.
+ * $ ./CloneBench res/polyhedrons/model.obj ...
+ * Prints the average time of one clone for both versions.
+ */
+
+#include "data/3d/ptrs.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Triangle.h"
+#include "data/3d/Polyhedron.h"
+#include "db/3d/OBJFile.h"
+#include "util/Timer.h"
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <map>
+#include <string>
+
+using namespace data::_3d;
+using db::_3d::OBJFile;
+using util::Timer;
+
+static PolyhedronSPtr cloneMap(PolyhedronSPtr polyhedron) {
+    std::map<VertexSPtr, VertexSPtr> vertices_c;
+    std::map<EdgeSPtr, EdgeSPtr> edges_c;
+    PolyhedronSPtr result = Polyhedron::create();
+    result->setDescription(polyhedron->getDescription());
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        VertexSPtr vertex_c = vertex->clone();
+        result->addVertex(vertex_c);
+        vertices_c[vertex] = vertex_c;
+    }
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        VertexSPtr src = vertices_c[edge->getVertexSrc()];
+        VertexSPtr dst = vertices_c[edge->getVertexDst()];
+        EdgeSPtr edge_c = Edge::create(src, dst);
+        result->addEdge(edge_c);
+        edges_c[edge] = edge_c;
+    }
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        FacetSPtr facet_c = Facet::create();
+        facet_c->setPlane(facet->getPlane());
+        std::list<VertexSPtr>::iterator it_fv = facet->vertices().begin();
+        while (it_fv != facet->vertices().end()) {
+            VertexSPtr vertex = *it_fv++;
+            facet_c->addVertex(vertices_c[vertex]);
+        }
+        std::list<EdgeSPtr>::iterator it_fe = facet->edges().begin();
+        while (it_fe != facet->edges().end()) {
+            EdgeSPtr edge = *it_fe++;
+            EdgeSPtr edge_c = edges_c[edge];
+            if (edge->getFacetL() == facet) {
+                edge_c->setFacetL(facet_c);
+            }
+            if (edge->getFacetR() == facet) {
+                edge_c->setFacetR(facet_c);
+            }
+            facet_c->addEdge(edge_c);
+        }
+        std::list<TriangleSPtr>::iterator it_t = facet->triangles().begin();
+        while (it_t != facet->triangles().end()) {
+            TriangleSPtr triangle = *it_t++;
+            VertexSPtr vertices_t_c[3];
+            for (unsigned int i = 0; i < 3; i++) {
+                vertices_t_c[i] = vertices_c[triangle->getVertex(i)];
+            }
+            Triangle::create(facet_c, vertices_t_c);
+        }
+        result->addFacet(facet_c);
+    }
+    return result;
+}
+
+/**
+ * Average time of one clone in microseconds.
+ */
+static double timeClone(PolyhedronSPtr polyhedron, bool slots, unsigned int repeat) {
+    double t_start = Timer::now();
+    for (unsigned int i = 0; i < repeat; i++) {
+        PolyhedronSPtr polyhedron_c;
+        if (slots) {
+            polyhedron_c = polyhedron->clone();
+        } else {
+            polyhedron_c = cloneMap(polyhedron);
+        }
+    }
+    double result = (Timer::now() - t_start) * 1.0e6 / repeat;
+    return result;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " [--repeat N] model.obj ..." << std::endl;
+        return 1;
+    }
+    unsigned int repeat = 100;
+    int i = 1;
+    if (argc > 3 && std::string(argv[i]).compare("--repeat") == 0) {
+        repeat = atoi(argv[i+1]);
+        i += 2;
+    }
+    std::cout << "model\t#vertices\t#edges\t#facets\tmap [us]\tslots [us]" << std::endl;
+    for (; i < argc; i++) {
+        PolyhedronSPtr polyhedron = OBJFile::load(argv[i]);
+        if (!polyhedron) {
+            std::cerr << "Error: Unable to load " << argv[i] << std::endl;
+            continue;
+        }
+        // warm up
+        timeClone(polyhedron, false, 1);
+        timeClone(polyhedron, true, 1);
+        double t_map = timeClone(polyhedron, false, repeat);
+        double t_slots = timeClone(polyhedron, true, repeat);
+        std::cout << argv[i] << "\t" << polyhedron->vertices().size()
+                << "\t" << polyhedron->edges().size()
+                << "\t" << polyhedron->facets().size()
+                << "\t" << t_map << "\t" << t_slots << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file   bench/kernel/IntersectionBench.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ *
+ * Compares the throughput of intersecting triples of planes
+ * one by one with the batched intersection on each instruction set.
+ * $ ./IntersectionBench [num_triples] [repeat]
+ */
+
+#include "kernel/intersection.h"
+#include "kernel/intersection_batch.h"
+#include "kernel/Plane3.h"
+#include "kernel/Point3.h"
+#include "util/Timer.h"
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <vector>
+
+using kernel::Plane3;
+using kernel::Point3;
+using kernel::PlaneTriples;
+using kernel::SimdLevel;
+using util::Timer;
+
+int main(int argc, char** argv) {
+    size_t n = 1 << 16;
+    unsigned int repeat = 100;
+    if (argc > 1) {
+        n = atol(argv[1]);
+    }
+    if (argc > 2) {
+        repeat = atoi(argv[2]);
+    }
+    srand(0);
+    std::vector<double> coeffs[12];
+    for (unsigned int k = 0; k < 12; k++) {
+        coeffs[k].resize(n);
+        for (size_t i = 0; i < n; i++) {
+            coeffs[k][i] = 2.0*((double)rand()/(double)RAND_MAX) - 1.0;
+        }
+    }
+    std::vector<Plane3> planes[3];
+    for (unsigned int j = 0; j < 3; j++) {
+        for (size_t i = 0; i < n; i++) {
+            planes[j].push_back(Plane3(coeffs[4*j][i], coeffs[4*j+1][i],
+                    coeffs[4*j+2][i], coeffs[4*j+3][i]));
+        }
+    }
+    PlaneTriples triples;
+    for (unsigned int j = 0; j < 3; j++) {
+        triples.a[j] = &(coeffs[4*j][0]);
+        triples.b[j] = &(coeffs[4*j+1][0]);
+        triples.c[j] = &(coeffs[4*j+2][0]);
+        triples.d[j] = &(coeffs[4*j+3][0]);
+    }
+    std::vector<double> x(n), y(n), z(n);
+    std::vector<unsigned char> valid(n);
+
+    std::cout << "version\tMtriples/s\tchecksum" << std::endl;
+    double checksum = 0.0;
+    double t_start = Timer::now();
+    for (unsigned int r = 0; r < repeat; r++) {
+        for (size_t i = 0; i < n; i++) {
+            std::optional<Point3> p = kernel::intersection(
+                    planes[0][i], planes[1][i], planes[2][i]);
+            if (p) {
+                x[i] = p->getX();
+            }
+        }
+        checksum += x[r % n];
+    }
+    double t = Timer::now() - t_start;
+    std::cout << "single\t" << (n * repeat) / t / 1.0e6 << "\t" << checksum << std::endl;
+
+    for (int level = kernel::SIMD_SCALAR; level <= kernel::simdLevelSupported(); level++) {
+        checksum = 0.0;
+        t_start = Timer::now();
+        for (unsigned int r = 0; r < repeat; r++) {
+            kernel::intersection(n, triples, &x[0], &y[0], &z[0], &valid[0],
+                    (SimdLevel)level);
+            checksum += x[r % n];
+        }
+        t = Timer::now() - t_start;
+        std::cout << kernel::simdLevelName((SimdLevel)level) << "\t"
+                << (n * repeat) / t / 1.0e6 << "\t" << checksum << std::endl;
+    }
+    return 0;
+}
@@ -20,14 +20,10 @@ KernelWrapper::~KernelWrapper() {
 
 Point2SPtr KernelWrapper::intersection(Line2SPtr line1, Line2SPtr line2) {
     Point2SPtr result = Point2SPtr();
-#ifdef USE_CGAL
-    CGAL::Object obj = CGAL::intersection(*line1, *line2);
-    if (const CGAL::Point2 *ipoint = CGAL::object_cast<CGAL::Point2>(&obj)) {
-        result = KernelFactory::createPoint2(*ipoint);
+    std::optional<Point2> p = intersection(*line1, *line2);
+    if (p) {
+        result = KernelFactory::createPoint2(*p);
     }
-#else
-    result = Point2SPtr(kernel::intersection(&(*line1), &(*line2)));
-#endif
     DEBUG_SPTR(result);
     return result;
 }
@@ -44,23 +40,11 @@ Line2SPtr KernelWrapper::bisector(Line2SPtr line1, Line2SPtr line2) {
 }
 
 double KernelWrapper::distance(Point2SPtr p, Point2SPtr q) {
-    double result = 0.0;
-#ifdef USE_CGAL
-    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(*p, *q)));
-#else
-    result = kernel::distance(&(*p), &(*q));
-#endif
-    return result;
+    return distance(*p, *q);
 }
 
 double KernelWrapper::distance(Line2SPtr line, Point2SPtr point) {
-    double result = 0.0;
-#ifdef USE_CGAL
-    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(*line, *point)));
-#else
-    result = kernel::distance(&(*line), &(*point));
-#endif
-    return result;
+    return distance(*line, *point);
 }
 
 Line2SPtr KernelWrapper::opposite(Line2SPtr line) {
@@ -77,30 +61,11 @@ Vector2SPtr KernelWrapper::perpendicular(Vector2SPtr vector) {
 }
 
 Vector2SPtr KernelWrapper::normalize(Vector2SPtr vector) {
-    Vector2SPtr result;
-#ifdef USE_CGAL
-    result = KernelFactory::createVector2(
-            *vector / CGAL::sqrt(vector->squared_length()));
-#else
-    result = KernelFactory::createVector2(vector->normalize());
-#endif
-    return result;
+    return KernelFactory::createVector2(normalize(*vector));
 }
 
 Line2SPtr KernelWrapper::offsetLine(Line2SPtr line, double offset) {
-    Line2SPtr result;
-    Point2 p = line->point();
-#ifdef USE_CGAL
-    Vector2 v_dir = line->to_vector();
-    Vector2 v_norm(-v_dir[1], v_dir[0]);
-    Vector2 v_normal = v_norm / CGAL::sqrt(v_norm.squared_length());
-#else
-    Vector2 v_dir = line->direction();
-    Vector2 v_normal = line->normal().normalize();
-#endif
-    Point2 p_trans = p + (v_normal * offset);
-    Line2 line_trans(p_trans, v_dir);
-    result = KernelFactory::createLine2(line_trans);
+    Line2SPtr result = KernelFactory::createLine2(offsetLine(*line, offset));
     DEBUG_SPTR(result);
     return result;
 }
@@ -138,25 +103,12 @@ double KernelWrapper::angle(Vector2SPtr v1, Vector2SPtr v2) {
 }
 
 int KernelWrapper::side(Line2SPtr line, Point2SPtr point) {
-    int result = 0;
-#ifdef USE_CGAL
-    CGAL::Oriented_side side = line->oriented_side(*point);
-    if (side == CGAL::ON_POSITIVE_SIDE) result = 1;
-    if (side == CGAL::ON_NEGATIVE_SIDE) result = -1;
-#else
-    result = line->side(*point);
-#endif
-    return result;
+    return side(*line, *point);
 }
 
 
 Point2SPtr KernelWrapper::projection(Line2SPtr line, Point2SPtr point) {
-    Point2SPtr result = Point2SPtr();
-#ifdef USE_CGAL
-    result = KernelFactory::createPoint2(line->projection(*point));
-#else
-    result = Point2SPtr(kernel::projection(&(*line), &(*point)));
-#endif
+    Point2SPtr result = KernelFactory::createPoint2(projection(*line, *point));
     DEBUG_SPTR(result);
     return result;
 }
@@ -188,4 +140,79 @@ bool KernelWrapper::isInside(Point2SPtr p, Point2SPtr p_box_1, Point2SPtr p_box_
     return result;
 }
 
+std::optional<Point2> KernelWrapper::intersection(const Line2& line1, const Line2& line2) {
+    std::optional<Point2> result;
+#ifdef USE_CGAL
+    CGAL::Object obj = CGAL::intersection(line1, line2);
+    if (const CGAL::Point2 *ipoint = CGAL::object_cast<CGAL::Point2>(&obj)) {
+        result = *ipoint;
+    }
+#else
+    result = kernel::intersection(line1, line2);
+#endif
+    return result;
+}
+
+double KernelWrapper::distance(const Point2& p, const Point2& q) {
+    double result = 0.0;
+#ifdef USE_CGAL
+    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(p, q)));
+#else
+    result = kernel::distance(&p, &q);
+#endif
+    return result;
+}
+
+double KernelWrapper::distance(const Line2& line, const Point2& point) {
+    double result = 0.0;
+#ifdef USE_CGAL
+    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(line, point)));
+#else
+    result = kernel::distance(&line, &point);
+#endif
+    return result;
+}
+
+Vector2 KernelWrapper::normalize(const Vector2& vector) {
+#ifdef USE_CGAL
+    return vector / CGAL::sqrt(vector.squared_length());
+#else
+    return vector.normalize();
+#endif
+}
+
+Line2 KernelWrapper::offsetLine(const Line2& line, double offset) {
+    Point2 p = line.point();
+#ifdef USE_CGAL
+    Vector2 v_dir = line.to_vector();
+    Vector2 v_norm(-v_dir[1], v_dir[0]);
+    Vector2 v_normal = v_norm / CGAL::sqrt(v_norm.squared_length());
+#else
+    Vector2 v_dir = line.direction();
+    Vector2 v_normal = line.normal().normalize();
+#endif
+    Point2 p_trans = p + (v_normal * offset);
+    return Line2(p_trans, v_dir);
+}
+
+int KernelWrapper::side(const Line2& line, const Point2& point) {
+    int result = 0;
+#ifdef USE_CGAL
+    CGAL::Oriented_side side = line.oriented_side(point);
+    if (side == CGAL::ON_POSITIVE_SIDE) result = 1;
+    if (side == CGAL::ON_NEGATIVE_SIDE) result = -1;
+#else
+    result = line.side(point);
+#endif
+    return result;
+}
+
+Point2 KernelWrapper::projection(const Line2& line, const Point2& point) {
+#ifdef USE_CGAL
+    return line.projection(point);
+#else
+    return kernel::projection(line, point);
+#endif
+}
+
 } }
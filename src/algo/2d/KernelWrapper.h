@@ -7,6 +7,8 @@
 #ifndef ALGO_2D_KERNELWRAPPER_H
 #define ALGO_2D_KERNELWRAPPER_H
 
+#include <optional>
+
 #include "config.h"
 #ifdef USE_CGAL
     #include "cgal_kernel.h"
@@ -50,6 +52,20 @@ public:
     static int compatePoints(Vector2SPtr v_dir, Point2SPtr p_1, Point2SPtr p_2);
     static bool isInside(Point2SPtr p, Point2SPtr p_box_1, Point2SPtr p_box_2);
 
+    /*
+     * The following take kernel objects by reference and return their
+     * result by value. Nothing is allocated on the heap, so they can be
+     * used in loops that only need intermediate results.
+     * The functions above that take shared pointers call these.
+     */
+    static std::optional<Point2> intersection(const Line2& line1, const Line2& line2);
+    static double distance(const Point2& p, const Point2& q);
+    static double distance(const Line2& line, const Point2& point);
+    static Vector2 normalize(const Vector2& vector);
+    static Line2 offsetLine(const Line2& line, double offset);
+    static int side(const Line2& line, const Point2& point);
+    static Point2 projection(const Line2& line, const Point2& point);
+
 protected:
     KernelWrapper();
 };
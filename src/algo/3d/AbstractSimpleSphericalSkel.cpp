@@ -30,6 +30,7 @@ AbstractSimpleSphericalSkel::AbstractSimpleSphericalSkel() {
 AbstractSimpleSphericalSkel::~AbstractSimpleSphericalSkel() {
     polygon_.reset();
     controller_.reset();
+    settings_.reset();
     skel_result_.reset();
 }
 
@@ -54,6 +54,7 @@ protected:
     int type_;
     SphericalPolygonSPtr polygon_;
     ControllerSPtr controller_;
+    SkelSettingsSPtr settings_;
     SphericalSkeletonSPtr skel_result_;
 };
 
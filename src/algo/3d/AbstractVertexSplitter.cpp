@@ -8,6 +8,7 @@
 
 #include "algo/3d/KernelWrapper.h"
 #include "algo/3d/SelfIntersection.h"
+#include "algo/3d/SimpleStraightSkel.h"
 #include "data/3d/Vertex.h"
 #include "data/3d/Edge.h"
 #include "data/3d/Facet.h"
@@ -42,13 +43,9 @@ PolyhedronSPtr AbstractVertexSplitter::splitConvexVertex(VertexSPtr vertex) {
         double speed_max = 0.0;
         FacetSPtr facet_1;
         FacetSPtr facet_2;
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (facet_wptr.expired()) {
-                continue;
-            }
-            FacetSPtr facet(facet_wptr);
+            FacetSPtr facet = (*it_f++).lock();
             FacetSPtr facet_prev = facet->prev(vertex);
             FacetSPtr facet_next = facet->next(vertex);
             Plane3SPtr offset_plane =
@@ -69,8 +66,7 @@ PolyhedronSPtr AbstractVertexSplitter::splitConvexVertex(VertexSPtr vertex) {
         }
         VertexSPtr vertex_splitted = vertex->split(facet_1, facet_2);
         if (vertex->hasData()) {
-            SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(
-                    vertex->getData());
+            SkelVertexData* data = SkelVertexData::of(vertex);
             SkelVertexDataSPtr data_splitted = SkelVertexData::create(
                     vertex_splitted);
             data_splitted->setNode(data->getNode());
@@ -86,13 +82,9 @@ PolyhedronSPtr AbstractVertexSplitter::splitReflexVertex(VertexSPtr vertex) {
         double speed_min = std::numeric_limits<double>::max();
         FacetSPtr facet_1;
         FacetSPtr facet_2;
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (facet_wptr.expired()) {
-                continue;
-            }
-            FacetSPtr facet(facet_wptr);
+            FacetSPtr facet = (*it_f++).lock();
             FacetSPtr facet_prev = facet->prev(vertex);
             FacetSPtr facet_next = facet->next(vertex);
             Plane3SPtr offset_plane =
@@ -113,8 +105,7 @@ PolyhedronSPtr AbstractVertexSplitter::splitReflexVertex(VertexSPtr vertex) {
         }
         VertexSPtr vertex_splitted = vertex->split(facet_1, facet_2);
         if (vertex->hasData()) {
-            SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(
-                    vertex->getData());
+            SkelVertexData* data = SkelVertexData::of(vertex);
             SkelVertexDataSPtr data_splitted = SkelVertexData::create(
                     vertex_splitted);
             data_splitted->setNode(data->getNode());
@@ -127,27 +118,23 @@ PolyhedronSPtr AbstractVertexSplitter::splitReflexVertex(VertexSPtr vertex) {
 PolyhedronSPtr AbstractVertexSplitter::shiftFacets(PolyhedronSPtr polyhedron, double offset) {
     PolyhedronSPtr result = Polyhedron::create();
 
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
     while (it_v != polyhedron->vertices().end()) {
         VertexSPtr vertex = *it_v++;
-        Plane3SPtr planes[3];
+        Plane3 planes[3];
         unsigned int i = 0;
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (i < 3 && it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet = FacetSPtr(facet_wptr);
-                double speed = 1.0;
-                if (facet->hasData()) {
-                    speed = std::dynamic_pointer_cast<SkelFacetData>(
-                            facet->getData())->getSpeed();
-                }
-                planes[i] = KernelWrapper::offsetPlane(facet->plane(), offset*speed);
-                i++;
-            }
+            FacetHandle facet = *it_f++;
+            planes[i] = SimpleStraightSkel::offsetPlane(facet.get(), offset);
+            i++;
         }
         if (i >= 3) {
-            Point3SPtr point = KernelWrapper::intersection(planes[0], planes[1], planes[2]);
+            std::optional<Point3> p = KernelWrapper::intersection(planes[0], planes[1], planes[2]);
+            Point3SPtr point;
+            if (p) {
+                point = KernelFactory::createPoint3(*p);
+            }
             if (!point) {
                 result = PolyhedronSPtr();
                 DEBUG_SPTR(result);
@@ -155,13 +142,13 @@ PolyhedronSPtr AbstractVertexSplitter::shiftFacets(PolyhedronSPtr polyhedron, do
             }
             VertexSPtr offset_vertex = Vertex::create(point);
             // SkelVertexData for each vertex should be created by init
-            SkelVertexDataSPtr data;
+            SkelVertexData* data = 0;
             if (vertex->hasData()) {
-                data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+                data = SkelVertexData::of(vertex);
                 SkelVertexDataSPtr offset_data = SkelVertexData::create(offset_vertex);
                 offset_data->setArc(data->getArc());
             } else {
-                data = SkelVertexData::create(vertex);
+                data = SkelVertexData::create(vertex).get();
             }
             data->setOffsetVertex(offset_vertex);
             result->addVertex(offset_vertex);
@@ -173,14 +160,9 @@ PolyhedronSPtr AbstractVertexSplitter::shiftFacets(PolyhedronSPtr polyhedron, do
     while (it_v != polyhedron->vertices().end()) {
         VertexSPtr vertex = *it_v++;
         EdgeSPtr edge;
-        unsigned int i = 0;
-        std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
-        while (it_e != vertex->edges().end()) {
-            EdgeWPtr edge_wptr = *it_e++;
-            if (!edge_wptr.expired()) {
-                edge = EdgeSPtr(edge_wptr);
-                i++;
-            }
+        unsigned int i = vertex->edges().size();
+        if (i > 0) {
+            edge = vertex->edges().back().lock();
         }
         if (i == 1) {
             VertexSPtr vertex_other;
@@ -189,72 +171,67 @@ PolyhedronSPtr AbstractVertexSplitter::shiftFacets(PolyhedronSPtr polyhedron, do
             } else if (edge->getVertexDst() == vertex) {
                 vertex_other = edge->getVertexSrc();
             }
-            SkelVertexDataSPtr data_other = std::dynamic_pointer_cast<SkelVertexData>(
-                    vertex_other->getData());
+            SkelVertexData* data_other = SkelVertexData::of(vertex_other);
             VertexSPtr offset_vertex_other = data_other->getOffsetVertex();
             Vector3 direction =
                     *(offset_vertex_other->getPoint()) - *(vertex_other->getPoint());
             Point3SPtr point = KernelFactory::createPoint3(
                     *(vertex->getPoint()) + direction);
             VertexSPtr offset_vertex = Vertex::create(point);
-            SkelVertexDataSPtr data;
+            SkelVertexData* data = 0;
             if (vertex->hasData()) {
-                data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+                data = SkelVertexData::of(vertex);
             } else {
-                data = SkelVertexData::create(vertex);
+                data = SkelVertexData::create(vertex).get();
             }
             data->setOffsetVertex(offset_vertex);
             result->addVertex(offset_vertex);
         }
     }
 
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
-        SkelVertexDataSPtr vertex_src_data = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexSrc()->getData());
-        SkelVertexDataSPtr vertex_dst_data = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexDst()->getData());
+        SkelVertexData* vertex_src_data = SkelVertexData::of(edge->getVertexSrc());
+        SkelVertexData* vertex_dst_data = SkelVertexData::of(edge->getVertexDst());
         if (vertex_src_data && vertex_dst_data) {
             VertexSPtr offset_vertex_src = vertex_src_data->getOffsetVertex();
             VertexSPtr offset_vertex_dst = vertex_dst_data->getOffsetVertex();
             EdgeSPtr offset_edge = Edge::create(offset_vertex_src, offset_vertex_dst);
-            SkelEdgeDataSPtr data;
+            SkelEdgeData* data = 0;
             if (edge->hasData()) {
-                data = std::dynamic_pointer_cast<SkelEdgeData>(edge->getData());
+                data = SkelEdgeData::of(edge);
                 SkelEdgeDataSPtr offset_data = SkelEdgeData::create(offset_edge);
                 offset_data->setSheet(data->getSheet());
             } else {
-                data = SkelEdgeData::create(edge);
+                data = SkelEdgeData::create(edge).get();
             }
             data->setOffsetEdge(offset_edge);
             result->addEdge(offset_edge);
         }
     }
 
-    std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         FacetSPtr facet = *it_f++;
         FacetSPtr offset_facet = Facet::create();
-        SkelFacetDataSPtr data;
-        double speed = 1.0;
+        SkelFacetData* data = 0;
         if (facet->hasData()) {
-            data = std::dynamic_pointer_cast<SkelFacetData>(facet->getData());
-            speed = data->getSpeed();
+            data = SkelFacetData::of(facet);
             SkelFacetDataSPtr data_offset = SkelFacetData::create(offset_facet);
             data_offset->setFacetOrigin(data->getFacetOrigin());
             data_offset->setSpeed(data->getSpeed());
         } else {
-            data = SkelFacetData::create(facet);
+            data = SkelFacetData::create(facet).get();
         }
-        Plane3SPtr offset_plane = KernelWrapper::offsetPlane(facet->plane(), offset*speed);
+        Plane3SPtr offset_plane = KernelFactory::createPlane3(
+                SimpleStraightSkel::offsetPlane(facet.get(), offset));
         offset_facet->setPlane(offset_plane);
         std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
         while (it_v != facet->vertices().end()) {
             VertexSPtr vertex = *it_v++;
             if (vertex->hasData()) {
-                SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-                    vertex->getData());
+                SkelVertexData* vertex_data = SkelVertexData::of(vertex);
                 VertexSPtr offset_vertex = vertex_data->getOffsetVertex();
                 if (offset_vertex) {
                     offset_facet->addVertex(offset_vertex);
@@ -264,8 +241,7 @@ PolyhedronSPtr AbstractVertexSplitter::shiftFacets(PolyhedronSPtr polyhedron, do
         std::list<EdgeSPtr>::iterator it_e = facet->edges().begin();
         while (it_e != facet->edges().end()) {
             EdgeSPtr edge = *it_e++;
-            SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-                edge->getData());
+            SkelEdgeData* edge_data = SkelEdgeData::of(edge);
             EdgeSPtr offset_edge = edge_data->getOffsetEdge();
             if (facet == edge->getFacetL()) {
                 offset_edge->setFacetL(offset_facet);
@@ -44,12 +44,12 @@ PolyhedronSPtr AngleVertexSplitter::splitVertex(VertexSPtr vertex) {
         double angle_min = 2*M_PI;
         FacetSPtr facet_min1;
         FacetSPtr facet_min2;
-        std::list<FacetWPtr>::iterator it_f1 = vertex1->facets().begin();
+        std::list<FacetHandle>::iterator it_f1 = vertex1->facets().begin();
         while (it_f1 != vertex1->facets().end()) {
-            FacetSPtr facet1 = FacetSPtr(*it_f1++);
-            std::list<FacetWPtr>::iterator it_f2 = vertex1->facets().begin();
+            FacetSPtr facet1 = (*it_f1++).lock();
+            std::list<FacetHandle>::iterator it_f2 = vertex1->facets().begin();
             while (it_f2 != vertex1->facets().end()) {
-                FacetSPtr facet2 = FacetSPtr(*it_f2++);
+                FacetSPtr facet2 = (*it_f2++).lock();
                 if (facet1 == facet2 ||
                         facet1->prev(vertex1) == facet2 ||
                         facet1->next(vertex1) == facet2) {
@@ -69,8 +69,7 @@ PolyhedronSPtr AngleVertexSplitter::splitVertex(VertexSPtr vertex) {
         // 2. split vertex
         VertexSPtr vertex2 = vertex1->split(facet_min1, facet_min2);
         if (vertex1->hasData()) {
-            SkelVertexDataSPtr data1 = std::dynamic_pointer_cast<SkelVertexData>(
-                    vertex1->getData());
+            SkelVertexData* data1 = SkelVertexData::of(vertex1);
             SkelVertexDataSPtr data2 = SkelVertexData::create(vertex2);
             data2->setNode(data1->getNode());
         }
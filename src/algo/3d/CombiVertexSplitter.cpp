@@ -8,13 +8,13 @@
 
 #include "debug.h"
 #include "typedefs_thread.h"
+#include "algo/3d/SkelSettings.h"
 #include "data/3d/Vertex.h"
 #include "data/3d/Edge.h"
 #include "data/3d/Facet.h"
 #include "data/3d/Polyhedron.h"
 #include "data/3d/skel/SkelVertexData.h"
 #include "data/3d/skel/SkelFacetData.h"
-#include "util/Configuration.h"
 #include <map>
 #include <sstream>
 
@@ -23,11 +23,11 @@ namespace algo { namespace _3d {
 CombiVertexSplitter::CombiVertexSplitter() {
     type_ = AbstractVertexSplitter::COMBI_VERTEX_SPLITTER;
     selected_combi_ = 0;
-    util::ConfigurationSPtr config = util::Configuration::getInstance();
-    if (config->isLoaded()) {
-        selected_combi_ = config->getInt(
-                "algo_3d_CombiVertexSplitter", "selected_combi");
-    }
+}
+
+CombiVertexSplitter::CombiVertexSplitter(SkelSettingsSPtr settings) {
+    type_ = AbstractVertexSplitter::COMBI_VERTEX_SPLITTER;
+    selected_combi_ = settings->getSelectedCombi();
 }
 
 CombiVertexSplitter::~CombiVertexSplitter() {
@@ -35,8 +35,12 @@ CombiVertexSplitter::~CombiVertexSplitter() {
 }
 
 CombiVertexSplitterSPtr CombiVertexSplitter::create() {
+    return create(SkelSettings::create());
+}
+
+CombiVertexSplitterSPtr CombiVertexSplitter::create(SkelSettingsSPtr settings) {
     CombiVertexSplitterSPtr result =
-            CombiVertexSplitterSPtr(new CombiVertexSplitter());
+            CombiVertexSplitterSPtr(new CombiVertexSplitter(settings));
     return result;
 }
 
@@ -263,8 +267,7 @@ PolyhedronSPtr CombiVertexSplitter::copyVertex(VertexSPtr vertex) {
             facet_c_data = SkelFacetData::create(facet_c);
             facet_c_data->setFacetOrigin(facet);
             if (facet->hasData()) {
-                facet_c_data->setSpeed(std::dynamic_pointer_cast<SkelFacetData>(
-                        facet->getData())->getSpeed());
+                facet_c_data->setSpeed(SkelFacetData::of(facet)->getSpeed());
             }
             result->addFacet(facet_c);
         }
@@ -283,8 +286,7 @@ PolyhedronSPtr CombiVertexSplitter::copyVertex(VertexSPtr vertex) {
     facet_c_data = SkelFacetData::create(facet_c);
     facet_c_data->setFacetOrigin(facet);
     if (facet->hasData()) {
-        facet_c_data->setSpeed(std::dynamic_pointer_cast<SkelFacetData>(
-                facet->getData())->getSpeed());
+        facet_c_data->setSpeed(SkelFacetData::of(facet)->getSpeed());
     }
     result->addFacet(facet_c);
     return result;
@@ -327,8 +329,7 @@ PolyhedronSPtr CombiVertexSplitter::splitVertex(VertexSPtr vertex, combi combina
                     edges_toremove.push_back(edge);
                 }
                 if (vertex->hasData()) {
-                    SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(
-                            vertex->getData());
+                    SkelVertexData* data = SkelVertexData::of(vertex);
                     SkelVertexDataSPtr data2 = SkelVertexData::create(vertex2);
                     data2->setNode(data->getNode());
                 }
@@ -369,23 +370,17 @@ PolyhedronSPtr CombiVertexSplitter::splitVertex(VertexSPtr vertex, combi combina
             VertexSPtr vertex_merged_src = vertex->prev(facet_l);
             VertexSPtr vertex_merged_dst = vertex->next(facet_l);
             FacetSPtr facet_r = facet_l->next(vertex);
-            std::list<EdgeWPtr>::iterator it_ew = vertex->edges().begin();
+            std::list<EdgeHandle>::iterator it_ew = vertex->edges().begin();
             while (it_ew != vertex->edges().end()) {
-                EdgeWPtr edge_wptr = *it_ew++;
-                if (!edge_wptr.expired()) {
-                    EdgeSPtr edge_toremove(edge_wptr);
-                    facet_l->removeEdge(edge_toremove);
-                    facet_r->removeEdge(edge_toremove);
-                    polyhedron->removeEdge(edge_toremove);
-                }
+                EdgeSPtr edge_toremove = (*it_ew++).lock();
+                facet_l->removeEdge(edge_toremove);
+                facet_r->removeEdge(edge_toremove);
+                polyhedron->removeEdge(edge_toremove);
             }
-            std::list<FacetWPtr>::iterator it_fw = vertex->facets().begin();
+            std::list<FacetHandle>::iterator it_fw = vertex->facets().begin();
             while (it_fw != vertex->facets().end()) {
-                FacetWPtr facet_wptr = *it_fw++;
-                if (!facet_wptr.expired()) {
-                    FacetSPtr facet(facet_wptr);
-                    facet->removeVertex(vertex);
-                }
+                FacetSPtr facet = (*it_fw++).lock();
+                facet->removeVertex(vertex);
             }
             polyhedron->removeVertex(vertex);
             EdgeSPtr edge_merged = Edge::create(vertex_merged_src, vertex_merged_dst);
@@ -403,12 +398,11 @@ PolyhedronSPtr CombiVertexSplitter::apply(PolyhedronSPtr poly_split, VertexSPtr
     PolyhedronSPtr polyhedron = vertex->getPolyhedron();
     NodeSPtr node;
     if (vertex->hasData()) {
-        SkelVertexDataSPtr data =
-                std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+        SkelVertexData* data = SkelVertexData::of(vertex);
         node = data->getNode();
     }
     std::map<VertexSPtr, VertexSPtr> vertices;
-    std::list<VertexSPtr>::iterator it_v = poly_split->vertices().begin();
+    util::SlotList<VertexSPtr>::iterator it_v = poly_split->vertices().begin();
     while (it_v != poly_split->vertices().end()) {
         VertexSPtr vertex_ps = *it_v++;
         if (vertex_ps->degree() > 1) {
@@ -420,7 +414,7 @@ PolyhedronSPtr CombiVertexSplitter::apply(PolyhedronSPtr poly_split, VertexSPtr
         }
     }
 
-    std::list<EdgeSPtr>::iterator it_e = poly_split->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = poly_split->edges().begin();
     while (it_e != poly_split->edges().end()) {
         EdgeSPtr edge_ps = *it_e++;
         VertexSPtr vertex_ps_src = edge_ps->getVertexSrc();
@@ -429,16 +423,13 @@ PolyhedronSPtr CombiVertexSplitter::apply(PolyhedronSPtr poly_split, VertexSPtr
         FacetSPtr facet_ps_r = edge_ps->getFacetR();
         if (vertex_ps_dst->degree() == 1) {
             EdgeSPtr edge_vs;
-            std::list<EdgeWPtr>::iterator it_ve = vertex->edges().begin();
+            std::list<EdgeHandle>::iterator it_ve = vertex->edges().begin();
             while (it_ve != vertex->edges().end()) {
-                EdgeWPtr edge_wptr = *it_ve++;
-                if (!edge_wptr.expired()) {
-                    EdgeSPtr edge(edge_wptr);
-                    if (edge->getVertexSrc()->getPoint() == vertex_ps_dst->getPoint() ||
-                            edge->getVertexDst()->getPoint() == vertex_ps_dst->getPoint()) {
-                        edge_vs = edge;
-                        break;
-                    }
+                EdgeSPtr edge = (*it_ve++).lock();
+                if (edge->getVertexSrc()->isCoincident(vertex_ps_dst) ||
+                        edge->getVertexDst()->isCoincident(vertex_ps_dst)) {
+                    edge_vs = edge;
+                    break;
                 }
             }
             VertexSPtr vertex_vs = vertices[vertex_ps_src];
@@ -455,16 +446,13 @@ PolyhedronSPtr CombiVertexSplitter::apply(PolyhedronSPtr poly_split, VertexSPtr
             }
         } else if (vertex_ps_src->degree() == 1) {
             EdgeSPtr edge_vs;
-            std::list<EdgeWPtr>::iterator it_ve = vertex->edges().begin();
+            std::list<EdgeHandle>::iterator it_ve = vertex->edges().begin();
             while (it_ve != vertex->edges().end()) {
-                EdgeWPtr edge_wptr = *it_ve++;
-                if (!edge_wptr.expired()) {
-                    EdgeSPtr edge(edge_wptr);
-                    if (edge->getVertexSrc()->getPoint() == vertex_ps_src->getPoint() ||
-                            edge->getVertexDst()->getPoint() == vertex_ps_src->getPoint()) {
-                        edge_vs = edge;
-                        break;
-                    }
+                EdgeSPtr edge = (*it_ve++).lock();
+                if (edge->getVertexSrc()->isCoincident(vertex_ps_src) ||
+                        edge->getVertexDst()->isCoincident(vertex_ps_src)) {
+                    edge_vs = edge;
+                    break;
                 }
             }
             VertexSPtr vertex_vs = vertices[vertex_ps_dst];
@@ -481,12 +469,8 @@ PolyhedronSPtr CombiVertexSplitter::apply(PolyhedronSPtr poly_split, VertexSPtr
             }
         } else {
             EdgeSPtr edge_vs = Edge::create(vertices[vertex_ps_src], vertices[vertex_ps_dst]);
-            SkelFacetDataSPtr data_l =
-                    std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_ps_l->getData());
-            SkelFacetDataSPtr data_r =
-                    std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_ps_r->getData());
+            SkelFacetData* data_l = SkelFacetData::of(facet_ps_l);
+            SkelFacetData* data_r = SkelFacetData::of(facet_ps_r);
             FacetSPtr facet_vs_l = data_l->getFacetOrigin();
             FacetSPtr facet_vs_r = data_r->getFacetOrigin();
             edge_vs->setFacetL(facet_vs_l);
@@ -497,13 +481,10 @@ PolyhedronSPtr CombiVertexSplitter::apply(PolyhedronSPtr poly_split, VertexSPtr
         }
     }
 
-    std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+    std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
     while (it_f != vertex->facets().end()) {
-        FacetWPtr facet_wptr = *it_f++;
-        if (!facet_wptr.expired()) {
-            FacetSPtr facet(facet_wptr);
-            facet->removeVertex(vertex);
-        }
+        FacetSPtr facet = (*it_f++).lock();
+        facet->removeVertex(vertex);
     }
     polyhedron->removeVertex(vertex);
     return polyhedron;
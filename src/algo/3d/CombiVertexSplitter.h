@@ -29,6 +29,7 @@ public:
     virtual ~CombiVertexSplitter();
 
     static CombiVertexSplitterSPtr create();
+    static CombiVertexSplitterSPtr create(SkelSettingsSPtr settings);
 
     static vec2i createSplit(int begin, int end);
     static int compareSplits(vec2i split1, vec2i split2);
@@ -55,6 +56,7 @@ public:
 
 protected:
     CombiVertexSplitter();
+    CombiVertexSplitter(SkelSettingsSPtr settings);
 
     unsigned int selected_combi_;
 };
@@ -11,25 +11,15 @@
 #include "data/3d/Vertex.h"
 #include "data/3d/Edge.h"
 #include "data/3d/Polyhedron.h"
-#include "util/ptrs.h"
-#include "util/Configuration.h"
+#include "algo/3d/SkelSettings.h"
 #include <list>
 
 namespace algo { namespace _3d {
 
-ConvexVertexSplitter::ConvexVertexSplitter() {
+ConvexVertexSplitter::ConvexVertexSplitter(SkelSettingsSPtr settings) {
     type_ = AbstractVertexSplitter::CONVEX_VERTEX_SPLITTER;
-    optimization_ = -1;
-    util::ConfigurationSPtr config = util::Configuration::getInstance();
-    if (config->isLoaded()) {
-        std::string s_optimization = config->getString(
-                "algo_3d_ConvexVertexSplitter", "optimization");
-        if (s_optimization.compare("max") == 0) {
-            optimization_ = -1;
-        } else if (s_optimization.compare("min") == 0) {
-            optimization_ = 1;
-        }
-    }
+    selected_combi_ = settings->getSelectedCombi();
+    optimization_ = settings->getConvexOptimization();
 }
 
 ConvexVertexSplitter::~ConvexVertexSplitter() {
@@ -37,14 +27,18 @@ ConvexVertexSplitter::~ConvexVertexSplitter() {
 }
 
 ConvexVertexSplitterSPtr ConvexVertexSplitter::create() {
+    return create(SkelSettings::create());
+}
+
+ConvexVertexSplitterSPtr ConvexVertexSplitter::create(SkelSettingsSPtr settings) {
     ConvexVertexSplitterSPtr result =
-            ConvexVertexSplitterSPtr(new ConvexVertexSplitter());
+            ConvexVertexSplitterSPtr(new ConvexVertexSplitter(settings));
     return result;
 }
 
 int ConvexVertexSplitter::countConvexEdges(PolyhedronSPtr polyhedron) {
     int result = 0;
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
         if (!edge->isReflex()) {
@@ -20,6 +20,7 @@ public:
     virtual ~ConvexVertexSplitter();
 
     static ConvexVertexSplitterSPtr create();
+    static ConvexVertexSplitterSPtr create(SkelSettingsSPtr settings);
 
     static int countConvexEdges(PolyhedronSPtr polyhedron);
 
@@ -28,7 +29,7 @@ public:
     virtual std::string toString() const;
 
 protected:
-    ConvexVertexSplitter();
+    ConvexVertexSplitter(SkelSettingsSPtr settings);
     int optimization_;
 };
 
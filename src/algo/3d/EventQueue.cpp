@@ -0,0 +1,1194 @@
+/**
+ * @file   algo/3d/EventQueue.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#include "algo/3d/EventQueue.h"
+
+#include "debug.h"
+#include "typedefs_thread.h"
+#include "algo/3d/SimpleStraightSkel.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Polyhedron.h"
+#include "data/3d/skel/AbstractEvent.h"
+#include "data/3d/skel/EdgeEvent.h"
+#include "data/3d/skel/EdgeMergeEvent.h"
+#include "data/3d/skel/TriangleEvent.h"
+#include "data/3d/skel/DblEdgeMergeEvent.h"
+#include "data/3d/skel/DblTriangleEvent.h"
+#include "data/3d/skel/TetrahedronEvent.h"
+#include "data/3d/skel/VertexEvent.h"
+#include "data/3d/skel/FlipVertexEvent.h"
+#include "data/3d/skel/SurfaceEvent.h"
+#include "data/3d/skel/PolyhedronSplitEvent.h"
+#include "data/3d/skel/SplitMergeEvent.h"
+#include "data/3d/skel/EdgeSplitEvent.h"
+#include "data/3d/skel/PierceEvent.h"
+#include "data/3d/skel/SkelVertexData.h"
+#include "data/3d/skel/SkelEdgeData.h"
+#include "data/3d/skel/SkelFacetData.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace algo { namespace _3d {
+
+/**
+ * Candidates with an offset closer than this (relative) epsilon
+ * to the best candidate are evaluated again by top(...).
+ */
+static const double EPSILON_TIES = 1e-6;
+
+EventQueue::EventQueue() {
+    seq_ = 0;
+    size_purged_ = 0;
+    clearSnapshot();
+}
+
+EventQueue::~EventQueue() {
+    candidates_.clear();
+    edges_reflex_.clear();
+    reflex_edges_.clear();
+    reflex_vertices_.clear();
+    vertices_coincident_.clear();
+    vertices_stamp_.clear();
+    edges_stamp_.clear();
+    facets_stamp_.clear();
+    offsets_pierce_.clear();
+    facets_pierce_.clear();
+    offsets_edge_split_.clear();
+    edges_edge_split_.clear();
+    clearSnapshot();
+    clearDirty();
+}
+
+EventQueueSPtr EventQueue::create() {
+    EventQueueSPtr result = EventQueueSPtr(new EventQueue());
+    return result;
+}
+
+bool EventQueue::isLess(const Candidate& candidate_1, const Candidate& candidate_2) {
+    if (candidate_1.offset != candidate_2.offset) {
+        return (candidate_1.offset < candidate_2.offset);
+    }
+    if (candidate_1.type != candidate_2.type) {
+        return (candidate_1.type < candidate_2.type);
+    }
+    return (candidate_1.seq > candidate_2.seq);
+}
+
+AbstractEventSPtr EventQueue::evaluate(const Candidate& candidate, double offset) {
+    AbstractEventSPtr result = AbstractEventSPtr();
+    if (candidate.type == AbstractEvent::EDGE_EVENT) {
+        result = SimpleStraightSkel::nextEdgeEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::EDGE_MERGE_EVENT) {
+        result = SimpleStraightSkel::nextEdgeMergeEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::TRIANGLE_EVENT) {
+        result = SimpleStraightSkel::nextTriangleEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::DBL_EDGE_MERGE_EVENT) {
+        result = SimpleStraightSkel::nextDblEdgeMergeEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::DBL_TRIANGLE_EVENT) {
+        result = SimpleStraightSkel::nextDblTriangleEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::TETRAHEDRON_EVENT) {
+        result = SimpleStraightSkel::nextTetrahedronEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::VERTEX_EVENT) {
+        result = SimpleStraightSkel::nextVertexEvent(candidate.vertex, offset);
+    } else if (candidate.type == AbstractEvent::FLIP_VERTEX_EVENT) {
+        result = SimpleStraightSkel::nextFlipVertexEvent(candidate.vertex, offset);
+    } else if (candidate.type == AbstractEvent::SURFACE_EVENT) {
+        result = SimpleStraightSkel::nextSurfaceEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+        result = SimpleStraightSkel::nextPolyhedronSplitEvent(candidate.edge, offset);
+    } else if (candidate.type == AbstractEvent::SPLIT_MERGE_EVENT) {
+        result = SimpleStraightSkel::nextSplitMergeEvent(candidate.vertex, offset);
+    } else if (candidate.type == AbstractEvent::EDGE_SPLIT_EVENT) {
+        result = SimpleStraightSkel::nextEdgeSplitEvent(candidate.edge, candidate.edge_2, offset);
+    } else if (candidate.type == AbstractEvent::PIERCE_EVENT) {
+        result = SimpleStraightSkel::nextPierceEvent(candidate.vertex, candidate.facet, offset);
+    }
+    return result;
+}
+
+VertexSPtr EventQueue::offsetVertex(VertexSPtr vertex) {
+    VertexSPtr result = VertexSPtr();
+    if (vertex->hasData()) {
+        SkelVertexData* data = SkelVertexData::of(vertex);
+        result = data->getOffsetVertex();
+    }
+    return result;
+}
+
+EdgeSPtr EventQueue::offsetEdge(EdgeSPtr edge) {
+    EdgeSPtr result = EdgeSPtr();
+    if (edge->hasData()) {
+        SkelEdgeData* data = SkelEdgeData::of(edge);
+        result = data->getOffsetEdge();
+    }
+    return result;
+}
+
+FacetSPtr EventQueue::offsetFacet(FacetSPtr facet) {
+    FacetSPtr result = FacetSPtr();
+    if (facet->hasData()) {
+        SkelFacetData* data = SkelFacetData::of(facet);
+        result = data->getOffsetFacet();
+    }
+    return result;
+}
+
+ArcSPtr EventQueue::arcOf(VertexSPtr vertex) {
+    ArcSPtr result = ArcSPtr();
+    if (vertex->hasData()) {
+        SkelVertexData* data = SkelVertexData::of(vertex);
+        result = data->getArc();
+    }
+    return result;
+}
+
+SheetSPtr EventQueue::sheetOf(EdgeSPtr edge) {
+    SheetSPtr result = SheetSPtr();
+    if (edge->hasData()) {
+        SkelEdgeData* data = SkelEdgeData::of(edge);
+        result = data->getSheet();
+    }
+    return result;
+}
+
+size_t EventQueue::rankOf(VertexSPtr vertex) {
+    return vertex->getPolyhedronSlot();
+}
+
+size_t EventQueue::rankOf(EdgeSPtr edge) {
+    return edge->getPolyhedronSlot();
+}
+
+size_t EventQueue::rankOf(FacetSPtr facet) {
+    return facet->getPolyhedronSlot();
+}
+
+bool EventQueue::isLowerRank(FacetSPtr facet_1, FacetSPtr facet_2) {
+    return (rankOf(facet_1) < rankOf(facet_2));
+}
+
+bool EventQueue::isLowerRank(EdgeSPtr edge_1, EdgeSPtr edge_2) {
+    return (rankOf(edge_1) < rankOf(edge_2));
+}
+
+void EventQueue::push(Candidate candidate, AbstractEventSPtr event) {
+    candidate.offset = event->getOffset();
+    candidate.seq = seq_++;
+    candidates_.push_back(candidate);
+    std::push_heap(candidates_.begin(), candidates_.end(), EventQueue::isLess);
+    if (candidate.type == AbstractEvent::PIERCE_EVENT) {
+        facets_pierce_[candidate.facet.get()].push_back(candidate.vertex);
+        std::unordered_map<const Vertex*, double>::iterator it_o =
+                offsets_pierce_.find(candidate.vertex.get());
+        if (it_o == offsets_pierce_.end() || it_o->second < candidate.offset) {
+            offsets_pierce_[candidate.vertex.get()] = candidate.offset;
+        }
+    } else if (candidate.type == AbstractEvent::EDGE_SPLIT_EVENT) {
+        edges_edge_split_[candidate.edge_2.get()].push_back(candidate.edge);
+        std::unordered_map<const Edge*, double>::iterator it_o =
+                offsets_edge_split_.find(candidate.edge.get());
+        if (it_o == offsets_edge_split_.end() || it_o->second < candidate.offset) {
+            offsets_edge_split_[candidate.edge.get()] = candidate.offset;
+        }
+    }
+}
+
+bool EventQueue::isStale(const Candidate& candidate, const Polyhedron* polyhedron) const {
+    if (candidate.vertex) {
+        if (candidate.vertex->getPolyhedron().get() != polyhedron) {
+            return true;
+        }
+        std::unordered_map<const Vertex*, unsigned long>::const_iterator it_s =
+                vertices_stamp_.find(candidate.vertex.get());
+        if (it_s != vertices_stamp_.end() && it_s->second > candidate.seq) {
+            return true;
+        }
+    }
+    for (unsigned int i = 0; i < 2; i++) {
+        const EdgeSPtr& edge = (i == 0) ? candidate.edge : candidate.edge_2;
+        if (edge) {
+            if (edge->getPolyhedron().get() != polyhedron) {
+                return true;
+            }
+            std::unordered_map<const Edge*, unsigned long>::const_iterator it_s =
+                    edges_stamp_.find(edge.get());
+            if (it_s != edges_stamp_.end() && it_s->second > candidate.seq) {
+                return true;
+            }
+        }
+    }
+    if (candidate.facet) {
+        if (candidate.facet->getPolyhedron().get() != polyhedron) {
+            return true;
+        }
+        std::unordered_map<const Facet*, unsigned long>::const_iterator it_s =
+                facets_stamp_.find(candidate.facet.get());
+        if (it_s != facets_stamp_.end() && it_s->second > candidate.seq) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void EventQueue::purge(const Polyhedron* polyhedron) {
+    std::vector<Candidate> candidates;
+    candidates.reserve(candidates_.size());
+    for (unsigned int i = 0; i < candidates_.size(); i++) {
+        if (!isStale(candidates_[i], polyhedron)) {
+            candidates.push_back(candidates_[i]);
+        }
+    }
+    candidates_.swap(candidates);
+    std::make_heap(candidates_.begin(), candidates_.end(), EventQueue::isLess);
+    size_purged_ = candidates_.size();
+}
+
+void EventQueue::evaluateEdge(EdgeSPtr edge, double offset) {
+    static const int types[8] = {
+        AbstractEvent::EDGE_EVENT,
+        AbstractEvent::EDGE_MERGE_EVENT,
+        AbstractEvent::TRIANGLE_EVENT,
+        AbstractEvent::DBL_EDGE_MERGE_EVENT,
+        AbstractEvent::DBL_TRIANGLE_EVENT,
+        AbstractEvent::TETRAHEDRON_EVENT,
+        AbstractEvent::SURFACE_EVENT,
+        AbstractEvent::POLYHEDRON_SPLIT_EVENT
+    };
+    Candidate candidate;
+    candidate.edge = edge;
+    for (unsigned int i = 0; i < 8; i++) {
+        candidate.type = types[i];
+        AbstractEventSPtr event = evaluate(candidate, offset);
+        if (event) {
+            push(candidate, event);
+        }
+    }
+}
+
+void EventQueue::evaluateVertex(VertexSPtr vertex, double offset) {
+    static const int types[3] = {
+        AbstractEvent::VERTEX_EVENT,
+        AbstractEvent::FLIP_VERTEX_EVENT,
+        AbstractEvent::SPLIT_MERGE_EVENT
+    };
+    Candidate candidate;
+    candidate.vertex = vertex;
+    for (unsigned int i = 0; i < 3; i++) {
+        candidate.type = types[i];
+        AbstractEventSPtr event = evaluate(candidate, offset);
+        if (event) {
+            push(candidate, event);
+        }
+    }
+}
+
+bool EventQueue::isReflex(EdgeSPtr edge) const {
+    std::unordered_map<const Edge*, bool>::const_iterator it =
+            edges_reflex_.find(edge.get());
+    if (it != edges_reflex_.end()) {
+        return it->second;
+    }
+    return SimpleStraightSkel::isReflex(edge);
+}
+
+bool EventQueue::isReflex(VertexSPtr vertex) const {
+    if (vertex->degree() == 0) {
+        return false;
+    }
+    bool result = true;
+    std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
+    while (it_e != vertex->edges().end()) {
+        EdgeSPtr edge = (*it_e++).lock();
+        if (!isReflex(edge)) {
+            result = false;
+        }
+    }
+    return result;
+}
+
+void EventQueue::initCoincidentVertices(PolyhedronSPtr polyhedron) {
+    // vertices that share the same point are handled differently
+    // by the scanning functions until the next shift of the facets
+    vertices_dirty_.clear();
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        vertices_dirty_.push_back(*it_v++);
+    }
+    updateCoincidentVertices();
+}
+
+void EventQueue::updateCoincidentVertices() {
+    // a point is only shared by vertices that have been changed
+    // since the last shift of the facets
+    vertices_coincident_.clear();
+    std::unordered_map<const Point3*, VertexSPtr> vertices_point;
+    for (unsigned int i = 0; i < vertices_dirty_.size(); i++) {
+        VertexSPtr vertex = vertices_dirty_[i];
+        std::unordered_map<const Point3*, VertexSPtr>::iterator it_p =
+                vertices_point.find(vertex->getPoint().get());
+        if (it_p == vertices_point.end()) {
+            vertices_point[vertex->getPoint().get()] = vertex;
+        } else {
+            if (it_p->second) {
+                vertices_coincident_.push_back(it_p->second);
+                it_p->second = VertexSPtr();
+            }
+            vertices_coincident_.push_back(vertex);
+        }
+    }
+}
+
+void EventQueue::markChanged(VertexSPtr vertex) {
+    if (vertices_changed_set_.insert(vertex.get()).second) {
+        vertices_changed_.push_back(vertex);
+    }
+}
+
+void EventQueue::markRescan(VertexSPtr vertex) {
+    if (vertices_rescan_set_.insert(vertex.get()).second) {
+        vertices_rescan_.push_back(vertex);
+    }
+}
+
+void EventQueue::markRescan(EdgeSPtr edge) {
+    if (edges_rescan_set_.insert(edge.get()).second) {
+        edges_rescan_.push_back(edge);
+    }
+}
+
+void EventQueue::addNeighbors(const std::vector<VertexSPtr>& vertices,
+        std::vector<VertexSPtr>& neighbors,
+        std::unordered_set<const Vertex*>& neighbors_set,
+        bool add_facets) {
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        VertexSPtr vertex = vertices[i];
+        if (neighbors_set.insert(vertex.get()).second) {
+            neighbors.push_back(vertex);
+        }
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
+        while (it_f != vertex->facets().end()) {
+            FacetSPtr facet = (*it_f++).lock();
+            if (add_facets) {
+                if (facets_dirty_set_.insert(facet.get()).second) {
+                    facets_dirty_.push_back(facet);
+                }
+            }
+            std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
+            while (it_v != facet->vertices().end()) {
+                VertexSPtr neighbor = *it_v++;
+                if (neighbors_set.insert(neighbor.get()).second) {
+                    neighbors.push_back(neighbor);
+                }
+            }
+        }
+    }
+}
+
+void EventQueue::clearSnapshot() {
+    snapshot_vertices_.clear();
+    snapshot_edges_.clear();
+    snapshot_facets_.clear();
+    snapshot_num_vertices_ = 0;
+    snapshot_num_edges_ = 0;
+    snapshot_num_facets_ = 0;
+    snapshot_slots_vertices_ = 0;
+    snapshot_slots_edges_ = 0;
+    snapshot_slots_facets_ = 0;
+}
+
+void EventQueue::clearDirty() {
+    vertices_changed_.clear();
+    vertices_changed_set_.clear();
+    vertices_removed_.clear();
+    edges_removed_.clear();
+    facets_removed_.clear();
+    vertices_dirty_.clear();
+    vertices_dirty_set_.clear();
+    edges_dirty_.clear();
+    edges_dirty_set_.clear();
+    facets_dirty_.clear();
+    facets_dirty_set_.clear();
+    vertices_rescan_.clear();
+    vertices_rescan_set_.clear();
+    edges_rescan_.clear();
+    edges_rescan_set_.clear();
+}
+
+void EventQueue::init(PolyhedronSPtr polyhedron, double offset) {
+    ReadLock l(polyhedron->mutex());
+    initCandidates(polyhedron, offset);
+}
+
+void EventQueue::initCandidates(PolyhedronSPtr polyhedron, double offset) {
+    candidates_.clear();
+    seq_ = 0;
+    polyhedron_ = polyhedron;
+    clearSnapshot();
+    clearDirty();
+    edges_reflex_.clear();
+    reflex_edges_.clear();
+    reflex_vertices_.clear();
+    vertices_stamp_.clear();
+    edges_stamp_.clear();
+    facets_stamp_.clear();
+    offsets_pierce_.clear();
+    facets_pierce_.clear();
+    offsets_edge_split_.clear();
+    edges_edge_split_.clear();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        edges_dirty_.push_back(edge);
+        edges_dirty_set_.insert(edge.get());
+        bool reflex = SimpleStraightSkel::isReflex(edge);
+        edges_reflex_[edge.get()] = reflex;
+        if (reflex) {
+            reflex_edges_[edge.get()] = edge;
+        }
+    }
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        vertices_dirty_.push_back(vertex);
+        vertices_dirty_set_.insert(vertex.get());
+        if (isReflex(vertex)) {
+            reflex_vertices_[vertex.get()] = vertex;
+        }
+    }
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        facets_dirty_.push_back(facet);
+        facets_dirty_set_.insert(facet.get());
+    }
+    evaluateDirty(polyhedron, offset);
+    initCoincidentVertices(polyhedron);
+    clearDirty();
+    size_purged_ = candidates_.size();
+}
+
+void EventQueue::shift(PolyhedronSPtr polyhedron) {
+    std::vector<Candidate> candidates;
+    candidates.reserve(candidates_.size());
+    for (unsigned int i = 0; i < candidates_.size(); i++) {
+        Candidate candidate = candidates_[i];
+        if (isStale(candidate, polyhedron.get())) {
+            continue;
+        }
+        bool valid = true;
+        if (candidate.vertex) {
+            candidate.vertex = offsetVertex(candidate.vertex);
+            valid = valid && candidate.vertex;
+        }
+        if (candidate.edge) {
+            candidate.edge = offsetEdge(candidate.edge);
+            valid = valid && candidate.edge;
+        }
+        if (candidate.edge_2) {
+            candidate.edge_2 = offsetEdge(candidate.edge_2);
+            valid = valid && candidate.edge_2;
+        }
+        if (candidate.facet) {
+            candidate.facet = offsetFacet(candidate.facet);
+            valid = valid && candidate.facet;
+        }
+        if (valid) {
+            candidates.push_back(candidate);
+        }
+    }
+    candidates_.swap(candidates);
+    std::make_heap(candidates_.begin(), candidates_.end(), EventQueue::isLess);
+    size_purged_ = candidates_.size();
+
+    // all elements are new, so none of them has been dirty
+    vertices_stamp_.clear();
+    edges_stamp_.clear();
+    facets_stamp_.clear();
+    offsets_pierce_.clear();
+    facets_pierce_.clear();
+    offsets_edge_split_.clear();
+    edges_edge_split_.clear();
+    for (unsigned int i = 0; i < candidates_.size(); i++) {
+        const Candidate& candidate = candidates_[i];
+        if (candidate.type == AbstractEvent::PIERCE_EVENT) {
+            facets_pierce_[candidate.facet.get()].push_back(candidate.vertex);
+            std::unordered_map<const Vertex*, double>::iterator it_o =
+                    offsets_pierce_.find(candidate.vertex.get());
+            if (it_o == offsets_pierce_.end() || it_o->second < candidate.offset) {
+                offsets_pierce_[candidate.vertex.get()] = candidate.offset;
+            }
+        } else if (candidate.type == AbstractEvent::EDGE_SPLIT_EVENT) {
+            edges_edge_split_[candidate.edge_2.get()].push_back(candidate.edge);
+            std::unordered_map<const Edge*, double>::iterator it_o =
+                    offsets_edge_split_.find(candidate.edge.get());
+            if (it_o == offsets_edge_split_.end() || it_o->second < candidate.offset) {
+                offsets_edge_split_[candidate.edge.get()] = candidate.offset;
+            }
+        }
+    }
+
+    std::unordered_map<const Edge*, bool> edges_reflex;
+    edges_reflex.reserve(edges_reflex_.size());
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        std::unordered_map<const Edge*, bool>::iterator it_r =
+                edges_reflex_.find(edge.get());
+        if (it_r != edges_reflex_.end()) {
+            EdgeSPtr offset_edge = offsetEdge(edge);
+            if (offset_edge) {
+                edges_reflex[offset_edge.get()] = it_r->second;
+            }
+        }
+    }
+    edges_reflex_.swap(edges_reflex);
+
+    std::unordered_map<const Edge*, EdgeSPtr> reflex_edges;
+    std::unordered_map<const Edge*, EdgeSPtr>::iterator it_re = reflex_edges_.begin();
+    while (it_re != reflex_edges_.end()) {
+        EdgeSPtr offset_edge = offsetEdge((it_re++)->second);
+        if (offset_edge) {
+            reflex_edges[offset_edge.get()] = offset_edge;
+        }
+    }
+    reflex_edges_.swap(reflex_edges);
+    std::unordered_map<const Vertex*, VertexSPtr> reflex_vertices;
+    std::unordered_map<const Vertex*, VertexSPtr>::iterator it_rv = reflex_vertices_.begin();
+    while (it_rv != reflex_vertices_.end()) {
+        VertexSPtr offset_vertex = offsetVertex((it_rv++)->second);
+        if (offset_vertex) {
+            reflex_vertices[offset_vertex.get()] = offset_vertex;
+        }
+    }
+    reflex_vertices_.swap(reflex_vertices);
+
+    std::vector<VertexSPtr> vertices_coincident;
+    for (unsigned int i = 0; i < vertices_coincident_.size(); i++) {
+        VertexSPtr offset_vertex = offsetVertex(vertices_coincident_[i]);
+        if (offset_vertex) {
+            vertices_coincident.push_back(offset_vertex);
+        }
+    }
+    vertices_coincident_.swap(vertices_coincident);
+
+    std::vector<VertexSPtr> vertices_rescan;
+    vertices_rescan.swap(vertices_rescan_);
+    vertices_rescan_set_.clear();
+    for (unsigned int i = 0; i < vertices_rescan.size(); i++) {
+        VertexSPtr offset_vertex = offsetVertex(vertices_rescan[i]);
+        if (offset_vertex) {
+            markRescan(offset_vertex);
+        }
+    }
+    std::vector<EdgeSPtr> edges_rescan;
+    edges_rescan.swap(edges_rescan_);
+    edges_rescan_set_.clear();
+    for (unsigned int i = 0; i < edges_rescan.size(); i++) {
+        EdgeSPtr offset_edge = offsetEdge(edges_rescan[i]);
+        if (offset_edge) {
+            markRescan(offset_edge);
+        }
+    }
+}
+
+void EventQueue::snapshotFacet(FacetSPtr facet) {
+    if (snapshot_facets_.find(facet.get()) != snapshot_facets_.end()) {
+        return;
+    }
+    FacetState& state = snapshot_facets_[facet.get()];
+    state.facet = facet;
+    state.plane = facet->plane();
+    state.edges.assign(facet->edges().begin(), facet->edges().end());
+    std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
+    while (it_v != facet->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        if (snapshot_vertices_.find(vertex.get()) == snapshot_vertices_.end()) {
+            VertexState& state_v = snapshot_vertices_[vertex.get()];
+            state_v.vertex = vertex;
+            state_v.point = vertex->getPoint();
+            state_v.arc = arcOf(vertex);
+        }
+    }
+    std::list<EdgeSPtr>::iterator it_e = facet->edges().begin();
+    while (it_e != facet->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        if (snapshot_edges_.find(edge.get()) == snapshot_edges_.end()) {
+            EdgeState& state_e = snapshot_edges_[edge.get()];
+            state_e.edge = edge;
+            state_e.vertex_src = edge->getVertexSrc();
+            state_e.vertex_dst = edge->getVertexDst();
+            state_e.facet_l = edge->getFacetL();
+            state_e.facet_r = edge->getFacetR();
+            state_e.sheet = sheetOf(edge);
+        }
+    }
+}
+
+void EventQueue::snapshot(PolyhedronSPtr polyhedron,
+        const std::list<AbstractEventSPtr>& events) {
+    ReadLock l(polyhedron->mutex());
+    polyhedron_ = polyhedron;
+    clearSnapshot();
+    snapshot_num_vertices_ = polyhedron->vertices().size();
+    snapshot_num_edges_ = polyhedron->edges().size();
+    snapshot_num_facets_ = polyhedron->facets().size();
+    // elements that are added by the events get slots behind these
+    snapshot_slots_vertices_ = polyhedron->vertices().numSlots();
+    snapshot_slots_edges_ = polyhedron->edges().numSlots();
+    snapshot_slots_facets_ = polyhedron->facets().numSlots();
+    std::unordered_set<const Facet*> facets;
+    std::list<AbstractEventSPtr>::const_iterator it_ev = events.begin();
+    while (it_ev != events.end()) {
+        SimpleStraightSkel::collectFacets(*it_ev++, facets);
+    }
+    std::unordered_set<const Facet*>::iterator it_f = facets.begin();
+    while (it_f != facets.end()) {
+        FacetSPtr facet = std::const_pointer_cast<Facet>((*it_f++)->shared_from_this());
+        FacetSPtr offset_facet = offsetFacet(facet);
+        if (!offset_facet) {
+            offset_facet = facet;
+        }
+        if (offset_facet->getPolyhedron() == polyhedron) {
+            snapshotFacet(offset_facet);
+        }
+    }
+}
+
+bool EventQueue::findChanges(PolyhedronSPtr polyhedron) {
+    std::vector<FacetSPtr> facets_changed;
+    unsigned int num_vertices_added = 0;
+    for (size_t slot = snapshot_slots_vertices_;
+            slot < polyhedron->vertices().numSlots(); slot++) {
+        VertexSPtr vertex = polyhedron->vertices().at(slot);
+        if (vertex) {
+            markChanged(vertex);
+            num_vertices_added++;
+        }
+    }
+    std::unordered_map<const Vertex*, VertexState>::iterator it_sv =
+            snapshot_vertices_.begin();
+    while (it_sv != snapshot_vertices_.end()) {
+        const VertexState& state = (it_sv++)->second;
+        VertexSPtr vertex = state.vertex;
+        if (vertex->getPolyhedron() != polyhedron) {
+            vertices_removed_.push_back(vertex);
+        } else if (state.point != vertex->getPoint() ||
+                state.arc != arcOf(vertex)) {
+            markChanged(vertex);
+        }
+    }
+
+    unsigned int num_edges_added = 0;
+    for (size_t slot = snapshot_slots_edges_;
+            slot < polyhedron->edges().numSlots(); slot++) {
+        EdgeSPtr edge = polyhedron->edges().at(slot);
+        if (edge) {
+            markChanged(edge->getVertexSrc());
+            markChanged(edge->getVertexDst());
+            if (edge->getFacetL()) {
+                facets_changed.push_back(edge->getFacetL());
+            }
+            if (edge->getFacetR()) {
+                facets_changed.push_back(edge->getFacetR());
+            }
+            num_edges_added++;
+        }
+    }
+    std::unordered_map<const Edge*, EdgeState>::iterator it_se =
+            snapshot_edges_.begin();
+    while (it_se != snapshot_edges_.end()) {
+        const EdgeState& state = (it_se++)->second;
+        EdgeSPtr edge = state.edge;
+        if (edge->getPolyhedron() != polyhedron) {
+            edges_removed_.push_back(edge);
+            // the remaining elements around a removed edge
+            if (state.vertex_src->getPolyhedron() == polyhedron) {
+                markChanged(state.vertex_src);
+            }
+            if (state.vertex_dst->getPolyhedron() == polyhedron) {
+                markChanged(state.vertex_dst);
+            }
+            if (state.facet_l && state.facet_l->getPolyhedron() == polyhedron) {
+                facets_changed.push_back(state.facet_l);
+            }
+            if (state.facet_r && state.facet_r->getPolyhedron() == polyhedron) {
+                facets_changed.push_back(state.facet_r);
+            }
+        } else if (state.vertex_src != edge->getVertexSrc() ||
+                state.vertex_dst != edge->getVertexDst() ||
+                state.facet_l != edge->getFacetL() ||
+                state.facet_r != edge->getFacetR() ||
+                state.sheet != sheetOf(edge)) {
+            markChanged(edge->getVertexSrc());
+            markChanged(edge->getVertexDst());
+            if (edge->getFacetL()) {
+                facets_changed.push_back(edge->getFacetL());
+            }
+            if (edge->getFacetR()) {
+                facets_changed.push_back(edge->getFacetR());
+            }
+        }
+    }
+
+    unsigned int num_facets_added = 0;
+    for (size_t slot = snapshot_slots_facets_;
+            slot < polyhedron->facets().numSlots(); slot++) {
+        FacetSPtr facet = polyhedron->facets().at(slot);
+        if (facet) {
+            facets_changed.push_back(facet);
+            num_facets_added++;
+        }
+    }
+    std::unordered_map<const Facet*, FacetState>::iterator it_sf =
+            snapshot_facets_.begin();
+    while (it_sf != snapshot_facets_.end()) {
+        const FacetState& state = (it_sf++)->second;
+        FacetSPtr facet = state.facet;
+        if (facet->getPolyhedron() != polyhedron) {
+            facets_removed_.push_back(facet);
+        } else if (state.plane != facet->plane() ||
+                state.edges.size() != facet->edges().size() ||
+                !std::equal(state.edges.begin(), state.edges.end(),
+                    facet->edges().begin())) {
+            facets_changed.push_back(facet);
+        }
+    }
+    for (unsigned int i = 0; i < facets_changed.size(); i++) {
+        FacetSPtr facet = facets_changed[i];
+        std::list<VertexSPtr>::iterator it_fv = facet->vertices().begin();
+        while (it_fv != facet->vertices().end()) {
+            VertexSPtr vertex = *it_fv++;
+            markChanged(vertex);
+        }
+    }
+    for (unsigned int i = 0; i < vertices_coincident_.size(); i++) {
+        VertexSPtr vertex = vertices_coincident_[i];
+        if (vertex->getPolyhedron() == polyhedron) {
+            markChanged(vertex);
+        }
+    }
+
+    // elements that have been removed outside of the snapshot
+    return (polyhedron->vertices().size() + vertices_removed_.size() ==
+                snapshot_num_vertices_ + num_vertices_added &&
+            polyhedron->edges().size() + edges_removed_.size() ==
+                snapshot_num_edges_ + num_edges_added &&
+            polyhedron->facets().size() + facets_removed_.size() ==
+                snapshot_num_facets_ + num_facets_added);
+}
+
+void EventQueue::update(PolyhedronSPtr polyhedron, double offset) {
+    ReadLock l(polyhedron->mutex());
+    if (!findChanges(polyhedron)) {
+        DEBUG_PRINT("EventQueue: the event changed elements outside of its facets.");
+        initCandidates(polyhedron, offset);
+        return;
+    }
+    clearSnapshot();
+
+    // all candidates within 2 rings of facets around the changed vertices
+    // have to be evaluated again
+    std::vector<VertexSPtr> vertices_ring;
+    std::unordered_set<const Vertex*> vertices_ring_set;
+    addNeighbors(vertices_changed_, vertices_ring, vertices_ring_set, false);
+    addNeighbors(vertices_ring, vertices_dirty_, vertices_dirty_set_, true);
+    for (unsigned int i = 0; i < vertices_dirty_.size(); i++) {
+        VertexSPtr vertex = vertices_dirty_[i];
+        std::list<EdgeHandle>::iterator it_ve = vertex->edges().begin();
+        while (it_ve != vertex->edges().end()) {
+            EdgeSPtr edge = (*it_ve++).lock();
+            if (edges_dirty_set_.insert(edge.get()).second) {
+                edges_dirty_.push_back(edge);
+            }
+        }
+    }
+    // dirty facets in the order of the polyhedron
+    std::sort(facets_dirty_.begin(), facets_dirty_.end(),
+            static_cast<bool (*)(FacetSPtr, FacetSPtr)>(EventQueue::isLowerRank));
+
+    invalidate(polyhedron);
+    updateReflex();
+    evaluateDirty(polyhedron, offset);
+    updateCoincidentVertices();
+    if (candidates_.size() > 2 * size_purged_ + 64) {
+        purge(polyhedron.get());
+    }
+    clearDirty();
+}
+
+void EventQueue::invalidate(PolyhedronSPtr polyhedron) {
+    // pierce and edge split events that depend on dirty or removed elements
+    // need a rescan of their vertex or (first) edge
+    std::vector<FacetSPtr> facets(facets_dirty_);
+    facets.insert(facets.end(), facets_removed_.begin(), facets_removed_.end());
+    for (unsigned int i = 0; i < facets.size(); i++) {
+        std::unordered_map<const Facet*, std::vector<VertexSPtr> >::iterator it_p =
+                facets_pierce_.find(facets[i].get());
+        if (it_p == facets_pierce_.end()) {
+            continue;
+        }
+        const std::vector<VertexSPtr>& vertices = it_p->second;
+        for (unsigned int j = 0; j < vertices.size(); j++) {
+            if (vertices[j]->getPolyhedron() == polyhedron) {
+                markRescan(vertices[j]);
+            }
+        }
+        facets_pierce_.erase(it_p);
+    }
+    std::vector<EdgeSPtr> edges(edges_dirty_);
+    edges.insert(edges.end(), edges_removed_.begin(), edges_removed_.end());
+    for (unsigned int i = 0; i < edges.size(); i++) {
+        std::unordered_map<const Edge*, std::vector<EdgeSPtr> >::iterator it_s =
+                edges_edge_split_.find(edges[i].get());
+        if (it_s == edges_edge_split_.end()) {
+            continue;
+        }
+        const std::vector<EdgeSPtr>& edges_1 = it_s->second;
+        for (unsigned int j = 0; j < edges_1.size(); j++) {
+            if (edges_1[j]->getPolyhedron() == polyhedron) {
+                markRescan(edges_1[j]);
+            }
+        }
+        edges_edge_split_.erase(it_s);
+    }
+
+    // the candidates of dirty elements become stale
+    for (unsigned int i = 0; i < vertices_dirty_.size(); i++) {
+        vertices_stamp_[vertices_dirty_[i].get()] = seq_;
+    }
+    for (unsigned int i = 0; i < edges_dirty_.size(); i++) {
+        edges_stamp_[edges_dirty_[i].get()] = seq_;
+    }
+    for (unsigned int i = 0; i < facets_dirty_.size(); i++) {
+        facets_stamp_[facets_dirty_[i].get()] = seq_;
+    }
+
+    for (unsigned int i = 0; i < vertices_removed_.size(); i++) {
+        const Vertex* vertex = vertices_removed_[i].get();
+        reflex_vertices_.erase(vertex);
+        vertices_stamp_.erase(vertex);
+        offsets_pierce_.erase(vertex);
+    }
+    for (unsigned int i = 0; i < edges_removed_.size(); i++) {
+        const Edge* edge = edges_removed_[i].get();
+        edges_reflex_.erase(edge);
+        reflex_edges_.erase(edge);
+        edges_stamp_.erase(edge);
+        offsets_edge_split_.erase(edge);
+    }
+    for (unsigned int i = 0; i < facets_removed_.size(); i++) {
+        facets_stamp_.erase(facets_removed_[i].get());
+    }
+}
+
+void EventQueue::updateReflex() {
+    std::vector<VertexSPtr> vertices(vertices_dirty_);
+    for (unsigned int i = 0; i < edges_dirty_.size(); i++) {
+        EdgeSPtr edge = edges_dirty_[i];
+        bool reflex = SimpleStraightSkel::isReflex(edge);
+        edges_reflex_[edge.get()] = reflex;
+        if (reflex) {
+            reflex_edges_[edge.get()] = edge;
+        } else {
+            reflex_edges_.erase(edge.get());
+        }
+        vertices.push_back(edge->getVertexSrc());
+        vertices.push_back(edge->getVertexDst());
+    }
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        VertexSPtr vertex = vertices[i];
+        if (isReflex(vertex)) {
+            reflex_vertices_[vertex.get()] = vertex;
+        } else {
+            reflex_vertices_.erase(vertex.get());
+        }
+    }
+}
+
+void EventQueue::evaluateDirty(PolyhedronSPtr polyhedron, double offset) {
+    for (unsigned int i = 0; i < edges_dirty_.size(); i++) {
+        EdgeSPtr edge = edges_dirty_[i];
+        evaluateEdge(edge, offset);
+    }
+    for (unsigned int i = 0; i < vertices_dirty_.size(); i++) {
+        VertexSPtr vertex = vertices_dirty_[i];
+        evaluateVertex(vertex, offset);
+    }
+    evaluatePierceEvents(polyhedron, offset);
+    evaluateEdgeSplitEvents(offset);
+}
+
+void EventQueue::evaluatePierceEvents(PolyhedronSPtr polyhedron, double offset) {
+    std::unordered_map<const Vertex*, VertexSPtr>::iterator it_v = reflex_vertices_.begin();
+    while (it_v != reflex_vertices_.end()) {
+        VertexSPtr vertex = (it_v++)->second;
+        bool rescan = (vertices_dirty_set_.find(vertex.get()) != vertices_dirty_set_.end() ||
+                vertices_rescan_set_.find(vertex.get()) != vertices_rescan_set_.end());
+        if (!rescan && facets_dirty_.empty()) {
+            continue;
+        }
+        Candidate candidate;
+        candidate.type = AbstractEvent::PIERCE_EVENT;
+        candidate.vertex = vertex;
+        PierceEventSPtr result = PierceEventSPtr();
+        if (rescan) {
+            util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+            while (it_f != polyhedron->facets().end()) {
+                FacetSPtr facet = *it_f++;
+                PierceEventSPtr event = SimpleStraightSkel::nextPierceEvent(vertex, facet, offset);
+                if (event) {
+                    if (SimpleStraightSkel::isNextEvent(event, result, offset)) {
+                        result = event;
+                        candidate.facet = facet;
+                    }
+                }
+            }
+        } else {
+            for (unsigned int i = 0; i < facets_dirty_.size(); i++) {
+                FacetSPtr facet = facets_dirty_[i];
+                PierceEventSPtr event = SimpleStraightSkel::nextPierceEvent(vertex, facet, offset);
+                if (event) {
+                    if (SimpleStraightSkel::isNextEvent(event, result, offset)) {
+                        result = event;
+                        candidate.facet = facet;
+                    }
+                }
+            }
+        }
+        std::unordered_map<const Vertex*, double>::iterator it_o =
+                offsets_pierce_.find(vertex.get());
+        if (rescan) {
+            if (it_o != offsets_pierce_.end()) {
+                offsets_pierce_.erase(it_o);
+            }
+            if (result) {
+                push(candidate, result);
+            }
+        } else if (result) {
+            if (it_o == offsets_pierce_.end() || result->getOffset() >= it_o->second) {
+                push(candidate, result);
+            }
+        }
+    }
+}
+
+void EventQueue::evaluateEdgeSplitEvents(double offset) {
+    std::vector<EdgeSPtr> edges_reflex_dirty;
+    for (unsigned int i = 0; i < edges_dirty_.size(); i++) {
+        if (isReflex(edges_dirty_[i])) {
+            edges_reflex_dirty.push_back(edges_dirty_[i]);
+        }
+    }
+    std::sort(edges_reflex_dirty.begin(), edges_reflex_dirty.end(),
+            static_cast<bool (*)(EdgeSPtr, EdgeSPtr)>(EventQueue::isLowerRank));
+    std::unordered_map<const Edge*, EdgeSPtr>::iterator it_e = reflex_edges_.begin();
+    while (it_e != reflex_edges_.end()) {
+        EdgeSPtr edge_1 = (it_e++)->second;
+        bool rescan = (edges_dirty_set_.find(edge_1.get()) != edges_dirty_set_.end() ||
+                edges_rescan_set_.find(edge_1.get()) != edges_rescan_set_.end());
+        Candidate candidate;
+        candidate.type = AbstractEvent::EDGE_SPLIT_EVENT;
+        candidate.edge = edge_1;
+        EdgeSplitEventSPtr result = EdgeSplitEventSPtr();
+        if (rescan) {
+            // the first of the edges with the highest offset
+            // that come after edge_1
+            std::unordered_map<const Edge*, EdgeSPtr>::iterator it_e2 = reflex_edges_.begin();
+            while (it_e2 != reflex_edges_.end()) {
+                EdgeSPtr edge_2 = (it_e2++)->second;
+                if (!isLowerRank(edge_1, edge_2)) {
+                    continue;
+                }
+                EdgeSplitEventSPtr event = SimpleStraightSkel::nextEdgeSplitEvent(edge_1, edge_2, offset);
+                if (event) {
+                    int order = 1;
+                    if (result) {
+                        order = SimpleStraightSkel::compareEvents(event, result, offset);
+                    }
+                    if (order > 0 || (order == 0 && isLowerRank(edge_2, candidate.edge_2))) {
+                        result = event;
+                        candidate.edge_2 = edge_2;
+                    }
+                }
+            }
+        } else {
+            for (unsigned int j = 0; j < edges_reflex_dirty.size(); j++) {
+                EdgeSPtr edge_2 = edges_reflex_dirty[j];
+                if (!isLowerRank(edge_1, edge_2)) {
+                    continue;
+                }
+                EdgeSplitEventSPtr event = SimpleStraightSkel::nextEdgeSplitEvent(edge_1, edge_2, offset);
+                if (event) {
+                    if (SimpleStraightSkel::isNextEvent(event, result, offset)) {
+                        result = event;
+                        candidate.edge_2 = edge_2;
+                    }
+                }
+            }
+        }
+        std::unordered_map<const Edge*, double>::iterator it_o =
+                offsets_edge_split_.find(edge_1.get());
+        if (rescan) {
+            if (it_o != offsets_edge_split_.end()) {
+                offsets_edge_split_.erase(it_o);
+            }
+            if (result) {
+                push(candidate, result);
+            }
+        } else if (result) {
+            if (it_o == offsets_edge_split_.end() || result->getOffset() >= it_o->second) {
+                push(candidate, result);
+            }
+        }
+    }
+}
+
+bool EventQueue::isBefore(const Candidate& candidate_1, AbstractEventSPtr event_1,
+        const Candidate& candidate_2, AbstractEventSPtr event_2) const {
+    if (event_1->getOffset() != event_2->getOffset()) {
+        return (event_1->getOffset() > event_2->getOffset());
+    }
+    if (candidate_1.type != candidate_2.type) {
+        return (candidate_1.type > candidate_2.type);
+    }
+    // same order as the scanning functions of SimpleStraightSkel
+    size_t rank_1;
+    size_t rank_2;
+    if (candidate_1.edge) {
+        rank_1 = rankOf(candidate_1.edge);
+        rank_2 = rankOf(candidate_2.edge);
+    } else {
+        rank_1 = rankOf(candidate_1.vertex);
+        rank_2 = rankOf(candidate_2.vertex);
+    }
+    if (rank_1 != rank_2) {
+        return (rank_1 < rank_2);
+    }
+    if (candidate_1.edge_2) {
+        return (rankOf(candidate_1.edge_2) < rankOf(candidate_2.edge_2));
+    } else if (candidate_1.facet) {
+        return (rankOf(candidate_1.facet) < rankOf(candidate_2.facet));
+    }
+    return false;
+}
+
+void EventQueue::rescan(PolyhedronSPtr polyhedron, double offset) {
+    evaluatePierceEvents(polyhedron, offset);
+    evaluateEdgeSplitEvents(offset);
+    vertices_rescan_.clear();
+    vertices_rescan_set_.clear();
+    edges_rescan_.clear();
+    edges_rescan_set_.clear();
+}
+
+AbstractEventSPtr EventQueue::top(double offset) {
+    AbstractEventSPtr result = AbstractEventSPtr();
+    PolyhedronSPtr polyhedron = polyhedron_.lock();
+    if (!polyhedron) {
+        return result;
+    }
+    while (!result && !candidates_.empty()) {
+        // stale candidates are dropped when they reach the top
+        if (isStale(candidates_.front(), polyhedron.get())) {
+            std::pop_heap(candidates_.begin(), candidates_.end(), EventQueue::isLess);
+            candidates_.pop_back();
+            continue;
+        }
+        double offset_max = candidates_.front().offset;
+        double epsilon = EPSILON_TIES * (1.0 + std::fabs(offset_max));
+        std::vector<Candidate> candidates_tie;
+        while (!candidates_.empty() &&
+                candidates_.front().offset >= offset_max - epsilon) {
+            std::pop_heap(candidates_.begin(), candidates_.end(), EventQueue::isLess);
+            if (!isStale(candidates_.back(), polyhedron.get())) {
+                candidates_tie.push_back(candidates_.back());
+            }
+            candidates_.pop_back();
+        }
+        std::vector<Candidate> candidates_valid;
+        std::vector<AbstractEventSPtr> events;
+        for (unsigned int i = 0; i < candidates_tie.size(); i++) {
+            Candidate candidate = candidates_tie[i];
+            AbstractEventSPtr event = evaluate(candidate, offset);
+            if (!event) {
+                // not valid anymore, the best pierce or edge split event
+                // of the vertex or edge might be another one now
+                if (candidate.type == AbstractEvent::PIERCE_EVENT) {
+                    markRescan(candidate.vertex);
+                } else if (candidate.type == AbstractEvent::EDGE_SPLIT_EVENT) {
+                    markRescan(candidate.edge);
+                }
+                continue;
+            }
+            candidate.offset = event->getOffset();
+            candidates_.push_back(candidate);
+            std::push_heap(candidates_.begin(), candidates_.end(), EventQueue::isLess);
+            candidates_valid.push_back(candidate);
+            events.push_back(event);
+        }
+        if (!vertices_rescan_.empty() || !edges_rescan_.empty()) {
+            // the next event of a rescanned vertex or edge
+            // may come before all events of this round
+            rescan(polyhedron, offset);
+            continue;
+        }
+        if (events.empty()) {
+            continue;
+        }
+        // the same tie handling as SimpleStraightSkel::nextEvent:
+        // events that come certainly after another one are out
+        unsigned int i_max = 0;
+        for (unsigned int i = 1; i < events.size(); i++) {
+            if (isBefore(candidates_valid[i], events[i],
+                    candidates_valid[i_max], events[i_max])) {
+                i_max = i;
+            }
+        }
+        double offset_tie = events[i_max]->getOffset() -
+                SimpleStraightSkel::tieWindow(events[i_max]->getOffset());
+        std::vector<unsigned int> ties;
+        for (unsigned int i = 0; i < events.size(); i++) {
+            if (events[i]->getOffset() >= offset_tie) {
+                ties.push_back(i);
+            }
+        }
+        std::vector<bool> after(ties.size(), false);
+        for (unsigned int a = 0; a < ties.size(); a++) {
+            for (unsigned int b = a+1; b < ties.size(); b++) {
+                int order = SimpleStraightSkel::certifyOrder(
+                        events[ties[a]], events[ties[b]], offset);
+                if (order > 0) {
+                    after[b] = true;
+                } else if (order < 0) {
+                    after[a] = true;
+                }
+            }
+        }
+        int i_result = -1;
+        for (unsigned int a = 0; a < ties.size(); a++) {
+            if (!after[a]) {
+                if (i_result < 0 || isBefore(candidates_valid[ties[a]], events[ties[a]],
+                        candidates_valid[i_result], events[i_result])) {
+                    i_result = ties[a];
+                }
+            }
+        }
+        if (i_result < 0) {
+            i_result = i_max;
+        }
+        result = events[i_result];
+    }
+    return result;
+}
+
+unsigned int EventQueue::size() const {
+    return candidates_.size();
+}
+
+} }
@@ -0,0 +1,282 @@
+/**
+ * @file   algo/3d/EventQueue.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef ALGO_3D_EVENTQUEUE_H
+#define ALGO_3D_EVENTQUEUE_H
+
+#include "algo/3d/ptrs.h"
+#include "data/3d/ptrs.h"
+#include "data/3d/skel/ptrs.h"
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace algo { namespace _3d {
+
+using namespace data::_3d;
+using namespace data::_3d::skel;
+
+/**
+ * Kinetic event queue for SimpleStraightSkel.
+ * Holds the best candidate event of every vertex and edge in a heap.
+ * After an event has been handled, only the candidates in the
+ * neighborhood of the changed elements are recomputed.
+ * Candidates that depend on changed elements are not removed from the heap,
+ * they are dropped when they reach the top (lazy deletion).
+ */
+class EventQueue {
+public:
+    virtual ~EventQueue();
+
+    static EventQueueSPtr create();
+
+    /**
+     * Determines the candidate events of all vertices and edges.
+     */
+    void init(PolyhedronSPtr polyhedron, double offset);
+
+    /**
+     * Maps all candidates to the offset elements.
+     * The given polyhedron is the one before SimpleStraightSkel::shiftFacets.
+     * Not needed if the facets have been shifted in place.
+     */
+    void shift(PolyhedronSPtr polyhedron);
+
+    /**
+     * Remembers the elements of the polyhedron that are modified
+     * by the given events (see SimpleStraightSkel::collectFacets).
+     * The events refer to the elements before the shift of the facets.
+     */
+    void snapshot(PolyhedronSPtr polyhedron,
+            const std::list<AbstractEventSPtr>& events);
+
+    /**
+     * Compares the elements of the last snapshot with the polyhedron and
+     * recomputes the candidates around the changed elements.
+     * Only if the events changed the polyhedron somewhere else,
+     * all candidates are determined again.
+     */
+    void update(PolyhedronSPtr polyhedron, double offset);
+
+    /**
+     * Returns the next event (the candidate with the highest offset).
+     * Candidates with almost the same offset are evaluated again.
+     * If a pierce or edge split candidate is not valid anymore,
+     * its vertex or edge is scanned again before the result is chosen.
+     * Events within SimpleStraightSkel::tieWindow are ordered
+     * by SimpleStraightSkel::certifyOrder like in SimpleStraightSkel::nextEvent.
+     */
+    AbstractEventSPtr top(double offset);
+
+    unsigned int size() const;
+
+protected:
+    EventQueue();
+
+    struct Candidate {
+        double offset;
+        int type;
+        unsigned long seq;
+        VertexSPtr vertex;
+        EdgeSPtr edge;
+        EdgeSPtr edge_2;
+        FacetSPtr facet;
+    };
+
+    struct VertexState {
+        VertexSPtr vertex;
+        Point3SPtr point;
+        ArcSPtr arc;
+    };
+
+    struct EdgeState {
+        EdgeSPtr edge;
+        VertexSPtr vertex_src;
+        VertexSPtr vertex_dst;
+        FacetSPtr facet_l;
+        FacetSPtr facet_r;
+        SheetSPtr sheet;
+    };
+
+    struct FacetState {
+        FacetSPtr facet;
+        Plane3SPtr plane;
+        std::vector<EdgeSPtr> edges;
+    };
+
+    /**
+     * Heap order: the candidate with the highest offset is on top.
+     * On equal offsets, the higher event type wins (like SimpleStraightSkel::nextEvent).
+     */
+    static bool isLess(const Candidate& candidate_1, const Candidate& candidate_2);
+
+    static AbstractEventSPtr evaluate(const Candidate& candidate, double offset);
+
+    static VertexSPtr offsetVertex(VertexSPtr vertex);
+    static EdgeSPtr offsetEdge(EdgeSPtr edge);
+    static FacetSPtr offsetFacet(FacetSPtr facet);
+    static ArcSPtr arcOf(VertexSPtr vertex);
+    static SheetSPtr sheetOf(EdgeSPtr edge);
+
+    /**
+     * Order of the elements in the polyhedron.
+     * The slots are compacted before each update, so they are the ranks.
+     */
+    static size_t rankOf(VertexSPtr vertex);
+    static size_t rankOf(EdgeSPtr edge);
+    static size_t rankOf(FacetSPtr facet);
+
+    static bool isLowerRank(FacetSPtr facet_1, FacetSPtr facet_2);
+    static bool isLowerRank(EdgeSPtr edge_1, EdgeSPtr edge_2);
+
+    void push(Candidate candidate, AbstractEventSPtr event);
+
+    /**
+     * A candidate is stale if one of its elements has been removed
+     * or has been dirty after the candidate was pushed.
+     */
+    bool isStale(const Candidate& candidate, const Polyhedron* polyhedron) const;
+
+    /**
+     * Removes all stale candidates from the heap.
+     */
+    void purge(const Polyhedron* polyhedron);
+
+    void evaluateEdge(EdgeSPtr edge, double offset);
+    void evaluateVertex(VertexSPtr vertex, double offset);
+
+    bool isReflex(EdgeSPtr edge) const;
+    bool isReflex(VertexSPtr vertex) const;
+
+    void initCandidates(PolyhedronSPtr polyhedron, double offset);
+    void initCoincidentVertices(PolyhedronSPtr polyhedron);
+
+    /**
+     * Vertices of the last update that share the same point.
+     */
+    void updateCoincidentVertices();
+
+    void snapshotFacet(FacetSPtr facet);
+
+    /**
+     * Compares the snapshot with the elements that are around it now.
+     * Returns false if the number of elements outside of the snapshot
+     * has changed.
+     */
+    bool findChanges(PolyhedronSPtr polyhedron);
+
+    /**
+     * Forgets the removed elements and the candidates that depend on
+     * dirty or removed elements.
+     */
+    void invalidate(PolyhedronSPtr polyhedron);
+
+    /**
+     * Recomputes the reflex edges and vertices around the dirty edges.
+     */
+    void updateReflex();
+
+    /**
+     * Recomputes the candidates of all dirty vertices and edges.
+     */
+    void evaluateDirty(PolyhedronSPtr polyhedron, double offset);
+
+    /**
+     * A reflex vertex against all facets (dirty or needs rescan)
+     * or against the dirty facets only.
+     */
+    void evaluatePierceEvents(PolyhedronSPtr polyhedron, double offset);
+
+    /**
+     * Pairs of reflex edges in the order of the polyhedron.
+     */
+    void evaluateEdgeSplitEvents(double offset);
+
+    /**
+     * Pushes the pierce and edge split events of the vertices and edges
+     * that have been marked for a rescan by top(...).
+     */
+    void rescan(PolyhedronSPtr polyhedron, double offset);
+
+    void markChanged(VertexSPtr vertex);
+    void markRescan(VertexSPtr vertex);
+    void markRescan(EdgeSPtr edge);
+
+    /**
+     * Adds the given vertices and all vertices of their facets.
+     */
+    void addNeighbors(const std::vector<VertexSPtr>& vertices,
+            std::vector<VertexSPtr>& neighbors,
+            std::unordered_set<const Vertex*>& neighbors_set,
+            bool add_facets);
+
+    void clearSnapshot();
+    void clearDirty();
+
+    bool isBefore(const Candidate& candidate_1, AbstractEventSPtr event_1,
+            const Candidate& candidate_2, AbstractEventSPtr event_2) const;
+
+    std::vector<Candidate> candidates_;
+    unsigned long seq_;
+    unsigned int size_purged_;
+    PolyhedronWPtr polyhedron_;
+
+    std::unordered_map<const Edge*, bool> edges_reflex_;
+    std::unordered_map<const Edge*, EdgeSPtr> reflex_edges_;
+    std::unordered_map<const Vertex*, VertexSPtr> reflex_vertices_;
+    std::vector<VertexSPtr> vertices_coincident_;
+
+    /**
+     * Value of seq_ when an element has been dirty the last time.
+     */
+    std::unordered_map<const Vertex*, unsigned long> vertices_stamp_;
+    std::unordered_map<const Edge*, unsigned long> edges_stamp_;
+    std::unordered_map<const Facet*, unsigned long> facets_stamp_;
+
+    /**
+     * The best offset of the pierce events of each vertex and
+     * the vertices that have a pierce event with each facet.
+     */
+    std::unordered_map<const Vertex*, double> offsets_pierce_;
+    std::unordered_map<const Facet*, std::vector<VertexSPtr> > facets_pierce_;
+    /**
+     * The best offset of the edge split events of each edge and
+     * the edges that have an edge split event with each (second) edge.
+     */
+    std::unordered_map<const Edge*, double> offsets_edge_split_;
+    std::unordered_map<const Edge*, std::vector<EdgeSPtr> > edges_edge_split_;
+
+    std::unordered_map<const Vertex*, VertexState> snapshot_vertices_;
+    std::unordered_map<const Edge*, EdgeState> snapshot_edges_;
+    std::unordered_map<const Facet*, FacetState> snapshot_facets_;
+    unsigned int snapshot_num_vertices_;
+    unsigned int snapshot_num_edges_;
+    unsigned int snapshot_num_facets_;
+    size_t snapshot_slots_vertices_;
+    size_t snapshot_slots_edges_;
+    size_t snapshot_slots_facets_;
+
+    std::vector<VertexSPtr> vertices_changed_;
+    std::unordered_set<const Vertex*> vertices_changed_set_;
+    std::vector<VertexSPtr> vertices_removed_;
+    std::vector<EdgeSPtr> edges_removed_;
+    std::vector<FacetSPtr> facets_removed_;
+    std::vector<VertexSPtr> vertices_dirty_;
+    std::unordered_set<const Vertex*> vertices_dirty_set_;
+    std::vector<EdgeSPtr> edges_dirty_;
+    std::unordered_set<const Edge*> edges_dirty_set_;
+    std::vector<FacetSPtr> facets_dirty_;
+    std::unordered_set<const Facet*> facets_dirty_set_;
+    std::vector<VertexSPtr> vertices_rescan_;
+    std::unordered_set<const Vertex*> vertices_rescan_set_;
+    std::vector<EdgeSPtr> edges_rescan_;
+    std::unordered_set<const Edge*> edges_rescan_set_;
+};
+
+} }
+
+#endif /* ALGO_3D_EVENTQUEUE_H */
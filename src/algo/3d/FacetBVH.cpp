@@ -0,0 +1,222 @@
+/**
+ * @file   algo/3d/FacetBVH.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#include "algo/3d/FacetBVH.h"
+
+#include "data/3d/Vertex.h"
+#include "data/3d/Facet.h"
+#include "data/3d/skel/SkelFacetData.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
+
+namespace algo { namespace _3d {
+
+using namespace data::_3d::skel;
+
+FacetBVH::FacetBVH() {
+    num_refits_ = 0;
+}
+
+FacetBVH::~FacetBVH() {
+    nodes_.clear();
+    indices_.clear();
+    boxes_.clear();
+}
+
+FacetBVHSPtr FacetBVH::create() {
+    return FacetBVHSPtr(new FacetBVH());
+}
+
+unsigned int FacetBVH::size() const {
+    return indices_.size();
+}
+
+void FacetBVH::computeBox(FacetSPtr facet, double sweep, unsigned int index) {
+    double* box = &boxes_[6*index];
+    for (unsigned int k = 0; k < 3; k++) {
+        box[k] = std::numeric_limits<double>::max();
+        box[3+k] = -std::numeric_limits<double>::max();
+    }
+    double coord_max = 1.0;
+    std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
+    while (it_v != facet->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        double coords[3] = {vertex->getX(), vertex->getY(), vertex->getZ()};
+        for (unsigned int k = 0; k < 3; k++) {
+            box[k] = std::min(box[k], coords[k]);
+            box[3+k] = std::max(box[3+k], coords[k]);
+            coord_max = std::max(coord_max, std::fabs(coords[k]));
+        }
+    }
+    double speed = 1.0;
+    if (facet->hasData()) {
+        speed = SkelFacetData::of(facet)->getSpeed();
+    }
+    // the tolerance covers facets that are not exactly planar
+    double margin = std::fabs(speed * sweep) * (1.0 + 1e-6) + 1e-6 * coord_max;
+    for (unsigned int k = 0; k < 3; k++) {
+        box[k] -= margin;
+        box[3+k] += margin;
+    }
+}
+
+void FacetBVH::update(const std::vector<FacetSPtr>& facets, double sweep) {
+    bool rebuild = (facets.size() != indices_.size() ||
+            num_refits_ >= MAX_REFITS);
+    boxes_.resize(6*facets.size());
+    for (unsigned int i = 0; i < facets.size(); i++) {
+        computeBox(facets[i], sweep, i);
+    }
+    if (rebuild) {
+        nodes_.clear();
+        indices_.resize(facets.size());
+        for (unsigned int i = 0; i < indices_.size(); i++) {
+            indices_[i] = i;
+        }
+        if (!indices_.empty()) {
+            build(0, indices_.size());
+        }
+        num_refits_ = 0;
+    } else {
+        refit();
+        num_refits_++;
+    }
+}
+
+void FacetBVH::fitNode(Node& node) const {
+    for (unsigned int k = 0; k < 3; k++) {
+        node.box_min[k] = std::numeric_limits<double>::max();
+        node.box_max[k] = -std::numeric_limits<double>::max();
+    }
+    if (node.child_l < 0) {
+        for (unsigned int i = node.begin; i < node.end; i++) {
+            const double* box = &boxes_[6*indices_[i]];
+            for (unsigned int k = 0; k < 3; k++) {
+                node.box_min[k] = std::min(node.box_min[k], box[k]);
+                node.box_max[k] = std::max(node.box_max[k], box[3+k]);
+            }
+        }
+    } else {
+        const Node& node_l = nodes_[node.child_l];
+        const Node& node_r = nodes_[node.child_r];
+        for (unsigned int k = 0; k < 3; k++) {
+            node.box_min[k] = std::min(node_l.box_min[k], node_r.box_min[k]);
+            node.box_max[k] = std::max(node_l.box_max[k], node_r.box_max[k]);
+        }
+    }
+}
+
+/**
+ * Orders indices of boxes by the center on one axis.
+ */
+class BoxCenterLess {
+public:
+    BoxCenterLess(const std::vector<double>& boxes, unsigned int axis) :
+            boxes_(boxes), axis_(axis) {
+    }
+    bool operator()(unsigned int index_1, unsigned int index_2) const {
+        double center_1 = boxes_[6*index_1 + axis_] + boxes_[6*index_1 + 3 + axis_];
+        double center_2 = boxes_[6*index_2 + axis_] + boxes_[6*index_2 + 3 + axis_];
+        if (center_1 == center_2) {
+            return index_1 < index_2;
+        }
+        return center_1 < center_2;
+    }
+protected:
+    const std::vector<double>& boxes_;
+    unsigned int axis_;
+};
+
+int FacetBVH::build(unsigned int begin, unsigned int end) {
+    int result = nodes_.size();
+    Node node;
+    node.child_l = -1;
+    node.child_r = -1;
+    node.begin = begin;
+    node.end = end;
+    fitNode(node);
+    nodes_.push_back(node);
+    if (end - begin > MAX_LEAF_SIZE) {
+        unsigned int axis = 0;
+        double extent_max = -1.0;
+        for (unsigned int k = 0; k < 3; k++) {
+            double extent = node.box_max[k] - node.box_min[k];
+            if (extent > extent_max) {
+                extent_max = extent;
+                axis = k;
+            }
+        }
+        unsigned int mid = begin + (end - begin) / 2;
+        std::nth_element(indices_.begin() + begin, indices_.begin() + mid,
+                indices_.begin() + end, BoxCenterLess(boxes_, axis));
+        int child_l = build(begin, mid);
+        int child_r = build(mid, end);
+        nodes_[result].child_l = child_l;
+        nodes_[result].child_r = child_r;
+    }
+    return result;
+}
+
+void FacetBVH::refit() {
+    // children are always stored after their parent
+    for (unsigned int i = nodes_.size(); i > 0; i--) {
+        fitNode(nodes_[i-1]);
+    }
+}
+
+void FacetBVH::query(VertexSPtr vertex, double radius,
+        std::vector<unsigned int>& result) const {
+    if (nodes_.empty()) {
+        return;
+    }
+    double coords[3] = {vertex->getX(), vertex->getY(), vertex->getZ()};
+    double box_min[3];
+    double box_max[3];
+    for (unsigned int k = 0; k < 3; k++) {
+        box_min[k] = coords[k] - radius;
+        box_max[k] = coords[k] + radius;
+    }
+    unsigned int size_before = result.size();
+    std::vector<int> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = nodes_[stack.back()];
+        stack.pop_back();
+        bool overlaps = true;
+        for (unsigned int k = 0; k < 3; k++) {
+            if (node.box_max[k] < box_min[k] || node.box_min[k] > box_max[k]) {
+                overlaps = false;
+                break;
+            }
+        }
+        if (!overlaps) {
+            continue;
+        }
+        if (node.child_l < 0) {
+            for (unsigned int i = node.begin; i < node.end; i++) {
+                const double* box = &boxes_[6*indices_[i]];
+                bool overlaps_box = true;
+                for (unsigned int k = 0; k < 3; k++) {
+                    if (box[3+k] < box_min[k] || box[k] > box_max[k]) {
+                        overlaps_box = false;
+                        break;
+                    }
+                }
+                if (overlaps_box) {
+                    result.push_back(indices_[i]);
+                }
+            }
+        } else {
+            stack.push_back(node.child_r);
+            stack.push_back(node.child_l);
+        }
+    }
+    std::sort(result.begin() + size_before, result.end());
+}
+
+} }
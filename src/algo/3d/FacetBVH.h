@@ -0,0 +1,83 @@
+/**
+ * @file   algo/3d/FacetBVH.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef ALGO_3D_FACETBVH_H
+#define ALGO_3D_FACETBVH_H
+
+#include "algo/3d/ptrs.h"
+#include "data/3d/ptrs.h"
+#include <vector>
+
+namespace algo { namespace _3d {
+
+using namespace data::_3d;
+
+/**
+ * Bounding volume hierarchy over the facets of a polyhedron.
+ * Every facet is bounded by an axis-aligned box that is swept
+ * (enlarged by speed * sweep) to cover the movement of the facet
+ * while the wavefront propagates by the given sweep.
+ * Used by SimpleStraightSkel::nextPierceEvent.
+ */
+class FacetBVH {
+public:
+    virtual ~FacetBVH();
+
+    static FacetBVHSPtr create();
+
+    /**
+     * Computes the swept boxes of the given facets.
+     * The tree is refitted if the number of facets did not change,
+     * otherwise (and every MAX_REFITS updates) it is rebuilt.
+     */
+    void update(const std::vector<FacetSPtr>& facets, double sweep);
+
+    /**
+     * Appends the indices of all facets whose box overlaps the box
+     * around the point of the vertex with the given radius.
+     * The indices are sorted ascending.
+     */
+    void query(VertexSPtr vertex, double radius,
+            std::vector<unsigned int>& result) const;
+
+    unsigned int size() const;
+
+    static const unsigned int MAX_LEAF_SIZE = 4;
+    static const unsigned int MAX_REFITS = 64;
+
+protected:
+    FacetBVH();
+
+    struct Node {
+        double box_min[3];
+        double box_max[3];
+        int child_l;
+        int child_r;
+        unsigned int begin;
+        unsigned int end;
+    };
+
+    void computeBox(FacetSPtr facet, double sweep, unsigned int index);
+
+    /**
+     * Splits indices_[begin, end) at the median of the longest axis.
+     * Returns the index of the created node.
+     */
+    int build(unsigned int begin, unsigned int end);
+
+    void refit();
+
+    void fitNode(Node& node) const;
+
+    std::vector<Node> nodes_;
+    std::vector<unsigned int> indices_;
+    std::vector<double> boxes_;
+    unsigned int num_refits_;
+};
+
+} }
+
+#endif /* ALGO_3D_FACETBVH_H */
@@ -75,7 +75,7 @@ NodeSPtr GraphChecker::getNode(AbstractEventSPtr event) {
 
 AbstractEventSPtr GraphChecker::findEvent(StraightSkeletonSPtr skel, NodeSPtr node) {
     AbstractEventSPtr result;
-    std::list<AbstractEventSPtr>::iterator it_e = skel->events().begin();
+    util::SlotList<AbstractEventSPtr>::iterator it_e = skel->events().begin();
     while (it_e != skel->events().end()) {
         AbstractEventSPtr event = *it_e++;
         if (getNode(event) == node) {
@@ -88,11 +88,9 @@ AbstractEventSPtr GraphChecker::findEvent(StraightSkeletonSPtr skel, NodeSPtr no
 
 unsigned int GraphChecker::countVisitedChilds(const std::set<NodeSPtr>& visited, NodeSPtr node) {
     unsigned int result = 0;
-    std::list<ArcWPtr>::iterator it_a_wptr = node->arcs().begin();
-    while (it_a_wptr != node->arcs().end()) {
-        ArcWPtr arc_wptr = *it_a_wptr++;
-        if (arc_wptr.expired()) continue;
-        ArcSPtr arc(arc_wptr);
+    std::list<ArcHandle>::iterator it_a = node->arcs().begin();
+    while (it_a != node->arcs().end()) {
+        ArcSPtr arc = (*it_a++).lock();
         NodeSPtr other;
         if (arc->getNodeSrc() == node) {
             other = arc->getNodeDst();
@@ -117,11 +115,11 @@ bool GraphChecker::check(StraightSkeletonSPtr skel) {
 
     // initialization: visit all nodes on boundary
     PolyhedronSPtr polyhedron = skel->getPolyhedron();
-    std::list<NodeSPtr>::iterator lit_n = skel->nodes().begin();
+    util::SlotList<NodeSPtr>::iterator lit_n = skel->nodes().begin();
     while (lit_n != skel->nodes().end()) {
         NodeSPtr node = *lit_n++;
         bool is_boundary = false;
-        std::list<VertexSPtr>::iterator lit_v = polyhedron->vertices().begin();
+        util::SlotList<VertexSPtr>::iterator lit_v = polyhedron->vertices().begin();
         while (lit_v != polyhedron->vertices().end()) {
             VertexSPtr vertex = *lit_v++;
             if (node->getPoint() == vertex->getPoint()) {
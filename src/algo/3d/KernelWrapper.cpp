@@ -8,6 +8,11 @@
 
 namespace algo { namespace _3d {
 
+const int KernelWrapper::KERNEL_FAST;
+const int KernelWrapper::KERNEL_EXACT;
+
+thread_local int KernelWrapper::kernel_ = KernelWrapper::KERNEL_EXACT;
+
 KernelWrapper::KernelWrapper() {
     // intentionally does nothing
 }
@@ -16,47 +21,59 @@ KernelWrapper::~KernelWrapper() {
     // intentionally does nothing
 }
 
-Point3SPtr KernelWrapper::intersection(Plane3SPtr plane1, Plane3SPtr plane2, Plane3SPtr plane3) {
-    Point3SPtr result = Point3SPtr();
+int KernelWrapper::getKernel() {
+    return kernel_;
+}
+
+KernelWrapper::Scope::Scope(int kernel) {
+    kernel_prev_ = kernel_;
+    kernel_ = kernel;
+}
+
+KernelWrapper::Scope::~Scope() {
+    kernel_ = kernel_prev_;
+}
+
+std::string KernelWrapper::getKernelName(int kernel) {
+    std::string result;
 #ifdef USE_CGAL
-    CGAL::Object obj = CGAL::intersection(*plane1, *plane2);
-    if (const CGAL::Line3 *iline = CGAL::object_cast<CGAL::Line3>(&obj)) {
-        CGAL::Object obj = CGAL::intersection(*iline, *plane3);
-        if (const CGAL::Point3 *ipoint = CGAL::object_cast<CGAL::Point3>(&obj)) {
-            result = KernelFactory::createPoint3(*ipoint);
-        }
-    }
+    result = "cgal";
 #else
-    result = Point3SPtr(kernel::intersection(&(*plane1), &(*plane2), &(*plane3)));
+    if (kernel == KERNEL_FAST) {
+        result = kernel::FastTraits::name();
+    } else {
+        result = kernel::ExactTraits::name();
+    }
 #endif
+    return result;
+}
+
+Point3SPtr KernelWrapper::intersection(Plane3SPtr plane1, Plane3SPtr plane2, Plane3SPtr plane3) {
+    Point3SPtr result = Point3SPtr();
+    std::optional<Point3> p = intersection(*plane1, *plane2, *plane3);
+    if (p) {
+        result = KernelFactory::createPoint3(*p);
+    }
     DEBUG_SPTR(result);
     return result;
 }
 
 Line3SPtr KernelWrapper::intersection(Plane3SPtr plane1, Plane3SPtr plane2) {
     Line3SPtr result = Line3SPtr();
-#ifdef USE_CGAL
-    CGAL::Object obj = CGAL::intersection(*plane1, *plane2);
-    if (const CGAL::Line3 *iline = CGAL::object_cast<CGAL::Line3>(&obj)) {
-        result = KernelFactory::createLine3(*iline);
+    std::optional<Line3> line = intersection(*plane1, *plane2);
+    if (line) {
+        result = KernelFactory::createLine3(*line);
     }
-#else
-    result = Line3SPtr(kernel::intersection(&(*plane1), &(*plane2)));
-#endif
     DEBUG_SPTR(result);
     return result;
 }
 
 Point3SPtr KernelWrapper::intersection(Plane3SPtr plane, Line3SPtr line) {
     Point3SPtr result = Point3SPtr();
-#ifdef USE_CGAL
-    CGAL::Object obj = CGAL::intersection(*plane, *line);
-    if (const CGAL::Point3 *ipoint = CGAL::object_cast<CGAL::Point3>(&obj)) {
-        result = KernelFactory::createPoint3(*ipoint);
+    std::optional<Point3> p = intersection(*plane, *line);
+    if (p) {
+        result = KernelFactory::createPoint3(*p);
     }
-#else
-    result = Point3SPtr(kernel::intersection(&(*plane), &(*line)));
-#endif
     DEBUG_SPTR(result);
     return result;
 }
@@ -96,33 +113,15 @@ Plane3SPtr KernelWrapper::bisector(Plane3SPtr plane1, Plane3SPtr plane2) {
 }
 
 double KernelWrapper::distance(Point3SPtr p1, Point3SPtr p2) {
-    double result = 0.0;
-#ifdef USE_CGAL
-    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(*p1, *p2)));
-#else
-    result = kernel::distance(&(*p1), &(*p2));
-#endif
-    return result;
+    return distance(*p1, *p2);
 }
 
 double KernelWrapper::distance(Plane3SPtr plane, Point3SPtr point) {
-    double result = 0.0;
-#ifdef USE_CGAL
-    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(*plane, *point)));
-#else
-    result = kernel::distance(&(*plane), &(*point));
-#endif
-    return result;
+    return distance(*plane, *point);
 }
 
 double KernelWrapper::distance(Line3SPtr line, Point3SPtr point) {
-    double result = 0.0;
-#ifdef USE_CGAL
-    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(*line, *point)));
-#else
-    result = kernel::distance(&(*line), &(*point));
-#endif
-    return result;
+    return distance(*line, *point);
 }
 
 Plane3SPtr KernelWrapper::opposite(Plane3SPtr plane) {
@@ -138,27 +137,11 @@ Line3SPtr KernelWrapper::opposite(Line3SPtr line) {
 }
 
 Vector3SPtr KernelWrapper::normalize(Vector3SPtr v) {
-    Vector3SPtr result;
-#ifdef USE_CGAL
-    result = KernelFactory::createVector3(*v / CGAL::sqrt(v->squared_length()));
-#else
-    result = KernelFactory::createVector3(v->normalize());
-#endif
-    return result;
+    return KernelFactory::createVector3(normalize(*v));
 }
 
 Plane3SPtr KernelWrapper::offsetPlane(Plane3SPtr plane, double offset) {
-    Plane3SPtr result = Plane3SPtr();
-    Point3 p = plane->point();
-#ifdef USE_CGAL
-    Vector3 v_norm = plane->orthogonal_vector();
-    Vector3 v_normal = v_norm / CGAL::sqrt(v_norm.squared_length());
-#else
-    Vector3 v_normal = plane->normal().normalize();
-#endif
-    Point3 p_trans = p + (v_normal * offset);
-    Plane3 plane_trans(p_trans, v_normal);
-    result = KernelFactory::createPlane3(plane_trans);
+    Plane3SPtr result = KernelFactory::createPlane3(offsetPlane(*plane, offset));
     DEBUG_SPTR(result);
     return result;
 }
@@ -222,39 +205,11 @@ Plane3SPtr KernelWrapper::rotatePlane(Plane3SPtr plane, Line3SPtr line, double a
 }
 
 int KernelWrapper::side(Plane3SPtr plane, Point3SPtr point) {
-    int result = 0;
-#ifdef USE_CGAL
-    CGAL::Oriented_side side = plane->oriented_side(*point);
-    if (side == CGAL::ON_POSITIVE_SIDE) result = 1;
-    if (side == CGAL::ON_NEGATIVE_SIDE) result = -1;
-#else
-    result = plane->side(*point);
-#endif
-    return result;
+    return side(*plane, *point);
 }
 
 int KernelWrapper::orientation(Line3SPtr line1, Line3SPtr line2) {
-    int result = 0;
-#ifdef USE_CGAL
-    Vector3 dir1 = line1->to_vector();
-    Vector3 dir2 = line2->to_vector();
-#else
-    Vector3 dir1 = line1->direction();
-    Vector3 dir2 = line2->direction();
-#endif
-    Point3 p0 = line1->point();
-    Point3 p1 = p0 + dir1;
-    Point3 p2 = line2->point();
-    Plane3 plane(p0, p1, p2);
-    Point3 point = p2 + dir2;
-#ifdef USE_CGAL
-    CGAL::Oriented_side side = plane.oriented_side(point);
-    if (side == CGAL::ON_POSITIVE_SIDE) result = 1;
-    if (side == CGAL::ON_NEGATIVE_SIDE) result = -1;
-#else
-    result = plane.side(point);
-#endif
-    return result;
+    return orientation(*line1, *line2);
 }
 
 double KernelWrapper::angle(Vector3SPtr v1, Vector3SPtr v2) {
@@ -322,47 +277,25 @@ bool KernelWrapper::isInside(Point3SPtr p, Point3SPtr p_box_1, Point3SPtr p_box_
 }
 
 Vector3SPtr KernelWrapper::cross(Vector3SPtr v1, Vector3SPtr v2) {
-    Vector3SPtr result = Vector3SPtr();
-#ifdef USE_CGAL
-    result = KernelFactory::createVector3(CGAL::cross_product(*v1, *v2));
-#else
-    result = KernelFactory::createVector3(v1->cross(*v2));
-#endif
+    Vector3SPtr result = KernelFactory::createVector3(cross(*v1, *v2));
     DEBUG_SPTR(result);
     return result;
 }
 
 Point3SPtr KernelWrapper::projection(Line3SPtr line, Point3SPtr point) {
-    Point3SPtr result = Point3SPtr();
-#ifdef USE_CGAL
-    result = KernelFactory::createPoint3(line->projection(*point));
-#else
-    result = Point3SPtr(kernel::projection(&(*line), &(*point)));
-#endif
+    Point3SPtr result = KernelFactory::createPoint3(projection(*line, *point));
     DEBUG_SPTR(result);
     return result;
 }
 
 Point3SPtr KernelWrapper::projection(Plane3SPtr plane, Point3SPtr point) {
-    Point3SPtr result = Point3SPtr();
-#ifdef USE_CGAL
-    result = KernelFactory::createPoint3(plane->projection(*point));
-#else
-    result = Point3SPtr(kernel::projection(&(*plane), &(*point)));
-#endif
+    Point3SPtr result = KernelFactory::createPoint3(projection(*plane, *point));
     DEBUG_SPTR(result);
     return result;
 }
 
 int KernelWrapper::comparePoints(Vector3SPtr v_dir, Point3SPtr p_1, Point3SPtr p_2) {
-    int result = 0;
-    double value = *v_dir * (*p_2 - *p_1);
-    if (value > 0.0) {         // angle < M_PI/2.0
-        result = -1;
-    } else if (value < 0.0) {  // angle > M_PI/2.0
-        result = 1;
-    }
-    return result;
+    return comparePoints(*v_dir, *p_1, *p_2);
 }
 
 Point3SPtr KernelWrapper::replaceCoord(Point3SPtr point, Point3SPtr replacement,
@@ -389,4 +322,216 @@ Point3SPtr KernelWrapper::replaceCoord(Point3SPtr point, Point3SPtr replacement,
     return result;
 }
 
+std::optional<Point3> KernelWrapper::intersection(const Plane3& plane1,
+        const Plane3& plane2, const Plane3& plane3) {
+    std::optional<Point3> result;
+#ifdef USE_CGAL
+    CGAL::Object obj = CGAL::intersection(plane1, plane2);
+    if (const CGAL::Line3 *iline = CGAL::object_cast<CGAL::Line3>(&obj)) {
+        CGAL::Object obj = CGAL::intersection(*iline, plane3);
+        if (const CGAL::Point3 *ipoint = CGAL::object_cast<CGAL::Point3>(&obj)) {
+            result = *ipoint;
+        }
+    }
+#else
+    result = kernel::intersection(plane1, plane2, plane3);
+#endif
+    return result;
+}
+
+std::optional<Line3> KernelWrapper::intersection(const Plane3& plane1, const Plane3& plane2) {
+    std::optional<Line3> result;
+#ifdef USE_CGAL
+    CGAL::Object obj = CGAL::intersection(plane1, plane2);
+    if (const CGAL::Line3 *iline = CGAL::object_cast<CGAL::Line3>(&obj)) {
+        result = *iline;
+    }
+#else
+    result = kernel::intersection(plane1, plane2);
+#endif
+    return result;
+}
+
+std::optional<Point3> KernelWrapper::intersection(const Plane3& plane, const Line3& line) {
+    std::optional<Point3> result;
+#ifdef USE_CGAL
+    CGAL::Object obj = CGAL::intersection(plane, line);
+    if (const CGAL::Point3 *ipoint = CGAL::object_cast<CGAL::Point3>(&obj)) {
+        result = *ipoint;
+    }
+#else
+    result = kernel::intersection(plane, line);
+#endif
+    return result;
+}
+
+double KernelWrapper::distance(const Point3& p1, const Point3& p2) {
+    double result = 0.0;
+#ifdef USE_CGAL
+    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(p1, p2)));
+#else
+    result = kernel::distance(&p1, &p2);
+#endif
+    return result;
+}
+
+double KernelWrapper::distance(const Plane3& plane, const Point3& point) {
+    double result = 0.0;
+#ifdef USE_CGAL
+    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(plane, point)));
+#else
+    result = kernel::distance(&plane, &point);
+#endif
+    return result;
+}
+
+double KernelWrapper::distance(const Line3& line, const Point3& point) {
+    double result = 0.0;
+#ifdef USE_CGAL
+    result = CGAL::to_double(CGAL::sqrt(CGAL::squared_distance(line, point)));
+#else
+    result = kernel::distance(&line, &point);
+#endif
+    return result;
+}
+
+Vector3 KernelWrapper::normal(const Plane3& plane) {
+#ifdef USE_CGAL
+    return plane.orthogonal_vector();
+#else
+    return plane.normal();
+#endif
+}
+
+Vector3 KernelWrapper::normalize(const Vector3& v) {
+#ifdef USE_CGAL
+    return v / CGAL::sqrt(v.squared_length());
+#else
+    return v.normalize();
+#endif
+}
+
+Vector3 KernelWrapper::cross(const Vector3& v1, const Vector3& v2) {
+#ifdef USE_CGAL
+    return CGAL::cross_product(v1, v2);
+#else
+    return v1.cross(v2);
+#endif
+}
+
+Plane3 KernelWrapper::offsetPlane(const Plane3& plane, double offset) {
+    Point3 p = plane.point();
+#ifdef USE_CGAL
+    Vector3 v_norm = plane.orthogonal_vector();
+    Vector3 v_normal = v_norm / CGAL::sqrt(v_norm.squared_length());
+#else
+    Vector3 v_normal = plane.normal().normalize();
+#endif
+    Point3 p_trans = p + (v_normal * offset);
+    return Plane3(p_trans, v_normal);
+}
+
+Plane3 KernelWrapper::translatePlane(const Plane3& unit_plane, double offset) {
+#ifdef USE_CGAL
+    return Plane3(unit_plane.a(), unit_plane.b(), unit_plane.c(),
+            unit_plane.d() - offset);
+#else
+    return Plane3(unit_plane.getA(), unit_plane.getB(), unit_plane.getC(),
+            unit_plane.getD() - offset);
+#endif
+}
+
+int KernelWrapper::side(const Plane3& plane, const Point3& point) {
+    return side(plane, point, kernel_);
+}
+
+int KernelWrapper::side(const Plane3& plane, const Point3& point, int kernel) {
+    int result = 0;
+#ifdef USE_CGAL
+    CGAL::Oriented_side side = plane.oriented_side(point);
+    if (side == CGAL::ON_POSITIVE_SIDE) result = 1;
+    if (side == CGAL::ON_NEGATIVE_SIDE) result = -1;
+#else
+    if (kernel == KERNEL_FAST) {
+        result = evalSide<kernel::FastTraits>(plane, point);
+    } else {
+        result = evalSide<kernel::ExactTraits>(plane, point);
+    }
+#endif
+    return result;
+}
+
+#ifndef USE_CGAL
+template<class Traits>
+int KernelWrapper::evalSide(const Plane3& plane, const Point3& point) {
+    return Traits::side(plane, point);
+}
+#endif
+
+int KernelWrapper::orientation(const Line3& line1, const Line3& line2) {
+    return orientation(line1, line2, kernel_);
+}
+
+int KernelWrapper::orientation(const Line3& line1, const Line3& line2, int kernel) {
+    int result = 0;
+#ifdef USE_CGAL
+    Vector3 dir1 = line1.to_vector();
+    Vector3 dir2 = line2.to_vector();
+    Point3 p0 = line1.point();
+    Point3 p1 = p0 + dir1;
+    Point3 p2 = line2.point();
+    Point3 point = p2 + dir2;
+    Plane3 plane(p0, p1, p2);
+    CGAL::Oriented_side side = plane.oriented_side(point);
+    if (side == CGAL::ON_POSITIVE_SIDE) result = 1;
+    if (side == CGAL::ON_NEGATIVE_SIDE) result = -1;
+#else
+    if (kernel == KERNEL_FAST) {
+        result = evalOrientation<kernel::FastTraits>(line1, line2);
+    } else {
+        result = evalOrientation<kernel::ExactTraits>(line1, line2);
+    }
+#endif
+    return result;
+}
+
+#ifndef USE_CGAL
+template<class Traits>
+int KernelWrapper::evalOrientation(const Line3& line1, const Line3& line2) {
+    Point3 p0 = line1.point();
+    Point3 p1 = p0 + line1.direction();
+    Point3 p2 = line2.point();
+    Point3 point = p2 + line2.direction();
+    // the side of point to Plane3(p0, p1, p2), without rounding the plane
+    return Traits::orientation(p1, p2, point, p0);
+}
+#endif
+
+Point3 KernelWrapper::projection(const Line3& line, const Point3& point) {
+#ifdef USE_CGAL
+    return line.projection(point);
+#else
+    return kernel::projection(line, point);
+#endif
+}
+
+Point3 KernelWrapper::projection(const Plane3& plane, const Point3& point) {
+#ifdef USE_CGAL
+    return plane.projection(point);
+#else
+    return kernel::projection(plane, point);
+#endif
+}
+
+int KernelWrapper::comparePoints(const Vector3& v_dir, const Point3& p_1, const Point3& p_2) {
+    int result = 0;
+    double value = v_dir * (p_2 - p_1);
+    if (value > 0.0) {         // angle < M_PI/2.0
+        result = -1;
+    } else if (value < 0.0) {  // angle > M_PI/2.0
+        result = 1;
+    }
+    return result;
+}
+
 } }
@@ -8,6 +8,8 @@
 #define ALGO_3D_KERNELWRAPPER_H
 
 #include <cmath>
+#include <optional>
+#include <string>
 
 #include "config.h"
 #ifdef USE_CGAL
@@ -22,6 +24,9 @@
     #include "kernel/distance.h"
     #include "kernel/bisector.h"
     #include "kernel/projection.h"
+    #include "kernel/predicates.h"
+    #include "kernel/intersection_batch.h"
+    #include "kernel/traits.h"
 #endif
 
 #include "debug.h"
@@ -36,6 +41,37 @@ class KernelWrapper {
 public:
     virtual ~KernelWrapper();
 
+    /**
+     * The kernel can be chosen at runtime (default: KERNEL_EXACT).
+     * Without CGAL, side and orientation are evaluated with
+     * kernel::FastTraits or kernel::ExactTraits,
+     * both are compiled into the binary.
+     * With CGAL, the CGAL kernel decides and the kernel is ignored.
+     * There is no process-wide setting: An algorithm owns its kernel
+     * (see SimpleStraightSkel::setKernel) and installs it with a Scope
+     * in every thread it runs in.
+     */
+    static const int KERNEL_FAST = 1;
+    static const int KERNEL_EXACT = 2;
+    static std::string getKernelName(int kernel);
+
+    /**
+     * The kernel of the calling thread.
+     */
+    static int getKernel();
+
+    /**
+     * Sets the kernel of the calling thread while it exists
+     * and restores the previous one when it is destroyed.
+     */
+    class Scope {
+    public:
+        explicit Scope(int kernel);
+        virtual ~Scope();
+    protected:
+        int kernel_prev_;
+    };
+
     static Point3SPtr intersection(Plane3SPtr plane1, Plane3SPtr plane2, Plane3SPtr plane3);
     static Line3SPtr intersection(Plane3SPtr plane1, Plane3SPtr plane2);
     static Point3SPtr intersection(Plane3SPtr plane, Line3SPtr line);
@@ -94,8 +130,58 @@ public:
     static Point3SPtr replaceCoord(Point3SPtr point, Point3SPtr replacement,
             unsigned int coord);
 
+    /*
+     * The following take kernel objects by reference and return their
+     * result by value. Nothing is allocated on the heap, so they can be
+     * used in loops that only need intermediate results.
+     * The functions above that take shared pointers call these.
+     */
+    static std::optional<Point3> intersection(const Plane3& plane1,
+            const Plane3& plane2, const Plane3& plane3);
+    static std::optional<Line3> intersection(const Plane3& plane1, const Plane3& plane2);
+    static std::optional<Point3> intersection(const Plane3& plane, const Line3& line);
+
+    static double distance(const Point3& p1, const Point3& p2);
+    static double distance(const Plane3& plane, const Point3& point);
+    static double distance(const Line3& line, const Point3& point);
+
+    static Vector3 normal(const Plane3& plane);
+    static Vector3 normalize(const Vector3& v);
+    static Vector3 cross(const Vector3& v1, const Vector3& v2);
+
+    static Plane3 offsetPlane(const Plane3& plane, double offset);
+
+    /**
+     * Like offsetPlane, but for a plane with a unit normal:
+     * Only the constant term changes, nothing is normalized.
+     */
+    static Plane3 translatePlane(const Plane3& unit_plane, double offset);
+
+    /**
+     * side and orientation without a kernel parameter
+     * use the kernel of the calling thread.
+     */
+    static int side(const Plane3& plane, const Point3& point);
+    static int orientation(const Line3& line1, const Line3& line2);
+    static int side(const Plane3& plane, const Point3& point, int kernel);
+    static int orientation(const Line3& line1, const Line3& line2, int kernel);
+
+    static Point3 projection(const Line3& line, const Point3& point);
+    static Point3 projection(const Plane3& plane, const Point3& point);
+
+    static int comparePoints(const Vector3& v_dir, const Point3& p_1, const Point3& p_2);
+
 protected:
     KernelWrapper();
+
+#ifndef USE_CGAL
+    template<class Traits>
+    static int evalSide(const Plane3& plane, const Point3& point);
+    template<class Traits>
+    static int evalOrientation(const Line3& line1, const Line3& line2);
+#endif
+
+    static thread_local int kernel_;
 };
 
 } }
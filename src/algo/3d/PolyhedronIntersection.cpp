@@ -85,7 +85,7 @@ FacetSPtr PolyhedronIntersection::intersect(PolyhedronSPtr polyhedron,
     result->setPlane(plane);
 
     EdgeSPtr edge_begin;
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
         Point3SPtr p = intersect(edge, plane);
@@ -10,12 +10,15 @@
 #include "data/3d/Vertex.h"
 #include "data/3d/Facet.h"
 #include "data/3d/Polyhedron.h"
+#include "data/3d/PointPool.h"
 #include "util/StringFactory.h"
 #include <cstdlib>
 #include <cmath>
 #include <ctime>
 #include <list>
 #include <limits>
+#include <vector>
+#include <algorithm>
 
 namespace algo { namespace _3d {
 
@@ -28,13 +31,9 @@ PolyhedronTransformation::~PolyhedronTransformation() {
 }
 
 void PolyhedronTransformation::translate(PolyhedronSPtr polyhedron, Vector3SPtr v_t) {
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
-    while (it_v != polyhedron->vertices().end()) {
-        VertexSPtr vertex = *it_v++;
-        Point3SPtr p = vertex->getPoint();
-        Point3SPtr p_t = KernelFactory::createPoint3(*p + *v_t);
-        vertex->setPoint(p_t);
-    }
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    points->translate((*v_t)[0], (*v_t)[1], (*v_t)[2]);
+    points->apply();
     polyhedron->initPlanes();
 
     polyhedron->appendDescription("translate=<" +
@@ -44,14 +43,9 @@ void PolyhedronTransformation::translate(PolyhedronSPtr polyhedron, Vector3SPtr
 }
 
 void PolyhedronTransformation::scale(PolyhedronSPtr polyhedron, Vector3SPtr v_s) {
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
-    while (it_v != polyhedron->vertices().end()) {
-        VertexSPtr vertex = *it_v++;
-        Point3SPtr p = vertex->getPoint();
-        Point3SPtr p_s = KernelFactory::createPoint3(
-                (*p)[0] * (*v_s)[0], (*p)[1] * (*v_s)[1], (*p)[2] * (*v_s)[2]);
-        vertex->setPoint(p_s);
-    }
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    points->scale((*v_s)[0], (*v_s)[1], (*v_s)[2]);
+    points->apply();
     polyhedron->initPlanes();
 
     polyhedron->appendDescription("scale=<" +
@@ -62,10 +56,10 @@ void PolyhedronTransformation::scale(PolyhedronSPtr polyhedron, Vector3SPtr v_s)
 
 bool PolyhedronTransformation::hasParallelPlanes(PolyhedronSPtr polyhedron) {
     bool result = false;
-    std::list<FacetSPtr>::iterator it_f1 = polyhedron->facets().begin();
+    util::SlotList<FacetSPtr>::iterator it_f1 = polyhedron->facets().begin();
     while (it_f1 != polyhedron->facets().end()) {
         FacetSPtr facet1 = *it_f1++;
-        std::list<FacetSPtr>::iterator it_f2 = it_f1;
+        util::SlotList<FacetSPtr>::iterator it_f2 = it_f1;
         while (it_f2 != polyhedron->facets().end()) {
             FacetSPtr facet2 = *it_f2++;
             if (!KernelWrapper::intersection(
@@ -82,14 +76,15 @@ bool PolyhedronTransformation::hasParallelPlanes(PolyhedronSPtr polyhedron) {
 }
 
 bool PolyhedronTransformation::doAll3PlanesIntersect(PolyhedronSPtr polyhedron) {
+#ifdef USE_CGAL
     bool result = true;
-    std::list<FacetSPtr>::iterator it_f1 = polyhedron->facets().begin();
+    util::SlotList<FacetSPtr>::iterator it_f1 = polyhedron->facets().begin();
     while (it_f1 != polyhedron->facets().end()) {
         FacetSPtr facet1 = *it_f1++;
-        std::list<FacetSPtr>::iterator it_f2 = it_f1;
+        util::SlotList<FacetSPtr>::iterator it_f2 = it_f1;
         while (it_f2 != polyhedron->facets().end()) {
             FacetSPtr facet2 = *it_f2++;
-            std::list<FacetSPtr>::iterator it_f3 = it_f2;
+            util::SlotList<FacetSPtr>::iterator it_f3 = it_f2;
             while (it_f3 != polyhedron->facets().end()) {
                 FacetSPtr facet3 = *it_f3++;
                 if (!KernelWrapper::intersection(
@@ -107,6 +102,75 @@ bool PolyhedronTransformation::doAll3PlanesIntersect(PolyhedronSPtr polyhedron)
         }
     }
     return result;
+#else
+    bool result = true;
+    std::vector<Plane3SPtr> planes;
+    planes.reserve(polyhedron->facets().size());
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        planes.push_back((*it_f++)->plane());
+    }
+    size_t n = planes.size();
+    if (n < 3) {
+        return result;
+    }
+    // every pair is part of a triple
+    for (size_t i = 0; i < n && result; i++) {
+        for (size_t j = i+1; j < n; j++) {
+            if (planes[i] == planes[j] || *(planes[i]) == *(planes[j])) {
+                result = false;
+                break;
+            }
+        }
+    }
+    if (!result) {
+        return result;
+    }
+    // the batch of triples (i, j, k) for all k > j
+    std::vector<double> coeffs[12];
+    for (unsigned int c = 0; c < 12; c++) {
+        coeffs[c].resize(n);
+    }
+    for (size_t k = 0; k < n; k++) {
+        coeffs[8][k] = planes[k]->getA();
+        coeffs[9][k] = planes[k]->getB();
+        coeffs[10][k] = planes[k]->getC();
+        coeffs[11][k] = planes[k]->getD();
+    }
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    std::vector<double> z(n);
+    std::vector<unsigned char> valid(n);
+    for (size_t i = 0; i < n && result; i++) {
+        std::fill(coeffs[0].begin(), coeffs[0].end(), coeffs[8][i]);
+        std::fill(coeffs[1].begin(), coeffs[1].end(), coeffs[9][i]);
+        std::fill(coeffs[2].begin(), coeffs[2].end(), coeffs[10][i]);
+        std::fill(coeffs[3].begin(), coeffs[3].end(), coeffs[11][i]);
+        for (size_t j = i+1; j+1 < n; j++) {
+            size_t m = n - (j+1);
+            std::fill(coeffs[4].begin(), coeffs[4].begin() + m, coeffs[8][j]);
+            std::fill(coeffs[5].begin(), coeffs[5].begin() + m, coeffs[9][j]);
+            std::fill(coeffs[6].begin(), coeffs[6].begin() + m, coeffs[10][j]);
+            std::fill(coeffs[7].begin(), coeffs[7].begin() + m, coeffs[11][j]);
+            kernel::PlaneTriples triples;
+            for (unsigned int p = 0; p < 2; p++) {
+                triples.a[p] = &(coeffs[4*p][0]);
+                triples.b[p] = &(coeffs[4*p+1][0]);
+                triples.c[p] = &(coeffs[4*p+2][0]);
+                triples.d[p] = &(coeffs[4*p+3][0]);
+            }
+            triples.a[2] = &(coeffs[8][j+1]);
+            triples.b[2] = &(coeffs[9][j+1]);
+            triples.c[2] = &(coeffs[10][j+1]);
+            triples.d[2] = &(coeffs[11][j+1]);
+            if (kernel::intersection(m, triples, &x[0], &y[0], &z[0], &valid[0]) < m) {
+                result = false;
+                break;
+            }
+        }
+    }
+    return result;
+#endif
 }
 
 Vector3SPtr PolyhedronTransformation::randVec(double min, double max) {
@@ -121,14 +185,15 @@ Vector3SPtr PolyhedronTransformation::randVec(double min, double max) {
 void PolyhedronTransformation::randMovePoints(PolyhedronSPtr polyhedron, double range) {
     // srand(time(NULL));
     srand(0);   // set seed to a const value to reproduce errors
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
-    while (it_v != polyhedron->vertices().end()) {
-        VertexSPtr vertex = *it_v++;
-        Point3SPtr p = vertex->getPoint();
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    for (uint32_t i = 0; i < points->numPoints(); i++) {
         Vector3SPtr v_r = randVec(-range/2.0, range/2.0);
-        Point3SPtr p_t = KernelFactory::createPoint3(*p + *v_r);
-        vertex->setPoint(p_t);
+        points->setPoint(i,
+                points->getX(i) + (*v_r)[0],
+                points->getY(i) + (*v_r)[1],
+                points->getZ(i) + (*v_r)[2]);
     }
+    points->apply();
     polyhedron->initPlanes();
 
     polyhedron->appendDescription("rand_move_points_range=" +
@@ -137,17 +202,11 @@ void PolyhedronTransformation::randMovePoints(PolyhedronSPtr polyhedron, double
 
 Point3SPtr PolyhedronTransformation::boundingBoxMin(PolyhedronSPtr polyhedron) {
     double p_min[3];
-    for (unsigned int i = 0; i < 3; i++) {
-        p_min[i] = std::numeric_limits<double>::max();
-    }
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
-    while (it_v != polyhedron->vertices().end()) {
-        VertexSPtr vertex = *it_v++;
-        Point3SPtr p = vertex->getPoint();
+    double p_max[3];
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    if (!points->boundingBox(p_min, p_max)) {
         for (unsigned int i = 0; i < 3; i++) {
-            if ((*p)[i] < p_min[i]) {
-                p_min[i] = (*p)[i];
-            }
+            p_min[i] = std::numeric_limits<double>::max();
         }
     }
     Point3SPtr result = KernelFactory::createPoint3(p_min[0],p_min[1],p_min[2]);
@@ -155,18 +214,12 @@ Point3SPtr PolyhedronTransformation::boundingBoxMin(PolyhedronSPtr polyhedron) {
 }
 
 Point3SPtr PolyhedronTransformation::boundingBoxMax(PolyhedronSPtr polyhedron) {
+    double p_min[3];
     double p_max[3];
-    for (unsigned int i = 0; i < 3; i++) {
-        p_max[i] = -std::numeric_limits<double>::max();
-    }
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
-    while (it_v != polyhedron->vertices().end()) {
-        VertexSPtr vertex = *it_v++;
-        Point3SPtr p = vertex->getPoint();
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    if (!points->boundingBox(p_min, p_max)) {
         for (unsigned int i = 0; i < 3; i++) {
-            if ((*p)[i] > p_max[i]) {
-                p_max[i] = (*p)[i];
-            }
+            p_max[i] = -std::numeric_limits<double>::max();
         }
     }
     Point3SPtr result = KernelFactory::createPoint3(p_max[0],p_max[1],p_max[2]);
@@ -216,22 +269,14 @@ void PolyhedronTransformation::translateNscale(PolyhedronSPtr polyhedron,
 
 bool PolyhedronTransformation::isInsideBox(PolyhedronSPtr polyhedron,
         Point3SPtr p_box_min, Point3SPtr p_box_max) {
-    bool result = true;
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
-    while (it_v != polyhedron->vertices().end()) {
-        VertexSPtr vertex = *it_v++;
-        Point3SPtr p = vertex->getPoint();
-        for (unsigned int i = 0; i < 3; i++) {
-            if (!((*p_box_min)[i] <= (*p)[i] &&
-                    (*p)[i] <= (*p_box_max)[i])) {
-                result = false;
-                break;
-            }
-        }
-        if (!result) {
-            break;
-        }
+    double box_min[3];
+    double box_max[3];
+    for (unsigned int i = 0; i < 3; i++) {
+        box_min[i] = (*p_box_min)[i];
+        box_max[i] = (*p_box_max)[i];
     }
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    bool result = points->isInsideBox(box_min, box_max);
     return result;
 }
 
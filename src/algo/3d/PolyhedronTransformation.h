@@ -24,6 +24,10 @@ public:
      * To check for parallel planes is not enough.
      */
     static bool hasParallelPlanes(PolyhedronSPtr polyhedron);
+    /**
+     * Checks all triples of facets. Without CGAL, the triples are
+     * intersected in batches (see kernel/intersection_batch.h).
+     */
     static bool doAll3PlanesIntersect(PolyhedronSPtr polyhedron);
     static void randMovePoints(PolyhedronSPtr polyhedron, double range);
 
@@ -10,6 +10,7 @@
 #include "typedefs_thread.h"
 #include "algo/Controller.h"
 #include "algo/3d/KernelWrapper.h"
+#include "algo/3d/SkelSettings.h"
 #include "data/3d/SphericalPolygon.h"
 #include "data/3d/CircularVertex.h"
 #include "data/3d/CircularEdge.h"
@@ -23,7 +24,6 @@
 #include "data/3d/skel/SphericalEdgeEvent.h"
 #include "data/3d/skel/SphericalSplitEvent.h"
 #include "data/3d/skel/SphericalTriangleEvent.h"
-#include "util/Configuration.h"
 #include <list>
 #include <limits>
 
@@ -33,12 +33,22 @@ ProjSimpleSphericalSkel::ProjSimpleSphericalSkel(SphericalPolygonSPtr polygon) {
     type_ = AbstractSimpleSphericalSkel::PROJ_SIMPLE_SPHERICAL_SKEL;
     polygon_ = polygon;
     controller_ = ControllerSPtr();
+    settings_ = SkelSettings::create();
     skel_result_ = SphericalSkeleton::create(polygon->getSphere());
 }
 
 ProjSimpleSphericalSkel::ProjSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller) {
     polygon_ = polygon;
     controller_ = controller;
+    settings_ = SkelSettings::create();
+    skel_result_ = SphericalSkeleton::create(polygon->getSphere());
+}
+
+ProjSimpleSphericalSkel::ProjSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+        SkelSettingsSPtr settings) {
+    polygon_ = polygon;
+    controller_ = controller;
+    settings_ = settings;
     skel_result_ = SphericalSkeleton::create(polygon->getSphere());
 }
 
@@ -54,6 +64,11 @@ ProjSimpleSphericalSkelSPtr ProjSimpleSphericalSkel::create(SphericalPolygonSPtr
     return ProjSimpleSphericalSkelSPtr(new ProjSimpleSphericalSkel(polygon, controller));
 }
 
+ProjSimpleSphericalSkelSPtr ProjSimpleSphericalSkel::create(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+        SkelSettingsSPtr settings) {
+    return ProjSimpleSphericalSkelSPtr(new ProjSimpleSphericalSkel(polygon, controller, settings));
+}
+
 void ProjSimpleSphericalSkel::run() {
     if (controller_) {
         controller_->wait();
@@ -401,8 +416,8 @@ SphericalAbstractEventSPtr ProjSimpleSphericalSkel::nextEvent(SphericalPolygonSP
     for (unsigned int i = 0; i < 4; i++) {
         events[i] = SphericalAbstractEventSPtr();
     }
-    double const_offset = util::Configuration::getInstance()->getDouble(
-            "algo_3d_ProjSimpleSphericalSkel", "const_offset");
+    double const_offset = settings_->getSphericalConstOffset(
+            AbstractSimpleSphericalSkel::PROJ_SIMPLE_SPHERICAL_SKEL);
     if (const_offset != 0.0) {
         events[0] = SphericalConstOffsetEvent::create(offset + const_offset);
     }
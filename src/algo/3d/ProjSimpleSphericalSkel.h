@@ -24,6 +24,8 @@ public:
 
     static ProjSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon);
     static ProjSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon, ControllerSPtr controller);
+    static ProjSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+            SkelSettingsSPtr settings);
 
     virtual void run();
 
@@ -80,6 +82,8 @@ public:
 protected:
     ProjSimpleSphericalSkel(SphericalPolygonSPtr polygon);
     ProjSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller);
+    ProjSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+            SkelSettingsSPtr settings);
 };
 
 } }
@@ -10,6 +10,7 @@
 #include "typedefs_thread.h"
 #include "algo/Controller.h"
 #include "algo/3d/KernelWrapper.h"
+#include "algo/3d/SkelSettings.h"
 #include "data/3d/KernelFactory.h"
 #include "data/3d/SphericalPolygon.h"
 #include "data/3d/CircularVertex.h"
@@ -24,7 +25,6 @@
 #include "data/3d/skel/SphericalEdgeEvent.h"
 #include "data/3d/skel/SphericalSplitEvent.h"
 #include "data/3d/skel/SphericalTriangleEvent.h"
-#include "util/Configuration.h"
 #include <limits>
 
 namespace algo { namespace _3d {
@@ -33,12 +33,22 @@ RotSimpleSphericalSkel::RotSimpleSphericalSkel(SphericalPolygonSPtr polygon) {
     type_ = AbstractSimpleSphericalSkel::ROT_SIMPLE_SPHERICAL_SKEL;
     polygon_ = polygon;
     controller_ = ControllerSPtr();
+    settings_ = SkelSettings::create();
     skel_result_ = SphericalSkeleton::create(polygon->getSphere());
 }
 
 RotSimpleSphericalSkel::RotSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller) {
     polygon_ = polygon;
     controller_ = controller;
+    settings_ = SkelSettings::create();
+    skel_result_ = SphericalSkeleton::create(polygon->getSphere());
+}
+
+RotSimpleSphericalSkel::RotSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+        SkelSettingsSPtr settings) {
+    polygon_ = polygon;
+    controller_ = controller;
+    settings_ = settings;
     skel_result_ = SphericalSkeleton::create(polygon->getSphere());
 }
 
@@ -54,6 +64,11 @@ RotSimpleSphericalSkelSPtr RotSimpleSphericalSkel::create(SphericalPolygonSPtr p
     return RotSimpleSphericalSkelSPtr(new RotSimpleSphericalSkel(polygon, controller));
 }
 
+RotSimpleSphericalSkelSPtr RotSimpleSphericalSkel::create(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+        SkelSettingsSPtr settings) {
+    return RotSimpleSphericalSkelSPtr(new RotSimpleSphericalSkel(polygon, controller, settings));
+}
+
 void RotSimpleSphericalSkel::run() {
     if (controller_) {
         controller_->wait();
@@ -363,8 +378,8 @@ SphericalAbstractEventSPtr RotSimpleSphericalSkel::nextEvent(SphericalPolygonSPt
     for (unsigned int i = 0; i < 4; i++) {
         events[i] = SphericalAbstractEventSPtr();
     }
-    double const_offset = util::Configuration::getInstance()->getDouble(
-            "algo_3d_RotSimpleSphericalSkel", "const_offset");
+    double const_offset = settings_->getSphericalConstOffset(
+            AbstractSimpleSphericalSkel::ROT_SIMPLE_SPHERICAL_SKEL);
     if (const_offset != 0.0) {
         events[0] = SphericalConstOffsetEvent::create(offset + const_offset);
     }
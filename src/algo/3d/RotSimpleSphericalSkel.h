@@ -25,6 +25,8 @@ public:
 
     static RotSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon);
     static RotSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon, ControllerSPtr controller);
+    static RotSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+            SkelSettingsSPtr settings);
 
     virtual void run();
 
@@ -60,6 +62,8 @@ public:
 protected:
     RotSimpleSphericalSkel(SphericalPolygonSPtr polygon);
     RotSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller);
+    RotSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+            SkelSettingsSPtr settings);
 };
 
 } }
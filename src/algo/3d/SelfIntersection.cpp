@@ -108,7 +108,7 @@ bool SelfIntersection::isSelfIntersectingFacet(FacetSPtr facet) {
 
 unsigned int SelfIntersection::hasSelfIntersectingFacets(PolyhedronSPtr polyhedron) {
     unsigned int result = 0;
-    std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         FacetSPtr facet = *it_f++;
         if (isSelfIntersectingFacet(facet)) {
@@ -123,16 +123,13 @@ Plane3SPtr SelfIntersection::bisector(FacetSPtr facet, VertexSPtr vertex) {
     Plane3SPtr result;
     EdgeSPtr edge_in;
     EdgeSPtr edge_out;
-    std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+    std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
     while (it_e != vertex->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            if (edge->src(facet) == vertex) {
-                edge_out = edge;
-            } else if (edge->dst(facet) == vertex) {
-                edge_in = edge;
-            }
+        EdgeSPtr edge = (*it_e++).lock();
+        if (edge->src(facet) == vertex) {
+            edge_out = edge;
+        } else if (edge->dst(facet) == vertex) {
+            edge_in = edge;
         }
     }
     if (edge_in && edge_out) {
@@ -247,10 +244,10 @@ bool SelfIntersection::hasSelfIntersectingSurface(PolyhedronSPtr polyhedron) {
     if (SelfIntersection::hasSelfIntersectingFacets(polyhedron)) {
         result = true;
     } else {
-        std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+        util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
         while (it_f != polyhedron->facets().end()) {
             FacetSPtr facet = *it_f++;
-            std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+            util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
             while (it_e != polyhedron->edges().end()) {
                 EdgeSPtr edge = *it_e++;
                 if (isEdgeInsideFacet(facet, edge, true)) {
@@ -9,6 +9,8 @@
 #include "debug.h"
 #include "algo/Controller.h"
 #include "algo/3d/KernelWrapper.h"
+#include "algo/3d/EventQueue.h"
+#include "algo/3d/FacetBVH.h"
 #include "algo/3d/LineInFacet.h"
 #include "algo/3d/SelfIntersection.h"
 #include "algo/3d/PolyhedronTransformation.h"
@@ -19,9 +21,12 @@
 #include "algo/3d/VolumeVertexSplitter.h"
 #include "algo/3d/WeightVertexSplitter.h"
 #include "algo/3d/SphereVertexSplitter.h"
+#include "algo/3d/SkelSettings.h"
 #include "data/3d/Vertex.h"
 #include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
 #include "data/3d/Polyhedron.h"
+#include "data/3d/HalfEdgeMesh.h"
 #include "data/3d/skel/StraightSkeleton.h"
 #include "data/3d/skel/AbstractEvent.h"
 #include "data/3d/skel/ConstOffsetEvent.h"
@@ -39,6 +44,7 @@
 #include "data/3d/skel/SplitMergeEvent.h"
 #include "data/3d/skel/EdgeSplitEvent.h"
 #include "data/3d/skel/PierceEvent.h"
+#include "data/3d/skel/PolyhedronSnapshot.h"
 #include "data/3d/skel/Sheet.h"
 #include "data/3d/skel/Arc.h"
 #include "data/3d/skel/Node.h"
@@ -46,46 +52,98 @@
 #include "data/3d/skel/SkelEdgeData.h"
 #include "data/3d/skel/SkelFacetData.h"
 #include "db/3d/OBJFile.h"
+#include "db/3d/CheckpointFile.h"
 #include "util/Configuration.h"
+#include "util/ThreadPool.h"
 #include "util/Timer.h"
 #include "util/StringFactory.h"
+#include <algorithm>
+#include <cstdio>
+#include <functional>
 #include <limits>
+#include <map>
 #include <sstream> 
 #include <stdexcept>
+#include <unordered_set>
+#include <vector>
 
 namespace algo { namespace _3d {
 
+const double SimpleStraightSkel::TIE_EPSILON = 1e-12;
+
 SimpleStraightSkel::SimpleStraightSkel(PolyhedronSPtr polyhedron) {
     polyhedron_ = polyhedron;
+    parent_ = 0;
+    max_offset_ = -std::numeric_limits<double>::max();
+    max_events_ = 0;
+    kernel_ = KernelWrapper::KERNEL_EXACT;
+    num_batches_ = 0;
     skel_result_ = StraightSkeleton::create();
     skel_result_->setPolyhedron(polyhedron);
-    initVertexSplitter();
-    initEdgeEvent();
+    settings_ = SkelSettings::create();
+    initSettings();
 }
 
 SimpleStraightSkel::SimpleStraightSkel(PolyhedronSPtr polyhedron, ControllerSPtr controller) {
     polyhedron_ = polyhedron;
     controller_ = controller;
+    parent_ = 0;
+    max_offset_ = -std::numeric_limits<double>::max();
+    max_events_ = 0;
+    kernel_ = KernelWrapper::KERNEL_EXACT;
+    num_batches_ = 0;
     skel_result_ = StraightSkeleton::create();
     skel_result_->setPolyhedron(polyhedron);
-    initVertexSplitter();
-    initEdgeEvent();
+    settings_ = SkelSettings::create();
+    initSettings();
 }
 
 SimpleStraightSkel::SimpleStraightSkel(PolyhedronSPtr polyhedron, ControllerSPtr controller, const std::list<double>& save_offsets) {
     polyhedron_ = polyhedron;
     controller_ = controller;
     save_offsets_ = save_offsets;
+    parent_ = 0;
+    max_offset_ = -std::numeric_limits<double>::max();
+    max_events_ = 0;
+    kernel_ = KernelWrapper::KERNEL_EXACT;
+    num_batches_ = 0;
     skel_result_ = StraightSkeleton::create();
     skel_result_->setPolyhedron(polyhedron);
-    initVertexSplitter();
-    initEdgeEvent();
+    settings_ = SkelSettings::create();
+    initSettings();
+}
+
+SimpleStraightSkel::SimpleStraightSkel(SimpleStraightSkel* parent) {
+    parent_ = parent;
+    polyhedron_ = parent->polyhedron_;
+    save_offsets_ = parent->save_offsets_;
+    settings_ = parent->settings_;
+    use_fast_vertex_splitter_ = parent->use_fast_vertex_splitter_;
+    vertex_splitter_ = parent->vertex_splitter_;
+    if (parent->event_queue_) {
+        event_queue_ = EventQueue::create();
+    }
+    // the components run in parallel, each one scans sequentially
+    if (parent->facet_bvh_) {
+        facet_bvh_ = FacetBVH::create();
+    }
+    max_offset_ = parent->max_offset_;
+    max_events_ = 0;
+    kernel_ = parent->kernel_;
+    num_batches_ = 0;
+    skel_result_ = StraightSkeleton::create();
+    skel_result_->setPolyhedron(polyhedron_);
 }
 
 SimpleStraightSkel::~SimpleStraightSkel() {
     polyhedron_.reset();
     controller_.reset();
+    settings_.reset();
     vertex_splitter_.reset();
+    event_queue_.reset();
+    thread_pool_.reset();
+    facet_bvh_.reset();
+    checkpoint_resume_.reset();
     skel_result_.reset();
 }
 
@@ -101,107 +159,91 @@ SimpleStraightSkelSPtr SimpleStraightSkel::create(PolyhedronSPtr polyhedron, Con
     return SimpleStraightSkelSPtr(new SimpleStraightSkel(polyhedron, controller, save_offsets));
 }
 
-void SimpleStraightSkel::initVertexSplitter() {
+void SimpleStraightSkel::initSettings() {
     use_fast_vertex_splitter_ = true;
-    util::ConfigurationSPtr config = util::Configuration::getInstance();
-    std::string s_vertex_splitter;
-    if (config->isLoaded()) {
-        s_vertex_splitter = config->getString(
-                "algo_3d_SimpleStraightSkel", "vertex_splitter");
-        if (s_vertex_splitter.compare("AngleVertexSplitter") == 0) {
+    switch (settings_->getVertexSplitter()) {
+        case SkelSettings::ANGLE_VERTEX_SPLITTER:
             vertex_splitter_ = AngleVertexSplitter::create();
-        } else if (s_vertex_splitter.compare("CombiVertexSplitter") == 0) {
-            vertex_splitter_ = CombiVertexSplitter::create();
-        } else if (s_vertex_splitter.compare("ConvexVertexSplitter") == 0) {
-            vertex_splitter_ = ConvexVertexSplitter::create();
-        } else if (s_vertex_splitter.compare("VolumeVertexSplitter") == 0) {
-            vertex_splitter_ = VolumeVertexSplitter::create();
-        } else if (s_vertex_splitter.compare("WeightVertexSplitter") == 0) {
+            break;
+        case SkelSettings::COMBI_VERTEX_SPLITTER:
+            vertex_splitter_ = CombiVertexSplitter::create(settings_);
+            break;
+        case SkelSettings::VOLUME_VERTEX_SPLITTER:
+            vertex_splitter_ = VolumeVertexSplitter::create(settings_);
+            break;
+        case SkelSettings::WEIGHT_VERTEX_SPLITTER:
             vertex_splitter_ = WeightVertexSplitter::create(controller_);
-        } else if (s_vertex_splitter.compare("SphereVertexSplitter") == 0) {
-            vertex_splitter_ = SphereVertexSplitter::create(controller_);
-        } else {
-            DEBUG_VAL("Warning: '" << s_vertex_splitter << "' not found.");
-            DEBUG_VAL("Using 'ConvexVertexSplitter'.");
-            vertex_splitter_ = ConvexVertexSplitter::create();
-        }
-    } else {
-        vertex_splitter_ = ConvexVertexSplitter::create();
+            break;
+        case SkelSettings::SPHERE_VERTEX_SPLITTER:
+            vertex_splitter_ = SphereVertexSplitter::create(controller_, settings_);
+            break;
+        default:
+            vertex_splitter_ = ConvexVertexSplitter::create(settings_);
+            break;
     }
     skel_result_->appendConfig("vertex_splitter="+vertex_splitter_->toString()+"; ");
-}
+    skel_result_->appendConfig("edge_event="+settings_->getEdgeEventName()+"; ");
 
-void SimpleStraightSkel::initEdgeEvent() {
-    util::ConfigurationSPtr config = util::Configuration::getInstance();
-    std::string s_edge_event;
-    if (config->isLoaded()) {
-        s_edge_event = util::Configuration::getInstance()->getString(
-                "algo_3d_SimpleStraightSkel", "edge_event");
-        if (s_edge_event.compare("convex") == 0) {
-            edge_event_ = 0;
-        } else if (s_edge_event.compare("reflex") == 0) {
-            edge_event_ = 1;
-        } else if (s_edge_event.compare("flip") == 0) {
-            edge_event_ = 2;
-        } else if (s_edge_event.compare("sphere") == 0) {
-            edge_event_ = 3;
-        } else {
-            DEBUG_VAL("Warning: option '" << s_edge_event << "' not found.");
-            DEBUG_VAL("Using 'convex'.");
-            edge_event_ = 0;
-            s_edge_event = "convex";
+    event_queue_.reset();
+    if (settings_->getEventScheduler() == SkelSettings::QUEUE_EVENT_SCHEDULER) {
+        event_queue_ = EventQueue::create();
+    }
+    skel_result_->appendConfig("event_scheduler="+settings_->getEventSchedulerName()+"; ");
+    skel_result_->appendConfig("propagation="+settings_->getPropagationName()+"; ");
+
+    unsigned int scanner_threads = settings_->getScannerThreads();
+    thread_pool_.reset();
+    if (scanner_threads != 1) {
+        thread_pool_ = util::ThreadPool::create(scanner_threads);
+        scanner_threads = thread_pool_->size();
+        if (scanner_threads == 1) {
+            thread_pool_.reset();
         }
-    } else {
-        edge_event_ = 0;
-        s_edge_event = "convex";
     }
-    skel_result_->appendConfig("edge_event="+s_edge_event+"; ");
-}
+    skel_result_->appendConfig("scanner_threads="+
+            util::StringFactory::fromInteger(scanner_threads)+"; ");
+
+    facet_bvh_.reset();
+    if (settings_->getPierceSearch() == SkelSettings::BVH_PIERCE_SEARCH) {
+        facet_bvh_ = FacetBVH::create();
+    }
+    skel_result_->appendConfig("pierce_search="+settings_->getPierceSearchName()+"; ");
 
+    skel_result_->appendConfig("event_batching="+
+            util::StringFactory::fromBoolean(settings_->getEventBatching())+"; ");
+    if (settings_->getEventBatching()) {
+        skel_result_->appendConfig("batch_epsilon="+
+                util::StringFactory::fromDouble(settings_->getBatchEpsilon())+"; ");
+    }
+    skel_result_->appendConfig("parallel_components="+
+            util::StringFactory::fromBoolean(settings_->getParallelComponents())+"; ");
+}
 
 bool SimpleStraightSkel::isReflex(EdgeSPtr edge) {
     bool result = false;
     VertexSPtr vertex_src = edge->getVertexSrc();
     VertexSPtr vertex_dst = edge->getVertexDst();
-    if (vertex_src->getPoint() == vertex_dst->getPoint()) {
+    if (vertex_src->isCoincident(vertex_dst)) {
         FacetSPtr facet_l = edge->getFacetL();
         FacetSPtr facet_r = edge->getFacetR();
         FacetSPtr facet_src = getFacetSrc(edge);
         FacetSPtr facet_dst = getFacetDst(edge);
-        double speed_l = 1.0;
-        if (facet_l->hasData()) {
-            speed_l = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_l->getData())->getSpeed();
-        }
-        double speed_r = 1.0;
-        if (facet_r->hasData()) {
-            speed_r = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_r->getData())->getSpeed();
-        }
-        double speed_src = 1.0;
-        if (facet_src->hasData()) {
-            speed_src = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_src->getData())->getSpeed();
-        }
-        double speed_dst = 1.0;
-        if (facet_dst->hasData()) {
-            speed_dst = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_dst->getData())->getSpeed();
-        }
-        Plane3SPtr offset_plane_l = KernelWrapper::offsetPlane(facet_l->plane(), -speed_l);
-        Plane3SPtr offset_plane_r = KernelWrapper::offsetPlane(facet_r->plane(), -speed_r);
-        Plane3SPtr offset_plane_src = KernelWrapper::offsetPlane(facet_src->plane(), -speed_src);
-        Plane3SPtr offset_plane_dst = KernelWrapper::offsetPlane(facet_dst->plane(), -speed_dst);
-        Point3SPtr p_src = KernelWrapper::intersection(offset_plane_src,
+        Plane3 offset_plane_l = offsetPlane(facet_l.get(), -1.0);
+        Plane3 offset_plane_r = offsetPlane(facet_r.get(), -1.0);
+        Plane3 offset_plane_src = offsetPlane(facet_src.get(), -1.0);
+        Plane3 offset_plane_dst = offsetPlane(facet_dst.get(), -1.0);
+        std::optional<Point3> p_src = KernelWrapper::intersection(offset_plane_src,
                 offset_plane_l, offset_plane_r);
-        Point3SPtr p_dst = KernelWrapper::intersection(offset_plane_dst,
+        std::optional<Point3> p_dst = KernelWrapper::intersection(offset_plane_dst,
                 offset_plane_l, offset_plane_r);
-        Vector3SPtr v_dir = KernelFactory::createVector3((*p_dst) - (*p_src));
-        Vector3SPtr normal_l = KernelFactory::createVector3(offset_plane_l);
-        Vector3SPtr v_cross = KernelWrapper::cross(normal_l, v_dir);
-        Point3SPtr p = KernelFactory::createPoint3((*p_src) + (*v_cross));
-        if (KernelWrapper::side(offset_plane_r, p) > 0) {
-            result = true;
+        if (p_src && p_dst) {
+            Vector3 v_dir = (*p_dst) - (*p_src);
+            Vector3 normal_l = KernelWrapper::normal(offset_plane_l);
+            Vector3 v_cross = KernelWrapper::cross(normal_l, v_dir);
+            Point3 p = (*p_src) + v_cross;
+            if (KernelWrapper::side(offset_plane_r, p) > 0) {
+                result = true;
+            }
         }
     } else {
         result = edge->isReflex();
@@ -209,19 +251,27 @@ bool SimpleStraightSkel::isReflex(EdgeSPtr edge) {
     return result;
 }
 
+bool SimpleStraightSkel::isReflex(Edge* edge) {
+    bool result = false;
+    if (edge->getVertexSrc()->isCoincident(edge->getVertexDst())) {
+        // needs the facets next to the edge
+        result = isReflex(EdgeHandle(edge).lock());
+    } else {
+        result = edge->isReflex();
+    }
+    return result;
+}
+
 bool SimpleStraightSkel::isReflex(VertexSPtr vertex) {
     if (vertex->degree() == 0) {
         return false;
     }
     bool result = true;
-    std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+    std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
     while (it_e != vertex->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge = EdgeSPtr(edge_wptr);
-            if (!isReflex(edge)) {
-                result = false;
-            }
+        Edge* edge = (*it_e++).get();
+        if (!isReflex(edge)) {
+            result = false;
         }
     }
     return result;
@@ -232,14 +282,11 @@ bool SimpleStraightSkel::isConvex(VertexSPtr vertex) {
         return false;
     }
     bool result = true;
-    std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+    std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
     while (it_e != vertex->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge = EdgeSPtr(edge_wptr);
-            if (isReflex(edge)) {
-                result = false;
-            }
+        Edge* edge = (*it_e++).get();
+        if (isReflex(edge)) {
+            result = false;
         }
     }
     return result;
@@ -250,47 +297,51 @@ Line3SPtr SimpleStraightSkel::line(EdgeSPtr edge) {
     Line3SPtr result = Line3SPtr();
     VertexSPtr vertex_src = edge->getVertexSrc();
     VertexSPtr vertex_dst = edge->getVertexDst();
-    if (vertex_src->getPoint() == vertex_dst->getPoint()) {
+    if (vertex_src->isCoincident(vertex_dst)) {
         FacetSPtr facet_l = edge->getFacetL();
         FacetSPtr facet_r = edge->getFacetR();
         FacetSPtr facet_src = getFacetSrc(edge);
         FacetSPtr facet_dst = getFacetDst(edge);
-        double speed_l = 1.0;
-        if (facet_l->hasData()) {
-            speed_l = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_l->getData())->getSpeed();
-        }
-        double speed_r = 1.0;
-        if (facet_r->hasData()) {
-            speed_r = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_r->getData())->getSpeed();
-        }
-        double speed_src = 1.0;
-        if (facet_src->hasData()) {
-            speed_src = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_src->getData())->getSpeed();
-        }
-        double speed_dst = 1.0;
-        if (facet_dst->hasData()) {
-            speed_dst = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_dst->getData())->getSpeed();
-        }
-        Plane3SPtr offset_plane_l = KernelWrapper::offsetPlane(facet_l->plane(), -speed_l);
-        Plane3SPtr offset_plane_r = KernelWrapper::offsetPlane(facet_r->plane(), -speed_r);
-        Plane3SPtr offset_plane_src = KernelWrapper::offsetPlane(facet_src->plane(), -speed_src);
-        Plane3SPtr offset_plane_dst = KernelWrapper::offsetPlane(facet_dst->plane(), -speed_dst);
-        Point3SPtr p_src = KernelWrapper::intersection(offset_plane_src,
+        Plane3 offset_plane_l = offsetPlane(facet_l.get(), -1.0);
+        Plane3 offset_plane_r = offsetPlane(facet_r.get(), -1.0);
+        Plane3 offset_plane_src = offsetPlane(facet_src.get(), -1.0);
+        Plane3 offset_plane_dst = offsetPlane(facet_dst.get(), -1.0);
+        std::optional<Point3> p_src = KernelWrapper::intersection(offset_plane_src,
                 offset_plane_l, offset_plane_r);
-        Point3SPtr p_dst = KernelWrapper::intersection(offset_plane_dst,
+        std::optional<Point3> p_dst = KernelWrapper::intersection(offset_plane_dst,
                 offset_plane_l, offset_plane_r);
-        Vector3SPtr v_dir = KernelFactory::createVector3((*p_dst) - (*p_src));
-        result = KernelFactory::createLine3(vertex_src->getPoint(), v_dir);
+        if (p_src && p_dst) {
+            result = KernelFactory::createLine3(
+                    Line3(*vertex_src->getPoint(), (*p_dst) - (*p_src)));
+        }
     } else {
         result = edge->line();
     }
     return result;
 }
 
+Plane3 SimpleStraightSkel::offsetPlane(Facet* facet, double offset) {
+    Plane3SPtr plane = facet->plane();
+    SkelFacetData* data = SkelFacetData::of(facet);
+    double speed = 1.0;
+    if (data) {
+        speed = data->getSpeed();
+        if (data->hasUnitPlane(plane)) {
+            return KernelWrapper::translatePlane(data->getUnitPlane(), offset*speed);
+        }
+    }
+    Plane3 unit_plane = KernelWrapper::offsetPlane(*plane, 0.0);
+    return KernelWrapper::translatePlane(unit_plane, offset*speed);
+}
+
+void SimpleStraightSkel::initUnitPlane(FacetSPtr facet) {
+    SkelFacetData* data = SkelFacetData::of(facet);
+    if (data) {
+        Plane3SPtr plane = facet->plane();
+        data->setUnitPlane(plane, KernelWrapper::offsetPlane(*plane, 0.0));
+    }
+}
+
 
 FacetSPtr SimpleStraightSkel::getFacetSrc(EdgeSPtr edge) {
     FacetSPtr result = FacetSPtr();
@@ -314,6 +365,7 @@ FacetSPtr SimpleStraightSkel::getFacetDst(EdgeSPtr edge) {
 
 
 void SimpleStraightSkel::run() {
+    KernelWrapper::Scope kernel_scope(kernel_);
     if (controller_) {
         controller_->wait();
         controller_->setDispPolyhedron(polyhedron_);
@@ -321,7 +373,16 @@ void SimpleStraightSkel::run() {
     }
     DEBUG_PRINT("== Straight Skeleton 3D started ==");
     double t_start = util::Timer::now();
-    PolyhedronSPtr polyhedron = polyhedron_->clone();
+    PolyhedronSPtr polyhedron;
+    double offset = 0.0;
+    unsigned int i = 0;
+    if (checkpoint_resume_) {
+        polyhedron = checkpoint_resume_->getPolyhedron();
+        offset = checkpoint_resume_->getOffset();
+        i = checkpoint_resume_->getNumBatches();
+    } else {
+        polyhedron = polyhedron_->clone();
+    }
 
     // Simple test for weighted straight skeleton.
     //unsigned int j = 0;
@@ -336,93 +397,175 @@ void SimpleStraightSkel::run() {
     //    j++;
     //}
 
+    bool initialized = true;
+    if (checkpoint_resume_) {
+        DEBUG_VAL("Resuming at offset=" << offset << ".");
+        DEBUG_VAR(i);
+        checkpoint_resume_.reset();
+        if (controller_) {
+            controller_->setDispPolyhedron(polyhedron);
+        }
+    } else {
+        DEBUG_VAL("Using " << vertex_splitter_->toString()
+                << " to initialize polyhedron.");
+        initialized = init(polyhedron);
+    }
+    if (initialized) {
+        propagate(polyhedron, offset, i);
+        if (!parent_) {
+            WriteLock l(skel_result_->mutex());
+            skel_result_->compact();
+        }
+        DEBUG_PRINT("== Straight Skeleton 3D finished ==");
+        double time = util::Timer::now() - t_start;
+        skel_result_->appendDescription("time=" +
+                util::StringFactory::fromDouble(time) + "; ");
+        //skel_result_->appendDescription("controller=" +
+        //        util::StringFactory::fromBoolean(controller_) + "; ");
+        DEBUG_VAR(skel_result_->toString());
+    }
+}
+
+void SimpleStraightSkel::propagate(PolyhedronSPtr polyhedron, double offset,
+        unsigned int i) {
+    KernelWrapper::Scope kernel_scope(kernel_);  // also in component threads
+    if (controller_) {
+        controller_->wait();
+    }
     Point3SPtr p_box_min;
     Point3SPtr p_box_max;
-    unsigned int i = 0;
-    DEBUG_VAL("Using " << vertex_splitter_->toString()
-            << " to initialize polyhedron.");
-    if (init(polyhedron)) {
+    double offset_prev = offset;
+    unsigned int num_events = 0;
+    unsigned int events_checkpoint = 0;
+    double t_checkpoint = util::Timer::now();
+    if (event_queue_) {
+        event_queue_->init(polyhedron, offset);
+    }
+    // shares the unchanged parts of the wavefront between offset events
+    PolyhedronSnapshotSPtr snapshot;
+    std::list<AbstractEventSPtr> events = nextEvents(polyhedron, offset);
+    while (events.size() > 0) {
+        if (events.front()->getOffset() < max_offset_ ||
+                (max_events_ > 0 && num_events >= max_events_)) {
+            DEBUG_VAL("Stopped at offset=" << offset << " after "
+                    << num_events << " events.");
+            skel_result_->appendDescription("stop_offset=" +
+                    util::StringFactory::fromDouble(offset) + "; ");
+            break;
+        }
+        std::list<AbstractEventSPtr>::iterator it_e = events.begin();
+        while (it_e != events.end()) {
+            AbstractEventSPtr event = *it_e++;
+            DEBUG_VAL("-- Next Event: " << event->toString() << " --");
+        }
         if (controller_) {
             controller_->wait();
         }
-        double offset = 0.0;
-        double offset_prev = 0.0;
-        AbstractEventSPtr event = nextEvent(polyhedron, offset);
-        while (event) {
-            DEBUG_VAL("-- Next Event: " << event->toString() << " --");
-            if (controller_) {
-                controller_->wait();
+        offset = events.front()->getOffset();
+        bool split_component = false;
+        if (settings_->getParallelComponents() && max_events_ == 0) {
+            it_e = events.begin();
+            while (it_e != events.end()) {
+                AbstractEventSPtr event = *it_e++;
+                if (event->getType() == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+                    split_component = true;
+                }
             }
-            offset = event->getOffset();
+        }
+        PolyhedronSPtr polyhedron_prev = polyhedron;
+        int propagation = settings_->getPropagation();
+        if (propagation == SkelSettings::REBUILD_PROPAGATION ||
+                !shiftFacetsInPlace(polyhedron, offset_prev, offset,
+                        (propagation == SkelSettings::KINETIC_PROPAGATION))) {
             polyhedron = shiftFacets(polyhedron, offset - offset_prev);
+        }
+        if (event_queue_) {
+            if (polyhedron != polyhedron_prev) {
+                event_queue_->shift(polyhedron_prev);
+            }
+            event_queue_->snapshot(polyhedron, events);
+        }
+        if (split_component) {
+            std::map<VertexSPtr, unsigned int> labels;
+            split_component = (labelComponents(polyhedron, labels) == 1);
+        }
+        it_e = events.begin();
+        while (it_e != events.end()) {
+            AbstractEventSPtr event = *it_e++;
             if (event->getType() == AbstractEvent::CONST_OFFSET_EVENT) {
-                event->setPolyhedronResult(polyhedron);
+                snapshot = PolyhedronSnapshot::create(polyhedron, offset, snapshot);
+                DEBUG_VAL(snapshot->toString());
+                event->setSnapshot(snapshot);
                 skel_result_->addEvent(event);
-                bool screenshot_on_const_offset_event =
-                        util::Configuration::getInstance()->getBool(
-                        "algo_3d_SimpleStraightSkel", "screenshot_on_const_offset_event");
-                if (controller_ && screenshot_on_const_offset_event) {
+                if (controller_ && settings_->getScreenshotOnConstOffsetEvent()) {
                     controller_->screenshot();
                 }
             } else if (event->getType() == AbstractEvent::SAVE_OFFSET_EVENT) {
-                event->setPolyhedronResult(polyhedron);
+                snapshot = PolyhedronSnapshot::create(polyhedron, offset, snapshot);
+                DEBUG_VAL(snapshot->toString());
+                event->setSnapshot(snapshot);
                 skel_result_->addEvent(event);
-                std::stringstream ss_filename;
-                ss_filename << "offset_" << offset << ".obj";
-                db::_3d::OBJFile::save(ss_filename.str(), polyhedron);
+                // the parent saves the offset of all components
+                if (!parent_) {
+                    std::stringstream ss_filename;
+                    ss_filename << "offset_" << offset << ".obj";
+                    db::_3d::OBJFile::save(ss_filename.str(), polyhedron);
+                }
                 save_offsets_.pop_front();
-            } else if (event->getType() == AbstractEvent::EDGE_EVENT) {
-                handleEdgeEvent(std::dynamic_pointer_cast<EdgeEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::EDGE_MERGE_EVENT) {
-                handleEdgeMergeEvent(std::dynamic_pointer_cast<EdgeMergeEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::TRIANGLE_EVENT) {
-                handleTriangleEvent(std::dynamic_pointer_cast<TriangleEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::DBL_EDGE_MERGE_EVENT) {
-                handleDblEdgeMergeEvent(std::dynamic_pointer_cast<DblEdgeMergeEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::DBL_TRIANGLE_EVENT) {
-                handleDblTriangleEvent(std::dynamic_pointer_cast<DblTriangleEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::TETRAHEDRON_EVENT) {
-                handleTetrahedronEvent(std::dynamic_pointer_cast<TetrahedronEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::VERTEX_EVENT) {
-                handleVertexEvent(std::dynamic_pointer_cast<VertexEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::FLIP_VERTEX_EVENT) {
-                handleFlipVertexEvent(std::dynamic_pointer_cast<FlipVertexEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::SURFACE_EVENT) {
-                handleSurfaceEvent(std::dynamic_pointer_cast<SurfaceEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
-                handlePolyhedronSplitEvent(std::dynamic_pointer_cast<PolyhedronSplitEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::SPLIT_MERGE_EVENT) {
-                handleSplitMergeEvent(std::dynamic_pointer_cast<SplitMergeEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::EDGE_SPLIT_EVENT) {
-                handleEdgeSplitEvent(std::dynamic_pointer_cast<EdgeSplitEvent>(event), polyhedron);
-            } else if (event->getType() == AbstractEvent::PIERCE_EVENT) {
-                handlePierceEvent(std::dynamic_pointer_cast<PierceEvent>(event), polyhedron);
-            }
-            assert(polyhedron->isConsistent());
-            assert(skel_result_->isConsistent());
-            if (p_box_min && p_box_max) {
-                assert(PolyhedronTransformation::isInsideBox(polyhedron,
-                        p_box_min, p_box_max));
             } else {
-                p_box_min = PolyhedronTransformation::boundingBoxMin(polyhedron);
-                p_box_max = PolyhedronTransformation::boundingBoxMax(polyhedron);
-            }
-            DEBUG_PRINT("-- Finished handling Event --");
-            i++;
-            DEBUG_VAR(i);
-            if (controller_) {
-                controller_->wait();
+                handleEvent(event, polyhedron);
+            }
+        }
+        if (event_queue_) {
+            // before compact(), the added elements are behind the slots
+            // of the snapshot
+            event_queue_->update(polyhedron, offset);
+        }
+        // the events refer to the elements they were found on
+        polyhedron_prev.reset();
+        {
+            // no iterators of the slot lists are held between events
+            WriteLock l(polyhedron->mutex());
+            polyhedron->compact();
+        }
+        assert(polyhedron->isConsistent());
+        assert(skel_result_->isConsistent());
+        if (p_box_min && p_box_max) {
+            assert(PolyhedronTransformation::isInsideBox(polyhedron,
+                    p_box_min, p_box_max));
+        } else {
+            p_box_min = PolyhedronTransformation::boundingBoxMin(polyhedron);
+            p_box_max = PolyhedronTransformation::boundingBoxMax(polyhedron);
+        }
+        DEBUG_PRINT("-- Finished handling Event --");
+        i++;
+        DEBUG_VAR(i);
+        num_events += events.size();
+        num_batches_++;
+        events_checkpoint += events.size();
+        // the components are saved by the checkpoints of the parent
+        unsigned int checkpoint_events = settings_->getCheckpointEvents();
+        double checkpoint_seconds = settings_->getCheckpointSeconds();
+        if (!parent_ && ((checkpoint_events > 0 &&
+                events_checkpoint >= checkpoint_events) ||
+                (checkpoint_seconds > 0.0 &&
+                util::Timer::now() - t_checkpoint >= checkpoint_seconds))) {
+            saveCheckpoint(polyhedron, offset, i);
+            events_checkpoint = 0;
+            t_checkpoint = util::Timer::now();
+        }
+        if (split_component) {
+            std::vector<PolyhedronSPtr> components = splitComponents(polyhedron);
+            if (components.size() > 1) {
+                propagateComponents(components, offset, i);
+                break;
             }
-            event = nextEvent(polyhedron, offset);
-            offset_prev = offset;
         }
-        DEBUG_PRINT("== Straight Skeleton 3D finished ==");
-        double time = util::Timer::now() - t_start;
-        skel_result_->appendDescription("time=" +
-                util::StringFactory::fromDouble(time) + "; ");
-        //skel_result_->appendDescription("controller=" +
-        //        util::StringFactory::fromBoolean(controller_) + "; ");
-        DEBUG_VAR(skel_result_->toString());
+        if (controller_) {
+            controller_->wait();
+        }
+        events = nextEvents(polyhedron, offset);
+        offset_prev = offset;
     }
 }
 
@@ -431,14 +574,330 @@ ThreadSPtr SimpleStraightSkel::startThread() {
             std::bind(&SimpleStraightSkel::run, this)));
 }
 
+void SimpleStraightSkel::resume(db::_3d::CheckpointFileSPtr checkpoint) {
+    checkpoint_resume_ = checkpoint;
+    polyhedron_ = checkpoint->getInput();
+    save_offsets_ = checkpoint->saveOffsets();
+    StraightSkeletonSPtr skel = checkpoint->getSkel();
+    skel->setConfig(skel_result_->getConfig());
+    skel->setPolyhedron(polyhedron_);
+    skel_result_ = skel;
+}
+
+void SimpleStraightSkel::setMaxOffset(double max_offset) {
+    max_offset_ = max_offset;
+}
+
+void SimpleStraightSkel::setMaxEvents(unsigned int max_events) {
+    max_events_ = max_events;
+}
+
+void SimpleStraightSkel::setKernel(int kernel) {
+    kernel_ = kernel;
+}
+
+int SimpleStraightSkel::getKernel() const {
+    return kernel_;
+}
+
+unsigned int SimpleStraightSkel::getNumBatches() const {
+    return num_batches_;
+}
+
+bool SimpleStraightSkel::saveCheckpoint(PolyhedronSPtr polyhedron,
+        double offset, unsigned int num_batches) {
+    db::_3d::CheckpointFileSPtr checkpoint = db::_3d::CheckpointFile::create();
+    checkpoint->setInput(polyhedron_);
+    checkpoint->setPolyhedron(polyhedron);
+    checkpoint->setSkel(skel_result_);
+    checkpoint->setOffset(offset);
+    checkpoint->setNumBatches(num_batches);
+    checkpoint->saveOffsets() = save_offsets_;
+    std::string checkpoint_file = settings_->getCheckpointFile();
+    std::string filename_tmp = checkpoint_file + ".tmp";
+    bool result = checkpoint->save(filename_tmp);
+    if (result) {
+        result = (std::rename(filename_tmp.c_str(), checkpoint_file.c_str()) == 0);
+    }
+    if (result) {
+        DEBUG_VAL("Checkpoint '" << checkpoint_file << "' written at offset="
+                << offset << ".");
+    } else {
+        DEBUG_VAL("Warning: Unable to write checkpoint '" << checkpoint_file << "'.");
+    }
+    return result;
+}
+
+
+SharedMutex& SimpleStraightSkel::skelMutex() {
+    if (parent_) {
+        return parent_->skelMutex();
+    }
+    return skel_result_->mutex();
+}
+
+unsigned int SimpleStraightSkel::labelComponents(PolyhedronSPtr polyhedron,
+        std::map<VertexSPtr, unsigned int>& labels) {
+    unsigned int result = 0;
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        if (labels.find(vertex) != labels.end()) {
+            continue;
+        }
+        std::list<VertexSPtr> stack;
+        stack.push_back(vertex);
+        labels[vertex] = result;
+        while (!stack.empty()) {
+            VertexSPtr current = stack.back();
+            stack.pop_back();
+            std::list<EdgeHandle>::iterator it_e = current->edges().begin();
+            while (it_e != current->edges().end()) {
+                Edge* edge = (*it_e++).get();
+                VertexSPtr neighbor = edge->getVertexSrc();
+                if (neighbor == current) {
+                    neighbor = edge->getVertexDst();
+                }
+                if (labels.find(neighbor) == labels.end()) {
+                    labels[neighbor] = result;
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+        result++;
+    }
+    return result;
+}
+
+FacetSPtr SimpleStraightSkel::splitFacet(FacetSPtr facet,
+        std::map<VertexSPtr, unsigned int>& labels, unsigned int label) {
+    FacetSPtr result = Facet::create();
+    result->setPlane(facet->getPlane());
+    if (facet->hasData()) {
+        SkelFacetData* data = SkelFacetData::of(facet);
+        SkelFacetDataSPtr data_result = SkelFacetData::create(result);
+        data_result->setFacetOrigin(data->getFacetOrigin());
+        data_result->setSpeed(data->getSpeed());
+    }
+    // lists are modified directly to keep the order of all elements
+    std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
+    while (it_v != facet->vertices().end()) {
+        std::list<VertexSPtr>::iterator it_current = it_v;
+        VertexSPtr vertex = *it_v++;
+        if (labels[vertex] != label) {
+            continue;
+        }
+        facet->vertices().erase(it_current);
+        result->vertices().push_back(vertex);
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
+        while (it_f != vertex->facets().end()) {
+            if (*it_f == facet) {
+                *it_f = FacetHandle(result);
+            }
+            it_f++;
+        }
+    }
+    std::list<EdgeSPtr>::iterator it_e = facet->edges().begin();
+    while (it_e != facet->edges().end()) {
+        std::list<EdgeSPtr>::iterator it_current = it_e;
+        EdgeSPtr edge = *it_e++;
+        if (labels[edge->getVertexSrc()] != label) {
+            continue;
+        }
+        bool left = (edge->getFacetL() == facet);
+        if (left && edge->getFacetR() == facet) {
+            left = (edge->getFacetLListIt() == it_current);
+        }
+        facet->edges().erase(it_current);
+        std::list<EdgeSPtr>::iterator it_result =
+                result->edges().insert(result->edges().end(), edge);
+        if (left) {
+            edge->setFacetL(result);
+            edge->setFacetLListIt(it_result);
+        } else {
+            edge->setFacetR(result);
+            edge->setFacetRListIt(it_result);
+        }
+    }
+    facet->triangles().clear();
+    return result;
+}
+
+std::vector<PolyhedronSPtr> SimpleStraightSkel::splitComponents(
+        PolyhedronSPtr polyhedron) {
+    std::vector<PolyhedronSPtr> result;
+    std::map<VertexSPtr, unsigned int> labels;
+    unsigned int num_components = labelComponents(polyhedron, labels);
+    if (num_components < 2) {
+        result.push_back(polyhedron);
+        return result;
+    }
+    for (unsigned int i = 0; i < num_components; i++) {
+        result.push_back(Polyhedron::create());
+    }
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        result[labels[vertex]]->addVertex(vertex);
+    }
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        result[labels[edge->getVertexSrc()]]->addEdge(edge);
+    }
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        // a facet that touches several components is split
+        std::vector<unsigned int> facet_labels;
+        std::list<VertexSPtr>::iterator it_fv = facet->vertices().begin();
+        while (it_fv != facet->vertices().end()) {
+            unsigned int label = labels[*it_fv++];
+            if (std::find(facet_labels.begin(), facet_labels.end(), label) ==
+                    facet_labels.end()) {
+                facet_labels.push_back(label);
+            }
+        }
+        if (facet_labels.empty()) {
+            facet_labels.push_back(0);
+        }
+        for (unsigned int i = 1; i < facet_labels.size(); i++) {
+            FacetSPtr facet_split = splitFacet(facet, labels, facet_labels[i]);
+            result[facet_labels[i]]->addFacet(facet_split);
+        }
+        result[facet_labels[0]]->addFacet(facet);
+    }
+    polyhedron->facets().clear();
+    polyhedron->edges().clear();
+    polyhedron->vertices().clear();
+    return result;
+}
+
+void SimpleStraightSkel::propagateComponents(
+        std::vector<PolyhedronSPtr>& components, double offset, unsigned int i) {
+    DEBUG_VAL("Propagating " << components.size()
+            << " components in parallel at offset=" << offset << ".");
+    std::vector<SimpleStraightSkelSPtr> children;
+    for (unsigned int j = 0; j < components.size(); j++) {
+        children.push_back(SimpleStraightSkelSPtr(new SimpleStraightSkel(this)));
+    }
+    std::vector<ThreadSPtr> threads;
+    for (unsigned int j = 1; j < components.size(); j++) {
+        threads.push_back(ThreadSPtr(new std::thread(
+                std::bind(&SimpleStraightSkel::propagate, children[j].get(),
+                components[j], offset, i))));
+    }
+    children[0]->propagate(components[0], offset, i);
+    for (unsigned int j = 0; j < threads.size(); j++) {
+        threads[j]->join();
+    }
+    for (unsigned int j = 0; j < children.size(); j++) {
+        num_batches_ += children[j]->num_batches_;
+    }
+    mergeComponents(children);
+}
+
+PolyhedronSPtr SimpleStraightSkel::mergePolyhedrons(
+        const std::list<PolyhedronSPtr>& polyhedrons) {
+    PolyhedronSPtr result = Polyhedron::create();
+    std::list<PolyhedronSPtr>::const_iterator it_p = polyhedrons.begin();
+    while (it_p != polyhedrons.end()) {
+        PolyhedronSPtr polyhedron = (*it_p++)->clone();
+        util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+        while (it_v != polyhedron->vertices().end()) {
+            result->addVertex(*it_v++);
+        }
+        util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+        while (it_e != polyhedron->edges().end()) {
+            result->addEdge(*it_e++);
+        }
+        util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+        while (it_f != polyhedron->facets().end()) {
+            result->addFacet(*it_f++);
+        }
+    }
+    return result;
+}
+
+void SimpleStraightSkel::mergeComponents(
+        std::vector<SimpleStraightSkelSPtr>& children) {
+    WriteLock l(skel_result_->mutex());
+    std::vector<std::list<AbstractEventSPtr> > events;
+    for (unsigned int j = 0; j < children.size(); j++) {
+        StraightSkeletonSPtr skel = children[j]->getResult();
+        util::SlotList<NodeSPtr>::iterator it_n = skel->nodes().begin();
+        while (it_n != skel->nodes().end()) {
+            skel_result_->addNode(*it_n++);
+        }
+        util::SlotList<ArcSPtr>::iterator it_a = skel->arcs().begin();
+        while (it_a != skel->arcs().end()) {
+            skel_result_->addArc(*it_a++);
+        }
+        util::SlotList<SheetSPtr>::iterator it_s = skel->sheets().begin();
+        while (it_s != skel->sheets().end()) {
+            skel_result_->addSheet(*it_s++);
+        }
+        events.push_back(std::list<AbstractEventSPtr>(
+                skel->events().begin(), skel->events().end()));
+    }
+    // the events of all components are merged in the order of time
+    while (true) {
+        int next = -1;
+        for (unsigned int j = 0; j < events.size(); j++) {
+            if (events[j].empty()) {
+                continue;
+            }
+            if (next < 0 || events[j].front()->getOffset() >
+                    events[next].front()->getOffset()) {
+                next = j;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+        AbstractEventSPtr event = events[next].front();
+        events[next].pop_front();
+        int type = event->getType();
+        if (type == AbstractEvent::CONST_OFFSET_EVENT ||
+                type == AbstractEvent::SAVE_OFFSET_EVENT) {
+            // one offset polyhedron for all components
+            std::list<PolyhedronSPtr> polyhedrons;
+            polyhedrons.push_back(event->getPolyhedronResult());
+            for (unsigned int j = 0; j < events.size(); j++) {
+                std::list<AbstractEventSPtr>::iterator it_e = events[j].begin();
+                while (it_e != events[j].end() &&
+                        (*it_e)->getOffset() == event->getOffset()) {
+                    std::list<AbstractEventSPtr>::iterator it_current = it_e;
+                    AbstractEventSPtr event_other = *it_e++;
+                    if (event_other->getType() == type) {
+                        polyhedrons.push_back(event_other->getPolyhedronResult());
+                        events[j].erase(it_current);
+                    }
+                }
+            }
+            if (polyhedrons.size() > 1) {
+                event->setSnapshot(PolyhedronSnapshot::create(
+                        mergePolyhedrons(polyhedrons), event->getOffset()));
+            }
+            if (type == AbstractEvent::SAVE_OFFSET_EVENT && !parent_) {
+                std::stringstream ss_filename;
+                ss_filename << "offset_" << event->getOffset() << ".obj";
+                db::_3d::OBJFile::save(ss_filename.str(),
+                        event->getPolyhedronResult());
+            }
+        }
+        skel_result_->addEvent(event);
+    }
+}
+
 
 NodeSPtr SimpleStraightSkel::createNode(VertexSPtr vertex) {
     NodeSPtr result = NodeSPtr();
-    SkelVertexDataSPtr data;
+    SkelVertexData* data = 0;
     if (vertex->hasData()) {
-        data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+        data = SkelVertexData::of(vertex);
     } else {
-        data = SkelVertexData::create(vertex);
+        data = SkelVertexData::create(vertex).get();
     }
     result = Node::create(vertex->getPoint());
     data->setNode(result);
@@ -449,50 +908,30 @@ NodeSPtr SimpleStraightSkel::createNode(VertexSPtr vertex) {
 ArcSPtr SimpleStraightSkel::createArc(VertexSPtr vertex) {
     ArcSPtr result = ArcSPtr();
     if (vertex->degree() == 3) {
-        SkelVertexDataSPtr data;
+        SkelVertexData* data = 0;
         if (vertex->hasData()) {
-            data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+            data = SkelVertexData::of(vertex);
         } else {
-            data = SkelVertexData::create(vertex);
+            data = SkelVertexData::create(vertex).get();
         }
-        FacetSPtr facets[3];
+        Facet* facets[3];
         for (unsigned int i = 0; i < 3; i++) {
-            facets[i] = FacetSPtr();
+            facets[i] = 0;
         }
         unsigned int i = 0;
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (i < 3 && it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                facets[i] = FacetSPtr(facet_wptr);
-                i++;
-            }
+            facets[i] = (*it_f++).get();
+            i++;
         }
         if (i >= 3) {
             Vector3SPtr direction;
-            Plane3SPtr plane_1 = facets[0]->plane();
-            Plane3SPtr plane_2 = facets[1]->plane();
-            Plane3SPtr plane_3 = facets[2]->plane();
-            double speed_1 = 1.0;
-            if (facets[0]->hasData()) {
-                speed_1 = std::dynamic_pointer_cast<SkelFacetData>(
-                        facets[0]->getData())->getSpeed();
-            }
-            double speed_2 = 1.0;
-            if (facets[1]->hasData()) {
-                speed_2 = std::dynamic_pointer_cast<SkelFacetData>(
-                        facets[1]->getData())->getSpeed();
-            }
-            double speed_3 = 1.0;
-            if (facets[2]->hasData()) {
-                speed_3 = std::dynamic_pointer_cast<SkelFacetData>(
-                        facets[2]->getData())->getSpeed();
-            }
-            Point3SPtr src = KernelWrapper::intersection(plane_1, plane_2, plane_3);
-            Plane3SPtr off_1 = KernelWrapper::offsetPlane(plane_1, -speed_1);
-            Plane3SPtr off_2 = KernelWrapper::offsetPlane(plane_2, -speed_2);
-            Plane3SPtr off_3 = KernelWrapper::offsetPlane(plane_3, -speed_3);
-            Point3SPtr dst = KernelWrapper::intersection(off_1, off_2, off_3);
+            std::optional<Point3> src = KernelWrapper::intersection(
+                    *(facets[0]->plane()), *(facets[1]->plane()), *(facets[2]->plane()));
+            std::optional<Point3> dst = KernelWrapper::intersection(
+                    offsetPlane(facets[0], -1.0),
+                    offsetPlane(facets[1], -1.0),
+                    offsetPlane(facets[2], -1.0));
             if (src && dst) {
                 direction = KernelFactory::createVector3(*dst - *src);
             }
@@ -500,18 +939,15 @@ ArcSPtr SimpleStraightSkel::createArc(VertexSPtr vertex) {
                 result = Arc::create(data->getNode(), direction);
                 data->setArc(result);
 
-                std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+                std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
                 while (it_e != vertex->edges().end()) {
-                    EdgeWPtr edge_wptr = *it_e++;
-                    if (!edge_wptr.expired()) {
-                        EdgeSPtr edge(edge_wptr);
-                        if (edge->hasData()) {
-                            SkelEdgeDataSPtr edge_data =
-                                    std::dynamic_pointer_cast<SkelEdgeData>(edge->getData());
-                            SheetSPtr sheet = edge_data->getSheet();
-                            if (sheet) {
-                                sheet->addArc(result);
-                            }
+                    Edge* edge = (*it_e++).get();
+                    if (edge->hasData()) {
+                        SkelEdgeData* edge_data =
+                                SkelEdgeData::of(edge);
+                        SheetSPtr sheet = edge_data->getSheet();
+                        if (sheet) {
+                            sheet->addArc(result);
                         }
                     }
                 }
@@ -526,11 +962,11 @@ ArcSPtr SimpleStraightSkel::createArc(VertexSPtr vertex) {
 
 SheetSPtr SimpleStraightSkel::createSheet(EdgeSPtr edge) {
     SheetSPtr result = SheetSPtr();
-    SkelEdgeDataSPtr data;
+    SkelEdgeData* data = 0;
     if (edge->hasData()) {
-        data = std::dynamic_pointer_cast<SkelEdgeData>(edge->getData());
+        data = SkelEdgeData::of(edge);
     } else {
-        data = SkelEdgeData::create(edge);
+        data = SkelEdgeData::create(edge).get();
     }
     FacetSPtr facet_l = edge->getFacetL();
     FacetSPtr facet_r = edge->getFacetR();
@@ -540,16 +976,14 @@ SheetSPtr SimpleStraightSkel::createSheet(EdgeSPtr edge) {
         FacetSPtr facet_b = facet_l;
         double speed_l = 1.0;
         if (facet_l->hasData()) {
-            SkelFacetDataSPtr data_l = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_l->getData());
+            SkelFacetData* data_l = SkelFacetData::of(facet_l);
             facet_b = data_l->getFacetOrigin();
             speed_l = data_l->getSpeed();
         }
         FacetSPtr facet_f = facet_r;
         double speed_r = 1.0;
         if (facet_r->hasData()) {
-            SkelFacetDataSPtr data_r = std::dynamic_pointer_cast<SkelFacetData>(
-                    facet_r->getData());
+            SkelFacetData* data_r = SkelFacetData::of(facet_r);
             facet_f = data_r->getFacetOrigin();
             speed_r = data_r->getSpeed();
         }
@@ -564,9 +998,8 @@ SheetSPtr SimpleStraightSkel::createSheet(EdgeSPtr edge) {
             }
         } else {
             Line3SPtr line = KernelWrapper::intersection(plane_l, plane_r);
-            Plane3SPtr offset_l = KernelWrapper::offsetPlane(plane_l, -speed_l);
-            Plane3SPtr offset_r = KernelWrapper::offsetPlane(plane_r, -speed_r);
-            Line3SPtr line_offset = KernelWrapper::intersection(offset_l, offset_r);
+            std::optional<Line3> line_offset = KernelWrapper::intersection(
+                    offsetPlane(facet_l.get(), -1.0), offsetPlane(facet_r.get(), -1.0));
             Point3SPtr point_1 = KernelFactory::createPoint3(line->point());
             Vector3SPtr direction = KernelFactory::createVector3(line);
             Point3SPtr point_2 = KernelFactory::createPoint3(*point_1 + *direction);
@@ -582,10 +1015,8 @@ SheetSPtr SimpleStraightSkel::createSheet(EdgeSPtr edge) {
         result->setFacetB(facet_b);
         result->setFacetF(facet_f);
         data->setSheet(result);
-        SkelVertexDataSPtr data_src = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexSrc()->getData());
-        SkelVertexDataSPtr data_dst = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexDst()->getData());
+        SkelVertexData* data_src = SkelVertexData::of(edge->getVertexSrc());
+        SkelVertexData* data_dst = SkelVertexData::of(edge->getVertexDst());
         if (data_src) {
             result->addNode(data_src->getNode());
             result->addArc(data_src->getArc());
@@ -602,7 +1033,17 @@ bool SimpleStraightSkel::init(PolyhedronSPtr polyhedron) {
     WriteLock l(polyhedron->mutex());
     bool result = true;
 
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    // the splitters and createArc use the unit planes already
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        if (!facet->hasData()) {
+            SkelFacetData::create(facet);
+        }
+        initUnitPlane(facet);
+    }
+
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
     while (it_v != polyhedron->vertices().end()) {
         VertexSPtr vertex = *it_v++;
         if (vertex->degree() < 3) {
@@ -625,11 +1066,11 @@ bool SimpleStraightSkel::init(PolyhedronSPtr polyhedron) {
         VertexSPtr vertex = *it_v++;
         if (vertex->degree() > 3) {
             vertices_tosplit.push_back(vertex);
-            SkelVertexDataSPtr data;
+            SkelVertexData* data = 0;
             if (vertex->hasData()) {
-                data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+                data = SkelVertexData::of(vertex);
             } else {
-                data = SkelVertexData::create(vertex);
+                data = SkelVertexData::create(vertex).get();
             }
             data->setHighlight(true);
         }
@@ -640,27 +1081,22 @@ bool SimpleStraightSkel::init(PolyhedronSPtr polyhedron) {
         controller_->wait();
         l.lock();
     }
-    it_v = vertices_tosplit.begin();
-    while (it_v != vertices_tosplit.end()) {
-        VertexSPtr vertex = *it_v++;
+    std::list<VertexSPtr>::iterator it_s = vertices_tosplit.begin();
+    while (it_s != vertices_tosplit.end()) {
+        VertexSPtr vertex = *it_s++;
         vertex->getData()->setHighlight(false);
     }
-    it_v = vertices_tosplit.begin();
-    while (it_v != vertices_tosplit.end()) {
-        VertexSPtr vertex = *it_v++;
+    it_s = vertices_tosplit.begin();
+    while (it_s != vertices_tosplit.end()) {
+        VertexSPtr vertex = *it_s++;
 
         bool equal_speeds = true;
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (facet_wptr.expired()) {
-                continue;
-            }
-            FacetSPtr facet(facet_wptr);
+            Facet* facet = (*it_f++).get();
             double speed = 1.0;
             if (facet->hasData()) {
-                speed = std::dynamic_pointer_cast<SkelFacetData>(
-                        facet->getData())->getSpeed();
+                speed = SkelFacetData::of(facet)->getSpeed();
             }
             if (speed != 1.0) {
                 equal_speeds = false;
@@ -697,7 +1133,7 @@ bool SimpleStraightSkel::init(PolyhedronSPtr polyhedron) {
             result = false;
         }
     }
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
         if (!edge->hasData()) {
@@ -710,13 +1146,6 @@ bool SimpleStraightSkel::init(PolyhedronSPtr polyhedron) {
             result = false;
         }
     }
-    std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
-    while (it_f != polyhedron->facets().end()) {
-        FacetSPtr facet = *it_f++;
-        if (!facet->hasData()) {
-            SkelFacetData::create(facet);
-        }
-    }
     assert(skel_result_->isConsistent());
     return result;
 }
@@ -797,29 +1226,29 @@ Point3SPtr SimpleStraightSkel::vanishesAt(EdgeSPtr edge) {
     if (!facet) {
         facet = edge->getFacetR();
     }
-    SkelEdgeDataSPtr data = std::dynamic_pointer_cast<SkelEdgeData>(edge->getData());
+    SkelEdgeData* data = SkelEdgeData::of(edge);
     if (data) {
         sheets[0] = data->getSheet();
     }
     EdgeSPtr edge_prev = edge->prev(facet);
-    data = std::dynamic_pointer_cast<SkelEdgeData>(edge_prev->getData());
+    data = SkelEdgeData::of(edge_prev);
     if (data) {
         sheets[1] = data->getSheet();
     }
     EdgeSPtr edge_next = edge->next(facet);
-    data = std::dynamic_pointer_cast<SkelEdgeData>(edge_next->getData());
+    data = SkelEdgeData::of(edge_next);
     if (data) {
         sheets[2] = data->getSheet();
     }
     if (sheets[0] && sheets[1] && sheets[2]) {
-        Point3SPtr p_intersect = KernelWrapper::intersection(
-                sheets[0]->getPlane(),
-                sheets[1]->getPlane(),
-                sheets[2]->getPlane());
+        std::optional<Point3> p_intersect = KernelWrapper::intersection(
+                *sheets[0]->getPlane(),
+                *sheets[1]->getPlane(),
+                *sheets[2]->getPlane());
         if (p_intersect) {
-            if (KernelWrapper::side(facet->plane(), p_intersect) <= 0) {
+            if (KernelWrapper::side(*facet->plane(), *p_intersect) <= 0) {
                 // inside polyhedron
-                result = p_intersect;
+                result = KernelFactory::createPoint3(*p_intersect);
             }
         }
     }
@@ -828,53 +1257,48 @@ Point3SPtr SimpleStraightSkel::vanishesAt(EdgeSPtr edge) {
 
 Point3SPtr SimpleStraightSkel::crashAt(EdgeSPtr edge_1, EdgeSPtr edge_2) {
     Point3SPtr result = Point3SPtr();
-    SkelEdgeDataSPtr data_1 = std::dynamic_pointer_cast<SkelEdgeData>(edge_1->getData());
-    SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(edge_2->getData());
-    Line3SPtr line_intersection = KernelWrapper::intersection(
-            data_1->getSheet()->getPlane(),
-            data_2->getSheet()->getPlane());
+    SkelEdgeData* data_1 = SkelEdgeData::of(edge_1);
+    SkelEdgeData* data_2 = SkelEdgeData::of(edge_2);
+    std::optional<Line3> line_intersection = KernelWrapper::intersection(
+            *data_1->getSheet()->getPlane(),
+            *data_2->getSheet()->getPlane());
     if (!line_intersection) {
         // degenerated case
         return result;
     }
     Plane3SPtr plane_1 = edge_1->getFacetL()->plane();
     Plane3SPtr plane_2 = edge_2->getFacetL()->plane();
-    Point3SPtr point_1 = KernelWrapper::intersection(plane_1, line_intersection);
-    Point3SPtr point_2 = KernelWrapper::intersection(plane_2, line_intersection);
+    std::optional<Point3> point_1 = KernelWrapper::intersection(*plane_1, *line_intersection);
+    std::optional<Point3> point_2 = KernelWrapper::intersection(*plane_2, *line_intersection);
     if (!point_1 || !point_2) {
         // degenerated case
         return result;
     }
-    Vector3SPtr direction = KernelFactory::createVector3(*point_2 - *point_1);
-    double distance = KernelWrapper::distance(point_2, point_1);
-    double facet_speed_1 = 1.0;
-    if (edge_1->getFacetL()->hasData()) {
-        facet_speed_1 = std::dynamic_pointer_cast<SkelFacetData>(
-                edge_1->getFacetL()->getData())->getSpeed();
-    }
-    double facet_speed_2 = 1.0;
-    if (edge_2->getFacetL()->hasData()) {
-        facet_speed_2 = std::dynamic_pointer_cast<SkelFacetData>(
-                edge_2->getFacetL()->getData())->getSpeed();
-    }
-    Plane3SPtr offset_plane_1 = KernelWrapper::offsetPlane(plane_1, -facet_speed_1);
-    Plane3SPtr offset_plane_2 = KernelWrapper::offsetPlane(plane_2, -facet_speed_2);
-    Point3SPtr offset_point_1 = KernelWrapper::intersection(offset_plane_1, line_intersection);
-    Point3SPtr offset_point_2 = KernelWrapper::intersection(offset_plane_2, line_intersection);
-    Vector3SPtr direction_1 = KernelFactory::createVector3(*offset_point_1 - *point_1);
-    Vector3SPtr direction_2 = KernelFactory::createVector3(*offset_point_2 - *point_2);
-    double speed_1 = KernelWrapper::distance(offset_point_1, point_1);
+    Vector3 direction = *point_2 - *point_1;
+    double distance = KernelWrapper::distance(*point_2, *point_1);
+    Plane3 offset_plane_1 = offsetPlane(edge_1->getFacetL().get(), -1.0);
+    Plane3 offset_plane_2 = offsetPlane(edge_2->getFacetL().get(), -1.0);
+    std::optional<Point3> offset_point_1 = KernelWrapper::intersection(offset_plane_1, *line_intersection);
+    std::optional<Point3> offset_point_2 = KernelWrapper::intersection(offset_plane_2, *line_intersection);
+    if (!offset_point_1 || !offset_point_2) {
+        // degenerated case
+        return result;
+    }
+    Vector3 direction_1 = *offset_point_1 - *point_1;
+    Vector3 direction_2 = *offset_point_2 - *point_2;
+    double speed_1 = KernelWrapper::distance(*offset_point_1, *point_1);
     //if (KernelWrapper::angle(direction_1, direction) > M_PI/2.0) {
-    if ((*direction_1 * *direction) < 0.0) {
+    if ((direction_1 * direction) < 0.0) {
         speed_1 *= -1.0;
     }
-    double speed_2 = KernelWrapper::distance(offset_point_2, point_2);
+    double speed_2 = KernelWrapper::distance(*offset_point_2, *point_2);
     //if (KernelWrapper::angle(direction_2, direction) > M_PI/2.0) {
-    if ((*direction_2 * *direction) < 0.0) {
+    if ((direction_2 * direction) < 0.0) {
         speed_2 *= -1.0;
     }
     double dist_1 = (distance * speed_1) / (speed_1 - speed_2);
-    Point3SPtr point = KernelWrapper::offsetPoint(point_1, direction, dist_1);
+    Point3SPtr point = KernelFactory::createPoint3(
+            *point_1 + (KernelWrapper::normalize(direction) * dist_1));
 
     bool inside_bounds = true;
     FacetSPtr facet_1_src = getFacetSrc(edge_1);
@@ -888,8 +1312,7 @@ Point3SPtr SimpleStraightSkel::crashAt(EdgeSPtr edge_1, EdgeSPtr edge_2) {
     }
     if (!(facet_1_src == edge_2->getFacetL() ||
             facet_1_src == edge_2->getFacetR())) {
-        SkelVertexDataSPtr data_1_src = std::dynamic_pointer_cast<SkelVertexData>(
-            edge_1->getVertexSrc()->getData());
+        SkelVertexData* data_1_src = SkelVertexData::of(edge_1->getVertexSrc());
         ArcSPtr arc_1_src = data_1_src->getArc();
         if (KernelWrapper::orientation(arc_1_src->line(), line_normal_1) > 0) {
             inside_bounds = false;
@@ -897,8 +1320,7 @@ Point3SPtr SimpleStraightSkel::crashAt(EdgeSPtr edge_1, EdgeSPtr edge_2) {
     }
     if (!(facet_1_dst == edge_2->getFacetL() ||
             facet_1_dst == edge_2->getFacetR())) {
-        SkelVertexDataSPtr data_1_dst = std::dynamic_pointer_cast<SkelVertexData>(
-            edge_1->getVertexDst()->getData());
+        SkelVertexData* data_1_dst = SkelVertexData::of(edge_1->getVertexDst());
         ArcSPtr arc_1_dst = data_1_dst->getArc();
         if (KernelWrapper::orientation(arc_1_dst->line(), line_normal_1) < 0) {
             inside_bounds = false;
@@ -911,8 +1333,7 @@ Point3SPtr SimpleStraightSkel::crashAt(EdgeSPtr edge_1, EdgeSPtr edge_2) {
     }
     if (!(facet_2_src == edge_1->getFacetL() ||
             facet_2_src == edge_1->getFacetR())) {
-        SkelVertexDataSPtr data_2_src = std::dynamic_pointer_cast<SkelVertexData>(
-            edge_2->getVertexSrc()->getData());
+        SkelVertexData* data_2_src = SkelVertexData::of(edge_2->getVertexSrc());
         ArcSPtr arc_2_src = data_2_src->getArc();
         if (KernelWrapper::orientation(arc_2_src->line(), line_normal_2) > 0) {
             inside_bounds = false;
@@ -920,8 +1341,7 @@ Point3SPtr SimpleStraightSkel::crashAt(EdgeSPtr edge_1, EdgeSPtr edge_2) {
     }
     if (!(facet_2_dst == edge_1->getFacetL() ||
             facet_2_dst == edge_1->getFacetR())) {
-        SkelVertexDataSPtr data_2_dst = std::dynamic_pointer_cast<SkelVertexData>(
-            edge_2->getVertexDst()->getData());
+        SkelVertexData* data_2_dst = SkelVertexData::of(edge_2->getVertexDst());
         ArcSPtr arc_2_dst = data_2_dst->getArc();
         if (KernelWrapper::orientation(arc_2_dst->line(), line_normal_2) < 0) {
             inside_bounds = false;
@@ -940,240 +1360,333 @@ double SimpleStraightSkel::offsetDist(FacetSPtr facet, Point3SPtr point) {
         result *= -1.0;
     }
     if (facet->hasData()) {
-        double speed = std::dynamic_pointer_cast<SkelFacetData>(
-                facet->getData())->getSpeed();
+        double speed = SkelFacetData::of(facet)->getSpeed();
         result /= speed;
     }
     return result;
 }
 
 
-EdgeEventSPtr SimpleStraightSkel::nextEdgeEvent(PolyhedronSPtr polyhedron, double offset) {
-    ReadLock l(polyhedron->mutex());
+EdgeEventSPtr SimpleStraightSkel::nextEdgeEvent(EdgeSPtr edge, double offset) {
     EdgeEventSPtr result = EdgeEventSPtr();
     double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
-    while (it_e != polyhedron->edges().end()) {
-        EdgeSPtr edge = *it_e++;
-        VertexSPtr vertex_src = edge->getVertexSrc();
-        VertexSPtr vertex_dst = edge->getVertexDst();
-        if (vertex_src->getPoint() == vertex_dst->getPoint()) {
-            continue;
+    VertexSPtr vertex_src = edge->getVertexSrc();
+    VertexSPtr vertex_dst = edge->getVertexDst();
+    if (vertex_src->isCoincident(vertex_dst)) {
+        return result;
+    }
+    FacetSPtr facet_l = edge->getFacetL();
+    FacetSPtr facet_r = edge->getFacetR();
+    if (isTriangle(facet_l, edge) || isTriangle(facet_r, edge)) {
+        // triangle event
+        return result;
+    }
+    Point3SPtr point = vanishesAt(edge);
+    if (!point) {
+        return result;
+    }
+    FacetSPtr facet_src = getFacetSrc(edge);
+    FacetSPtr facet_dst = getFacetDst(edge);
+    // This does not work when there is more than one edge between both facets.
+    // EdgeSPtr edge_2 = facet_src->findEdge(facet_dst);
+    bool split_event = false;
+    std::list<EdgeSPtr> edges_2 = facet_src->findEdges(facet_dst);
+    std::list<EdgeSPtr>::iterator it_e2 = edges_2.begin();
+    while (it_e2 != edges_2.end()) {
+        EdgeSPtr edge_2 = *it_e2++;
+        bool split_event_current = true;
+        SkelEdgeData* data_2 = SkelEdgeData::of(edge_2);
+        Vector3SPtr normal_2 = KernelFactory::createVector3(data_2->getSheet()->getPlane());
+        Line3SPtr line_normal_2 = KernelFactory::createLine3(point, normal_2);
+        if (KernelWrapper::orientation(line(edge_2), line_normal_2) < 0) {
+            // out of bounded area
+            split_event_current = false;
+        }
+        SkelVertexData* data_2_src = SkelVertexData::of(edge_2->getVertexSrc());
+        ArcSPtr arc_2_src = data_2_src->getArc();
+        if (KernelWrapper::orientation(arc_2_src->line(), line_normal_2) > 0) {
+            // out of bounded area
+            split_event_current = false;
         }
-        FacetSPtr facet_l = edge->getFacetL();
-        FacetSPtr facet_r = edge->getFacetR();
-        if (isTriangle(facet_l, edge) || isTriangle(facet_r, edge)) {
-            // triangle event
-            continue;
-        }
-        Point3SPtr point = vanishesAt(edge);
-        if (!point) {
-            continue;
-        }
-        FacetSPtr facet_src = getFacetSrc(edge);
-        FacetSPtr facet_dst = getFacetDst(edge);
-        // This does not work when there is more than one edge between both facets.
-        // EdgeSPtr edge_2 = facet_src->findEdge(facet_dst);
-        bool split_event = false;
-        std::list<EdgeSPtr> edges_2 = facet_src->findEdges(facet_dst);
-        std::list<EdgeSPtr>::iterator it_e2 = edges_2.begin();
-        while (it_e2 != edges_2.end()) {
-            EdgeSPtr edge_2 = *it_e2++;
-            bool split_event_current = true;
-            SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(edge_2->getData());
-            Vector3SPtr normal_2 = KernelFactory::createVector3(data_2->getSheet()->getPlane());
-            Line3SPtr line_normal_2 = KernelFactory::createLine3(point, normal_2);
-            if (KernelWrapper::orientation(line(edge_2), line_normal_2) < 0) {
-                // out of bounded area
-                split_event_current = false;
-            }
-            SkelVertexDataSPtr data_2_src = std::dynamic_pointer_cast<SkelVertexData>(
-                edge_2->getVertexSrc()->getData());
-            ArcSPtr arc_2_src = data_2_src->getArc();
-            if (KernelWrapper::orientation(arc_2_src->line(), line_normal_2) > 0) {
-                // out of bounded area
-                split_event_current = false;
-            }
-            SkelVertexDataSPtr data_2_dst = std::dynamic_pointer_cast<SkelVertexData>(
-                edge_2->getVertexDst()->getData());
-            ArcSPtr arc_2_dst = data_2_dst->getArc();
-            if (KernelWrapper::orientation(arc_2_dst->line(), line_normal_2) < 0) {
-                // out of bounded area
-                split_event_current = false;
-            }
-            if (split_event_current) {
-                split_event = true;
-                break;
-            }
-        }
-        if (split_event) {
-            continue;
-        }
-        // edge merge event
-        EdgeSPtr edge_prev = edge->prev(facet_l);
-        EdgeSPtr edge_next = edge->next(facet_l)->next(facet_l);
-        if (edge_prev->hasSameFacets(edge_next)) {
-            continue;
-        }
-        edge_prev = edge->prev(facet_l)->prev(facet_l);
-        edge_next = edge->next(facet_l);
-        if (edge_prev->hasSameFacets(edge_next)) {
-            continue;
-        }
-        edge_prev = edge->prev(facet_r);
-        edge_next = edge->next(facet_r)->next(facet_r);
-        if (edge_prev->hasSameFacets(edge_next)) {
-            continue;
+        SkelVertexData* data_2_dst = SkelVertexData::of(edge_2->getVertexDst());
+        ArcSPtr arc_2_dst = data_2_dst->getArc();
+        if (KernelWrapper::orientation(arc_2_dst->line(), line_normal_2) < 0) {
+            // out of bounded area
+            split_event_current = false;
         }
-        edge_prev = edge->prev(facet_r)->prev(facet_r);
-        edge_next = edge->next(facet_r);
-        if (edge_prev->hasSameFacets(edge_next)) {
-            continue;
+        if (split_event_current) {
+            split_event = true;
+            break;
         }
+    }
+    if (split_event) {
+        return result;
+    }
+    // edge merge event
+    EdgeSPtr edge_prev = edge->prev(facet_l);
+    EdgeSPtr edge_next = edge->next(facet_l)->next(facet_l);
+    if (edge_prev->hasSameFacets(edge_next)) {
+        return result;
+    }
+    edge_prev = edge->prev(facet_l)->prev(facet_l);
+    edge_next = edge->next(facet_l);
+    if (edge_prev->hasSameFacets(edge_next)) {
+        return result;
+    }
+    edge_prev = edge->prev(facet_r);
+    edge_next = edge->next(facet_r)->next(facet_r);
+    if (edge_prev->hasSameFacets(edge_next)) {
+        return result;
+    }
+    edge_prev = edge->prev(facet_r)->prev(facet_r);
+    edge_next = edge->next(facet_r);
+    if (edge_prev->hasSameFacets(edge_next)) {
+        return result;
+    }
 
-        double offset_event = offsetDist(facet_l, point);
-        if (offset_event > offset_max) {
-            NodeSPtr node;
-            if (!result) {
-                node = Node::create(point);
-                result = EdgeEvent::create();
-                result->setNode(node);
+    double offset_event = offsetDist(facet_l, point);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = EdgeEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setEdge(edge);
+        SkelVertexData* data_src = SkelVertexData::of(edge->getVertexSrc());
+        SkelVertexData* data_dst = SkelVertexData::of(edge->getVertexDst());
+        node->addArc(data_src->getArc());
+        node->addArc(data_dst->getArc());
+        SkelEdgeData* data_edge = SkelEdgeData::of(edge);
+        node->addSheet(data_edge->getSheet());
+        offset_max = offset_event;
+    }
+    return result;
+}
+
+EdgeEventSPtr SimpleStraightSkel::nextEdgeEvent(PolyhedronSPtr polyhedron, double offset) {
+    ReadLock l(polyhedron->mutex());
+    EdgeEventSPtr result = EdgeEventSPtr();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        EdgeEventSPtr event = nextEdgeEvent(edge, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
             }
-            node = result->getNode();
-            node->clear();
-            node->setOffset(offset + offset_event);
-            node->setPoint(point);
-            result->setEdge(edge);
-            SkelVertexDataSPtr data_src = std::dynamic_pointer_cast<SkelVertexData>(
-                    edge->getVertexSrc()->getData());
-            SkelVertexDataSPtr data_dst = std::dynamic_pointer_cast<SkelVertexData>(
-                    edge->getVertexDst()->getData());
-            node->addArc(data_src->getArc());
-            node->addArc(data_dst->getArc());
-            SkelEdgeDataSPtr data_edge = std::dynamic_pointer_cast<SkelEdgeData>(
-                    edge->getData());
-            node->addSheet(data_edge->getSheet());
-            offset_max = offset_event;
         }
     }
     return result;
 }
 
+EdgeMergeEventSPtr SimpleStraightSkel::nextEdgeMergeEvent(EdgeSPtr edge, double offset) {
+    EdgeMergeEventSPtr result = EdgeMergeEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    VertexSPtr vertex_src = edge->getVertexSrc();
+    VertexSPtr vertex_dst = edge->getVertexDst();
+    if (vertex_src->isCoincident(vertex_dst)) {
+        return result;
+    }
+    FacetSPtr facet_l = edge->getFacetL();
+    FacetSPtr facet_r = edge->getFacetR();
+    if (isTriangle(facet_l, edge) || isTriangle(facet_r, edge)) {
+        // triangle event
+        return result;
+    }
+    FacetSPtr facet_other = edge->getFacetL();
+    EdgeSPtr edge_next = edge->next(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->prev(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->next(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->prev(facet_other);
+    if (edge_next == edge) {
+        // dbl edge merge event
+        return result;
+    }
+    facet_other = edge->getFacetR();
+    edge_next = edge->prev(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->next(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->prev(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->next(facet_other);
+    if (edge_next == edge) {
+        // dbl edge merge event
+        return result;
+    }
+    FacetSPtr facet = FacetSPtr();
+    EdgeSPtr edge_1 = EdgeSPtr();
+    EdgeSPtr edge_2 = EdgeSPtr();
+    EdgeSPtr edge_prev = edge->prev(facet_l);
+    edge_next = edge->next(facet_l)->next(facet_l);
+    if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
+        facet = facet_l;
+        edge_1 = edge_prev;
+        edge_2 = edge_next;
+    }
+    edge_prev = edge->prev(facet_l)->prev(facet_l);
+    edge_next = edge->next(facet_l);
+    if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
+        facet = facet_l;
+        edge_1 = edge_prev;
+        edge_2 = edge_next;
+    }
+    edge_prev = edge->prev(facet_r);
+    edge_next = edge->next(facet_r)->next(facet_r);
+    if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
+        facet = facet_r;
+        edge_1 = edge_prev;
+        edge_2 = edge_next;
+    }
+    edge_prev = edge->prev(facet_r)->prev(facet_r);
+    edge_next = edge->next(facet_r);
+    if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
+        facet = facet_r;
+        edge_1 = edge_prev;
+        edge_2 = edge_next;
+    }
+    if (!(facet && edge_1 && edge_2)) {
+        return result;
+    }
+
+    Point3SPtr point = vanishesAt(edge);
+    if (!point) {
+        return result;
+    }
+    double offset_event = offsetDist(facet_l, point);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = EdgeMergeEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setFacet(facet);
+        result->setEdge1(edge_1);
+        result->setEdge2(edge_2);
+        EdgeSPtr edge_toremove_1 = edge_1->next(facet);
+        EdgeSPtr edge_toremove_2 = edge_toremove_1->next(facet);
+        SkelVertexData* data_vertex = SkelVertexData::of(edge_toremove_1->src(facet));
+        node->addArc(data_vertex->getArc());
+        data_vertex = SkelVertexData::of(edge_toremove_1->dst(facet));
+        node->addArc(data_vertex->getArc());
+        data_vertex = SkelVertexData::of(edge_toremove_2->dst(facet));
+        node->addArc(data_vertex->getArc());
+        SkelEdgeData* data_edge = SkelEdgeData::of(edge_toremove_1);
+        node->addSheet(data_edge->getSheet());
+        data_edge = SkelEdgeData::of(edge_toremove_2);
+        node->addSheet(data_edge->getSheet());
+        offset_max = offset_event;
+    }
+    return result;
+}
+
 EdgeMergeEventSPtr SimpleStraightSkel::nextEdgeMergeEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
     EdgeMergeEventSPtr result = EdgeMergeEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
-        VertexSPtr vertex_src = edge->getVertexSrc();
-        VertexSPtr vertex_dst = edge->getVertexDst();
-        if (vertex_src->getPoint() == vertex_dst->getPoint()) {
-            continue;
-        }
-        FacetSPtr facet_l = edge->getFacetL();
-        FacetSPtr facet_r = edge->getFacetR();
-        if (isTriangle(facet_l, edge) || isTriangle(facet_r, edge)) {
-            // triangle event
-            continue;
-        }
-        FacetSPtr facet_other = edge->getFacetL();
-        EdgeSPtr edge_next = edge->next(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->prev(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->next(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->prev(facet_other);
-        if (edge_next == edge) {
-            // dbl edge merge event
-            continue;
-        }
-        facet_other = edge->getFacetR();
-        edge_next = edge->prev(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->next(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->prev(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->next(facet_other);
-        if (edge_next == edge) {
-            // dbl edge merge event
-            continue;
+        EdgeMergeEventSPtr event = nextEdgeMergeEvent(edge, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
+            }
         }
-        FacetSPtr facet = FacetSPtr();
-        EdgeSPtr edge_1 = EdgeSPtr();
-        EdgeSPtr edge_2 = EdgeSPtr();
-        EdgeSPtr edge_prev = edge->prev(facet_l);
-        edge_next = edge->next(facet_l)->next(facet_l);
-        if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
-            facet = facet_l;
-            edge_1 = edge_prev;
-            edge_2 = edge_next;
-        }
-        edge_prev = edge->prev(facet_l)->prev(facet_l);
-        edge_next = edge->next(facet_l);
-        if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
-            facet = facet_l;
-            edge_1 = edge_prev;
-            edge_2 = edge_next;
-        }
-        edge_prev = edge->prev(facet_r);
-        edge_next = edge->next(facet_r)->next(facet_r);
-        if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
-            facet = facet_r;
-            edge_1 = edge_prev;
-            edge_2 = edge_next;
-        }
-        edge_prev = edge->prev(facet_r)->prev(facet_r);
-        edge_next = edge->next(facet_r);
-        if (edge_prev->hasSameFacets(edge_next) && edge_prev != edge_next) {
-            facet = facet_r;
-            edge_1 = edge_prev;
-            edge_2 = edge_next;
-        }
-        if (!(facet && edge_1 && edge_2)) {
-            continue;
+    }
+    return result;
+}
+
+TriangleEventSPtr SimpleStraightSkel::nextTriangleEvent(EdgeSPtr edge, double offset) {
+    TriangleEventSPtr result = TriangleEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    if (edge->getVertexSrc()->isCoincident(edge->getVertexDst())) {
+        return result;
+    }
+    if (isTetrahedron(edge)) {
+        // tetrahedron event
+        return result;
+    }
+    FacetSPtr facet;
+    if (isTriangle(edge->getFacetL(), edge)) {
+        facet = edge->getFacetL();
+    } else if (isTriangle(edge->getFacetR(), edge)) {
+        facet = edge->getFacetR();
+    } else {
+        return result;
+    }
+
+    bool dbl_triangle_event = false;
+    EdgeSPtr edge_tmp = edge;
+    for (unsigned int i = 0; i < 3; i++) {
+        FacetSPtr facet_tmp_l = edge_tmp->getFacetL();
+        FacetSPtr facet_tmp_r = edge_tmp->getFacetR();
+        if (facet_tmp_l && facet_tmp_r) {
+            if (isTriangle(facet_tmp_l, edge_tmp) &&
+                    isTriangle(facet_tmp_r, edge_tmp)) {
+                dbl_triangle_event = true;
+                break;
+            }
         }
+        edge_tmp = edge_tmp->next(facet);
+    }
+    if (dbl_triangle_event) {
+        return result;
+    }
 
-        Point3SPtr point = vanishesAt(edge);
-        if (!point) {
-            continue;
+    Point3SPtr point = vanishesAt(edge);
+    if (!point) {
+        return result;
+    }
+    if ((KernelWrapper::side(edge->getFacetL()->plane(), point) > 0.0) ||
+            KernelWrapper::side(edge->getFacetR()->plane(), point) > 0.0) {
+        // triangle may not be a hole
+        // after pierce event
+        return result;
+    }
+    double offset_event = offsetDist(facet, point);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = TriangleEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setFacet(facet);
+        result->setEdgeBegin(edge);
+
+        VertexSPtr vertices[3];
+        result->getVertices(vertices);
+        for (unsigned int i = 0; i < 3; i++) {
+            SkelVertexData* data = SkelVertexData::of(vertices[i]);
+            ArcSPtr arc = data->getArc();
+            node->addArc(arc);
         }
-        double offset_event = offsetDist(facet_l, point);
-        if (offset_event > offset_max) {
-            NodeSPtr node;
-            if (!result) {
-                node = Node::create(point);
-                result = EdgeMergeEvent::create();
-                result->setNode(node);
-            }
-            node = result->getNode();
-            node->clear();
-            node->setOffset(offset + offset_event);
-            node->setPoint(point);
-            result->setFacet(facet);
-            result->setEdge1(edge_1);
-            result->setEdge2(edge_2);
-            EdgeSPtr edge_toremove_1 = edge_1->next(facet);
-            EdgeSPtr edge_toremove_2 = edge_toremove_1->next(facet);
-            SkelVertexDataSPtr data_vertex = std::dynamic_pointer_cast<SkelVertexData>(
-                    edge_toremove_1->src(facet)->getData());
-            node->addArc(data_vertex->getArc());
-            data_vertex = std::dynamic_pointer_cast<SkelVertexData>(
-                    edge_toremove_1->dst(facet)->getData());
-            node->addArc(data_vertex->getArc());
-            data_vertex = std::dynamic_pointer_cast<SkelVertexData>(
-                    edge_toremove_2->dst(facet)->getData());
-            node->addArc(data_vertex->getArc());
-            SkelEdgeDataSPtr data_edge = std::dynamic_pointer_cast<SkelEdgeData>(
-                    edge_toremove_1->getData());
-            node->addSheet(data_edge->getSheet());
-            data_edge = std::dynamic_pointer_cast<SkelEdgeData>(
-                    edge_toremove_2->getData());
-            node->addSheet(data_edge->getSheet());
-            offset_max = offset_event;
+        EdgeSPtr edges[3];
+        result->getEdges(edges);
+        for (unsigned int i = 0; i < 3; i++) {
+            SkelEdgeData* data = SkelEdgeData::of(edges[i]);
+            SheetSPtr sheet = data->getSheet();
+            node->addSheet(sheet);
         }
+
+        offset_max = offset_event;
     }
     return result;
 }
@@ -1181,633 +1694,724 @@ EdgeMergeEventSPtr SimpleStraightSkel::nextEdgeMergeEvent(PolyhedronSPtr polyhed
 TriangleEventSPtr SimpleStraightSkel::nextTriangleEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
     TriangleEventSPtr result = TriangleEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
-        if (edge->getVertexSrc()->getPoint() == edge->getVertexDst()->getPoint()) {
-            continue;
+        TriangleEventSPtr event = nextTriangleEvent(edge, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
+            }
         }
-        if (isTetrahedron(edge)) {
-            // tetrahedron event
-            continue;
+    }
+    return result;
+}
+
+DblEdgeMergeEventSPtr SimpleStraightSkel::nextDblEdgeMergeEvent(EdgeSPtr edge, double offset) {
+    DblEdgeMergeEventSPtr result = DblEdgeMergeEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    if (!isReflex(edge)) {
+        return result;
+    }
+
+    bool is_dbl_edge_merge_event = false;
+    FacetSPtr facet_1;
+    EdgeSPtr edge_11;
+    EdgeSPtr edge_12;
+    FacetSPtr facet_2;
+    EdgeSPtr edge_21;
+    EdgeSPtr edge_22;
+    FacetSPtr facet_other = edge->getFacetL();
+    EdgeSPtr edge_next = edge->next(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->prev(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->next(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->prev(facet_other);
+    if (edge_next == edge) {
+        is_dbl_edge_merge_event = true;
+        facet_1 = edge->getFacetL();
+        edge_11 = edge->prev(facet_1);
+        edge_12 = edge->next(facet_1)->next(facet_1);
+        facet_2 = edge->getFacetR();
+        edge_21 = edge->prev(facet_2);
+        edge_22 = edge->next(facet_2)->next(facet_2);
+    }
+    facet_other = edge->getFacetR();
+    edge_next = edge->prev(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->next(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->prev(facet_other);
+    facet_other = edge_next->other(facet_other);
+    edge_next = edge_next->next(facet_other);
+    if (edge_next == edge) {
+        is_dbl_edge_merge_event = true;
+        facet_1 = edge->getFacetR();
+        edge_11 = edge->prev(facet_1)->prev(facet_1);
+        edge_12 = edge->next(facet_1);
+        facet_2 = edge->getFacetL();
+        edge_21 = edge->prev(facet_2)->prev(facet_2);
+        edge_22 = edge->next(facet_2);
+    }
+    if (edge_11 == edge_12 || edge_21 == edge_22) {
+        // double triangle event
+        return result;
+    }
+    if (!is_dbl_edge_merge_event) {
+        return result;
+    }
+
+    Point3SPtr point = vanishesAt(edge);
+    if (!point) {
+        return result;
+    }
+    double offset_event = offsetDist(edge->getFacetL(), point);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = DblEdgeMergeEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setFacet1(facet_1);
+        result->setEdge11(edge_11);
+        result->setEdge12(edge_12);
+        result->setFacet2(facet_2);
+        result->setEdge21(edge_21);
+        result->setEdge22(edge_22);
+        VertexSPtr vertices[4];
+        result->getVertices(vertices);
+        for (unsigned int i = 0; i < 4; i++) {
+            SkelVertexData* vertex_data = SkelVertexData::of(vertices[i]);
+            ArcSPtr arc = vertex_data->getArc();
+            node->addArc(arc);
         }
-        FacetSPtr facet;
-        if (isTriangle(edge->getFacetL(), edge)) {
-            facet = edge->getFacetL();
-        } else if (isTriangle(edge->getFacetR(), edge)) {
-            facet = edge->getFacetR();
-        } else {
-            continue;
+        EdgeSPtr edges[4];
+        result->getEdges(edges);
+        for (unsigned int i = 0; i < 4; i++) {
+            SkelEdgeData* edge_data = SkelEdgeData::of(edges[i]);
+            SheetSPtr sheet = edge_data->getSheet();
+            node->addSheet(sheet);
         }
+        offset_max = offset_event;
+    }
+    return result;
+}
 
-        bool dbl_triangle_event = false;
-        EdgeSPtr edge_tmp = edge;
-        for (unsigned int i = 0; i < 3; i++) {
-            FacetSPtr facet_tmp_l = edge_tmp->getFacetL();
-            FacetSPtr facet_tmp_r = edge_tmp->getFacetR();
-            if (facet_tmp_l && facet_tmp_r) {
-                if (isTriangle(facet_tmp_l, edge_tmp) &&
-                        isTriangle(facet_tmp_r, edge_tmp)) {
-                    dbl_triangle_event = true;
-                    break;
-                }
+DblEdgeMergeEventSPtr SimpleStraightSkel::nextDblEdgeMergeEvent(PolyhedronSPtr polyhedron, double offset) {
+    ReadLock l(polyhedron->mutex());
+    DblEdgeMergeEventSPtr result = DblEdgeMergeEventSPtr();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        DblEdgeMergeEventSPtr event = nextDblEdgeMergeEvent(edge, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
             }
-            edge_tmp = edge_tmp->next(facet);
-        }
-        if (dbl_triangle_event) {
-            continue;
         }
+    }
+    return result;
+}
 
-        Point3SPtr point = vanishesAt(edge);
-        if (!point) {
-            continue;
+DblTriangleEventSPtr SimpleStraightSkel::nextDblTriangleEvent(EdgeSPtr edge, double offset) {
+    DblTriangleEventSPtr result = DblTriangleEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    if (isTetrahedron(edge)) {
+        return result;
+    }
+    FacetSPtr facet_l = edge->getFacetL();
+    FacetSPtr facet_r = edge->getFacetR();
+    if (!facet_l || !facet_r) {
+        return result;
+    }
+    if (!(isTriangle(facet_l, edge) &&
+            isTriangle(facet_r, edge))) {
+        return result;
+    }
+
+    Point3SPtr point = vanishesAt(edge);
+    if (!point) {
+        return result;
+    }
+    double offset_event = offsetDist(edge->getFacetL(), point);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = DblTriangleEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setEdge(edge);
+
+        VertexSPtr vertices[4];
+        result->getVertices(vertices);
+        for (unsigned int i = 0; i < 4; i++) {
+            SkelVertexData* data = SkelVertexData::of(vertices[i]);
+            ArcSPtr arc = data->getArc();
+            node->addArc(arc);
         }
-        if ((KernelWrapper::side(edge->getFacetL()->plane(), point) > 0.0) ||
-                KernelWrapper::side(edge->getFacetR()->plane(), point) > 0.0) {
-            // triangle may not be a hole
-            // after pierce event
-            continue;
+        EdgeSPtr edges[5];
+        result->getEdges(edges);
+        for (unsigned int i = 0; i < 5; i++) {
+            SkelEdgeData* data = SkelEdgeData::of(edges[i]);
+            SheetSPtr sheet = data->getSheet();
+            node->addSheet(sheet);
         }
-        double offset_event = offsetDist(facet, point);
-        if (offset_event > offset_max) {
-            NodeSPtr node;
-            if (!result) {
-                node = Node::create(point);
-                result = TriangleEvent::create();
-                result->setNode(node);
-            }
-            node = result->getNode();
-            node->clear();
-            node->setOffset(offset + offset_event);
-            node->setPoint(point);
-            result->setFacet(facet);
-            result->setEdgeBegin(edge);
-
-            VertexSPtr vertices[3];
-            result->getVertices(vertices);
-            for (unsigned int i = 0; i < 3; i++) {
-                SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertices[i]->getData());
-                ArcSPtr arc = data->getArc();
-                node->addArc(arc);
-            }
-            EdgeSPtr edges[3];
-            result->getEdges(edges);
-            for (unsigned int i = 0; i < 3; i++) {
-                SkelEdgeDataSPtr data = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edges[i]->getData());
-                SheetSPtr sheet = data->getSheet();
-                node->addSheet(sheet);
+
+        offset_max = offset_event;
+    }
+    return result;
+}
+
+DblTriangleEventSPtr SimpleStraightSkel::nextDblTriangleEvent(PolyhedronSPtr polyhedron, double offset) {
+    ReadLock l(polyhedron->mutex());
+    DblTriangleEventSPtr result = DblTriangleEventSPtr();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        DblTriangleEventSPtr event = nextDblTriangleEvent(edge, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
             }
+        }
+    }
+    return result;
+}
 
-            offset_max = offset_event;
+TetrahedronEventSPtr SimpleStraightSkel::nextTetrahedronEvent(EdgeSPtr edge, double offset) {
+    TetrahedronEventSPtr result = TetrahedronEventSPtr();
+    if (!isTetrahedron(edge)) {
+        return result;
+    }
+    double offset_max = -std::numeric_limits<double>::max();
+    FacetSPtr facet = edge->getFacetL();
+    Point3SPtr point = vanishesAt(edge);
+    if (!point) {
+        return result;
+    }
+    double offset_event = offsetDist(facet, point);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = TetrahedronEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setEdgeBegin(edge);
+        VertexSPtr vertices[4];
+        result->getVertices(vertices);
+        for (unsigned int i = 0; i < 4; i++) {
+            SkelVertexData* vertex_data = SkelVertexData::of(vertices[i]);
+            ArcSPtr arc = vertex_data->getArc();
+            node->addArc(arc);
+        }
+        EdgeSPtr edges[6];
+        result->getEdges(edges);
+        for (unsigned int i = 0; i < 6; i++) {
+            SkelEdgeData* edge_data = SkelEdgeData::of(edges[i]);
+            SheetSPtr sheet = edge_data->getSheet();
+            node->addSheet(sheet);
         }
+
+        offset_max = offset_event;
     }
     return result;
 }
 
-DblEdgeMergeEventSPtr SimpleStraightSkel::nextDblEdgeMergeEvent(PolyhedronSPtr polyhedron, double offset) {
+TetrahedronEventSPtr SimpleStraightSkel::nextTetrahedronEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
-    DblEdgeMergeEventSPtr result = DblEdgeMergeEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    TetrahedronEventSPtr result = TetrahedronEventSPtr();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
-        if (!isReflex(edge)) {
+        TetrahedronEventSPtr event = nextTetrahedronEvent(edge, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
+            }
+        }
+    }
+    return result;
+}
+
+VertexEventSPtr SimpleStraightSkel::nextVertexEvent(VertexSPtr vertex_1, double offset) {
+    VertexEventSPtr result = VertexEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    if (isConvex(vertex_1)) {
+        return result;
+    }
+
+    std::list<VertexSPtr> vertices_2;
+    std::list<FacetHandle>::iterator it_f = vertex_1->facets().begin();
+    while (it_f != vertex_1->facets().end()) {
+        Facet* facet = (*it_f++).get();
+        vertices_2.insert(vertices_2.end(),
+                facet->vertices().begin(), facet->vertices().end());
+    }
+    std::list<VertexSPtr>::iterator it_v2 = vertices_2.begin();
+    while (it_v2 != vertices_2.end()) {
+        VertexSPtr vertex_2 = *it_v2++;
+        if (vertex_1 == vertex_2) {
+            continue;
+        }
+        if (vertex_1->isCoincident(vertex_2)) {
+            continue;
+        }
+        if (isConvex(vertex_2)) {
+            continue;
+        }
+
+        if (vertex_1->findEdge(vertex_2)) {
+            // edge event
             continue;
         }
 
-        bool is_dbl_edge_merge_event = false;
         FacetSPtr facet_1;
-        EdgeSPtr edge_11;
-        EdgeSPtr edge_12;
         FacetSPtr facet_2;
-        EdgeSPtr edge_21;
-        EdgeSPtr edge_22;
-        FacetSPtr facet_other = edge->getFacetL();
-        EdgeSPtr edge_next = edge->next(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->prev(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->next(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->prev(facet_other);
-        if (edge_next == edge) {
-            is_dbl_edge_merge_event = true;
-            facet_1 = edge->getFacetL();
-            edge_11 = edge->prev(facet_1);
-            edge_12 = edge->next(facet_1)->next(facet_1);
-            facet_2 = edge->getFacetR();
-            edge_21 = edge->prev(facet_2);
-            edge_22 = edge->next(facet_2)->next(facet_2);
-        }
-        facet_other = edge->getFacetR();
-        edge_next = edge->prev(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->next(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->prev(facet_other);
-        facet_other = edge_next->other(facet_other);
-        edge_next = edge_next->next(facet_other);
-        if (edge_next == edge) {
-            is_dbl_edge_merge_event = true;
-            facet_1 = edge->getFacetR();
-            edge_11 = edge->prev(facet_1)->prev(facet_1);
-            edge_12 = edge->next(facet_1);
-            facet_2 = edge->getFacetL();
-            edge_21 = edge->prev(facet_2)->prev(facet_2);
-            edge_22 = edge->next(facet_2);
-        }
-        if (edge_11 == edge_12 || edge_21 == edge_22) {
-            // double triangle event
+        int num_equal_facets = 0;
+        std::list<FacetHandle>::iterator it_f1 = vertex_1->facets().begin();
+        while (it_f1 != vertex_1->facets().end()) {
+            FacetHandle facet_1_h = *it_f1++;
+            std::list<FacetHandle>::iterator it_f2 = vertex_2->facets().begin();
+            while (it_f2 != vertex_2->facets().end()) {
+                FacetHandle facet_2_h = *it_f2++;
+                if (facet_1_h == facet_2_h) {
+                    if (num_equal_facets == 0) {
+                        facet_1 = facet_1_h.lock();
+                    } else {
+                        facet_2 = facet_2_h.lock();
+                    }
+                    num_equal_facets++;
+                }
+            }
+        }
+        if (num_equal_facets != 2) {
             continue;
         }
-        if (!is_dbl_edge_merge_event) {
+        if (facet_1->next(vertex_1) != facet_2) {
+            FacetSPtr facet_tmp = facet_1;
+            facet_1 = facet_2;
+            facet_2 = facet_tmp;
+        }
+        if (vertex_1->next(facet_1)->next(facet_1) == vertex_2 ||
+                vertex_1->next(facet_2)->next(facet_2) == vertex_2 ||
+                vertex_1->prev(facet_1)->prev(facet_1) == vertex_2 ||
+                vertex_1->prev(facet_2)->prev(facet_2) == vertex_2) {
+            // edge merge event
+            continue;
+        }
+
+        EdgeSPtr edge_11 = EdgeSPtr();
+        EdgeSPtr edge_12 = EdgeSPtr();
+        std::list<EdgeHandle>::iterator it_e1 = vertex_1->edges().begin();
+        while (it_e1 != vertex_1->edges().end()) {
+            EdgeHandle edge_1 = *it_e1++;
+            FacetSPtr facet_1l = edge_1->getFacetL();
+            FacetSPtr facet_1r = edge_1->getFacetR();
+            if ((facet_1l == facet_1 && facet_1r != facet_2) ||
+                    (facet_1r == facet_1 && facet_1l != facet_2)) {
+                edge_11 = edge_1.lock();
+            } else if ((facet_1l == facet_2 && facet_1r != facet_1) ||
+                    (facet_1r == facet_2 && facet_1l != facet_1)) {
+                edge_12 = edge_1.lock();
+            }
+        }
+        EdgeSPtr edge_21 = EdgeSPtr();
+        EdgeSPtr edge_22 = EdgeSPtr();
+        std::list<EdgeHandle>::iterator it_e2 = vertex_2->edges().begin();
+        while (it_e2 != vertex_2->edges().end()) {
+            EdgeHandle edge_2 = *it_e2++;
+            FacetSPtr facet_2l = edge_2->getFacetL();
+            FacetSPtr facet_2r = edge_2->getFacetR();
+            if ((facet_2l == facet_1 && facet_2r != facet_2) ||
+                    (facet_2r == facet_1 && facet_2l != facet_2)) {
+                edge_21 = edge_2.lock();
+            } else if ((facet_2l == facet_2 && facet_2r != facet_1) ||
+                    (facet_2r == facet_2 && facet_2l != facet_1)) {
+                edge_22 = edge_2.lock();
+            }
+        }
+        if (!((edge_11->next(vertex_1) == edge_12 && edge_22->next(vertex_2) == edge_21) ||
+                (edge_12->next(vertex_1) == edge_11 && edge_21->next(vertex_2) == edge_22))) {
+            // flip vertex event
+            continue;
+        }
+        bool conv_split_event = false;
+        FacetSPtr facet_1b = facet_2->next(vertex_1);
+        FacetSPtr facet_2b = facet_1->next(vertex_2);
+        EdgeSPtr edge_cur = edge_11->next(facet_1b);
+        while (edge_cur != edge_11) {
+            if ((edge_cur->getFacetL() == facet_1b && edge_cur->getFacetR() == facet_2b) ||
+                    (edge_cur->getFacetR() == facet_1b && edge_cur->getFacetL() == facet_2b)) {
+                conv_split_event = true;
+                break;
+            }
+            edge_cur = edge_cur->next(facet_1b);
+        }
+        if (conv_split_event) {
             continue;
         }
 
-        Point3SPtr point = vanishesAt(edge);
+        Point3SPtr point = crashAt(edge_11, edge_22);
         if (!point) {
             continue;
         }
-        double offset_event = offsetDist(edge->getFacetL(), point);
+        double offset_event = offsetDist(edge_11->getFacetL(), point);
         if (offset_event > offset_max) {
             NodeSPtr node;
             if (!result) {
                 node = Node::create(point);
-                result = DblEdgeMergeEvent::create();
+                result = VertexEvent::create();
                 result->setNode(node);
             }
             node = result->getNode();
             node->clear();
+            SkelVertexData* data_1 = SkelVertexData::of(vertex_1);
+            node->addArc(data_1->getArc());
+            SkelVertexData* data_2 = SkelVertexData::of(vertex_2);
+            node->addArc(data_2->getArc());
             node->setOffset(offset + offset_event);
             node->setPoint(point);
+            result->setVertex1(vertex_1);
+            result->setVertex2(vertex_2);
             result->setFacet1(facet_1);
-            result->setEdge11(edge_11);
-            result->setEdge12(edge_12);
             result->setFacet2(facet_2);
-            result->setEdge21(edge_21);
-            result->setEdge22(edge_22);
-            VertexSPtr vertices[4];
-            result->getVertices(vertices);
-            for (unsigned int i = 0; i < 4; i++) {
-                SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertices[i]->getData());
-                ArcSPtr arc = vertex_data->getArc();
-                node->addArc(arc);
-            }
-            EdgeSPtr edges[4];
-            result->getEdges(edges);
-            for (unsigned int i = 0; i < 4; i++) {
-                SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edges[i]->getData());
-                SheetSPtr sheet = edge_data->getSheet();
-                node->addSheet(sheet);
-            }
             offset_max = offset_event;
         }
     }
     return result;
 }
 
-DblTriangleEventSPtr SimpleStraightSkel::nextDblTriangleEvent(PolyhedronSPtr polyhedron, double offset) {
+VertexEventSPtr SimpleStraightSkel::nextVertexEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
-    DblTriangleEventSPtr result = DblTriangleEventSPtr();
+    VertexEventSPtr result = VertexEventSPtr();
+    util::SlotList<VertexSPtr>::iterator it_v1 = polyhedron->vertices().begin();
+    while (it_v1 != polyhedron->vertices().end()) {
+        VertexSPtr vertex_1 = *it_v1++;
+        VertexEventSPtr event = nextVertexEvent(vertex_1, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
+            }
+        }
+    }
+    return result;
+}
+
+FlipVertexEventSPtr SimpleStraightSkel::nextFlipVertexEvent(VertexSPtr vertex_1, double offset) {
+    FlipVertexEventSPtr result = FlipVertexEventSPtr();
     double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
-    while (it_e != polyhedron->edges().end()) {
-        EdgeSPtr edge = *it_e++;
-        if (isTetrahedron(edge)) {
+    if (isConvex(vertex_1)) {
+        return result;
+    }
+
+    std::list<VertexSPtr> vertices_2;
+    std::list<FacetHandle>::iterator it_f = vertex_1->facets().begin();
+    while (it_f != vertex_1->facets().end()) {
+        Facet* facet = (*it_f++).get();
+        vertices_2.insert(vertices_2.end(),
+                facet->vertices().begin(), facet->vertices().end());
+    }
+    std::list<VertexSPtr>::iterator it_v2 = vertices_2.begin();
+    while (it_v2 != vertices_2.end()) {
+        VertexSPtr vertex_2 = *it_v2++;
+        if (vertex_1 == vertex_2) {
             continue;
         }
-        FacetSPtr facet_l = edge->getFacetL();
-        FacetSPtr facet_r = edge->getFacetR();
-        if (!facet_l || !facet_r) {
+        if (vertex_1->isCoincident(vertex_2)) {
+            continue;
+        }
+        if (isConvex(vertex_2)) {
+            continue;
+        }
+
+        if (vertex_1->findEdge(vertex_2)) {
+            // edge event
+            continue;
+        }
+
+        FacetSPtr facet_1;
+        FacetSPtr facet_2;
+        int num_equal_facets = 0;
+        std::list<FacetHandle>::iterator it_f1 = vertex_1->facets().begin();
+        while (it_f1 != vertex_1->facets().end()) {
+            FacetHandle facet_1_h = *it_f1++;
+            std::list<FacetHandle>::iterator it_f2 = vertex_2->facets().begin();
+            while (it_f2 != vertex_2->facets().end()) {
+                FacetHandle facet_2_h = *it_f2++;
+                if (facet_1_h == facet_2_h) {
+                    if (num_equal_facets == 0) {
+                        facet_1 = facet_1_h.lock();
+                    } else {
+                        facet_2 = facet_2_h.lock();
+                    }
+                    num_equal_facets++;
+                }
+            }
+        }
+        if (num_equal_facets != 2) {
+            continue;
+        }
+        if (facet_1->next(vertex_1) != facet_2) {
+            FacetSPtr facet_tmp = facet_1;
+            facet_1 = facet_2;
+            facet_2 = facet_tmp;
+        }
+        if (vertex_1->next(facet_1)->next(facet_1) == vertex_2 ||
+                vertex_1->next(facet_2)->next(facet_2) == vertex_2 ||
+                vertex_1->prev(facet_1)->prev(facet_1) == vertex_2 ||
+                vertex_1->prev(facet_2)->prev(facet_2) == vertex_2) {
+            // edge merge event
             continue;
         }
-        if (!(isTriangle(facet_l, edge) &&
-                isTriangle(facet_r, edge))) {
+
+        EdgeSPtr edge_11 = EdgeSPtr();
+        EdgeSPtr edge_12 = EdgeSPtr();
+        std::list<EdgeHandle>::iterator it_e1 = vertex_1->edges().begin();
+        while (it_e1 != vertex_1->edges().end()) {
+            EdgeHandle edge_1 = *it_e1++;
+            FacetSPtr facet_1l = edge_1->getFacetL();
+            FacetSPtr facet_1r = edge_1->getFacetR();
+            if ((facet_1l == facet_1 && facet_1r != facet_2) ||
+                    (facet_1r == facet_1 && facet_1l != facet_2)) {
+                edge_11 = edge_1.lock();
+            } else if ((facet_1l == facet_2 && facet_1r != facet_1) ||
+                    (facet_1r == facet_2 && facet_1l != facet_1)) {
+                edge_12 = edge_1.lock();
+            }
+        }
+        EdgeSPtr edge_21 = EdgeSPtr();
+        EdgeSPtr edge_22 = EdgeSPtr();
+        std::list<EdgeHandle>::iterator it_e2 = vertex_2->edges().begin();
+        while (it_e2 != vertex_2->edges().end()) {
+            EdgeHandle edge_2 = *it_e2++;
+            FacetSPtr facet_2l = edge_2->getFacetL();
+            FacetSPtr facet_2r = edge_2->getFacetR();
+            if ((facet_2l == facet_1 && facet_2r != facet_2) ||
+                    (facet_2r == facet_1 && facet_2l != facet_2)) {
+                edge_21 = edge_2.lock();
+            } else if ((facet_2l == facet_2 && facet_2r != facet_1) ||
+                    (facet_2r == facet_2 && facet_2l != facet_1)) {
+                edge_22 = edge_2.lock();
+            }
+        }
+        if (!(edge_12->next(vertex_1) == edge_11 && edge_22->next(vertex_2) == edge_21)) {
+            // vertex event
+            continue;
+        }
+        bool conv_split_event = false;
+        FacetSPtr facet_1b = facet_2->next(vertex_1);
+        FacetSPtr facet_2b = facet_2->next(vertex_2);
+        EdgeSPtr edge_cur = edge_11->next(facet_1b);
+        while (edge_cur != edge_11) {
+            if ((edge_cur->getFacetL() == facet_1b && edge_cur->getFacetR() == facet_2b) ||
+                    (edge_cur->getFacetR() == facet_1b && edge_cur->getFacetL() == facet_2b)) {
+                conv_split_event = true;
+                break;
+            }
+            edge_cur = edge_cur->next(facet_1b);
+        }
+        if (conv_split_event) {
             continue;
         }
 
-        Point3SPtr point = vanishesAt(edge);
+        Point3SPtr point = crashAt(edge_11, edge_22);
         if (!point) {
             continue;
         }
-        double offset_event = offsetDist(edge->getFacetL(), point);
+        double offset_event = offsetDist(edge_11->getFacetL(), point);
         if (offset_event > offset_max) {
             NodeSPtr node;
             if (!result) {
                 node = Node::create(point);
-                result = DblTriangleEvent::create();
+                result = FlipVertexEvent::create();
                 result->setNode(node);
             }
             node = result->getNode();
             node->clear();
+            SkelVertexData* data_1 = SkelVertexData::of(vertex_1);
+            node->addArc(data_1->getArc());
+            SkelVertexData* data_2 = SkelVertexData::of(vertex_2);
+            node->addArc(data_2->getArc());
             node->setOffset(offset + offset_event);
             node->setPoint(point);
-            result->setEdge(edge);
-
-            VertexSPtr vertices[4];
-            result->getVertices(vertices);
-            for (unsigned int i = 0; i < 4; i++) {
-                SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertices[i]->getData());
-                ArcSPtr arc = data->getArc();
-                node->addArc(arc);
-            }
-            EdgeSPtr edges[5];
-            result->getEdges(edges);
-            for (unsigned int i = 0; i < 5; i++) {
-                SkelEdgeDataSPtr data = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edges[i]->getData());
-                SheetSPtr sheet = data->getSheet();
-                node->addSheet(sheet);
-            }
-
+            result->setVertex1(vertex_1);
+            result->setVertex2(vertex_2);
+            result->setFacet1(facet_1);
+            result->setFacet2(facet_2);
             offset_max = offset_event;
         }
     }
     return result;
 }
 
-TetrahedronEventSPtr SimpleStraightSkel::nextTetrahedronEvent(PolyhedronSPtr polyhedron, double offset) {
+FlipVertexEventSPtr SimpleStraightSkel::nextFlipVertexEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
-    TetrahedronEventSPtr result = TetrahedronEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
-    while (it_e != polyhedron->edges().end()) {
-        EdgeSPtr edge = *it_e++;
-        if (isTetrahedron(edge)) {
-            FacetSPtr facet = edge->getFacetL();
-            Point3SPtr point = vanishesAt(edge);
-            if (!point) {
-                continue;
-            }
-            double offset_event = offsetDist(facet, point);
-            if (offset_event > offset_max) {
-                NodeSPtr node;
-                if (!result) {
-                    node = Node::create(point);
-                    result = TetrahedronEvent::create();
-                    result->setNode(node);
-                }
-                node = result->getNode();
-                node->clear();
-                node->setOffset(offset + offset_event);
-                node->setPoint(point);
-                result->setEdgeBegin(edge);
-                VertexSPtr vertices[4];
-                result->getVertices(vertices);
-                for (unsigned int i = 0; i < 4; i++) {
-                    SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-                            vertices[i]->getData());
-                    ArcSPtr arc = vertex_data->getArc();
-                    node->addArc(arc);
-                }
-                EdgeSPtr edges[6];
-                result->getEdges(edges);
-                for (unsigned int i = 0; i < 6; i++) {
-                    SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-                            edges[i]->getData());
-                    SheetSPtr sheet = edge_data->getSheet();
-                    node->addSheet(sheet);
-                }
-
-                offset_max = offset_event;
+    FlipVertexEventSPtr result = FlipVertexEventSPtr();
+    util::SlotList<VertexSPtr>::iterator it_v1 = polyhedron->vertices().begin();
+    while (it_v1 != polyhedron->vertices().end()) {
+        VertexSPtr vertex_1 = *it_v1++;
+        FlipVertexEventSPtr event = nextFlipVertexEvent(vertex_1, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
             }
         }
     }
     return result;
 }
 
-VertexEventSPtr SimpleStraightSkel::nextVertexEvent(PolyhedronSPtr polyhedron, double offset) {
-    ReadLock l(polyhedron->mutex());
-    VertexEventSPtr result = VertexEventSPtr();
+SurfaceEventSPtr SimpleStraightSkel::nextSurfaceEvent(EdgeSPtr edge_1, double offset) {
+    SurfaceEventSPtr result = SurfaceEventSPtr();
     double offset_max = -std::numeric_limits<double>::max();
-    std::list<VertexSPtr>::iterator it_v1 = polyhedron->vertices().begin();
-    while (it_v1 != polyhedron->vertices().end()) {
-        VertexSPtr vertex_1 = *it_v1++;
-        if (isConvex(vertex_1)) {
+    FacetSPtr facet_1_src = getFacetSrc(edge_1);
+    FacetSPtr facet_1_dst = getFacetDst(edge_1);
+    std::list<EdgeSPtr> edges_2;
+    edges_2.insert(edges_2.end(),
+            facet_1_src->edges().begin(), facet_1_src->edges().end());
+    edges_2.insert(edges_2.end(),
+            facet_1_dst->edges().begin(), facet_1_dst->edges().end());
+    std::list<EdgeSPtr>::iterator it_e2 = edges_2.begin();
+    while (it_e2 != edges_2.end()) {
+        EdgeSPtr edge_2 = *it_e2++;
+        if (edge_1 == edge_2) {
             continue;
         }
-
-        std::list<VertexSPtr> vertices_2;
-        std::list<FacetWPtr>::iterator it_f = vertex_1->facets().begin();
-        while (it_f != vertex_1->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet(facet_wptr);
-                vertices_2.insert(vertices_2.end(),
-                        facet->vertices().begin(), facet->vertices().end());
-            }
+        if (edge_1->getFacetL() == edge_2->getFacetL() ||
+                edge_1->getFacetL() == edge_2->getFacetR() ||
+                edge_1->getFacetR() == edge_2->getFacetL() ||
+                edge_1->getFacetR() == edge_2->getFacetR()) {
+            // on same facet
+            continue;
         }
-        std::list<VertexSPtr>::iterator it_v2 = vertices_2.begin();
-        while (it_v2 != vertices_2.end()) {
-            VertexSPtr vertex_2 = *it_v2++;
-            if (vertex_1 == vertex_2) {
-                continue;
-            }
-            if (vertex_1->getPoint() == vertex_2->getPoint()) {
-                continue;
-            }
-            if (isConvex(vertex_2)) {
-                continue;
-            }
-
-            if (vertex_1->findEdge(vertex_2)) {
-                // edge event
-                continue;
-            }
-
-            FacetSPtr facet_1;
-            FacetSPtr facet_2;
-            int num_equal_facets = 0;
-            std::list<FacetWPtr>::iterator it_f1 = vertex_1->facets().begin();
-            while (it_f1 != vertex_1->facets().end()) {
-                FacetWPtr facet_1_wptr = *it_f1++;
-                if (!facet_1_wptr.expired()) {
-                    std::list<FacetWPtr>::iterator it_f2 = vertex_2->facets().begin();
-                    while (it_f2 != vertex_2->facets().end()) {
-                        FacetWPtr facet_2_wptr = *it_f2++;
-                        if (facet_1_wptr == facet_2_wptr) {
-                            if (num_equal_facets == 0) {
-                                facet_1 = FacetSPtr(facet_1_wptr);
-                            } else {
-                                facet_2 = FacetSPtr(facet_2_wptr);
-                            }
-                            num_equal_facets++;
-                        }
-                    }
-                }
-            }
-            if (num_equal_facets != 2) {
-                continue;
-            }
-            if (facet_1->next(vertex_1) != facet_2) {
-                FacetSPtr facet_tmp = facet_1;
-                facet_1 = facet_2;
-                facet_2 = facet_tmp;
-            }
-            if (vertex_1->next(facet_1)->next(facet_1) == vertex_2 ||
-                    vertex_1->next(facet_2)->next(facet_2) == vertex_2 ||
-                    vertex_1->prev(facet_1)->prev(facet_1) == vertex_2 ||
-                    vertex_1->prev(facet_2)->prev(facet_2) == vertex_2) {
-                // edge merge event
-                continue;
-            }
-
-            EdgeSPtr edge_11 = EdgeSPtr();
-            EdgeSPtr edge_12 = EdgeSPtr();
-            std::list<EdgeWPtr>::iterator it_e1 = vertex_1->edges().begin();
-            while (it_e1 != vertex_1->edges().end()) {
-                EdgeWPtr edge_1_wptr = *it_e1++;
-                if (!edge_1_wptr.expired()) {
-                    EdgeSPtr edge_1 = EdgeSPtr(edge_1_wptr);
-                    FacetSPtr facet_1l = edge_1->getFacetL();
-                    FacetSPtr facet_1r = edge_1->getFacetR();
-                    if ((facet_1l == facet_1 && facet_1r != facet_2) ||
-                            (facet_1r == facet_1 && facet_1l != facet_2)) {
-                        edge_11 = edge_1;
-                    } else if ((facet_1l == facet_2 && facet_1r != facet_1) ||
-                            (facet_1r == facet_2 && facet_1l != facet_1)) {
-                        edge_12 = edge_1;
-                    }
-                }
-            }
-            EdgeSPtr edge_21 = EdgeSPtr();
-            EdgeSPtr edge_22 = EdgeSPtr();
-            std::list<EdgeWPtr>::iterator it_e2 = vertex_2->edges().begin();
-            while (it_e2 != vertex_2->edges().end()) {
-                EdgeWPtr edge_2_wptr = *it_e2++;
-                if (!edge_2_wptr.expired()) {
-                    EdgeSPtr edge_2 = EdgeSPtr(edge_2_wptr);
-                    FacetSPtr facet_2l = edge_2->getFacetL();
-                    FacetSPtr facet_2r = edge_2->getFacetR();
-                    if ((facet_2l == facet_1 && facet_2r != facet_2) ||
-                            (facet_2r == facet_1 && facet_2l != facet_2)) {
-                        edge_21 = edge_2;
-                    } else if ((facet_2l == facet_2 && facet_2r != facet_1) ||
-                            (facet_2r == facet_2 && facet_2l != facet_1)) {
-                        edge_22 = edge_2;
-                    }
-                }
-            }
-            if (!((edge_11->next(vertex_1) == edge_12 && edge_22->next(vertex_2) == edge_21) ||
-                    (edge_12->next(vertex_1) == edge_11 && edge_21->next(vertex_2) == edge_22))) {
-                // flip vertex event
+        if (edge_1->getVertexSrc()->isCoincident(edge_2->getVertexSrc()) ||
+                edge_1->getVertexSrc()->isCoincident(edge_2->getVertexDst()) ||
+                edge_1->getVertexDst()->isCoincident(edge_2->getVertexSrc()) ||
+                edge_1->getVertexDst()->isCoincident(edge_2->getVertexDst())) {
+            // share a vertex
+            continue;
+        }
+        // vertex of edge_1 splits edge_2
+        if (!((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() != facet_1_dst) ||
+                (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() != facet_1_src) ||
+                (edge_2->getFacetR() == facet_1_src && edge_2->getFacetL() != facet_1_dst) ||
+                (edge_2->getFacetR() == facet_1_dst && edge_2->getFacetL() != facet_1_src))) {
+            // no surface event
+            continue;
+        }
+        FacetSPtr facet_2_src = getFacetSrc(edge_2);
+        FacetSPtr facet_2_dst = getFacetDst(edge_2);
+        if ((edge_1->getFacetL() == facet_2_src && edge_1->getFacetR() != facet_2_dst) ||
+                (edge_1->getFacetL() == facet_2_dst && edge_1->getFacetR() != facet_2_src) ||
+                (edge_1->getFacetR() == facet_2_src && edge_1->getFacetL() != facet_2_dst) ||
+                (edge_1->getFacetR() == facet_2_dst && edge_1->getFacetL() != facet_2_src)) {
+            // flip vertex event
+            continue;
+        }
+        if (edge_1->getVertexSrc()->findEdge(edge_2->getVertexSrc()) ||
+                edge_1->getVertexSrc()->findEdge(edge_2->getVertexDst()) ||
+                edge_1->getVertexDst()->findEdge(edge_2->getVertexSrc()) ||
+                edge_1->getVertexDst()->findEdge(edge_2->getVertexDst()) ) {
+            // edge event (when a pyramid grows outwards)
+            // a surface split is not possible with only one edge in between
+            continue;
+        }
+        if ((edge_1->getFacetL() == facet_2_src && facet_1_src == edge_2->getFacetL()) ||
+                (edge_1->getFacetL() == facet_2_dst && facet_1_src == edge_2->getFacetR()) ||
+                (edge_1->getFacetR() == facet_2_src && facet_1_dst == edge_2->getFacetL()) ||
+                (edge_1->getFacetR() == facet_2_dst && facet_1_dst == edge_2->getFacetR()) ||
+                (edge_1->getFacetR() == facet_2_src && facet_1_src == edge_2->getFacetR()) ||
+                (edge_1->getFacetR() == facet_2_dst && facet_1_src == edge_2->getFacetL()) ||
+                (edge_1->getFacetL() == facet_2_src && facet_1_dst == edge_2->getFacetR()) ||
+                (edge_1->getFacetL() == facet_2_dst && facet_1_dst == edge_2->getFacetL())) {
+            // vertex event
+            continue;
+        }
+        bool is_conv_split_event = false;
+        std::list<EdgeSPtr> edges = edge_1->getFacetL()->findEdges(edge_1->getFacetR());
+        std::list<EdgeSPtr>::iterator it_e = edges.begin();
+        while (it_e != edges.end()) {
+            EdgeSPtr edge = *it_e++;
+            if (edge == edge_1) {
                 continue;
             }
-            bool conv_split_event = false;
-            FacetSPtr facet_1b = facet_2->next(vertex_1);
-            FacetSPtr facet_2b = facet_1->next(vertex_2);
-            EdgeSPtr edge_cur = edge_11->next(facet_1b);
-            while (edge_cur != edge_11) {
-                if ((edge_cur->getFacetL() == facet_1b && edge_cur->getFacetR() == facet_2b) ||
-                        (edge_cur->getFacetR() == facet_1b && edge_cur->getFacetL() == facet_2b)) {
-                    conv_split_event = true;
+            FacetSPtr facet_src = getFacetSrc(edge);
+            FacetSPtr facet_dst = getFacetDst(edge);
+            if (facet_1_src == edge_2->getFacetL() ||
+                    facet_1_dst == edge_2->getFacetL()) {
+                if (facet_src == edge_2->getFacetR() ||
+                        facet_dst == edge_2->getFacetR()) {
+                    is_conv_split_event = true;
                     break;
                 }
-                edge_cur = edge_cur->next(facet_1b);
-            }
-            if (conv_split_event) {
-                continue;
-            }
-
-            Point3SPtr point = crashAt(edge_11, edge_22);
-            if (!point) {
-                continue;
-            }
-            double offset_event = offsetDist(edge_11->getFacetL(), point);
-            if (offset_event > offset_max) {
-                NodeSPtr node;
-                if (!result) {
-                    node = Node::create(point);
-                    result = VertexEvent::create();
-                    result->setNode(node);
+            } else if (facet_1_src == edge_2->getFacetR() ||
+                    facet_1_dst == edge_2->getFacetR()) {
+                if (facet_src == edge_2->getFacetL() ||
+                        facet_dst == edge_2->getFacetL()) {
+                    is_conv_split_event = true;
+                    break;
                 }
-                node = result->getNode();
-                node->clear();
-                SkelVertexDataSPtr data_1 = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertex_1->getData());
-                node->addArc(data_1->getArc());
-                SkelVertexDataSPtr data_2 = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertex_2->getData());
-                node->addArc(data_2->getArc());
-                node->setOffset(offset + offset_event);
-                node->setPoint(point);
-                result->setVertex1(vertex_1);
-                result->setVertex2(vertex_2);
-                result->setFacet1(facet_1);
-                result->setFacet2(facet_2);
-                offset_max = offset_event;
             }
         }
-    }
-    return result;
-}
-
-FlipVertexEventSPtr SimpleStraightSkel::nextFlipVertexEvent(PolyhedronSPtr polyhedron, double offset) {
-    ReadLock l(polyhedron->mutex());
-    FlipVertexEventSPtr result = FlipVertexEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<VertexSPtr>::iterator it_v1 = polyhedron->vertices().begin();
-    while (it_v1 != polyhedron->vertices().end()) {
-        VertexSPtr vertex_1 = *it_v1++;
-        if (isConvex(vertex_1)) {
+        if (is_conv_split_event) {
             continue;
         }
 
-        std::list<VertexSPtr> vertices_2;
-        std::list<FacetWPtr>::iterator it_f = vertex_1->facets().begin();
-        while (it_f != vertex_1->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet(facet_wptr);
-                vertices_2.insert(vertices_2.end(),
-                        facet->vertices().begin(), facet->vertices().end());
-            }
+        // calculate intersection point
+        Point3SPtr point = crashAt(edge_1, edge_2);
+        if (!point) {
+            continue;
         }
-        std::list<VertexSPtr>::iterator it_v2 = vertices_2.begin();
-        while (it_v2 != vertices_2.end()) {
-            VertexSPtr vertex_2 = *it_v2++;
-            if (vertex_1 == vertex_2) {
-                continue;
-            }
-            if (vertex_1->getPoint() == vertex_2->getPoint()) {
-                continue;
-            }
-            if (isConvex(vertex_2)) {
-                continue;
-            }
 
-            if (vertex_1->findEdge(vertex_2)) {
-                // edge event
-                continue;
+        // find minimum orthogonal distance
+        double offset_event = offsetDist(edge_1->getFacetL(), point);
+        if (offset_event > offset_max) {
+            NodeSPtr node;
+            if (!result) {
+                node = Node::create(point);
+                result = SurfaceEvent::create();
+                result->setNode(node);
             }
+            node = result->getNode();
+            node->clear();
+            node->setOffset(offset + offset_event);
+            node->setPoint(point);
+            result->setEdge1(edge_1);
+            result->setEdge2(edge_2);
 
-            FacetSPtr facet_1;
-            FacetSPtr facet_2;
-            int num_equal_facets = 0;
-            std::list<FacetWPtr>::iterator it_f1 = vertex_1->facets().begin();
-            while (it_f1 != vertex_1->facets().end()) {
-                FacetWPtr facet_1_wptr = *it_f1++;
-                if (!facet_1_wptr.expired()) {
-                    std::list<FacetWPtr>::iterator it_f2 = vertex_2->facets().begin();
-                    while (it_f2 != vertex_2->facets().end()) {
-                        FacetWPtr facet_2_wptr = *it_f2++;
-                        if (facet_1_wptr == facet_2_wptr) {
-                            if (num_equal_facets == 0) {
-                                facet_1 = FacetSPtr(facet_1_wptr);
-                            } else {
-                                facet_2 = FacetSPtr(facet_2_wptr);
-                            }
-                            num_equal_facets++;
-                        }
-                    }
-                }
-            }
-            if (num_equal_facets != 2) {
-                continue;
-            }
-            if (facet_1->next(vertex_1) != facet_2) {
-                FacetSPtr facet_tmp = facet_1;
-                facet_1 = facet_2;
-                facet_2 = facet_tmp;
-            }
-            if (vertex_1->next(facet_1)->next(facet_1) == vertex_2 ||
-                    vertex_1->next(facet_2)->next(facet_2) == vertex_2 ||
-                    vertex_1->prev(facet_1)->prev(facet_1) == vertex_2 ||
-                    vertex_1->prev(facet_2)->prev(facet_2) == vertex_2) {
-                // edge merge event
-                continue;
-            }
+            SkelEdgeData* data_1 = SkelEdgeData::of(edge_1);
+            SkelEdgeData* data_2 = SkelEdgeData::of(edge_2);
+            node->addSheet(data_1->getSheet());
+            node->addSheet(data_2->getSheet());
 
-            EdgeSPtr edge_11 = EdgeSPtr();
-            EdgeSPtr edge_12 = EdgeSPtr();
-            std::list<EdgeWPtr>::iterator it_e1 = vertex_1->edges().begin();
-            while (it_e1 != vertex_1->edges().end()) {
-                EdgeWPtr edge_1_wptr = *it_e1++;
-                if (!edge_1_wptr.expired()) {
-                    EdgeSPtr edge_1 = EdgeSPtr(edge_1_wptr);
-                    FacetSPtr facet_1l = edge_1->getFacetL();
-                    FacetSPtr facet_1r = edge_1->getFacetR();
-                    if ((facet_1l == facet_1 && facet_1r != facet_2) ||
-                            (facet_1r == facet_1 && facet_1l != facet_2)) {
-                        edge_11 = edge_1;
-                    } else if ((facet_1l == facet_2 && facet_1r != facet_1) ||
-                            (facet_1r == facet_2 && facet_1l != facet_1)) {
-                        edge_12 = edge_1;
-                    }
-                }
-            }
-            EdgeSPtr edge_21 = EdgeSPtr();
-            EdgeSPtr edge_22 = EdgeSPtr();
-            std::list<EdgeWPtr>::iterator it_e2 = vertex_2->edges().begin();
-            while (it_e2 != vertex_2->edges().end()) {
-                EdgeWPtr edge_2_wptr = *it_e2++;
-                if (!edge_2_wptr.expired()) {
-                    EdgeSPtr edge_2 = EdgeSPtr(edge_2_wptr);
-                    FacetSPtr facet_2l = edge_2->getFacetL();
-                    FacetSPtr facet_2r = edge_2->getFacetR();
-                    if ((facet_2l == facet_1 && facet_2r != facet_2) ||
-                            (facet_2r == facet_1 && facet_2l != facet_2)) {
-                        edge_21 = edge_2;
-                    } else if ((facet_2l == facet_2 && facet_2r != facet_1) ||
-                            (facet_2r == facet_2 && facet_2l != facet_1)) {
-                        edge_22 = edge_2;
-                    }
-                }
+            if (facet_1_src == edge_2->getFacetL() ||
+                    facet_1_src == edge_2->getFacetR()) {
+                SkelVertexData* data_1_src = SkelVertexData::of(edge_1->getVertexSrc());
+                node->addArc(data_1_src->getArc());
             }
-            if (!(edge_12->next(vertex_1) == edge_11 && edge_22->next(vertex_2) == edge_21)) {
-                // vertex event
-                continue;
-            }
-            bool conv_split_event = false;
-            FacetSPtr facet_1b = facet_2->next(vertex_1);
-            FacetSPtr facet_2b = facet_2->next(vertex_2);
-            EdgeSPtr edge_cur = edge_11->next(facet_1b);
-            while (edge_cur != edge_11) {
-                if ((edge_cur->getFacetL() == facet_1b && edge_cur->getFacetR() == facet_2b) ||
-                        (edge_cur->getFacetR() == facet_1b && edge_cur->getFacetL() == facet_2b)) {
-                    conv_split_event = true;
-                    break;
-                }
-                edge_cur = edge_cur->next(facet_1b);
-            }
-            if (conv_split_event) {
-                continue;
+            if (facet_1_dst == edge_2->getFacetL() ||
+                    facet_1_dst == edge_2->getFacetR()) {
+                SkelVertexData* data_1_dst = SkelVertexData::of(edge_1->getVertexDst());
+                node->addArc(data_1_dst->getArc());
             }
 
-            Point3SPtr point = crashAt(edge_11, edge_22);
-            if (!point) {
-                continue;
-            }
-            double offset_event = offsetDist(edge_11->getFacetL(), point);
-            if (offset_event > offset_max) {
-                NodeSPtr node;
-                if (!result) {
-                    node = Node::create(point);
-                    result = FlipVertexEvent::create();
-                    result->setNode(node);
-                }
-                node = result->getNode();
-                node->clear();
-                SkelVertexDataSPtr data_1 = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertex_1->getData());
-                node->addArc(data_1->getArc());
-                SkelVertexDataSPtr data_2 = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertex_2->getData());
-                node->addArc(data_2->getArc());
-                node->setOffset(offset + offset_event);
-                node->setPoint(point);
-                result->setVertex1(vertex_1);
-                result->setVertex2(vertex_2);
-                result->setFacet1(facet_1);
-                result->setFacet2(facet_2);
-                offset_max = offset_event;
-            }
+            offset_max = offset_event;
         }
     }
     return result;
@@ -1816,147 +2420,89 @@ FlipVertexEventSPtr SimpleStraightSkel::nextFlipVertexEvent(PolyhedronSPtr polyh
 SurfaceEventSPtr SimpleStraightSkel::nextSurfaceEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
     SurfaceEventSPtr result = SurfaceEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e1 = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e1 = polyhedron->edges().begin();
     while (it_e1 != polyhedron->edges().end()) {
         EdgeSPtr edge_1 = *it_e1++;
-        FacetSPtr facet_1_src = getFacetSrc(edge_1);
-        FacetSPtr facet_1_dst = getFacetDst(edge_1);
-        std::list<EdgeSPtr> edges_2;
-        edges_2.insert(edges_2.end(),
-                facet_1_src->edges().begin(), facet_1_src->edges().end());
-        edges_2.insert(edges_2.end(),
-                facet_1_dst->edges().begin(), facet_1_dst->edges().end());
-        std::list<EdgeSPtr>::iterator it_e2 = edges_2.begin();
-        while (it_e2 != edges_2.end()) {
-            EdgeSPtr edge_2 = *it_e2++;
-            if (edge_1 == edge_2) {
-                continue;
-            }
-            if (edge_1->getFacetL() == edge_2->getFacetL() ||
-                    edge_1->getFacetL() == edge_2->getFacetR() ||
-                    edge_1->getFacetR() == edge_2->getFacetL() ||
-                    edge_1->getFacetR() == edge_2->getFacetR()) {
-                // on same facet
-                continue;
-            }
-            if (edge_1->getVertexSrc()->getPoint() == edge_2->getVertexSrc()->getPoint() ||
-                    edge_1->getVertexSrc()->getPoint() == edge_2->getVertexDst()->getPoint() ||
-                    edge_1->getVertexDst()->getPoint() == edge_2->getVertexSrc()->getPoint() ||
-                    edge_1->getVertexDst()->getPoint() == edge_2->getVertexDst()->getPoint()) {
-                // share a vertex
-                continue;
-            }
-            // vertex of edge_1 splits edge_2
-            if (!((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() != facet_1_dst) ||
-                    (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() != facet_1_src) ||
-                    (edge_2->getFacetR() == facet_1_src && edge_2->getFacetL() != facet_1_dst) ||
-                    (edge_2->getFacetR() == facet_1_dst && edge_2->getFacetL() != facet_1_src))) {
-                // no surface event
-                continue;
-            }
-            FacetSPtr facet_2_src = getFacetSrc(edge_2);
-            FacetSPtr facet_2_dst = getFacetDst(edge_2);
-            if ((edge_1->getFacetL() == facet_2_src && edge_1->getFacetR() != facet_2_dst) ||
-                    (edge_1->getFacetL() == facet_2_dst && edge_1->getFacetR() != facet_2_src) ||
-                    (edge_1->getFacetR() == facet_2_src && edge_1->getFacetL() != facet_2_dst) ||
-                    (edge_1->getFacetR() == facet_2_dst && edge_1->getFacetL() != facet_2_src)) {
-                // flip vertex event
-                continue;
-            }
-            if (edge_1->getVertexSrc()->findEdge(edge_2->getVertexSrc()) ||
-                    edge_1->getVertexSrc()->findEdge(edge_2->getVertexDst()) ||
-                    edge_1->getVertexDst()->findEdge(edge_2->getVertexSrc()) ||
-                    edge_1->getVertexDst()->findEdge(edge_2->getVertexDst()) ) {
-                // edge event (when a pyramid grows outwards)
-                // a surface split is not possible with only one edge in between
-                continue;
-            }
-            if ((edge_1->getFacetL() == facet_2_src && facet_1_src == edge_2->getFacetL()) ||
-                    (edge_1->getFacetL() == facet_2_dst && facet_1_src == edge_2->getFacetR()) ||
-                    (edge_1->getFacetR() == facet_2_src && facet_1_dst == edge_2->getFacetL()) ||
-                    (edge_1->getFacetR() == facet_2_dst && facet_1_dst == edge_2->getFacetR()) ||
-                    (edge_1->getFacetR() == facet_2_src && facet_1_src == edge_2->getFacetR()) ||
-                    (edge_1->getFacetR() == facet_2_dst && facet_1_src == edge_2->getFacetL()) ||
-                    (edge_1->getFacetL() == facet_2_src && facet_1_dst == edge_2->getFacetR()) ||
-                    (edge_1->getFacetL() == facet_2_dst && facet_1_dst == edge_2->getFacetL())) {
-                // vertex event
-                continue;
-            }
-            bool is_conv_split_event = false;
-            std::list<EdgeSPtr> edges = edge_1->getFacetL()->findEdges(edge_1->getFacetR());
-            std::list<EdgeSPtr>::iterator it_e = edges.begin();
-            while (it_e != edges.end()) {
-                EdgeSPtr edge = *it_e++;
-                if (edge == edge_1) {
-                    continue;
-                }
-                FacetSPtr facet_src = getFacetSrc(edge);
-                FacetSPtr facet_dst = getFacetDst(edge);
-                if (facet_1_src == edge_2->getFacetL() ||
-                        facet_1_dst == edge_2->getFacetL()) {
-                    if (facet_src == edge_2->getFacetR() ||
-                            facet_dst == edge_2->getFacetR()) {
-                        is_conv_split_event = true;
-                        break;
-                    }
-                } else if (facet_1_src == edge_2->getFacetR() ||
-                        facet_1_dst == edge_2->getFacetR()) {
-                    if (facet_src == edge_2->getFacetL() ||
-                            facet_dst == edge_2->getFacetL()) {
-                        is_conv_split_event = true;
-                        break;
-                    }
-                }
-            }
-            if (is_conv_split_event) {
-                continue;
+        SurfaceEventSPtr event = nextSurfaceEvent(edge_1, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
             }
+        }
+    }
+    return result;
+}
 
-            // calculate intersection point
-            Point3SPtr point = crashAt(edge_1, edge_2);
-            if (!point) {
-                continue;
-            }
+PolyhedronSplitEventSPtr SimpleStraightSkel::nextPolyhedronSplitEvent(EdgeSPtr edge_1, double offset) {
+    PolyhedronSplitEventSPtr result = PolyhedronSplitEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    if (!isReflex(edge_1)) {
+        return result;
+    }
+    FacetSPtr facet_1_src = getFacetSrc(edge_1);
+    FacetSPtr facet_1_dst = getFacetDst(edge_1);
+    std::list<EdgeSPtr>::iterator it_e2 = facet_1_src->edges().begin();
+    while (it_e2 != facet_1_src->edges().end()) {
+        EdgeSPtr edge_2 = *it_e2++;
+        if (edge_1->getVertexSrc()->isCoincident(edge_2->getVertexSrc()) ||
+                edge_1->getVertexSrc()->isCoincident(edge_2->getVertexDst()) ||
+                edge_1->getVertexDst()->isCoincident(edge_2->getVertexSrc()) ||
+                edge_1->getVertexDst()->isCoincident(edge_2->getVertexDst())) {
+            // share a vertex
+            continue;
+        }
+        if (!((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() == facet_1_dst) ||
+                (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() == facet_1_src))) {
+            // no polyhedron split event
+            continue;
+        }
+        if (edge_1->getVertexSrc()->findEdge(edge_2->getVertexSrc()) ||
+                edge_1->getVertexSrc()->findEdge(edge_2->getVertexDst()) ||
+                edge_1->getVertexDst()->findEdge(edge_2->getVertexSrc()) ||
+                edge_1->getVertexDst()->findEdge(edge_2->getVertexDst())) {
+            // does not work when there is only one edge in between
+            continue;
+        }
 
-            // find minimum orthogonal distance
-            double offset_event = offsetDist(edge_1->getFacetL(), point);
-            if (offset_event > offset_max) {
-                NodeSPtr node;
-                if (!result) {
-                    node = Node::create(point);
-                    result = SurfaceEvent::create();
-                    result->setNode(node);
-                }
-                node = result->getNode();
-                node->clear();
-                node->setOffset(offset + offset_event);
-                node->setPoint(point);
-                result->setEdge1(edge_1);
-                result->setEdge2(edge_2);
-
-                SkelEdgeDataSPtr data_1 = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edge_1->getData());
-                SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edge_2->getData());
-                node->addSheet(data_1->getSheet());
-                node->addSheet(data_2->getSheet());
-
-                if (facet_1_src == edge_2->getFacetL() ||
-                        facet_1_src == edge_2->getFacetR()) {
-                    SkelVertexDataSPtr data_1_src = std::dynamic_pointer_cast<SkelVertexData>(
-                        edge_1->getVertexSrc()->getData());
-                    node->addArc(data_1_src->getArc());
-                }
-                if (facet_1_dst == edge_2->getFacetL() ||
-                        facet_1_dst == edge_2->getFacetR()) {
-                    SkelVertexDataSPtr data_1_dst = std::dynamic_pointer_cast<SkelVertexData>(
-                        edge_1->getVertexDst()->getData());
-                    node->addArc(data_1_dst->getArc());
-                }
+        // calculate intersection point
+        Point3SPtr point = crashAt(edge_1, edge_2);
+        if (!point) {
+            continue;
+        }
+
+        // find minimum orthogonal distance
+        double offset_event = offsetDist(edge_1->getFacetL(), point);
+        if (offset_event > offset_max) {
+            NodeSPtr node;
+            if (!result) {
+                node = Node::create(point);
+                result = PolyhedronSplitEvent::create();
+                result->setNode(node);
+            }
+            node = result->getNode();
+            node->clear();
+            node->setOffset(offset + offset_event);
+            node->setPoint(point);
+            result->setEdge1(edge_1);
+            result->setEdge2(edge_2);
 
-                offset_max = offset_event;
+            SkelEdgeData* data_1 = SkelEdgeData::of(edge_1);
+            SkelEdgeData* data_2 = SkelEdgeData::of(edge_2);
+            node->addSheet(data_1->getSheet());
+            node->addSheet(data_2->getSheet());
+
+            if (facet_1_src == edge_2->getFacetL() ||
+                    facet_1_src == edge_2->getFacetR()) {
+                SkelVertexData* data_1_src = SkelVertexData::of(edge_1->getVertexSrc());
+                node->addArc(data_1_src->getArc());
+            }
+            if (facet_1_dst == edge_2->getFacetL() ||
+                    facet_1_dst == edge_2->getFacetR()) {
+                SkelVertexData* data_1_dst = SkelVertexData::of(edge_1->getVertexDst());
+                node->addArc(data_1_dst->getArc());
             }
+
+            offset_max = offset_event;
         }
     }
     return result;
@@ -1965,82 +2511,161 @@ SurfaceEventSPtr SimpleStraightSkel::nextSurfaceEvent(PolyhedronSPtr polyhedron,
 PolyhedronSplitEventSPtr SimpleStraightSkel::nextPolyhedronSplitEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
     PolyhedronSplitEventSPtr result = PolyhedronSplitEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<EdgeSPtr>::iterator it_e1 = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e1 = polyhedron->edges().begin();
     while (it_e1 != polyhedron->edges().end()) {
         EdgeSPtr edge_1 = *it_e1++;
-        if (!isReflex(edge_1)) {
+        PolyhedronSplitEventSPtr event = nextPolyhedronSplitEvent(edge_1, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
+            }
+        }
+    }
+    return result;
+}
+
+SplitMergeEventSPtr SimpleStraightSkel::nextSplitMergeEvent(VertexSPtr vertex_1, double offset) {
+    SplitMergeEventSPtr result = SplitMergeEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    if (isConvex(vertex_1)) {
+        return result;
+    }
+
+    std::list<VertexSPtr> vertices_2;
+    std::list<FacetHandle>::iterator it_f = vertex_1->facets().begin();
+    while (it_f != vertex_1->facets().end()) {
+        Facet* facet = (*it_f++).get();
+        vertices_2.insert(vertices_2.end(),
+                facet->vertices().begin(), facet->vertices().end());
+    }
+    std::list<VertexSPtr>::iterator it_v2 = vertices_2.begin();
+    while (it_v2 != vertices_2.end()) {
+        VertexSPtr vertex_2 = *it_v2++;
+        if (vertex_1 == vertex_2) {
+            continue;
+        }
+        if (vertex_1->isCoincident(vertex_2)) {
+            continue;
+        }
+        if (isConvex(vertex_2)) {
             continue;
         }
-        FacetSPtr facet_1_src = getFacetSrc(edge_1);
-        FacetSPtr facet_1_dst = getFacetDst(edge_1);
-        std::list<EdgeSPtr>::iterator it_e2 = facet_1_src->edges().begin();
-        while (it_e2 != facet_1_src->edges().end()) {
-            EdgeSPtr edge_2 = *it_e2++;
-            if (edge_1->getVertexSrc()->getPoint() == edge_2->getVertexSrc()->getPoint() ||
-                    edge_1->getVertexSrc()->getPoint() == edge_2->getVertexDst()->getPoint() ||
-                    edge_1->getVertexDst()->getPoint() == edge_2->getVertexSrc()->getPoint() ||
-                    edge_1->getVertexDst()->getPoint() == edge_2->getVertexDst()->getPoint()) {
-                // share a vertex
-                continue;
-            }
-            if (!((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() == facet_1_dst) ||
-                    (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() == facet_1_src))) {
-                // no polyhedron split event
-                continue;
-            }
-            if (edge_1->getVertexSrc()->findEdge(edge_2->getVertexSrc()) ||
-                    edge_1->getVertexSrc()->findEdge(edge_2->getVertexDst()) ||
-                    edge_1->getVertexDst()->findEdge(edge_2->getVertexSrc()) ||
-                    edge_1->getVertexDst()->findEdge(edge_2->getVertexDst())) {
-                // does not work when there is only one edge in between
-                continue;
-            }
 
-            // calculate intersection point
-            Point3SPtr point = crashAt(edge_1, edge_2);
-            if (!point) {
-                continue;
-            }
+        if (vertex_1->findEdge(vertex_2)) {
+            // edge event
+            continue;
+        }
 
-            // find minimum orthogonal distance
-            double offset_event = offsetDist(edge_1->getFacetL(), point);
-            if (offset_event > offset_max) {
-                NodeSPtr node;
-                if (!result) {
-                    node = Node::create(point);
-                    result = PolyhedronSplitEvent::create();
-                    result->setNode(node);
-                }
-                node = result->getNode();
-                node->clear();
-                node->setOffset(offset + offset_event);
-                node->setPoint(point);
-                result->setEdge1(edge_1);
-                result->setEdge2(edge_2);
-
-                SkelEdgeDataSPtr data_1 = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edge_1->getData());
-                SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edge_2->getData());
-                node->addSheet(data_1->getSheet());
-                node->addSheet(data_2->getSheet());
-
-                if (facet_1_src == edge_2->getFacetL() ||
-                        facet_1_src == edge_2->getFacetR()) {
-                    SkelVertexDataSPtr data_1_src = std::dynamic_pointer_cast<SkelVertexData>(
-                        edge_1->getVertexSrc()->getData());
-                    node->addArc(data_1_src->getArc());
-                }
-                if (facet_1_dst == edge_2->getFacetL() ||
-                        facet_1_dst == edge_2->getFacetR()) {
-                    SkelVertexDataSPtr data_1_dst = std::dynamic_pointer_cast<SkelVertexData>(
-                        edge_1->getVertexDst()->getData());
-                    node->addArc(data_1_dst->getArc());
+        FacetSPtr facet_1;
+        FacetSPtr facet_2;
+        int num_equal_facets = 0;
+        std::list<FacetHandle>::iterator it_f1 = vertex_1->facets().begin();
+        while (it_f1 != vertex_1->facets().end()) {
+            FacetHandle facet_1_h = *it_f1++;
+            std::list<FacetHandle>::iterator it_f2 = vertex_2->facets().begin();
+            while (it_f2 != vertex_2->facets().end()) {
+                FacetHandle facet_2_h = *it_f2++;
+                if (facet_1_h == facet_2_h) {
+                    if (num_equal_facets == 0) {
+                        facet_1 = facet_1_h.lock();
+                    } else {
+                        facet_2 = facet_2_h.lock();
+                    }
+                    num_equal_facets++;
                 }
+            }
+        }
+        if (num_equal_facets != 2) {
+            continue;
+        }
+        if (facet_1->next(vertex_1) != facet_2) {
+            FacetSPtr facet_tmp = facet_1;
+            facet_1 = facet_2;
+            facet_2 = facet_tmp;
+        }
+        if (vertex_1->next(facet_1)->next(facet_1) == vertex_2 ||
+                vertex_1->next(facet_2)->next(facet_2) == vertex_2 ||
+                vertex_1->prev(facet_1)->prev(facet_1) == vertex_2 ||
+                vertex_1->prev(facet_2)->prev(facet_2) == vertex_2) {
+            // edge merge event
+            continue;
+        }
+
+        EdgeSPtr edge_11 = EdgeSPtr();
+        EdgeSPtr edge_12 = EdgeSPtr();
+        std::list<EdgeHandle>::iterator it_e1 = vertex_1->edges().begin();
+        while (it_e1 != vertex_1->edges().end()) {
+            EdgeHandle edge_1 = *it_e1++;
+            FacetSPtr facet_1l = edge_1->getFacetL();
+            FacetSPtr facet_1r = edge_1->getFacetR();
+            if ((facet_1l == facet_1 && facet_1r != facet_2) ||
+                    (facet_1r == facet_1 && facet_1l != facet_2)) {
+                edge_11 = edge_1.lock();
+            } else if ((facet_1l == facet_2 && facet_1r != facet_1) ||
+                    (facet_1r == facet_2 && facet_1l != facet_1)) {
+                edge_12 = edge_1.lock();
+            }
+        }
+        EdgeSPtr edge_21 = EdgeSPtr();
+        EdgeSPtr edge_22 = EdgeSPtr();
+        std::list<EdgeHandle>::iterator it_e2 = vertex_2->edges().begin();
+        while (it_e2 != vertex_2->edges().end()) {
+            EdgeHandle edge_2 = *it_e2++;
+            FacetSPtr facet_2l = edge_2->getFacetL();
+            FacetSPtr facet_2r = edge_2->getFacetR();
+            if ((facet_2l == facet_1 && facet_2r != facet_2) ||
+                    (facet_2r == facet_1 && facet_2l != facet_2)) {
+                edge_21 = edge_2.lock();
+            } else if ((facet_2l == facet_2 && facet_2r != facet_1) ||
+                    (facet_2r == facet_2 && facet_2l != facet_1)) {
+                edge_22 = edge_2.lock();
+            }
+        }
+        bool conv_split_event = false;
+        FacetSPtr facet_1b = facet_2->next(vertex_1);
+        FacetSPtr facet_2b = facet_1->next(vertex_2);
+        if (facet_2b == facet_2) {
+            // flip vertex event
+            facet_2b = facet_2b->next(vertex_2);
+        }
+        EdgeSPtr edge_cur = edge_11->next(facet_1b);
+        while (edge_cur != edge_11) {
+            if ((edge_cur->getFacetL() == facet_1b && edge_cur->getFacetR() == facet_2b) ||
+                    (edge_cur->getFacetR() == facet_1b && edge_cur->getFacetL() == facet_2b)) {
+                conv_split_event = true;
+                break;
+            }
+            edge_cur = edge_cur->next(facet_1b);
+        }
+        if (!conv_split_event) {
+            continue;
+        }
 
-                offset_max = offset_event;
+        Point3SPtr point = crashAt(edge_11, edge_22);
+        if (!point) {
+            continue;
+        }
+        double offset_event = offsetDist(edge_11->getFacetL(), point);
+        if (offset_event > offset_max) {
+            NodeSPtr node;
+            if (!result) {
+                node = Node::create(point);
+                result = SplitMergeEvent::create();
+                result->setNode(node);
             }
+            node = result->getNode();
+            node->clear();
+            SkelVertexData* data_1 = SkelVertexData::of(vertex_1);
+            node->addArc(data_1->getArc());
+            SkelVertexData* data_2 = SkelVertexData::of(vertex_2);
+            node->addArc(data_2->getArc());
+            node->setOffset(offset + offset_event);
+            node->setPoint(point);
+            result->setVertex1(vertex_1);
+            result->setVertex2(vertex_2);
+            result->setFacet1(facet_1);
+            result->setFacet2(facet_2);
+            offset_max = offset_event;
         }
     }
     return result;
@@ -2049,164 +2674,101 @@ PolyhedronSplitEventSPtr SimpleStraightSkel::nextPolyhedronSplitEvent(Polyhedron
 SplitMergeEventSPtr SimpleStraightSkel::nextSplitMergeEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
     SplitMergeEventSPtr result = SplitMergeEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<VertexSPtr>::iterator it_v1 = polyhedron->vertices().begin();
+    util::SlotList<VertexSPtr>::iterator it_v1 = polyhedron->vertices().begin();
     while (it_v1 != polyhedron->vertices().end()) {
         VertexSPtr vertex_1 = *it_v1++;
-        if (isConvex(vertex_1)) {
-            continue;
-        }
-
-        std::list<VertexSPtr> vertices_2;
-        std::list<FacetWPtr>::iterator it_f = vertex_1->facets().begin();
-        while (it_f != vertex_1->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet(facet_wptr);
-                vertices_2.insert(vertices_2.end(),
-                        facet->vertices().begin(), facet->vertices().end());
+        SplitMergeEventSPtr event = nextSplitMergeEvent(vertex_1, offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
             }
         }
-        std::list<VertexSPtr>::iterator it_v2 = vertices_2.begin();
-        while (it_v2 != vertices_2.end()) {
-            VertexSPtr vertex_2 = *it_v2++;
-            if (vertex_1 == vertex_2) {
-                continue;
-            }
-            if (vertex_1->getPoint() == vertex_2->getPoint()) {
-                continue;
-            }
-            if (isConvex(vertex_2)) {
-                continue;
-            }
+    }
+    return result;
+}
 
-            if (vertex_1->findEdge(vertex_2)) {
-                // edge event
-                continue;
-            }
+EdgeSplitEventSPtr SimpleStraightSkel::nextEdgeSplitEvent(EdgeSPtr edge_1, EdgeSPtr edge_2, double offset) {
+    EdgeSplitEventSPtr result = EdgeSplitEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    FacetSPtr facet_1_src = getFacetSrc(edge_1);
+    FacetSPtr facet_1_dst = getFacetDst(edge_1);
+    if (edge_1->getFacetL() == edge_2->getFacetL() ||
+            edge_1->getFacetL() == edge_2->getFacetR() ||
+            edge_1->getFacetR() == edge_2->getFacetL() ||
+            edge_1->getFacetR() == edge_2->getFacetR()) {
+        // on same facet
+        return result;
+    }
+    if (edge_1->getVertexSrc()->isCoincident(edge_2->getVertexSrc()) ||
+            edge_1->getVertexSrc()->isCoincident(edge_2->getVertexDst()) ||
+            edge_1->getVertexDst()->isCoincident(edge_2->getVertexSrc()) ||
+            edge_1->getVertexDst()->isCoincident(edge_2->getVertexDst())) {
+        // share a vertex
+        return result;
+    }
+    if (((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() == facet_1_dst) ||
+            (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() == facet_1_src))) {
+        // polyhedron split event
+        return result;
+    }
+    FacetSPtr facet_2_src = getFacetSrc(edge_2);
+    FacetSPtr facet_2_dst = getFacetDst(edge_2);
+    if ((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() != facet_1_dst) ||
+            (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() != facet_1_src) ||
+            (edge_2->getFacetR() == facet_1_src && edge_2->getFacetL() != facet_1_dst) ||
+            (edge_2->getFacetR() == facet_1_dst && edge_2->getFacetL() != facet_1_src)) {
+        // surface event
+        return result;
+    }
+    if ((edge_1->getFacetL() == facet_2_src && edge_1->getFacetR() != facet_2_dst) ||
+            (edge_1->getFacetL() == facet_2_dst && edge_1->getFacetR() != facet_2_src) ||
+            (edge_1->getFacetR() == facet_2_src && edge_1->getFacetL() != facet_2_dst) ||
+            (edge_1->getFacetR() == facet_2_dst && edge_1->getFacetL() != facet_2_src)) {
+        // surface event
+        return result;
+    }
 
-            FacetSPtr facet_1;
-            FacetSPtr facet_2;
-            int num_equal_facets = 0;
-            std::list<FacetWPtr>::iterator it_f1 = vertex_1->facets().begin();
-            while (it_f1 != vertex_1->facets().end()) {
-                FacetWPtr facet_1_wptr = *it_f1++;
-                if (!facet_1_wptr.expired()) {
-                    std::list<FacetWPtr>::iterator it_f2 = vertex_2->facets().begin();
-                    while (it_f2 != vertex_2->facets().end()) {
-                        FacetWPtr facet_2_wptr = *it_f2++;
-                        if (facet_1_wptr == facet_2_wptr) {
-                            if (num_equal_facets == 0) {
-                                facet_1 = FacetSPtr(facet_1_wptr);
-                            } else {
-                                facet_2 = FacetSPtr(facet_2_wptr);
-                            }
-                            num_equal_facets++;
-                        }
-                    }
-                }
-            }
-            if (num_equal_facets != 2) {
-                continue;
-            }
-            if (facet_1->next(vertex_1) != facet_2) {
-                FacetSPtr facet_tmp = facet_1;
-                facet_1 = facet_2;
-                facet_2 = facet_tmp;
-            }
-            if (vertex_1->next(facet_1)->next(facet_1) == vertex_2 ||
-                    vertex_1->next(facet_2)->next(facet_2) == vertex_2 ||
-                    vertex_1->prev(facet_1)->prev(facet_1) == vertex_2 ||
-                    vertex_1->prev(facet_2)->prev(facet_2) == vertex_2) {
-                // edge merge event
-                continue;
-            }
+    // calculate intersection point
+    Point3SPtr point = crashAt(edge_1, edge_2);
+    if (!point) {
+        return result;
+    }
 
-            EdgeSPtr edge_11 = EdgeSPtr();
-            EdgeSPtr edge_12 = EdgeSPtr();
-            std::list<EdgeWPtr>::iterator it_e1 = vertex_1->edges().begin();
-            while (it_e1 != vertex_1->edges().end()) {
-                EdgeWPtr edge_1_wptr = *it_e1++;
-                if (!edge_1_wptr.expired()) {
-                    EdgeSPtr edge_1 = EdgeSPtr(edge_1_wptr);
-                    FacetSPtr facet_1l = edge_1->getFacetL();
-                    FacetSPtr facet_1r = edge_1->getFacetR();
-                    if ((facet_1l == facet_1 && facet_1r != facet_2) ||
-                            (facet_1r == facet_1 && facet_1l != facet_2)) {
-                        edge_11 = edge_1;
-                    } else if ((facet_1l == facet_2 && facet_1r != facet_1) ||
-                            (facet_1r == facet_2 && facet_1l != facet_1)) {
-                        edge_12 = edge_1;
-                    }
-                }
-            }
-            EdgeSPtr edge_21 = EdgeSPtr();
-            EdgeSPtr edge_22 = EdgeSPtr();
-            std::list<EdgeWPtr>::iterator it_e2 = vertex_2->edges().begin();
-            while (it_e2 != vertex_2->edges().end()) {
-                EdgeWPtr edge_2_wptr = *it_e2++;
-                if (!edge_2_wptr.expired()) {
-                    EdgeSPtr edge_2 = EdgeSPtr(edge_2_wptr);
-                    FacetSPtr facet_2l = edge_2->getFacetL();
-                    FacetSPtr facet_2r = edge_2->getFacetR();
-                    if ((facet_2l == facet_1 && facet_2r != facet_2) ||
-                            (facet_2r == facet_1 && facet_2l != facet_2)) {
-                        edge_21 = edge_2;
-                    } else if ((facet_2l == facet_2 && facet_2r != facet_1) ||
-                            (facet_2r == facet_2 && facet_2l != facet_1)) {
-                        edge_22 = edge_2;
-                    }
-                }
-            }
-            bool conv_split_event = false;
-            FacetSPtr facet_1b = facet_2->next(vertex_1);
-            FacetSPtr facet_2b = facet_1->next(vertex_2);
-            if (facet_2b == facet_2) {
-                // flip vertex event
-                facet_2b = facet_2b->next(vertex_2);
-            }
-            EdgeSPtr edge_cur = edge_11->next(facet_1b);
-            while (edge_cur != edge_11) {
-                if ((edge_cur->getFacetL() == facet_1b && edge_cur->getFacetR() == facet_2b) ||
-                        (edge_cur->getFacetR() == facet_1b && edge_cur->getFacetL() == facet_2b)) {
-                    conv_split_event = true;
-                    break;
-                }
-                edge_cur = edge_cur->next(facet_1b);
-            }
-            if (!conv_split_event) {
-                continue;
-            }
+    // find minimum orthogonal distance
+    double offset_event = offsetDist(edge_1->getFacetL(), point);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = EdgeSplitEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setEdge1(edge_1);
+        result->setEdge2(edge_2);
+        result->setOrientation(KernelWrapper::orientation(
+                line(edge_1), line(edge_2)));
 
-            Point3SPtr point = crashAt(edge_11, edge_22);
-            if (!point) {
-                continue;
-            }
-            double offset_event = offsetDist(edge_11->getFacetL(), point);
-            if (offset_event > offset_max) {
-                NodeSPtr node;
-                if (!result) {
-                    node = Node::create(point);
-                    result = SplitMergeEvent::create();
-                    result->setNode(node);
-                }
-                node = result->getNode();
-                node->clear();
-                SkelVertexDataSPtr data_1 = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertex_1->getData());
-                node->addArc(data_1->getArc());
-                SkelVertexDataSPtr data_2 = std::dynamic_pointer_cast<SkelVertexData>(
-                        vertex_2->getData());
-                node->addArc(data_2->getArc());
-                node->setOffset(offset + offset_event);
-                node->setPoint(point);
-                result->setVertex1(vertex_1);
-                result->setVertex2(vertex_2);
-                result->setFacet1(facet_1);
-                result->setFacet2(facet_2);
-                offset_max = offset_event;
-            }
+        SkelEdgeData* data_1 = SkelEdgeData::of(edge_1);
+        SkelEdgeData* data_2 = SkelEdgeData::of(edge_2);
+        node->addSheet(data_1->getSheet());
+        node->addSheet(data_2->getSheet());
+
+        if (facet_1_src == edge_2->getFacetL() ||
+                facet_1_src == edge_2->getFacetR()) {
+            SkelVertexData* data_1_src = SkelVertexData::of(edge_1->getVertexSrc());
+            node->addArc(data_1_src->getArc());
+        }
+        if (facet_1_dst == edge_2->getFacetL() ||
+                facet_1_dst == edge_2->getFacetR()) {
+            SkelVertexData* data_1_dst = SkelVertexData::of(edge_1->getVertexDst());
+            node->addArc(data_1_dst->getArc());
         }
+
+        offset_max = offset_event;
     }
     return result;
 }
@@ -2214,9 +2776,8 @@ SplitMergeEventSPtr SimpleStraightSkel::nextSplitMergeEvent(PolyhedronSPtr polyh
 EdgeSplitEventSPtr SimpleStraightSkel::nextEdgeSplitEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
     EdgeSplitEventSPtr result = EdgeSplitEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
     std::list<EdgeSPtr> edges_reflex;
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
         if (isReflex(edge)) {
@@ -2226,92 +2787,107 @@ EdgeSplitEventSPtr SimpleStraightSkel::nextEdgeSplitEvent(PolyhedronSPtr polyhed
     std::list<EdgeSPtr>::iterator it_e1 = edges_reflex.begin();
     while (it_e1 != edges_reflex.end()) {
         EdgeSPtr edge_1 = *it_e1++;
-        FacetSPtr facet_1_src = getFacetSrc(edge_1);
-        FacetSPtr facet_1_dst = getFacetDst(edge_1);
         std::list<EdgeSPtr>::iterator it_e2 = it_e1;
         while (it_e2 != edges_reflex.end()) {
             EdgeSPtr edge_2 = *it_e2++;
-            if (edge_1->getFacetL() == edge_2->getFacetL() ||
-                    edge_1->getFacetL() == edge_2->getFacetR() ||
-                    edge_1->getFacetR() == edge_2->getFacetL() ||
-                    edge_1->getFacetR() == edge_2->getFacetR()) {
-                // on same facet
-                continue;
-            }
-            if (edge_1->getVertexSrc()->getPoint() == edge_2->getVertexSrc()->getPoint() ||
-                    edge_1->getVertexSrc()->getPoint() == edge_2->getVertexDst()->getPoint() ||
-                    edge_1->getVertexDst()->getPoint() == edge_2->getVertexSrc()->getPoint() ||
-                    edge_1->getVertexDst()->getPoint() == edge_2->getVertexDst()->getPoint()) {
-                // share a vertex
-                continue;
-            }
-            if (((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() == facet_1_dst) ||
-                    (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() == facet_1_src))) {
-                // polyhedron split event
-                continue;
-            }
-            FacetSPtr facet_2_src = getFacetSrc(edge_2);
-            FacetSPtr facet_2_dst = getFacetDst(edge_2);
-            if ((edge_2->getFacetL() == facet_1_src && edge_2->getFacetR() != facet_1_dst) ||
-                    (edge_2->getFacetL() == facet_1_dst && edge_2->getFacetR() != facet_1_src) ||
-                    (edge_2->getFacetR() == facet_1_src && edge_2->getFacetL() != facet_1_dst) ||
-                    (edge_2->getFacetR() == facet_1_dst && edge_2->getFacetL() != facet_1_src)) {
-                // surface event
-                continue;
-            }
-            if ((edge_1->getFacetL() == facet_2_src && edge_1->getFacetR() != facet_2_dst) ||
-                    (edge_1->getFacetL() == facet_2_dst && edge_1->getFacetR() != facet_2_src) ||
-                    (edge_1->getFacetR() == facet_2_src && edge_1->getFacetL() != facet_2_dst) ||
-                    (edge_1->getFacetR() == facet_2_dst && edge_1->getFacetL() != facet_2_src)) {
-                // surface event
-                continue;
+            EdgeSplitEventSPtr event = nextEdgeSplitEvent(edge_1, edge_2, offset);
+            if (event) {
+                if (isNextEvent(event, result, offset)) {
+                    result = event;
+                }
             }
+        }
+    }
+    return result;
+}
 
-            // calculate intersection point
-            Point3SPtr point = crashAt(edge_1, edge_2);
-            if (!point) {
-                continue;
-            }
+PierceEventSPtr SimpleStraightSkel::nextPierceEvent(VertexSPtr vertex, FacetSPtr facet, double offset) {
+    PierceEventSPtr result = PierceEventSPtr();
+    double offset_max = -std::numeric_limits<double>::max();
+    SkelVertexData* data = SkelVertexData::of(vertex);
+    ArcSPtr arc = data->getArc();
+
+    bool contains_vertex = false;
+    std::list<VertexSPtr>::iterator it_v2 = facet->vertices().begin();
+    while (it_v2 != facet->vertices().end()) {
+        VertexSPtr vertex_2 = *it_v2++;
+        if (vertex_2->isCoincident(vertex)) {
+            contains_vertex = true;
+            break;
+        }
+    }
+    if (contains_vertex) {
+        return result;
+    }
 
-            // find minimum orthogonal distance
-            double offset_event = offsetDist(edge_1->getFacetL(), point);
-            if (offset_event > offset_max) {
-                NodeSPtr node;
-                if (!result) {
-                    node = Node::create(point);
-                    result = EdgeSplitEvent::create();
-                    result->setNode(node);
-                }
-                node = result->getNode();
-                node->clear();
-                node->setOffset(offset + offset_event);
-                node->setPoint(point);
-                result->setEdge1(edge_1);
-                result->setEdge2(edge_2);
-
-                SkelEdgeDataSPtr data_1 = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edge_1->getData());
-                SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(
-                        edge_2->getData());
-                node->addSheet(data_1->getSheet());
-                node->addSheet(data_2->getSheet());
-
-                if (facet_1_src == edge_2->getFacetL() ||
-                        facet_1_src == edge_2->getFacetR()) {
-                    SkelVertexDataSPtr data_1_src = std::dynamic_pointer_cast<SkelVertexData>(
-                        edge_1->getVertexSrc()->getData());
-                    node->addArc(data_1_src->getArc());
-                }
-                if (facet_1_dst == edge_2->getFacetL() ||
-                        facet_1_dst == edge_2->getFacetR()) {
-                    SkelVertexDataSPtr data_1_dst = std::dynamic_pointer_cast<SkelVertexData>(
-                        edge_1->getVertexDst()->getData());
-                    node->addArc(data_1_dst->getArc());
-                }
+    bool has_edge_to_facet = false;
+    std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
+    while (it_e != vertex->edges().end()) {
+        EdgeHandle edge = *it_e++;
+        FacetSPtr facet_src = edge->getFacetL()->next(edge->getVertexSrc());
+        FacetSPtr facet_dst = edge->getFacetR()->next(edge->getVertexDst());
+        if (facet == facet_src || facet == facet_dst) {
+            has_edge_to_facet = true;
+            break;
+        }
+    }
+    if (has_edge_to_facet) {
+        return result;
+    }
 
-                offset_max = offset_event;
-            }
+    if (KernelWrapper::side(facet->plane(), vertex->getPoint()) > 0) {
+        return result;
+    }
+    Line3SPtr line = arc->line();
+    if (!IsLineInFacet(facet, line)) {
+        return result;
+    }
+
+    Facet* facet_vertex = vertex->facets().front().get();
+    std::optional<Point3> point_vertex_offset = KernelWrapper::intersection(
+            offsetPlane(facet_vertex, -1.0), *line);
+    std::optional<Point3> point_facet = KernelWrapper::intersection(
+            *(facet->plane()), *line);
+    std::optional<Point3> point_facet_offset = KernelWrapper::intersection(
+            offsetPlane(facet.get(), -1.0), *line);
+    if (!point_vertex_offset || !point_facet || !point_facet_offset) {
+        return result;
+    }
+    double speed_vertex = KernelWrapper::distance(*(vertex->getPoint()), *point_vertex_offset);
+    double speed_facet = KernelWrapper::distance(*point_facet, *point_facet_offset);
+
+    double distance = KernelWrapper::distance(*(vertex->getPoint()), *point_facet);
+    double dist_vertex = (distance * speed_vertex) /
+            (speed_vertex + speed_facet);
+    if (KernelWrapper::comparePoints(*(arc->getDirection()),
+            *point_facet, *point_facet_offset) < 0) {
+        // for weighted straight skeleton
+        // reflex vertex and facet move into same direction
+        if (speed_facet < speed_vertex) {
+            // facet to slow
+            return result;
         }
+        dist_vertex = (distance * speed_vertex) /
+                (speed_facet - speed_vertex);
+    }
+    double offset_event = -dist_vertex / speed_vertex;
+    Point3SPtr point = KernelWrapper::offsetPoint(vertex->getPoint(),
+            arc->getDirection(), dist_vertex);
+    if (offset_event > offset_max) {
+        NodeSPtr node;
+        if (!result) {
+            node = Node::create(point);
+            result = PierceEvent::create();
+            result->setNode(node);
+        }
+        node = result->getNode();
+        node->clear();
+        node->addArc(arc);
+        node->setOffset(offset + offset_event);
+        node->setPoint(point);
+        result->setFacet(facet);
+        result->setVertex(vertex);
+        offset_max = offset_event;
     }
     return result;
 }
@@ -2319,116 +2895,288 @@ EdgeSplitEventSPtr SimpleStraightSkel::nextEdgeSplitEvent(PolyhedronSPtr polyhed
 PierceEventSPtr SimpleStraightSkel::nextPierceEvent(PolyhedronSPtr polyhedron, double offset) {
     ReadLock l(polyhedron->mutex());
     PierceEventSPtr result = PierceEventSPtr();
-    double offset_max = -std::numeric_limits<double>::max();
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
     while (it_v != polyhedron->vertices().end()) {
         VertexSPtr vertex = *it_v++;
         if (isReflex(vertex)) {
-            SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
-            ArcSPtr arc = data->getArc();
-            std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+            util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
             while (it_f != polyhedron->facets().end()) {
                 FacetSPtr facet = *it_f++;
-
-                bool contains_vertex = false;
-                std::list<VertexSPtr>::iterator it_v2 = facet->vertices().begin();
-                while (it_v2 != facet->vertices().end()) {
-                    VertexSPtr vertex_2 = *it_v2++;
-                    if (vertex_2->getPoint() == vertex->getPoint()) {
-                        contains_vertex = true;
-                        break;
+                PierceEventSPtr event = nextPierceEvent(vertex, facet, offset);
+                if (event) {
+                    if (isNextEvent(event, result, offset)) {
+                        result = event;
                     }
                 }
-                if (contains_vertex) {
-                    continue;
+            }
+        }
+    }
+    return result;
+}
+
+PierceEventSPtr SimpleStraightSkel::nextPierceEvent(VertexSPtr vertex,
+        const std::vector<FacetSPtr>& facets, FacetBVHSPtr facet_bvh,
+        double offset, double offset_min) {
+    PierceEventSPtr result = PierceEventSPtr();
+    std::vector<unsigned int> indices;
+    bool is_indexed = false;
+    if (facet_bvh && offset_min > -std::numeric_limits<double>::max()) {
+        // an event before offset_min is at most (offset - offset_min) * speed away
+        SkelVertexData* data = SkelVertexData::of(vertex);
+        ArcSPtr arc = data->getArc();
+        Facet* facet_vertex = vertex->facets().front().get();
+        std::optional<Point3> point_vertex_offset = KernelWrapper::intersection(
+                offsetPlane(facet_vertex, -1.0), *(arc->line()));
+        if (point_vertex_offset) {
+            double speed_vertex = KernelWrapper::distance(*(vertex->getPoint()), *point_vertex_offset);
+            double radius = (offset - offset_min) * speed_vertex * (1.0 + 1e-6);
+            facet_bvh->query(vertex, radius, indices);
+            is_indexed = true;
+        }
+    }
+    if (!is_indexed) {
+        for (unsigned int i = 0; i < facets.size(); i++) {
+            indices.push_back(i);
+        }
+    }
+    for (unsigned int i = 0; i < indices.size(); i++) {
+        PierceEventSPtr event = nextPierceEvent(vertex, facets[indices[i]], offset);
+        if (event) {
+            if (isNextEvent(event, result, offset)) {
+                result = event;
+            }
+        }
+    }
+    return result;
+}
+
+PierceEventSPtr SimpleStraightSkel::nextPierceEvent(PolyhedronSPtr polyhedron,
+        FacetBVHSPtr facet_bvh, double offset, double offset_min) {
+    ReadLock l(polyhedron->mutex());
+    PierceEventSPtr result = PierceEventSPtr();
+    std::vector<FacetSPtr> facets(polyhedron->facets().begin(),
+            polyhedron->facets().end());
+    if (facet_bvh && offset_min > -std::numeric_limits<double>::max()) {
+        facet_bvh->update(facets, offset - offset_min);
+    }
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        if (isReflex(vertex)) {
+            PierceEventSPtr event = nextPierceEvent(vertex, facets,
+                    facet_bvh, offset, offset_min);
+            if (event) {
+                if (isNextEvent(event, result, offset)) {
+                    result = event;
                 }
+            }
+        }
+    }
+    return result;
+}
 
-                bool has_edge_to_facet = false;
-                std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
-                while (it_e != vertex->edges().end()) {
-                    EdgeWPtr edge_wptr = *it_e++;
-                    if (!edge_wptr.expired()) {
-                        EdgeSPtr edge(edge_wptr);
-                        FacetSPtr facet_src = edge->getFacetL()->next(edge->getVertexSrc());
-                        FacetSPtr facet_dst = edge->getFacetR()->next(edge->getVertexDst());
-                        if (facet == facet_src || facet == facet_dst) {
-                            has_edge_to_facet = true;
-                            break;
+
+void SimpleStraightSkel::scanChunk(const ScanInput* input, unsigned int scanner,
+        unsigned int begin, unsigned int end, AbstractEventSPtr* result,
+        std::list<AbstractEventSPtr>* candidates) {
+    KernelWrapper::Scope kernel_scope(input->kernel);
+    double offset = input->offset;
+    AbstractEventSPtr event_max = AbstractEventSPtr();
+    for (unsigned int i = begin; i < end; i++) {
+        AbstractEventSPtr event = AbstractEventSPtr();
+        switch (scanner) {
+            case 2:
+                event = nextEdgeEvent(input->edges[i], offset);
+                break;
+            case 3:
+                event = nextEdgeMergeEvent(input->edges[i], offset);
+                break;
+            case 4:
+                event = nextTriangleEvent(input->edges[i], offset);
+                break;
+            case 5:
+                event = nextDblEdgeMergeEvent(input->edges[i], offset);
+                break;
+            case 6:
+                event = nextDblTriangleEvent(input->edges[i], offset);
+                break;
+            case 7:
+                event = nextTetrahedronEvent(input->edges[i], offset);
+                break;
+            case 8:
+                event = nextVertexEvent(input->vertices[i], offset);
+                break;
+            case 9:
+                event = nextFlipVertexEvent(input->vertices[i], offset);
+                break;
+            case 10:
+                event = nextSurfaceEvent(input->edges[i], offset);
+                break;
+            case 11:
+                event = nextPolyhedronSplitEvent(input->edges[i], offset);
+                break;
+            case 12:
+                event = nextSplitMergeEvent(input->vertices[i], offset);
+                break;
+            case 13:
+                for (unsigned int j = i+1; j < input->edges_reflex.size(); j++) {
+                    EdgeSplitEventSPtr event_split = nextEdgeSplitEvent(
+                            input->edges_reflex[i], input->edges_reflex[j], offset);
+                    if (event_split) {
+                        if (isNextEvent(event_split, event, offset)) {
+                            event = event_split;
                         }
                     }
                 }
-                if (has_edge_to_facet) {
-                    continue;
-                }
+                break;
+            case 14:
+                event = nextPierceEvent(input->vertices_reflex[i], input->facets,
+                        input->facet_bvh, offset, input->offset_min);
+                break;
+        }
+        if (event) {
+            if (isNextEvent(event, event_max, offset)) {
+                event_max = event;
+            }
+            if (candidates && event->getOffset() >=
+                    event_max->getOffset() - input->epsilon) {
+                candidates->push_back(event);
+            }
+        }
+    }
+    *result = event_max;
+    if (candidates && event_max) {
+        std::list<AbstractEventSPtr>::iterator it_c = candidates->begin();
+        while (it_c != candidates->end()) {
+            std::list<AbstractEventSPtr>::iterator it_current = it_c;
+            AbstractEventSPtr candidate = *it_c++;
+            if (candidate->getOffset() < event_max->getOffset() - input->epsilon) {
+                candidates->erase(it_current);
+            }
+        }
+    }
+}
 
-                if (KernelWrapper::side(facet->plane(), vertex->getPoint()) > 0) {
-                    continue;
-                }
-                if (!IsLineInFacet(facet, arc->line())) {
-                    continue;
+void SimpleStraightSkel::scanChunks(PolyhedronSPtr polyhedron, double offset,
+        AbstractEventSPtr events[], std::list<AbstractEventSPtr>* candidates) {
+    ReadLock l(polyhedron->mutex());
+    ScanInput input;
+    input.offset = offset;
+    input.epsilon = settings_->getBatchEpsilon();
+    input.kernel = kernel_;
+    input.offset_min = -std::numeric_limits<double>::max();
+    for (unsigned int i = 0; i < 2; i++) {
+        if (events[i] && events[i]->getOffset() > input.offset_min) {
+            input.offset_min = events[i]->getOffset();
+        }
+    }
+    if (input.offset_min > -std::numeric_limits<double>::max()) {
+        input.offset_min -= tieWindow(input.offset_min);
+    }
+    input.facet_bvh = facet_bvh_;
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        facet->plane();  // initializes the plane before the threads read it
+        input.facets.push_back(facet);
+    }
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        input.edges.push_back(edge);
+        if (isReflex(edge)) {
+            input.edges_reflex.push_back(edge);
+        }
+    }
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        input.vertices.push_back(vertex);
+        if (isReflex(vertex)) {
+            input.vertices_reflex.push_back(vertex);
+        }
+    }
+    if (input.facet_bvh && input.offset_min > -std::numeric_limits<double>::max()) {
+        input.facet_bvh->update(input.facets, offset - input.offset_min);
+    }
+
+    unsigned int num_chunks = 1;
+    if (thread_pool_) {
+        num_chunks = thread_pool_->size();
+    }
+    std::vector<AbstractEventSPtr> results(15 * num_chunks);
+    std::vector<std::list<AbstractEventSPtr> > results_candidates;
+    if (candidates) {
+        results_candidates.resize(15 * num_chunks);
+    }
+    std::vector<util::ThreadPool::Task> tasks;
+    for (unsigned int scanner = 2; scanner < 15; scanner++) {
+        unsigned int size = input.edges.size();
+        if (scanner == 8 || scanner == 9 || scanner == 12) {
+            size = input.vertices.size();
+        } else if (scanner == 13) {
+            size = input.edges_reflex.size();
+        } else if (scanner == 14) {
+            size = input.vertices_reflex.size();
+        }
+        for (unsigned int chunk = 0; chunk < num_chunks; chunk++) {
+            unsigned int begin = (size * chunk) / num_chunks;
+            unsigned int end = (size * (chunk+1)) / num_chunks;
+            if (begin < end) {
+                std::list<AbstractEventSPtr>* chunk_candidates = 0;
+                if (candidates) {
+                    chunk_candidates = &results_candidates[scanner * num_chunks + chunk];
                 }
+                tasks.push_back(std::bind(&SimpleStraightSkel::scanChunk,
+                        &input, scanner, begin, end,
+                        &results[scanner * num_chunks + chunk], chunk_candidates));
+            }
+        }
+    }
+    if (thread_pool_) {
+        thread_pool_->run(tasks);
+    } else {
+        for (unsigned int i = 0; i < tasks.size(); i++) {
+            tasks[i]();
+        }
+    }
 
-                FacetSPtr facet_vertex = FacetSPtr(vertex->facets().front());
-                double facet_speed_vertex = 1.0;
-                if (facet_vertex->hasData()) {
-                    facet_speed_vertex = std::dynamic_pointer_cast<SkelFacetData>(
-                            facet_vertex->getData())->getSpeed();
-                }
-                Plane3SPtr plane_vertex_offset = KernelWrapper::offsetPlane(facet_vertex->plane(), -facet_speed_vertex);
-                Point3SPtr point_vertex_offset = KernelWrapper::intersection(plane_vertex_offset, arc->line());
-                double speed_vertex = KernelWrapper::distance(vertex->getPoint(), point_vertex_offset);
-
-                Point3SPtr point_facet = KernelWrapper::intersection(facet->plane(), arc->line());
-                double facet_speed = 1.0;
-                if (facet->hasData()) {
-                    facet_speed = std::dynamic_pointer_cast<SkelFacetData>(
-                            facet->getData())->getSpeed();
+    for (unsigned int scanner = 2; scanner < 15; scanner++) {
+        for (unsigned int chunk = 0; chunk < num_chunks; chunk++) {
+            AbstractEventSPtr event = results[scanner * num_chunks + chunk];
+            if (event) {
+                if (isNextEvent(event, events[scanner], offset)) {
+                    events[scanner] = event;
                 }
-                Plane3SPtr plane_facet_offset = KernelWrapper::offsetPlane(facet->plane(), -facet_speed);
-                Point3SPtr point_facet_offset = KernelWrapper::intersection(plane_facet_offset, arc->line());
-                double speed_facet = KernelWrapper::distance(point_facet, point_facet_offset);
-
-                double distance = KernelWrapper::distance(vertex->getPoint(), point_facet);
-                double dist_vertex = (distance * speed_vertex) /
-                        (speed_vertex + speed_facet);
-                if (KernelWrapper::comparePoints(arc->getDirection(),
-                        point_facet, point_facet_offset) < 0) {
-                    // for weighted straight skeleton
-                    // reflex vertex and facet move into same direction
-                    if (speed_facet < speed_vertex) {
-                        // facet to slow
-                        continue;
-                    }
-                    dist_vertex = (distance * speed_vertex) /
-                            (speed_facet - speed_vertex);
-                }
-                double offset_event = -dist_vertex / speed_vertex;
-                Point3SPtr point = KernelWrapper::offsetPoint(vertex->getPoint(),
-                        arc->getDirection(), dist_vertex);
-                if (offset_event > offset_max) {
-                    NodeSPtr node;
-                    if (!result) {
-                        node = Node::create(point);
-                        result = PierceEvent::create();
-                        result->setNode(node);
-                    }
-                    node = result->getNode();
-                    node->clear();
-                    node->addArc(arc);
-                    node->setOffset(offset + offset_event);
-                    node->setPoint(point);
-                    result->setFacet(facet);
-                    result->setVertex(vertex);
-                    offset_max = offset_event;
+            }
+        }
+    }
+
+    if (candidates) {
+        double offset_max = -std::numeric_limits<double>::max();
+        for (unsigned int scanner = 2; scanner < 15; scanner++) {
+            if (events[scanner] && events[scanner]->getOffset() > offset_max) {
+                offset_max = events[scanner]->getOffset();
+            }
+        }
+        for (unsigned int i = 0; i < results_candidates.size(); i++) {
+            std::list<AbstractEventSPtr>::iterator it_c = results_candidates[i].begin();
+            while (it_c != results_candidates[i].end()) {
+                AbstractEventSPtr candidate = *it_c++;
+                if (candidate->getOffset() >= offset_max - input.epsilon) {
+                    candidates->push_back(candidate);
                 }
             }
         }
     }
-    return result;
 }
 
-
 AbstractEventSPtr SimpleStraightSkel::nextEvent(PolyhedronSPtr polyhedron, double offset) {
+    return nextEvent(polyhedron, offset, 0);
+}
+
+AbstractEventSPtr SimpleStraightSkel::nextEvent(PolyhedronSPtr polyhedron, double offset,
+        std::list<AbstractEventSPtr>* candidates) {
     AbstractEventSPtr result = AbstractEventSPtr();
     if (!polyhedron) {
         return result;
@@ -2440,8 +3188,7 @@ AbstractEventSPtr SimpleStraightSkel::nextEvent(PolyhedronSPtr polyhedron, doubl
     for (unsigned int i = 0; i < 15; i++) {
         events[i] = AbstractEventSPtr();
     }
-    double const_offset = util::Configuration::getInstance()->getDouble(
-            "algo_3d_SimpleStraightSkel", "const_offset");
+    double const_offset = settings_->getConstOffset();
     if (const_offset != 0.0) {
         double next_offset = floor(offset/const_offset + 1.0) * const_offset;
         if (next_offset >= offset) {
@@ -2452,61 +3199,508 @@ AbstractEventSPtr SimpleStraightSkel::nextEvent(PolyhedronSPtr polyhedron, doubl
     if (!save_offsets_.empty()) {
         events[1] = SaveOffsetEvent::create(save_offsets_.front());
     }
-    events[2] = nextEdgeEvent(polyhedron, offset);
-    events[3] = nextEdgeMergeEvent(polyhedron, offset);
-    events[4] = nextTriangleEvent(polyhedron, offset);
-    events[5] = nextDblEdgeMergeEvent(polyhedron, offset);
-    events[6] = nextDblTriangleEvent(polyhedron, offset);
-    events[7] = nextTetrahedronEvent(polyhedron, offset);
-    events[8] = nextVertexEvent(polyhedron, offset);
-    events[9] = nextFlipVertexEvent(polyhedron, offset);
-    events[10] = nextSurfaceEvent(polyhedron, offset);
-    events[11] = nextPolyhedronSplitEvent(polyhedron, offset);
-    events[12] = nextSplitMergeEvent(polyhedron, offset);
-    events[13] = nextEdgeSplitEvent(polyhedron, offset);
-    events[14] = nextPierceEvent(polyhedron, offset);
-    for (unsigned int i = 0; i < 15; i++) {
+    if (event_queue_) {
+        ReadLock l(polyhedron->mutex());
+        events[2] = event_queue_->top(offset);
+    } else if (thread_pool_ || candidates) {
+        scanChunks(polyhedron, offset, events, candidates);
+    } else {
+        events[2] = nextEdgeEvent(polyhedron, offset);
+        events[3] = nextEdgeMergeEvent(polyhedron, offset);
+        events[4] = nextTriangleEvent(polyhedron, offset);
+        events[5] = nextDblEdgeMergeEvent(polyhedron, offset);
+        events[6] = nextDblTriangleEvent(polyhedron, offset);
+        events[7] = nextTetrahedronEvent(polyhedron, offset);
+        events[8] = nextVertexEvent(polyhedron, offset);
+        events[9] = nextFlipVertexEvent(polyhedron, offset);
+        events[10] = nextSurfaceEvent(polyhedron, offset);
+        events[11] = nextPolyhedronSplitEvent(polyhedron, offset);
+        events[12] = nextSplitMergeEvent(polyhedron, offset);
+        events[13] = nextEdgeSplitEvent(polyhedron, offset);
+        // pierce events before the best event so far cannot be the next event,
+        // unless they are within its tie window
+        double offset_min = -std::numeric_limits<double>::max();
+        for (unsigned int i = 0; i < 14; i++) {
+            if (events[i] && events[i]->getOffset() > offset_min) {
+                offset_min = events[i]->getOffset();
+            }
+        }
+        if (offset_min > -std::numeric_limits<double>::max()) {
+            offset_min -= tieWindow(offset_min);
+        }
+        events[14] = nextPierceEvent(polyhedron, facet_bvh_, offset, offset_min);
+    }
+    ReadLock l(polyhedron->mutex());
+    // highest computed offset, the later event on equal offsets
+    int i_max = -1;
+    for (int i = 0; i < 15; i++) {
         if (events[i]) {
-            if (!result) {
-                result = events[i];
-            } else if (result->getOffset() < events[i]->getOffset()) {
-                result = events[i];
-            } else if (result->getOffset() == events[i]->getOffset()) {
-                DEBUG_VAL("WARNING: More than one possible next event.");
-                DEBUG_VAL(result->toString());
-                DEBUG_VAL(events[i]->toString());
-                result = events[i];
+            if (i_max < 0 || events[i]->getOffset() >= events[i_max]->getOffset()) {
+                i_max = i;
+            }
+        }
+    }
+    if (i_max < 0) {
+        return result;
+    }
+    // the order within the tie cluster is decided by the certified offsets only,
+    // so the result does not depend on the order of the events
+    std::vector<int> ties;
+    double offset_tie = events[i_max]->getOffset() - tieWindow(events[i_max]->getOffset());
+    for (int i = 0; i < 15; i++) {
+        if (events[i] && events[i]->getOffset() >= offset_tie) {
+            ties.push_back(i);
+        }
+    }
+    result = events[i_max];
+    if (ties.size() > 1) {
+        std::vector<bool> after(ties.size(), false);
+        for (unsigned int a = 0; a < ties.size(); a++) {
+            for (unsigned int b = a+1; b < ties.size(); b++) {
+                int order = certifyOrder(events[ties[a]], events[ties[b]], offset);
+                if (order > 0) {
+                    after[b] = true;
+                } else if (order < 0) {
+                    after[a] = true;
+                }
+            }
+        }
+        int i_result = -1;
+        unsigned int num_uncertified = 0;
+        for (unsigned int a = 0; a < ties.size(); a++) {
+            if (!after[a]) {
+                num_uncertified++;
+                if (i_result < 0 ||
+                        events[ties[a]]->getOffset() >= events[i_result]->getOffset()) {
+                    i_result = ties[a];
+                }
+            }
+        }
+        if (i_result >= 0) {
+            result = events[i_result];
+        }
+        if (num_uncertified > 1) {
+            DEBUG_VAL("WARNING: More than one possible next event.");
+            for (unsigned int a = 0; a < ties.size(); a++) {
+                if (!after[a]) {
+                    DEBUG_VAL(events[ties[a]]->toString());
+                }
             }
         }
     }
     result->setHighlight(true);
+    if (candidates) {
+        if (result == events[0] || result == events[1]) {
+            candidates->clear();
+        }
+        std::list<AbstractEventSPtr>::iterator it_c = candidates->begin();
+        while (it_c != candidates->end()) {
+            std::list<AbstractEventSPtr>::iterator it_current = it_c;
+            AbstractEventSPtr candidate = *it_c++;
+            // constant and save offset events have to be handled before
+            if ((events[0] && candidate->getOffset() < events[0]->getOffset()) ||
+                    (events[1] && candidate->getOffset() < events[1]->getOffset())) {
+                candidates->erase(it_current);
+            }
+        }
+    }
+    return result;
+}
+
+std::list<AbstractEventSPtr> SimpleStraightSkel::nextEvents(PolyhedronSPtr polyhedron, double offset) {
+    std::list<AbstractEventSPtr> result;
+    if (!settings_->getEventBatching()) {
+        AbstractEventSPtr event = nextEvent(polyhedron, offset);
+        if (event) {
+            result.push_back(event);
+        }
+        return result;
+    }
+    std::list<AbstractEventSPtr> candidates;
+    AbstractEventSPtr event = nextEvent(polyhedron, offset, &candidates);
+    if (!event) {
+        return result;
+    }
+    result.push_back(event);
+    ReadLock l(polyhedron->mutex());
+    // an event must not overtake an earlier event that it depends on
+    candidates.sort(isLaterEvent);
+    std::unordered_set<const Facet*> facets_batch;
+    std::unordered_set<const Facet*> facets_blocked;
+    collectFacets(event, facets_batch);
+    std::list<AbstractEventSPtr>::iterator it_c = candidates.begin();
+    while (it_c != candidates.end()) {
+        AbstractEventSPtr candidate = *it_c++;
+        if (candidate == event) {
+            continue;
+        }
+        std::unordered_set<const Facet*> facets;
+        collectFacets(candidate, facets);
+        bool is_independent = true;
+        std::unordered_set<const Facet*>::iterator it_f = facets.begin();
+        while (it_f != facets.end()) {
+            const Facet* facet = *it_f++;
+            if (facets_batch.find(facet) != facets_batch.end() ||
+                    facets_blocked.find(facet) != facets_blocked.end()) {
+                is_independent = false;
+                break;
+            }
+        }
+        if (is_independent) {
+            facets_batch.insert(facets.begin(), facets.end());
+            candidate->setHighlight(true);
+            result.push_back(candidate);
+        } else {
+            facets_blocked.insert(facets.begin(), facets.end());
+        }
+    }
+    return result;
+}
+
+bool SimpleStraightSkel::isLaterEvent(AbstractEventSPtr event_1, AbstractEventSPtr event_2) {
+    return event_1->getOffset() > event_2->getOffset();
+}
+
+NodeSPtr SimpleStraightSkel::getNode(AbstractEventSPtr event) {
+    NodeSPtr result;
+    int type = event->getType();
+    if (type == AbstractEvent::EDGE_EVENT) {
+        result = std::dynamic_pointer_cast<EdgeEvent>(event)->getNode();
+    } else if (type == AbstractEvent::EDGE_MERGE_EVENT) {
+        result = std::dynamic_pointer_cast<EdgeMergeEvent>(event)->getNode();
+    } else if (type == AbstractEvent::TRIANGLE_EVENT) {
+        result = std::dynamic_pointer_cast<TriangleEvent>(event)->getNode();
+    } else if (type == AbstractEvent::DBL_EDGE_MERGE_EVENT) {
+        result = std::dynamic_pointer_cast<DblEdgeMergeEvent>(event)->getNode();
+    } else if (type == AbstractEvent::DBL_TRIANGLE_EVENT) {
+        result = std::dynamic_pointer_cast<DblTriangleEvent>(event)->getNode();
+    } else if (type == AbstractEvent::TETRAHEDRON_EVENT) {
+        result = std::dynamic_pointer_cast<TetrahedronEvent>(event)->getNode();
+    } else if (type == AbstractEvent::VERTEX_EVENT) {
+        result = std::dynamic_pointer_cast<VertexEvent>(event)->getNode();
+    } else if (type == AbstractEvent::FLIP_VERTEX_EVENT) {
+        result = std::dynamic_pointer_cast<FlipVertexEvent>(event)->getNode();
+    } else if (type == AbstractEvent::SURFACE_EVENT) {
+        result = std::dynamic_pointer_cast<SurfaceEvent>(event)->getNode();
+    } else if (type == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+        result = std::dynamic_pointer_cast<PolyhedronSplitEvent>(event)->getNode();
+    } else if (type == AbstractEvent::SPLIT_MERGE_EVENT) {
+        result = std::dynamic_pointer_cast<SplitMergeEvent>(event)->getNode();
+    } else if (type == AbstractEvent::EDGE_SPLIT_EVENT) {
+        result = std::dynamic_pointer_cast<EdgeSplitEvent>(event)->getNode();
+    } else if (type == AbstractEvent::PIERCE_EVENT) {
+        result = std::dynamic_pointer_cast<PierceEvent>(event)->getNode();
+    }
+    return result;
+}
+
+template<class T>
+bool SimpleStraightSkel::certifyOffset(AbstractEventSPtr event, double offset,
+        util::Interval<T>& result) {
+    NodeSPtr node = getNode(event);
+    if (!node || !node->getPoint()) {
+        return false;
+    }
+    Point3SPtr point = node->getPoint();
+    double offset_event = event->getOffset() - offset;
+    std::unordered_set<const Facet*> facets;
+    collectFacets(event, facets);
+    // residuals of the computed point and offset, only facets that
+    // reach the point at the offset of the event define it
+    double tolerance = 1e-6 * (1.0 + fabs(offset_event));
+    std::vector<std::pair<double, FacetSPtr> > candidates;
+    std::unordered_set<const Facet*>::iterator it_f = facets.begin();
+    while (it_f != facets.end()) {
+        FacetSPtr facet = std::const_pointer_cast<Facet>((*it_f++)->shared_from_this());
+        if (!facet->hasData() || !facet->plane()) {
+            continue;
+        }
+        double residual = fabs(offsetDist(facet, point) - offset_event);
+        if (residual <= tolerance) {
+            candidates.push_back(std::pair<double, FacetSPtr>(residual, facet));
+        }
+    }
+    if (candidates.size() < 4) {
+        return false;
+    }
+    std::sort(candidates.begin(), candidates.end());
+    if (candidates.size() > 6) {
+        candidates.resize(6);
+    }
+    // a*x + b*y + c*z - |n|*speed*t = -d for every facet
+    const unsigned int n = candidates.size();
+    std::vector<util::Interval<T> > rows(n * 5);
+    for (unsigned int i = 0; i < n; i++) {
+        FacetSPtr facet = candidates[i].second;
+        Plane3SPtr plane = facet->plane();
+#ifdef USE_CGAL
+        util::Interval<T> a(CGAL::to_double(plane->a()));
+        util::Interval<T> b(CGAL::to_double(plane->b()));
+        util::Interval<T> c(CGAL::to_double(plane->c()));
+        util::Interval<T> d(CGAL::to_double(plane->d()));
+#else
+        util::Interval<T> a(plane->getA());
+        util::Interval<T> b(plane->getB());
+        util::Interval<T> c(plane->getC());
+        util::Interval<T> d(plane->getD());
+#endif
+        util::Interval<T> speed(SkelFacetData::of(facet)->getSpeed());
+        rows[i*5] = a;
+        rows[i*5 + 1] = b;
+        rows[i*5 + 2] = c;
+        rows[i*5 + 3] = -((a*a + b*b + c*c).sqrt() * speed);
+        rows[i*5 + 4] = -d;
+    }
+    // the best fitting combination of 4 facets that is not singular
+    for (unsigned int i0 = 0; i0 < n; i0++) {
+        for (unsigned int i1 = i0 + 1; i1 < n; i1++) {
+            for (unsigned int i2 = i1 + 1; i2 < n; i2++) {
+                for (unsigned int i3 = i2 + 1; i3 < n; i3++) {
+                    unsigned int selected[4] = {i0, i1, i2, i3};
+                    util::Interval<T> m[4][5];
+                    for (unsigned int r = 0; r < 4; r++) {
+                        for (unsigned int j = 0; j < 5; j++) {
+                            m[r][j] = rows[selected[r]*5 + j];
+                        }
+                    }
+                    // gaussian elimination with partial pivoting,
+                    // the offset is the last unknown
+                    bool singular = false;
+                    for (unsigned int k = 0; k < 4 && !singular; k++) {
+                        unsigned int pivot = k;
+                        for (unsigned int r = k + 1; r < 4; r++) {
+                            if (m[r][k].mignitude() > m[pivot][k].mignitude()) {
+                                pivot = r;
+                            }
+                        }
+                        if (m[pivot][k].containsZero()) {
+                            singular = true;
+                            break;
+                        }
+                        if (pivot != k) {
+                            for (unsigned int j = k; j < 5; j++) {
+                                std::swap(m[k][j], m[pivot][j]);
+                            }
+                        }
+                        for (unsigned int r = k + 1; r < 4; r++) {
+                            util::Interval<T> factor = m[r][k] / m[k][k];
+                            for (unsigned int j = k + 1; j < 5; j++) {
+                                m[r][j] = m[r][j] - factor * m[k][j];
+                            }
+                        }
+                    }
+                    if (singular) {
+                        continue;
+                    }
+                    util::Interval<T> offset_rel = m[3][4] / m[3][3];
+                    if (!offset_rel.isBounded()) {
+                        continue;
+                    }
+                    result = util::Interval<T>(offset) + offset_rel;
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+template bool SimpleStraightSkel::certifyOffset<double>(AbstractEventSPtr event,
+        double offset, util::Interval<double>& result);
+template bool SimpleStraightSkel::certifyOffset<long double>(AbstractEventSPtr event,
+        double offset, util::Interval<long double>& result);
+
+int SimpleStraightSkel::compareEvents(AbstractEventSPtr event_1, AbstractEventSPtr event_2,
+        double offset) {
+    double offset_1 = event_1->getOffset();
+    double offset_2 = event_2->getOffset();
+    if (fabs(offset_1 - offset_2) <= tieWindow(std::max(fabs(offset_1), fabs(offset_2)))) {
+        int order = certifyOrder(event_1, event_2, offset);
+        if (order != 0) {
+            return order;
+        }
+    }
+    int result = 0;
+    if (offset_1 > offset_2) {
+        result = 1;
+    } else if (offset_1 < offset_2) {
+        result = -1;
+    }
     return result;
 }
 
+int SimpleStraightSkel::certifyOrder(AbstractEventSPtr event_1, AbstractEventSPtr event_2,
+        double offset) {
+    util::Interval<double> interval_1;
+    util::Interval<double> interval_2;
+    if (certifyOffset(event_1, offset, interval_1) &&
+            certifyOffset(event_2, offset, interval_2)) {
+        if (interval_1.isGreater(interval_2)) {
+            return 1;
+        } else if (interval_2.isGreater(interval_1)) {
+            return -1;
+        }
+        // overlapping intervals are evaluated again
+        util::Interval<long double> interval_precise_1;
+        util::Interval<long double> interval_precise_2;
+        if (certifyOffset(event_1, offset, interval_precise_1) &&
+                certifyOffset(event_2, offset, interval_precise_2)) {
+            if (interval_precise_1.isGreater(interval_precise_2)) {
+                return 1;
+            } else if (interval_precise_2.isGreater(interval_precise_1)) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+bool SimpleStraightSkel::isNextEvent(AbstractEventSPtr event, AbstractEventSPtr result,
+        double offset) {
+    return (!result || compareEvents(event, result, offset) > 0);
+}
+
+double SimpleStraightSkel::tieWindow(double offset) {
+    return TIE_EPSILON * std::max(1.0, fabs(offset));
+}
+
+void SimpleStraightSkel::collectFacets(AbstractEventSPtr event,
+        std::unordered_set<const Facet*>& facets) {
+    std::list<VertexSPtr> vertices;
+    std::list<EdgeSPtr> edges;
+    std::list<FacetSPtr> facets_event;
+    int type = event->getType();
+    if (type == AbstractEvent::EDGE_EVENT) {
+        edges.push_back(std::dynamic_pointer_cast<EdgeEvent>(event)->getEdge());
+    } else if (type == AbstractEvent::EDGE_MERGE_EVENT) {
+        EdgeMergeEventSPtr edge_merge_event = std::dynamic_pointer_cast<EdgeMergeEvent>(event);
+        edges.push_back(edge_merge_event->getEdge1());
+        edges.push_back(edge_merge_event->getEdge2());
+        facets_event.push_back(edge_merge_event->getFacet());
+    } else if (type == AbstractEvent::TRIANGLE_EVENT) {
+        TriangleEventSPtr triangle_event = std::dynamic_pointer_cast<TriangleEvent>(event);
+        edges.push_back(triangle_event->getEdgeBegin());
+        facets_event.push_back(triangle_event->getFacet());
+    } else if (type == AbstractEvent::DBL_EDGE_MERGE_EVENT) {
+        DblEdgeMergeEventSPtr dbl_edge_merge_event = std::dynamic_pointer_cast<DblEdgeMergeEvent>(event);
+        edges.push_back(dbl_edge_merge_event->getEdge11());
+        edges.push_back(dbl_edge_merge_event->getEdge12());
+        edges.push_back(dbl_edge_merge_event->getEdge21());
+        edges.push_back(dbl_edge_merge_event->getEdge22());
+        facets_event.push_back(dbl_edge_merge_event->getFacet1());
+        facets_event.push_back(dbl_edge_merge_event->getFacet2());
+    } else if (type == AbstractEvent::DBL_TRIANGLE_EVENT) {
+        edges.push_back(std::dynamic_pointer_cast<DblTriangleEvent>(event)->getEdge());
+    } else if (type == AbstractEvent::TETRAHEDRON_EVENT) {
+        edges.push_back(std::dynamic_pointer_cast<TetrahedronEvent>(event)->getEdgeBegin());
+    } else if (type == AbstractEvent::VERTEX_EVENT) {
+        VertexEventSPtr vertex_event = std::dynamic_pointer_cast<VertexEvent>(event);
+        vertices.push_back(vertex_event->getVertex1());
+        vertices.push_back(vertex_event->getVertex2());
+    } else if (type == AbstractEvent::FLIP_VERTEX_EVENT) {
+        FlipVertexEventSPtr flip_vertex_event = std::dynamic_pointer_cast<FlipVertexEvent>(event);
+        vertices.push_back(flip_vertex_event->getVertex1());
+        vertices.push_back(flip_vertex_event->getVertex2());
+    } else if (type == AbstractEvent::SURFACE_EVENT) {
+        SurfaceEventSPtr surface_event = std::dynamic_pointer_cast<SurfaceEvent>(event);
+        edges.push_back(surface_event->getEdge1());
+        edges.push_back(surface_event->getEdge2());
+    } else if (type == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+        PolyhedronSplitEventSPtr polyhedron_split_event = std::dynamic_pointer_cast<PolyhedronSplitEvent>(event);
+        edges.push_back(polyhedron_split_event->getEdge1());
+        edges.push_back(polyhedron_split_event->getEdge2());
+    } else if (type == AbstractEvent::SPLIT_MERGE_EVENT) {
+        SplitMergeEventSPtr split_merge_event = std::dynamic_pointer_cast<SplitMergeEvent>(event);
+        vertices.push_back(split_merge_event->getVertex1());
+        vertices.push_back(split_merge_event->getVertex2());
+    } else if (type == AbstractEvent::EDGE_SPLIT_EVENT) {
+        EdgeSplitEventSPtr edge_split_event = std::dynamic_pointer_cast<EdgeSplitEvent>(event);
+        edges.push_back(edge_split_event->getEdge1());
+        edges.push_back(edge_split_event->getEdge2());
+    } else if (type == AbstractEvent::PIERCE_EVENT) {
+        PierceEventSPtr pierce_event = std::dynamic_pointer_cast<PierceEvent>(event);
+        vertices.push_back(pierce_event->getVertex());
+        facets_event.push_back(pierce_event->getFacet());
+    }
+    std::list<EdgeSPtr>::iterator it_e = edges.begin();
+    while (it_e != edges.end()) {
+        EdgeSPtr edge = *it_e++;
+        if (edge) {
+            vertices.push_back(edge->getVertexSrc());
+            vertices.push_back(edge->getVertexDst());
+        }
+    }
+    std::list<FacetSPtr>::iterator it_f = facets_event.begin();
+    while (it_f != facets_event.end()) {
+        FacetSPtr facet = *it_f++;
+        if (facet) {
+            vertices.insert(vertices.end(),
+                    facet->vertices().begin(), facet->vertices().end());
+        }
+    }
+    std::list<VertexSPtr>::iterator it_v = vertices.begin();
+    while (it_v != vertices.end()) {
+        VertexSPtr vertex = *it_v++;
+        if (!vertex) {
+            continue;
+        }
+        std::list<FacetHandle>::iterator it_fw = vertex->facets().begin();
+        while (it_fw != vertex->facets().end()) {
+            facets.insert((*it_fw++).get());
+        }
+    }
+}
+
+void SimpleStraightSkel::handleEvent(AbstractEventSPtr event, PolyhedronSPtr polyhedron) {
+    if (event->getType() == AbstractEvent::EDGE_EVENT) {
+        handleEdgeEvent(std::dynamic_pointer_cast<EdgeEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::EDGE_MERGE_EVENT) {
+        handleEdgeMergeEvent(std::dynamic_pointer_cast<EdgeMergeEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::TRIANGLE_EVENT) {
+        handleTriangleEvent(std::dynamic_pointer_cast<TriangleEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::DBL_EDGE_MERGE_EVENT) {
+        handleDblEdgeMergeEvent(std::dynamic_pointer_cast<DblEdgeMergeEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::DBL_TRIANGLE_EVENT) {
+        handleDblTriangleEvent(std::dynamic_pointer_cast<DblTriangleEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::TETRAHEDRON_EVENT) {
+        handleTetrahedronEvent(std::dynamic_pointer_cast<TetrahedronEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::VERTEX_EVENT) {
+        handleVertexEvent(std::dynamic_pointer_cast<VertexEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::FLIP_VERTEX_EVENT) {
+        handleFlipVertexEvent(std::dynamic_pointer_cast<FlipVertexEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::SURFACE_EVENT) {
+        handleSurfaceEvent(std::dynamic_pointer_cast<SurfaceEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+        handlePolyhedronSplitEvent(std::dynamic_pointer_cast<PolyhedronSplitEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::SPLIT_MERGE_EVENT) {
+        handleSplitMergeEvent(std::dynamic_pointer_cast<SplitMergeEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::EDGE_SPLIT_EVENT) {
+        handleEdgeSplitEvent(std::dynamic_pointer_cast<EdgeSplitEvent>(event), polyhedron);
+    } else if (event->getType() == AbstractEvent::PIERCE_EVENT) {
+        handlePierceEvent(std::dynamic_pointer_cast<PierceEvent>(event), polyhedron);
+    }
+}
+
 PolyhedronSPtr SimpleStraightSkel::shiftFacets(PolyhedronSPtr polyhedron, double offset) {
     PolyhedronSPtr result = Polyhedron::create();
 
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
     while (it_v != polyhedron->vertices().end()) {
         VertexSPtr vertex = *it_v++;
-        Plane3SPtr planes[3];
+        Plane3 planes[3];
         unsigned int i = 0;
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (i < 3 && it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet = FacetSPtr(facet_wptr);
-                double speed = 1.0;
-                if (facet->hasData()) {
-                    speed = std::dynamic_pointer_cast<SkelFacetData>(
-                            facet->getData())->getSpeed();
-                }
-                planes[i] = KernelWrapper::offsetPlane(facet->plane(), offset*speed);
-                i++;
-            }
+            FacetHandle facet = *it_f++;
+            planes[i] = offsetPlane(facet.get(), offset);
+            i++;
         }
         if (i >= 3) {
-            Point3SPtr point = KernelWrapper::intersection(planes[0], planes[1], planes[2]);
+            std::optional<Point3> p = KernelWrapper::intersection(planes[0], planes[1], planes[2]);
+            Point3SPtr point;
+            if (p) {
+                point = KernelFactory::createPoint3(*p);
+            }
             if (!point) {
                 result = PolyhedronSPtr();
                 DEBUG_SPTR(result);
@@ -2514,13 +3708,13 @@ PolyhedronSPtr SimpleStraightSkel::shiftFacets(PolyhedronSPtr polyhedron, double
             }
             VertexSPtr offset_vertex = Vertex::create(point);
             // SkelVertexData for each vertex should be created by init
-            SkelVertexDataSPtr data;
+            SkelVertexData* data = 0;
             if (vertex->hasData()) {
-                data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+                data = SkelVertexData::of(vertex);
                 SkelVertexDataSPtr offset_data = SkelVertexData::create(offset_vertex);
                 offset_data->setArc(data->getArc());
             } else {
-                data = SkelVertexData::create(vertex);
+                data = SkelVertexData::create(vertex).get();
             }
             data->setOffsetVertex(offset_vertex);
             result->addVertex(offset_vertex);
@@ -2530,15 +3724,10 @@ PolyhedronSPtr SimpleStraightSkel::shiftFacets(PolyhedronSPtr polyhedron, double
     it_v = polyhedron->vertices().begin();
     while (it_v != polyhedron->vertices().end()) {
         VertexSPtr vertex = *it_v++;
-        EdgeSPtr edge;
-        unsigned int i = 0;
-        std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
-        while (it_e != vertex->edges().end()) {
-            EdgeWPtr edge_wptr = *it_e++;
-            if (!edge_wptr.expired()) {
-                edge = EdgeSPtr(edge_wptr);
-                i++;
-            }
+        EdgeHandle edge;
+        unsigned int i = vertex->edges().size();
+        if (i > 0) {
+            edge = vertex->edges().back();
         }
         if (i == 1) {
             VertexSPtr vertex_other;
@@ -2547,72 +3736,74 @@ PolyhedronSPtr SimpleStraightSkel::shiftFacets(PolyhedronSPtr polyhedron, double
             } else if (edge->getVertexDst() == vertex) {
                 vertex_other = edge->getVertexSrc();
             }
-            SkelVertexDataSPtr data_other = std::dynamic_pointer_cast<SkelVertexData>(
-                    vertex_other->getData());
+            SkelVertexData* data_other = SkelVertexData::of(vertex_other);
             VertexSPtr offset_vertex_other = data_other->getOffsetVertex();
             Vector3 direction =
                     *(offset_vertex_other->getPoint()) - *(vertex_other->getPoint());
             Point3SPtr point = KernelFactory::createPoint3(
                     *(vertex->getPoint()) + direction);
             VertexSPtr offset_vertex = Vertex::create(point);
-            SkelVertexDataSPtr data;
+            SkelVertexData* data = 0;
             if (vertex->hasData()) {
-                data = std::dynamic_pointer_cast<SkelVertexData>(vertex->getData());
+                data = SkelVertexData::of(vertex);
             } else {
-                data = SkelVertexData::create(vertex);
+                data = SkelVertexData::create(vertex).get();
             }
             data->setOffsetVertex(offset_vertex);
             result->addVertex(offset_vertex);
         }
     }
 
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
-        SkelVertexDataSPtr vertex_src_data = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexSrc()->getData());
-        SkelVertexDataSPtr vertex_dst_data = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexDst()->getData());
+        SkelVertexData* vertex_src_data = SkelVertexData::of(edge->getVertexSrc());
+        SkelVertexData* vertex_dst_data = SkelVertexData::of(edge->getVertexDst());
         if (vertex_src_data && vertex_dst_data) {
             VertexSPtr offset_vertex_src = vertex_src_data->getOffsetVertex();
             VertexSPtr offset_vertex_dst = vertex_dst_data->getOffsetVertex();
             EdgeSPtr offset_edge = Edge::create(offset_vertex_src, offset_vertex_dst);
-            SkelEdgeDataSPtr data;
+            SkelEdgeData* data = 0;
             if (edge->hasData()) {
-                data = std::dynamic_pointer_cast<SkelEdgeData>(edge->getData());
+                data = SkelEdgeData::of(edge);
                 SkelEdgeDataSPtr offset_data = SkelEdgeData::create(offset_edge);
                 offset_data->setSheet(data->getSheet());
             } else {
-                data = SkelEdgeData::create(edge);
+                data = SkelEdgeData::create(edge).get();
             }
             data->setOffsetEdge(offset_edge);
             result->addEdge(offset_edge);
         }
     }
 
-    std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         FacetSPtr facet = *it_f++;
         FacetSPtr offset_facet = Facet::create();
-        SkelFacetDataSPtr data;
+        SkelFacetData* data = 0;
         double speed = 1.0;
         if (facet->hasData()) {
-            data = std::dynamic_pointer_cast<SkelFacetData>(facet->getData());
+            data = SkelFacetData::of(facet);
             speed = data->getSpeed();
             SkelFacetDataSPtr data_offset = SkelFacetData::create(offset_facet);
             data_offset->setFacetOrigin(data->getFacetOrigin());
             data_offset->setSpeed(speed);
         } else {
-            data = SkelFacetData::create(facet);
+            data = SkelFacetData::create(facet).get();
         }
-        Plane3SPtr offset_plane = KernelWrapper::offsetPlane(facet->plane(), offset*speed);
+        Plane3SPtr offset_plane = KernelFactory::createPlane3(
+                offsetPlane(facet.get(), offset));
         offset_facet->setPlane(offset_plane);
+        // the offset plane has a unit normal already
+        SkelFacetData* data_offset_facet = SkelFacetData::of(offset_facet);
+        if (data_offset_facet) {
+            data_offset_facet->setUnitPlane(offset_plane, *offset_plane);
+        }
         std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
         while (it_v != facet->vertices().end()) {
             VertexSPtr vertex = *it_v++;
             if (vertex->hasData()) {
-                SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-                    vertex->getData());
+                SkelVertexData* vertex_data = SkelVertexData::of(vertex);
                 VertexSPtr offset_vertex = vertex_data->getOffsetVertex();
                 if (offset_vertex) {
                     offset_facet->addVertex(offset_vertex);
@@ -2622,8 +3813,7 @@ PolyhedronSPtr SimpleStraightSkel::shiftFacets(PolyhedronSPtr polyhedron, double
         std::list<EdgeSPtr>::iterator it_e = facet->edges().begin();
         while (it_e != facet->edges().end()) {
             EdgeSPtr edge = *it_e++;
-            SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-                edge->getData());
+            SkelEdgeData* edge_data = SkelEdgeData::of(edge);
             EdgeSPtr offset_edge = edge_data->getOffsetEdge();
             if (facet == edge->getFacetL()) {
                 offset_edge->setFacetL(offset_facet);
@@ -2644,40 +3834,245 @@ PolyhedronSPtr SimpleStraightSkel::shiftFacets(PolyhedronSPtr polyhedron, double
     return result;
 }
 
+HalfEdgeMeshSPtr SimpleStraightSkel::shiftFacets(HalfEdgeMeshSPtr mesh, double offset) {
+    HalfEdgeMeshSPtr result = mesh->clone();
+    for (uint32_t f = 0; f < mesh->numFacets(); f++) {
+        FacetSPtr facet = mesh->getFacet(f);
+        Plane3SPtr plane = mesh->getPlane(f);
+        if (facet && (!plane || plane == facet->plane())) {
+            result->setPlane(f, KernelFactory::createPlane3(
+                    offsetPlane(facet.get(), offset)));
+        } else {
+            double speed = 1.0;
+            if (facet && facet->hasData()) {
+                speed = SkelFacetData::of(facet)->getSpeed();
+            }
+            result->setPlane(f, KernelFactory::createPlane3(
+                    KernelWrapper::offsetPlane(*plane, offset*speed)));
+        }
+    }
+    for (uint32_t v = 0; v < mesh->numVertices(); v++) {
+        uint32_t facets[3];
+        unsigned int i = 0;
+        uint32_t h_begin = mesh->vertexHalfEdge(v);
+        uint32_t h = h_begin;
+        unsigned int j = 0;
+        while (i < 3 && h != HalfEdgeMesh::NONE && j < mesh->numHalfEdges()) {
+            uint32_t f = mesh->facet(h);
+            if (f != HalfEdgeMesh::NONE &&
+                    (i == 0 || facets[0] != f) && (i <= 1 || facets[1] != f)) {
+                facets[i] = f;
+                i++;
+            }
+            h = mesh->nextAround(h);
+            if (h == h_begin) {
+                break;
+            }
+            j++;
+        }
+        if (i < 3) {
+            result = HalfEdgeMeshSPtr();
+            DEBUG_SPTR(result);
+            return result;
+        }
+        std::optional<Point3> point = KernelWrapper::intersection(
+                *(result->getPlane(facets[0])),
+                *(result->getPlane(facets[1])),
+                *(result->getPlane(facets[2])));
+        if (!point) {
+            result = HalfEdgeMeshSPtr();
+            DEBUG_SPTR(result);
+            return result;
+        }
+        result->setPoint(v, KernelFactory::createPoint3(*point));
+    }
+    return result;
+}
+
+bool SimpleStraightSkel::isEdgeSlotLess(const EdgeHandle& edge_1,
+        const EdgeHandle& edge_2) {
+    return (edge_1->getPolyhedronSlot() < edge_2->getPolyhedronSlot());
+}
+
+bool SimpleStraightSkel::isFacetSlotLess(const FacetHandle& facet_1,
+        const FacetHandle& facet_2) {
+    return (facet_1->getPolyhedronSlot() < facet_2->getPolyhedronSlot());
+}
+
+bool SimpleStraightSkel::shiftFacetsInPlace(PolyhedronSPtr polyhedron,
+        double offset_prev, double offset_next, bool kinetic) {
+    double offset = offset_next - offset_prev;
+    // 1st pass: compute all points before anything is moved
+    std::vector<Point3> points(polyhedron->vertices().numSlots());
+    std::vector<bool> computed(points.size(), false);
+    std::list<VertexSPtr> vertices_deg_1;
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        size_t slot = vertex->getPolyhedronSlot();
+        if (kinetic && vertex->hasData()) {
+            SkelVertexData* data =
+                    SkelVertexData::of(vertex);
+            if (data && data->hasKinematics()) {
+                points[slot] = *(data->pointAt(offset_next));
+                computed[slot] = true;
+                continue;
+            }
+        }
+        Plane3 planes[3];
+        unsigned int i = 0;
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
+        while (i < 3 && it_f != vertex->facets().end()) {
+            FacetHandle facet = *it_f++;
+            planes[i] = offsetPlane(facet.get(), offset);
+            i++;
+        }
+        if (i >= 3) {
+            std::optional<Point3> p = KernelWrapper::intersection(planes[0], planes[1], planes[2]);
+            if (!p) {
+                DEBUG_VAL("Warning: Unable to compute the offset of " << vertex->toString());
+                return false;
+            }
+            points[slot] = *p;
+            computed[slot] = true;
+        } else if (vertex->degree() == 1) {
+            vertices_deg_1.push_back(vertex);
+        }
+    }
+
+    std::list<VertexSPtr>::iterator it_d = vertices_deg_1.begin();
+    while (it_d != vertices_deg_1.end()) {
+        VertexSPtr vertex = *it_d++;
+        EdgeSPtr edge = vertex->firstEdge();
+        VertexSPtr vertex_other;
+        if (edge->getVertexSrc() == vertex) {
+            vertex_other = edge->getVertexDst();
+        } else if (edge->getVertexDst() == vertex) {
+            vertex_other = edge->getVertexSrc();
+        }
+        if (!vertex_other || !computed[vertex_other->getPolyhedronSlot()]) {
+            DEBUG_VAL("Warning: Unable to compute the offset of " << vertex->toString());
+            return false;
+        }
+        Vector3 direction = points[vertex_other->getPolyhedronSlot()] -
+                *(vertex_other->getPoint());
+        size_t slot = vertex->getPolyhedronSlot();
+        points[slot] = *(vertex->getPoint()) + direction;
+        computed[slot] = true;
+    }
+
+    // 2nd pass: move the elements; every element is its own offset element
+    it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        size_t slot = vertex->getPolyhedronSlot();
+        if (!computed[slot]) {
+            continue;
+        }
+        Point3SPtr point = vertex->getPoint();
+        // only referenced here and by the vertex,
+        // not by a node, a coincident vertex or a snapshot
+        if (point && point.use_count() == 2) {
+            *point = points[slot];
+        } else {
+            vertex->setPoint(KernelFactory::createPoint3(points[slot]));
+        }
+        SkelVertexData* data = 0;
+        if (vertex->hasData()) {
+            data = SkelVertexData::of(vertex);
+        } else {
+            data = SkelVertexData::create(vertex).get();
+        }
+        data->setOffsetVertex(vertex);
+    }
+    // shiftFacets appends vertices of degree 1 to the end of the list
+    it_d = vertices_deg_1.begin();
+    while (it_d != vertices_deg_1.end()) {
+        VertexSPtr vertex = *it_d++;
+        size_t slot = polyhedron->vertices().moveToBack(vertex->getPolyhedronSlot());
+        vertex->setPolyhedronSlot(slot);
+    }
+
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        SkelEdgeData* data = 0;
+        if (edge->hasData()) {
+            data = SkelEdgeData::of(edge);
+        } else {
+            data = SkelEdgeData::create(edge).get();
+        }
+        data->setOffsetEdge(edge);
+    }
+
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        SkelFacetData* data = 0;
+        if (facet->hasData()) {
+            data = SkelFacetData::of(facet);
+        } else {
+            data = SkelFacetData::create(facet).get();
+        }
+        Plane3 offset_plane = offsetPlane(facet.get(), offset);
+        Plane3SPtr plane = facet->plane();
+        // only referenced here, by the facet and by the key of its unit plane
+        if (data->hasUnitPlane(plane) && plane.use_count() == 3) {
+            *plane = offset_plane;
+        } else {
+            plane = KernelFactory::createPlane3(offset_plane);
+            facet->setPlane(plane);
+        }
+        data->setUnitPlane(plane, offset_plane);
+        facet->triangles().clear();
+        data->setOffsetFacet(facet);
+    }
+
+    // same order of incident edges and facets as in an offset polyhedron,
+    // where they are added in the order of their slots.
+    // Sorting a list relinks its nodes, the iterators of the edges stay valid.
+    it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        if (!std::is_sorted(vertex->edges().begin(), vertex->edges().end(),
+                isEdgeSlotLess)) {
+            vertex->edges().sort(isEdgeSlotLess);
+        }
+        if (!std::is_sorted(vertex->facets().begin(), vertex->facets().end(),
+                isFacetSlotLess)) {
+            vertex->facets().sort(isFacetSlotLess);
+        }
+    }
+
+    return true;
+}
+
 void SimpleStraightSkel::appendEventNode(NodeSPtr node) {
-    std::list<ArcWPtr>::iterator it_a = node->arcs().begin();
+    std::list<ArcHandle>::iterator it_a = node->arcs().begin();
     while (it_a != node->arcs().end()) {
-        ArcWPtr arc_wptr = *it_a++;
-        if (!arc_wptr.expired()) {
-            ArcSPtr arc = ArcSPtr(arc_wptr);
-            arc->setNodeDst(node);
-            arc->setNodeDstListIt(
-                    std::find(node->arcs().begin(), node->arcs().end(), arc_wptr));
-        }
+        ArcHandle arc_h = *it_a++;
+        arc_h->setNodeDst(node);
+        arc_h->setNodeDstListIt(
+                std::find(node->arcs().begin(), node->arcs().end(), arc_h));
     }
-    std::list<SheetWPtr>::iterator it_s = node->sheets().begin();
+    std::list<SheetHandle>::iterator it_s = node->sheets().begin();
     while (it_s != node->sheets().end()) {
-        SheetWPtr sheet_wptr = *it_s++;
-        if (!sheet_wptr.expired()) {
-            SheetSPtr sheet = SheetSPtr(sheet_wptr);
-            sheet->addNode(node);
-        }
+        Sheet* sheet = (*it_s++).get();
+        sheet->addNode(node);
     }
     skel_result_->addNode(node);
 }
 
 void SimpleStraightSkel::handleEdgeEvent(EdgeEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
 
     NodeSPtr node = event->getNode();
     appendEventNode(node);
 
     EdgeSPtr edge = event->getEdge();
-    SkelVertexDataSPtr data_src = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexSrc()->getData());
+    SkelVertexData* data_src = SkelVertexData::of(edge->getVertexSrc());
     VertexSPtr vertex_src_offset = data_src->getOffsetVertex();
-    SkelVertexDataSPtr data_dst = std::dynamic_pointer_cast<SkelVertexData>(
-                edge->getVertexDst()->getData());
+    SkelVertexData* data_dst = SkelVertexData::of(edge->getVertexDst());
     VertexSPtr vertex_dst_offset = data_dst->getOffsetVertex();
     EdgeSPtr edge_offset = vertex_src_offset->findEdge(vertex_dst_offset);
     vertex_src_offset->setPoint(node->getPoint());
@@ -2724,8 +4119,7 @@ void SimpleStraightSkel::handleEdgeEvent(EdgeEventSPtr event, PolyhedronSPtr pol
             facets_clone[i]->setPlane(facets[i]->getPlane());
             if (facets[i]->hasData()) {
                 SkelFacetDataSPtr data_clone = SkelFacetData::create(facets_clone[i]);
-                data_clone->setSpeed(std::dynamic_pointer_cast<SkelFacetData>(
-                        facets[i]->getData())->getSpeed());
+                data_clone->setSpeed(SkelFacetData::of(facets[i])->getSpeed());
             }
         }
         edge_no_flip->setFacetL(facets_clone[3]);
@@ -2767,8 +4161,7 @@ void SimpleStraightSkel::handleEdgeEvent(EdgeEventSPtr event, PolyhedronSPtr pol
             facets_clone[i]->setPlane(facets[i]->getPlane());
             if (facets[i]->hasData()) {
                 SkelFacetDataSPtr data_clone = SkelFacetData::create(facets_clone[i]);
-                data_clone->setSpeed(std::dynamic_pointer_cast<SkelFacetData>(
-                        facets[i]->getData())->getSpeed());
+                data_clone->setSpeed(SkelFacetData::of(facets[i])->getSpeed());
             }
         }
         edge_flipped->setFacetL(facets_clone[0]);
@@ -2802,17 +4195,17 @@ void SimpleStraightSkel::handleEdgeEvent(EdgeEventSPtr event, PolyhedronSPtr pol
                 facets[1]->plane(), facets[3]->plane());
         DEBUG_VAR(angle_no_flip);
         DEBUG_VAR(angle_flipped);
-        if (edge_event_ == 0) {
+        if (settings_->getEdgeEvent() == SkelSettings::CONVEX_EDGE_EVENT) {
             // convex
             flip_edge = (angle_flipped <= angle_no_flip);
-        } else if (edge_event_ == 1) {
+        } else if (settings_->getEdgeEvent() == SkelSettings::REFLEX_EDGE_EVENT) {
             // reflex
             // choose edge that moves faster
             flip_edge = (angle_flipped >= angle_no_flip);
-        } else if (edge_event_ == 2) {
+        } else if (settings_->getEdgeEvent() == SkelSettings::FLIP_EDGE_EVENT) {
             // flip_when_possible
             flip_edge = true;
-        } else if (edge_event_ == 3) {
+        } else if (settings_->getEdgeEvent() == SkelSettings::SPHERE_EDGE_EVENT) {
             // sphere
             VertexSPtr vertex_c = Vertex::create(node->getPoint());
             EdgeSPtr edges[4];
@@ -2831,7 +4224,7 @@ void SimpleStraightSkel::handleEdgeEvent(EdgeEventSPtr event, PolyhedronSPtr pol
                 facets_c[i]->addEdge(edges[i]);
             }
             PolyhedronSPtr polyhedron_sphere = Polyhedron::create(4, facets_c);
-            SphereVertexSplitterSPtr splitter = SphereVertexSplitter::create();
+            SphereVertexSplitterSPtr splitter = SphereVertexSplitter::create(ControllerSPtr(), settings_);
             splitter->splitVertex(vertex_c);
             if (facets_c[0]->findEdge(facets_c[2])) {
                 flip_edge = true;
@@ -2881,12 +4274,11 @@ void SimpleStraightSkel::handleEdgeEvent(EdgeEventSPtr event, PolyhedronSPtr pol
     }
 
     // update arcs and sheets
-    SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_offset->getData());
+    SkelEdgeData* edge_data = SkelEdgeData::of(edge_offset);
     edge_data->setSheet(SheetSPtr());
 
-    data_src = std::dynamic_pointer_cast<SkelVertexData>(vertex_src_offset->getData());
-    data_dst = std::dynamic_pointer_cast<SkelVertexData>(vertex_dst_offset->getData());
+    data_src = SkelVertexData::of(vertex_src_offset);
+    data_dst = SkelVertexData::of(vertex_dst_offset);
     data_src->setNode(node);
     data_dst->setNode(node);
     ArcSPtr arc_src = createArc(vertex_src_offset);
@@ -2901,16 +4293,13 @@ void SimpleStraightSkel::handleEdgeEvent(EdgeEventSPtr event, PolyhedronSPtr pol
 }
 
 void SimpleStraightSkel::handleEdgeMergeEvent(EdgeMergeEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
 
-    SkelFacetDataSPtr facet_data = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet()->getData());
+    SkelFacetData* facet_data = SkelFacetData::of(event->getFacet());
     FacetSPtr facet = facet_data->getOffsetFacet();
-    SkelEdgeDataSPtr edge_data_1 = std::dynamic_pointer_cast<SkelEdgeData>(
-                event->getEdge1()->getData());
-    SkelEdgeDataSPtr edge_data_2 = std::dynamic_pointer_cast<SkelEdgeData>(
-                event->getEdge2()->getData());
+    SkelEdgeData* edge_data_1 = SkelEdgeData::of(event->getEdge1());
+    SkelEdgeData* edge_data_2 = SkelEdgeData::of(event->getEdge2());
     EdgeSPtr edge_1 = edge_data_1->getOffsetEdge();
     EdgeSPtr edge_2 = edge_data_2->getOffsetEdge();
 
@@ -2960,27 +4349,20 @@ void SimpleStraightSkel::handleEdgeMergeEvent(EdgeMergeEventSPtr event, Polyhedr
     edge_2->getFacetL()->removeEdge(edge_2);
     edge_2->getFacetR()->removeEdge(edge_2);
     polyhedron->removeEdge(edge_2);
-    std::list<FacetWPtr>::iterator it_f = vertex_1->facets().begin();
+    std::list<FacetHandle>::iterator it_f = vertex_1->facets().begin();
     while (it_f != vertex_1->facets().end()) {
-        FacetWPtr facet_wptr = *it_f++;
-        if (!facet_wptr.expired()) {
-            FacetSPtr facet = FacetSPtr(facet_wptr);
-            facet->removeVertex(vertex_1);
-        }
+        Facet* facet = (*it_f++).get();
+        facet->removeVertex(vertex_1);
     }
     polyhedron->removeVertex(vertex_1);
     it_f = vertex_2->facets().begin();
     while (it_f != vertex_2->facets().end()) {
-        FacetWPtr facet_wptr = *it_f++;
-        if (!facet_wptr.expired()) {
-            FacetSPtr facet = FacetSPtr(facet_wptr);
-            facet->removeVertex(vertex_2);
-        }
+        Facet* facet = (*it_f++).get();
+        facet->removeVertex(vertex_2);
     }
     polyhedron->removeVertex(vertex_2);
 
-    SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-            vertex->getData());
+    SkelVertexData* vertex_data = SkelVertexData::of(vertex);
     vertex_data->setNode(event->getNode());
     ArcSPtr arc = createArc(vertex);
     skel_result_->addArc(arc);
@@ -3002,18 +4384,16 @@ void SimpleStraightSkel::handleEdgeMergeEvent(EdgeMergeEventSPtr event, Polyhedr
 }
 
 void SimpleStraightSkel::handleTriangleEvent(TriangleEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
     VertexSPtr vertices[3];
     event->getVertices(vertices);
     VertexSPtr vertices_offset[3];
     for (unsigned int i = 0; i < 3; i++) {
-        SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(
-                vertices[i]->getData());
+        SkelVertexData* data = SkelVertexData::of(vertices[i]);
         vertices_offset[i] = data->getOffsetVertex();
     }
-    SkelFacetDataSPtr facet_data = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet()->getData());
+    SkelFacetData* facet_data = SkelFacetData::of(event->getFacet());
     FacetSPtr facet_offset = facet_data->getOffsetFacet();
 
     if (facet_offset->vertices().size() == 3) {
@@ -3031,7 +4411,7 @@ void SimpleStraightSkel::handleTriangleEvent(TriangleEventSPtr event, Polyhedron
     }
     VertexSPtr vertex_offset = Vertex::create(event->getNode()->getPoint());
     for (unsigned int i = 0; i < 3; i++) {
-        EdgeSPtr edge_offset = EdgeSPtr(vertices_offset[i]->edges().front());
+        EdgeSPtr edge_offset = vertices_offset[i]->edges().front().lock();
         if (edge_offset->getVertexSrc() == vertices_offset[i]) {
             edge_offset->replaceVertexSrc(vertex_offset);
         } else if (edge_offset->getVertexDst() == vertices_offset[i]) {
@@ -3059,35 +4439,29 @@ void SimpleStraightSkel::handleTriangleEvent(TriangleEventSPtr event, Polyhedron
 }
 
 void SimpleStraightSkel::handleDblEdgeMergeEvent(DblEdgeMergeEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
 
-    SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge11()->getData());
+    SkelEdgeData* edge_data = SkelEdgeData::of(event->getEdge11());
     EdgeSPtr edge_offset_11 = edge_data->getOffsetEdge();
-    edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge12()->getData());
+    edge_data = SkelEdgeData::of(event->getEdge12());
     EdgeSPtr edge_offset_12 = edge_data->getOffsetEdge();
-    edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge21()->getData());
+    edge_data = SkelEdgeData::of(event->getEdge21());
     EdgeSPtr edge_offset_21 = edge_data->getOffsetEdge();
-    edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge22()->getData());
+    edge_data = SkelEdgeData::of(event->getEdge22());
     EdgeSPtr edge_offset_22 = edge_data->getOffsetEdge();
     VertexSPtr vertices[4];
     event->getVertices(vertices);
     VertexSPtr vertices_offset[4];
     for (unsigned int i = 0; i < 4; i++) {
-        SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-                vertices[i]->getData());
+        SkelVertexData* vertex_data = SkelVertexData::of(vertices[i]);
         vertices_offset[i] = vertex_data->getOffsetVertex();
     }
     EdgeSPtr edges[4];
     event->getEdges(edges);
     EdgeSPtr edges_offset[4];
     for (unsigned int i = 0; i < 4; i++) {
-        SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-                edges[i]->getData());
+        SkelEdgeData* edge_data = SkelEdgeData::of(edges[i]);
         edges_offset[i] = edge_data->getOffsetEdge();
     }
 
@@ -3131,13 +4505,10 @@ void SimpleStraightSkel::handleDblEdgeMergeEvent(DblEdgeMergeEventSPtr event, Po
     polyhedron->removeEdge(edge_offset_22);
     for (unsigned int i = 0; i < 4; i++) {
         VertexSPtr vertex = vertices_offset[i];
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet = FacetSPtr(facet_wptr);
-                facet->removeVertex(vertex);
-            }
+            Facet* facet = (*it_f++).get();
+            facet->removeVertex(vertex);
         }
         polyhedron->removeVertex(vertex);
     }
@@ -3147,7 +4518,7 @@ void SimpleStraightSkel::handleDblEdgeMergeEvent(DblEdgeMergeEventSPtr event, Po
 }
 
 void SimpleStraightSkel::handleDblTriangleEvent(DblTriangleEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
     EdgeSPtr edge = event->getEdge();
 
@@ -3155,16 +4526,14 @@ void SimpleStraightSkel::handleDblTriangleEvent(DblTriangleEventSPtr event, Poly
     event->getVertices(vertices);
     VertexSPtr vertices_offset[4];
     for (unsigned int i = 0; i < 4; i++) {
-        SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-                vertices[i]->getData());
+        SkelVertexData* vertex_data = SkelVertexData::of(vertices[i]);
         vertices_offset[i] = vertex_data->getOffsetVertex();
     }
     EdgeSPtr edges[5];
     event->getEdges(edges);
     EdgeSPtr edges_offset[5];
     for (unsigned int i = 0; i < 5; i++) {
-        SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-                edges[i]->getData());
+        SkelEdgeData* edge_data = SkelEdgeData::of(edges[i]);
         edges_offset[i] = edge_data->getOffsetEdge();
     }
 
@@ -3179,23 +4548,17 @@ void SimpleStraightSkel::handleDblTriangleEvent(DblTriangleEventSPtr event, Poly
     FacetSPtr facet_rr = edge_r->other(facet_r);
     edge_r = edge_r->prev(facet_rr);
 
-    SkelFacetDataSPtr facet_data_l = std::dynamic_pointer_cast<SkelFacetData>(
-            facet_l->getData());
+    SkelFacetData* facet_data_l = SkelFacetData::of(facet_l);
     FacetSPtr facet_offset_l = facet_data_l->getOffsetFacet();
-    SkelFacetDataSPtr facet_data_r = std::dynamic_pointer_cast<SkelFacetData>(
-            facet_r->getData());
+    SkelFacetData* facet_data_r = SkelFacetData::of(facet_r);
     FacetSPtr facet_offset_r = facet_data_r->getOffsetFacet();
-    SkelVertexDataSPtr vertex_data_l = std::dynamic_pointer_cast<SkelVertexData>(
-            vertex_l->getData());
+    SkelVertexData* vertex_data_l = SkelVertexData::of(vertex_l);
     VertexSPtr vertex_offset_l = vertex_data_l->getOffsetVertex();
-    SkelVertexDataSPtr vertex_data_r = std::dynamic_pointer_cast<SkelVertexData>(
-            vertex_r->getData());
+    SkelVertexData* vertex_data_r = SkelVertexData::of(vertex_r);
     VertexSPtr vertex_offset_r = vertex_data_r->getOffsetVertex();
-    SkelEdgeDataSPtr edge_data_l = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_l->getData());
+    SkelEdgeData* edge_data_l = SkelEdgeData::of(edge_l);
     EdgeSPtr edge_offset_l = edge_data_l->getOffsetEdge();
-    SkelEdgeDataSPtr edge_data_r = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_r->getData());
+    SkelEdgeData* edge_data_r = SkelEdgeData::of(edge_r);
     EdgeSPtr edge_offset_r = edge_data_r->getOffsetEdge();
 
     if (facet_offset_l->edges().size() == 3) {
@@ -3234,13 +4597,10 @@ void SimpleStraightSkel::handleDblTriangleEvent(DblTriangleEventSPtr event, Poly
 
     for (unsigned int i = 0; i < 4; i++) {
         VertexSPtr vertex = vertices_offset[i];
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet = FacetSPtr(facet_wptr);
-                facet->removeVertex(vertex);
-            }
+            Facet* facet = (*it_f++).get();
+            facet->removeVertex(vertex);
         }
         polyhedron->removeVertex(vertex);
     }
@@ -3250,31 +4610,28 @@ void SimpleStraightSkel::handleDblTriangleEvent(DblTriangleEventSPtr event, Poly
 }
 
 void SimpleStraightSkel::handleTetrahedronEvent(TetrahedronEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
 
     VertexSPtr vertices[4];
     event->getVertices(vertices);
     VertexSPtr vertices_offset[4];
     for (unsigned int i = 0; i < 4; i++) {
-        SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-                vertices[i]->getData());
+        SkelVertexData* vertex_data = SkelVertexData::of(vertices[i]);
         vertices_offset[i] = vertex_data->getOffsetVertex();
     }
     EdgeSPtr edges[6];
     event->getEdges(edges);
     EdgeSPtr edges_offset[6];
     for (unsigned int i = 0; i < 6; i++) {
-        SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-                edges[i]->getData());
+        SkelEdgeData* edge_data = SkelEdgeData::of(edges[i]);
         edges_offset[i] = edge_data->getOffsetEdge();
     }
     FacetSPtr facets[4];
     event->getFacets(facets);
     FacetSPtr facets_offset[4];
     for (unsigned int i = 0; i < 4; i++) {
-        SkelFacetDataSPtr facet_data = std::dynamic_pointer_cast<SkelFacetData>(
-                facets[i]->getData());
+        SkelFacetData* facet_data = SkelFacetData::of(facets[i]);
         facets_offset[i] = facet_data->getOffsetFacet();
     }
 
@@ -3295,13 +4652,10 @@ void SimpleStraightSkel::handleTetrahedronEvent(TetrahedronEventSPtr event, Poly
     }
     for (unsigned int i = 0; i < 4; i++) {
         VertexSPtr vertex = vertices_offset[i];
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet = FacetSPtr(facet_wptr);
-                facet->removeVertex(vertex);
-            }
+            Facet* facet = (*it_f++).get();
+            facet->removeVertex(vertex);
         }
         polyhedron->removeVertex(vertex);
     }
@@ -3311,21 +4665,17 @@ void SimpleStraightSkel::handleTetrahedronEvent(TetrahedronEventSPtr event, Poly
 }
 
 void SimpleStraightSkel::handleVertexEvent(VertexEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
 
-    SkelVertexDataSPtr vertex_data_1 = std::dynamic_pointer_cast<SkelVertexData>(
-            event->getVertex1()->getData());
-    SkelVertexDataSPtr vertex_data_2 = std::dynamic_pointer_cast<SkelVertexData>(
-            event->getVertex2()->getData());
+    SkelVertexData* vertex_data_1 = SkelVertexData::of(event->getVertex1());
+    SkelVertexData* vertex_data_2 = SkelVertexData::of(event->getVertex2());
     VertexSPtr vertex_1 = vertex_data_1->getOffsetVertex();
     VertexSPtr vertex_2 = vertex_data_2->getOffsetVertex();
     vertex_1->setPoint(event->getNode()->getPoint());
     vertex_2->setPoint(event->getNode()->getPoint());
-    SkelFacetDataSPtr facet_data_1 = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet1()->getData());
-    SkelFacetDataSPtr facet_data_2 = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet2()->getData());
+    SkelFacetData* facet_data_1 = SkelFacetData::of(event->getFacet1());
+    SkelFacetData* facet_data_2 = SkelFacetData::of(event->getFacet2());
     FacetSPtr facet_1 = facet_data_1->getOffsetFacet();
     FacetSPtr facet_2 = facet_data_2->getOffsetFacet();
 
@@ -3335,40 +4685,34 @@ void SimpleStraightSkel::handleVertexEvent(VertexEventSPtr event, PolyhedronSPtr
     EdgeSPtr edge_tomerge_2 = EdgeSPtr();
     EdgeSPtr edge_21 = EdgeSPtr();
     EdgeSPtr edge_22 = EdgeSPtr();
-    std::list<EdgeWPtr>::iterator it_e1 = vertex_1->edges().begin();
+    std::list<EdgeHandle>::iterator it_e1 = vertex_1->edges().begin();
     while (it_e1 != vertex_1->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e1++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
-                    (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
-                edge_tomerge_1 = edge;
-                continue;
-            }
-            if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
-                edge_11 = edge;
-            }
-            if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
-                edge_12 = edge;
-            }
+        EdgeHandle edge = *it_e1++;
+        if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
+                (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
+            edge_tomerge_1 = edge.lock();
+            continue;
+        }
+        if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
+            edge_11 = edge.lock();
+        }
+        if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
+            edge_12 = edge.lock();
         }
     }
-    std::list<EdgeWPtr>::iterator it_e2 = vertex_2->edges().begin();
+    std::list<EdgeHandle>::iterator it_e2 = vertex_2->edges().begin();
     while (it_e2 != vertex_2->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e2++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
-                    (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
-                edge_tomerge_2 = edge;
-                continue;
-            }
-            if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
-                edge_21 = edge;
-            }
-            if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
-                edge_22 = edge;
-            }
+        EdgeHandle edge = *it_e2++;
+        if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
+                (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
+            edge_tomerge_2 = edge.lock();
+            continue;
+        }
+        if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
+            edge_21 = edge.lock();
+        }
+        if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
+            edge_22 = edge.lock();
         }
     }
     FacetSPtr facet_1b = edge_11->getFacetL();
@@ -3412,13 +4756,12 @@ void SimpleStraightSkel::handleVertexEvent(VertexEventSPtr event, PolyhedronSPtr
         edge_21->replaceVertexDst(vertex_1);
     }
 
-    SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_tomerge_2->getData());
+    SkelEdgeData* edge_data = SkelEdgeData::of(edge_tomerge_2);
     edge_data->setSheet(SheetSPtr());
 
-    vertex_data_1 = std::dynamic_pointer_cast<SkelVertexData>(vertex_1->getData());
+    vertex_data_1 = SkelVertexData::of(vertex_1);
     vertex_data_1->setNode(event->getNode());
-    vertex_data_2 = std::dynamic_pointer_cast<SkelVertexData>(vertex_2->getData());
+    vertex_data_2 = SkelVertexData::of(vertex_2);
     vertex_data_2->setNode(event->getNode());
     ArcSPtr arc_1 = createArc(vertex_1);
     skel_result_->addArc(arc_1);
@@ -3431,19 +4774,15 @@ void SimpleStraightSkel::handleVertexEvent(VertexEventSPtr event, PolyhedronSPtr
 }
 
 void SimpleStraightSkel::handleFlipVertexEvent(FlipVertexEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
 
-    SkelVertexDataSPtr vertex_data_1 = std::dynamic_pointer_cast<SkelVertexData>(
-            event->getVertex1()->getData());
-    SkelVertexDataSPtr vertex_data_2 = std::dynamic_pointer_cast<SkelVertexData>(
-            event->getVertex2()->getData());
+    SkelVertexData* vertex_data_1 = SkelVertexData::of(event->getVertex1());
+    SkelVertexData* vertex_data_2 = SkelVertexData::of(event->getVertex2());
     VertexSPtr vertex_1 = vertex_data_1->getOffsetVertex();
     VertexSPtr vertex_2 = vertex_data_2->getOffsetVertex();
-    SkelFacetDataSPtr facet_data_1 = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet1()->getData());
-    SkelFacetDataSPtr facet_data_2 = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet2()->getData());
+    SkelFacetData* facet_data_1 = SkelFacetData::of(event->getFacet1());
+    SkelFacetData* facet_data_2 = SkelFacetData::of(event->getFacet2());
     FacetSPtr facet_1 = facet_data_1->getOffsetFacet();
     FacetSPtr facet_2 = facet_data_2->getOffsetFacet();
 
@@ -3451,29 +4790,23 @@ void SimpleStraightSkel::handleFlipVertexEvent(FlipVertexEventSPtr event, Polyhe
     vertex_2->setPoint(event->getNode()->getPoint());
 
     EdgeSPtr edge_1;
-    std::list<EdgeWPtr>::iterator it_e1 = vertex_1->edges().begin();
+    std::list<EdgeHandle>::iterator it_e1 = vertex_1->edges().begin();
     while (it_e1 != vertex_1->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e1++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
-                    (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
-                edge_1 = edge;
-                break;
-            }
+        EdgeHandle edge = *it_e1++;
+        if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
+                (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
+            edge_1 = edge.lock();
+            break;
         }
     }
     EdgeSPtr edge_2;
-    std::list<EdgeWPtr>::iterator it_e2 = vertex_2->edges().begin();
+    std::list<EdgeHandle>::iterator it_e2 = vertex_2->edges().begin();
     while (it_e2 != vertex_2->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e2++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
-                    (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
-                edge_2 = edge;
-                break;
-            }
+        EdgeHandle edge = *it_e2++;
+        if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
+                (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
+            edge_2 = edge.lock();
+            break;
         }
     }
 
@@ -3488,9 +4821,9 @@ void SimpleStraightSkel::handleFlipVertexEvent(FlipVertexEventSPtr event, Polyhe
         edge_2->replaceVertexDst(vertex_1);
     }
 
-    vertex_data_1 = std::dynamic_pointer_cast<SkelVertexData>(vertex_1->getData());
+    vertex_data_1 = SkelVertexData::of(vertex_1);
     vertex_data_1->setNode(event->getNode());
-    vertex_data_2 = std::dynamic_pointer_cast<SkelVertexData>(vertex_2->getData());
+    vertex_data_2 = SkelVertexData::of(vertex_2);
     vertex_data_2->setNode(event->getNode());
     ArcSPtr arc_1 = createArc(vertex_1);
     skel_result_->addArc(arc_1);
@@ -3502,16 +4835,14 @@ void SimpleStraightSkel::handleFlipVertexEvent(FlipVertexEventSPtr event, Polyhe
 }
 
 void SimpleStraightSkel::handleSurfaceEvent(SurfaceEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
 
     NodeSPtr node = event->getNode();
     appendEventNode(node);
 
-    SkelEdgeDataSPtr data_1 = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge1()->getData());
+    SkelEdgeData* data_1 = SkelEdgeData::of(event->getEdge1());
     EdgeSPtr edge_1 = data_1->getOffsetEdge();
-    SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge2()->getData());
+    SkelEdgeData* data_2 = SkelEdgeData::of(event->getEdge2());
     EdgeSPtr edge_2 = data_2->getOffsetEdge();
 
     FacetSPtr facet_1_src = getFacetSrc(edge_1);
@@ -3584,22 +4915,20 @@ void SimpleStraightSkel::handleSurfaceEvent(SurfaceEventSPtr event, PolyhedronSP
         }
     }
 
-    SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_2->getData());
+    SkelEdgeData* edge_data = SkelEdgeData::of(edge_2);
     SheetSPtr sheet = edge_data->getSheet();
-    edge_data = SkelEdgeData::create(edge_tmp);
+    edge_data = SkelEdgeData::create(edge_tmp).get();
     edge_data->setSheet(sheet);
 
-    SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-            vertex->getData());
+    SkelVertexData* vertex_data = SkelVertexData::of(vertex);
     vertex_data->setNode(node);
     ArcSPtr arc = createArc(vertex);
     skel_result_->addArc(arc);
-    vertex_data = SkelVertexData::create(vertex_21);
+    vertex_data = SkelVertexData::create(vertex_21).get();
     vertex_data->setNode(node);
     arc = createArc(vertex_21);
     skel_result_->addArc(arc);
-    vertex_data = SkelVertexData::create(vertex_22);
+    vertex_data = SkelVertexData::create(vertex_22).get();
     vertex_data->setNode(node);
     arc = createArc(vertex_22);
     skel_result_->addArc(arc);
@@ -3616,16 +4945,14 @@ void SimpleStraightSkel::handleSurfaceEvent(SurfaceEventSPtr event, PolyhedronSP
 }
 
 void SimpleStraightSkel::handlePolyhedronSplitEvent(PolyhedronSplitEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
 
     NodeSPtr node = event->getNode();
     appendEventNode(node);
 
-    SkelEdgeDataSPtr data_1 = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge1()->getData());
+    SkelEdgeData* data_1 = SkelEdgeData::of(event->getEdge1());
     EdgeSPtr edge_1 = data_1->getOffsetEdge();
-    SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge2()->getData());
+    SkelEdgeData* data_2 = SkelEdgeData::of(event->getEdge2());
     EdgeSPtr edge_2 = data_2->getOffsetEdge();
 
     FacetSPtr facet_1_src = getFacetSrc(edge_1);
@@ -3701,14 +5028,11 @@ void SimpleStraightSkel::handlePolyhedronSplitEvent(PolyhedronSplitEventSPtr eve
         edge_22->replaceFacetR(edge_2->getFacetR());
     }
 
-    SkelVertexDataSPtr data_l = std::dynamic_pointer_cast<SkelVertexData>(
-            vertex_l->getData());
+    SkelVertexData* data_l = SkelVertexData::of(vertex_l);
     data_l->setNode(node);
-    SkelVertexDataSPtr data_r = std::dynamic_pointer_cast<SkelVertexData>(
-            vertex_r->getData());
+    SkelVertexData* data_r = SkelVertexData::of(vertex_r);
     data_r->setNode(node);
-    SkelEdgeDataSPtr data_22 = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_22->getData());
+    SkelEdgeData* data_22 = SkelEdgeData::of(edge_22);
     data_22->setSheet(data_2->getSheet());
     ArcSPtr arc_l = createArc(vertex_l);
     ArcSPtr arc_r = createArc(vertex_r);
@@ -3720,21 +5044,17 @@ void SimpleStraightSkel::handlePolyhedronSplitEvent(PolyhedronSplitEventSPtr eve
 }
 
 void SimpleStraightSkel::handleSplitMergeEvent(SplitMergeEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
     appendEventNode(event->getNode());
 
-    SkelVertexDataSPtr vertex_data_1 = std::dynamic_pointer_cast<SkelVertexData>(
-            event->getVertex1()->getData());
-    SkelVertexDataSPtr vertex_data_2 = std::dynamic_pointer_cast<SkelVertexData>(
-            event->getVertex2()->getData());
+    SkelVertexData* vertex_data_1 = SkelVertexData::of(event->getVertex1());
+    SkelVertexData* vertex_data_2 = SkelVertexData::of(event->getVertex2());
     VertexSPtr vertex_1 = vertex_data_1->getOffsetVertex();
     VertexSPtr vertex_2 = vertex_data_2->getOffsetVertex();
     vertex_1->setPoint(event->getNode()->getPoint());
     vertex_2->setPoint(event->getNode()->getPoint());
-    SkelFacetDataSPtr facet_data_1 = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet1()->getData());
-    SkelFacetDataSPtr facet_data_2 = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet2()->getData());
+    SkelFacetData* facet_data_1 = SkelFacetData::of(event->getFacet1());
+    SkelFacetData* facet_data_2 = SkelFacetData::of(event->getFacet2());
     FacetSPtr facet_1 = facet_data_1->getOffsetFacet();
     FacetSPtr facet_2 = facet_data_2->getOffsetFacet();
 
@@ -3744,40 +5064,34 @@ void SimpleStraightSkel::handleSplitMergeEvent(SplitMergeEventSPtr event, Polyhe
     EdgeSPtr edge_tomerge_2 = EdgeSPtr();
     EdgeSPtr edge_21 = EdgeSPtr();
     EdgeSPtr edge_22 = EdgeSPtr();
-    std::list<EdgeWPtr>::iterator it_e1 = vertex_1->edges().begin();
+    std::list<EdgeHandle>::iterator it_e1 = vertex_1->edges().begin();
     while (it_e1 != vertex_1->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e1++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
-                    (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
-                edge_tomerge_1 = edge;
-                continue;
-            }
-            if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
-                edge_11 = edge;
-            }
-            if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
-                edge_12 = edge;
-            }
+        EdgeHandle edge = *it_e1++;
+        if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
+                (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
+            edge_tomerge_1 = edge.lock();
+            continue;
+        }
+        if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
+            edge_11 = edge.lock();
+        }
+        if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
+            edge_12 = edge.lock();
         }
     }
-    std::list<EdgeWPtr>::iterator it_e2 = vertex_2->edges().begin();
+    std::list<EdgeHandle>::iterator it_e2 = vertex_2->edges().begin();
     while (it_e2 != vertex_2->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e2++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
-                    (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
-                edge_tomerge_2 = edge;
-                continue;
-            }
-            if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
-                edge_21 = edge;
-            }
-            if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
-                edge_22 = edge;
-            }
+        EdgeHandle edge = *it_e2++;
+        if ((edge->getFacetL() == facet_1 && edge->getFacetR() == facet_2) ||
+                (edge->getFacetL() == facet_2 && edge->getFacetR() == facet_1)) {
+            edge_tomerge_2 = edge.lock();
+            continue;
+        }
+        if (edge->getFacetL() == facet_1 || edge->getFacetR() == facet_1) {
+            edge_21 = edge.lock();
+        }
+        if (edge->getFacetL() == facet_2 || edge->getFacetR() == facet_2) {
+            edge_22 = edge.lock();
         }
     }
     FacetSPtr facet_1b = edge_11->getFacetL();
@@ -3842,16 +5156,14 @@ void SimpleStraightSkel::handleSplitMergeEvent(SplitMergeEventSPtr event, Polyhe
     edge_tomerge_2->replaceFacetL(edge_tosplit->getFacetL());
     edge_tomerge_2->replaceFacetR(edge_tosplit->getFacetR());
 
-    SkelEdgeDataSPtr edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_tosplit->getData());
+    SkelEdgeData* edge_data = SkelEdgeData::of(edge_tosplit);
     SheetSPtr sheet = edge_data->getSheet();
-    edge_data = std::dynamic_pointer_cast<SkelEdgeData>(
-            edge_tomerge_2->getData());
+    edge_data = SkelEdgeData::of(edge_tomerge_2);
     edge_data->setSheet(sheet);
 
-    vertex_data_1 = std::dynamic_pointer_cast<SkelVertexData>(vertex_1->getData());
+    vertex_data_1 = SkelVertexData::of(vertex_1);
     vertex_data_1->setNode(event->getNode());
-    vertex_data_2 = std::dynamic_pointer_cast<SkelVertexData>(vertex_2->getData());
+    vertex_data_2 = SkelVertexData::of(vertex_2);
     vertex_data_2->setNode(event->getNode());
     ArcSPtr arc_1 = createArc(vertex_1);
     skel_result_->addArc(arc_1);
@@ -3862,16 +5174,14 @@ void SimpleStraightSkel::handleSplitMergeEvent(SplitMergeEventSPtr event, Polyhe
 }
 
 void SimpleStraightSkel::handleEdgeSplitEvent(EdgeSplitEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
 
     NodeSPtr node = event->getNode();
     appendEventNode(node);
 
-    SkelEdgeDataSPtr data_1 = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge1()->getData());
+    SkelEdgeData* data_1 = SkelEdgeData::of(event->getEdge1());
     EdgeSPtr edge_1 = data_1->getOffsetEdge();
-    SkelEdgeDataSPtr data_2 = std::dynamic_pointer_cast<SkelEdgeData>(
-            event->getEdge2()->getData());
+    SkelEdgeData* data_2 = SkelEdgeData::of(event->getEdge2());
     EdgeSPtr edge_2 = data_2->getOffsetEdge();
 
     VertexSPtr vertices[4];
@@ -3884,8 +5194,7 @@ void SimpleStraightSkel::handleEdgeSplitEvent(EdgeSplitEventSPtr event, Polyhedr
         edges[i] = Edge::create(vertices[i], vertices[(i+1)%4]);
         polyhedron->addEdge(edges[i]);
     }
-    if (KernelWrapper::orientation(line(event->getEdge1()),
-            line(event->getEdge2())) > 0) {
+    if (event->getOrientation() > 0) {
         edges[0]->setFacetL(edge_2->getFacetR());
         edges[0]->setFacetR(edge_1->getFacetR());
         edges[1]->setFacetL(edge_2->getFacetL());
@@ -3914,10 +5223,10 @@ void SimpleStraightSkel::handleEdgeSplitEvent(EdgeSplitEventSPtr event, Polyhedr
         edges[i]->getFacetR()->addEdge(edges[i]);
     }
 
-    SkelEdgeDataSPtr edge_data_1 = std::dynamic_pointer_cast<SkelEdgeData>(edge_1->getData());
+    SkelEdgeData* edge_data_1 = SkelEdgeData::of(edge_1);
     SkelEdgeDataSPtr edge_data_12 = SkelEdgeData::create(edge_12);
     edge_data_12->setSheet(edge_data_1->getSheet());
-    SkelEdgeDataSPtr edge_data_2 = std::dynamic_pointer_cast<SkelEdgeData>(edge_2->getData());
+    SkelEdgeData* edge_data_2 = SkelEdgeData::of(edge_2);
     SkelEdgeDataSPtr edge_data_22 = SkelEdgeData::create(edge_22);
     edge_data_22->setSheet(edge_data_2->getSheet());
     for (unsigned int i = 0; i < 4; i++) {
@@ -3937,16 +5246,14 @@ void SimpleStraightSkel::handleEdgeSplitEvent(EdgeSplitEventSPtr event, Polyhedr
 }
 
 void SimpleStraightSkel::handlePierceEvent(PierceEventSPtr event, PolyhedronSPtr polyhedron) {
-    WriteLock l(skel_result_->mutex());
+    WriteLock l(skelMutex());
 
     NodeSPtr node = event->getNode();
     appendEventNode(node);
 
-    SkelVertexDataSPtr vertex_data = std::dynamic_pointer_cast<SkelVertexData>(
-            event->getVertex()->getData());
+    SkelVertexData* vertex_data = SkelVertexData::of(event->getVertex());
     VertexSPtr vertex_offset = vertex_data->getOffsetVertex();
-    SkelFacetDataSPtr facet_data = std::dynamic_pointer_cast<SkelFacetData>(
-            event->getFacet()->getData());
+    SkelFacetData* facet_data = SkelFacetData::of(event->getFacet());
     FacetSPtr facet_offset = facet_data->getOffsetFacet();
     FacetSPtr facets[3];
     EdgeSPtr edges[3];
@@ -12,7 +12,14 @@
 #include "algo/3d/ptrs.h"
 #include "data/3d/ptrs.h"
 #include "data/3d/skel/ptrs.h"
+#include "db/3d/ptrs.h"
+#include "util/ptrs.h"
+#include "util/Interval.h"
 #include <list>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace algo { namespace _3d {
 
@@ -27,18 +34,77 @@ public:
     static SimpleStraightSkelSPtr create(PolyhedronSPtr polyhedron, ControllerSPtr controller);
     static SimpleStraightSkelSPtr create(PolyhedronSPtr polyhedron, ControllerSPtr controller, const std::list<double>& save_offsets);
 
-    void initVertexSplitter();
-    void initEdgeEvent();
-
     static bool isReflex(EdgeSPtr edge);
+    static bool isReflex(Edge* edge);
     static bool isReflex(VertexSPtr vertex);
     static bool isConvex(VertexSPtr vertex);
 
     static Line3SPtr line(EdgeSPtr edge);
 
+    /**
+     * Plane of the facet moved by offset times the speed of the facet.
+     * The unit plane stored in SkelFacetData is moved along its normal,
+     * only the constant term of the plane changes.
+     * If the facet got a new plane since the unit plane was set,
+     * it is computed again, but not stored:
+     * Scanner threads call this concurrently.
+     */
+    static Plane3 offsetPlane(Facet* facet, double offset);
+
+    /**
+     * Stores the unit plane of the current plane of the facet.
+     * Called where no scanner thread runs (init and shiftFacets).
+     */
+    static void initUnitPlane(FacetSPtr facet);
+
     void run();
     ThreadSPtr startThread();
 
+    /**
+     * The next call of run() continues the computation stored in the
+     * checkpoint instead of starting at offset 0.
+     * The input polyhedron and the partial straight skeleton
+     * are taken from the checkpoint.
+     */
+    void resume(db::_3d::CheckpointFileSPtr checkpoint);
+
+    /**
+     * run() stops before the first event with an offset below max_offset.
+     * Offsets are negative while the polyhedron shrinks (e.g. -1.0).
+     * The wavefront has been saved at all save offsets down to max_offset,
+     * the result is a partial straight skeleton.
+     */
+    void setMaxOffset(double max_offset);
+
+    /**
+     * run() stops after max_events events (0: no limit).
+     * A batch of simultaneous events is always handled completely.
+     */
+    void setMaxEvents(unsigned int max_events);
+
+    /**
+     * Kernel of the predicates, one of KernelWrapper::KERNEL_*
+     * (default: KERNEL_EXACT). Copied to the skeletons of the components.
+     * run() installs it in its thread and in the scanner threads,
+     * other skeletons keep their own kernel.
+     */
+    void setKernel(int kernel);
+    int getKernel() const;
+
+    /**
+     * Number of batches of events handled by run(),
+     * including those of components that were propagated in parallel.
+     * Less than the number of events if event_batching combined events.
+     */
+    unsigned int getNumBatches() const;
+
+    /**
+     * Writes the state of run() to checkpoint_file.
+     * The file is replaced only after it was written completely.
+     */
+    bool saveCheckpoint(PolyhedronSPtr polyhedron, double offset,
+            unsigned int num_batches);
+
     /**
      * All vertices of the input polyhedron have to have a maximum degree of 3.
      * The splitting is done by using the speed during the shrinking process.
@@ -104,66 +170,225 @@ public:
      * Edge flip event.
      */
     static EdgeEventSPtr nextEdgeEvent(PolyhedronSPtr polyhedron, double offset);
+    static EdgeEventSPtr nextEdgeEvent(EdgeSPtr edge, double offset);
 
     static EdgeMergeEventSPtr nextEdgeMergeEvent(PolyhedronSPtr polyhedron, double offset);
+    static EdgeMergeEventSPtr nextEdgeMergeEvent(EdgeSPtr edge, double offset);
 
     /**
      * The triangle on the surface vanishes.
      */
     static TriangleEventSPtr nextTriangleEvent(PolyhedronSPtr polyhedron, double offset);
+    static TriangleEventSPtr nextTriangleEvent(EdgeSPtr edge, double offset);
 
     static DblEdgeMergeEventSPtr nextDblEdgeMergeEvent(PolyhedronSPtr polyhedron, double offset);
+    static DblEdgeMergeEventSPtr nextDblEdgeMergeEvent(EdgeSPtr edge, double offset);
 
     static DblTriangleEventSPtr nextDblTriangleEvent(PolyhedronSPtr polyhedron, double offset);
+    static DblTriangleEventSPtr nextDblTriangleEvent(EdgeSPtr edge, double offset);
 
     /**
      * A tetrahedron causes one final event only.
      */
     static TetrahedronEventSPtr nextTetrahedronEvent(PolyhedronSPtr polyhedron, double offset);
+    static TetrahedronEventSPtr nextTetrahedronEvent(EdgeSPtr edge, double offset);
 
     /**
      * Two vertices crash into each other.
      */
     static VertexEventSPtr nextVertexEvent(PolyhedronSPtr polyhedron, double offset);
+    static VertexEventSPtr nextVertexEvent(VertexSPtr vertex, double offset);
 
     static FlipVertexEventSPtr nextFlipVertexEvent(PolyhedronSPtr polyhedron, double offset);
+    static FlipVertexEventSPtr nextFlipVertexEvent(VertexSPtr vertex, double offset);
 
     /**
      * Split event on the surface.
      * Edges do not need to be reflex.
      */
     static SurfaceEventSPtr nextSurfaceEvent(PolyhedronSPtr polyhedron, double offset);
+    static SurfaceEventSPtr nextSurfaceEvent(EdgeSPtr edge, double offset);
 
     /**
      * This event occurs when two edges collide.
      * The first edge is always reflex.
      */
     static PolyhedronSplitEventSPtr nextPolyhedronSplitEvent(PolyhedronSPtr polyhedron, double offset);
+    static PolyhedronSplitEventSPtr nextPolyhedronSplitEvent(EdgeSPtr edge, double offset);
 
     static SplitMergeEventSPtr nextSplitMergeEvent(PolyhedronSPtr polyhedron, double offset);
+    static SplitMergeEventSPtr nextSplitMergeEvent(VertexSPtr vertex, double offset);
 
     /**
      * This event occurs when two edges collide.
      * The first edge is always reflex.
      */
     static EdgeSplitEventSPtr nextEdgeSplitEvent(PolyhedronSPtr polyhedron, double offset);
+    /**
+     * Both edges have to be reflex.
+     */
+    static EdgeSplitEventSPtr nextEdgeSplitEvent(EdgeSPtr edge_1, EdgeSPtr edge_2, double offset);
 
     /**
      * A reflex vertex reaches a facet.
      */
     static PierceEventSPtr nextPierceEvent(PolyhedronSPtr polyhedron, double offset);
+    /**
+     * The vertex has to be reflex.
+     */
+    static PierceEventSPtr nextPierceEvent(VertexSPtr vertex, FacetSPtr facet, double offset);
+    /**
+     * Like nextPierceEvent(polyhedron, offset), but events with an offset
+     * below offset_min are not guaranteed to be found.
+     * If facet_bvh is set, it is updated and every reflex vertex is tested
+     * only against the facets that it can reach before offset_min.
+     */
+    static PierceEventSPtr nextPierceEvent(PolyhedronSPtr polyhedron,
+            FacetBVHSPtr facet_bvh, double offset, double offset_min);
+    /**
+     * The vertex has to be reflex.
+     * facet_bvh has to be updated for the given facets and offset_min before.
+     */
+    static PierceEventSPtr nextPierceEvent(VertexSPtr vertex,
+            const std::vector<FacetSPtr>& facets, FacetBVHSPtr facet_bvh,
+            double offset, double offset_min);
 
     /**
      * Determines the next event.
+     * Uses the event queue if configured (event_scheduler = queue),
+     * otherwise all scanning functions above.
+     * The scanning functions run on the thread pool if scanner_threads != 1.
+     * Of the events within TIE_EPSILON of the highest offset, the one
+     * that is not certified to come after another one wins.
      */
     AbstractEventSPtr nextEvent(PolyhedronSPtr polyhedron, double offset);
 
+    /**
+     * Returns the next event and, if event_batching is enabled,
+     * all other events within batch_epsilon that do not share
+     * a facet (see collectFacets) with each other
+     * or with an earlier event that is not part of the batch.
+     * The events can be handled after a single shift of the facets.
+     * The event queue does not support batching.
+     */
+    std::list<AbstractEventSPtr> nextEvents(PolyhedronSPtr polyhedron, double offset);
+
+    /**
+     * Collects the facets that are modified when the event is handled.
+     * These are the facets around the vertices of the edges,
+     * vertices and facets of the event.
+     */
+    static void collectFacets(AbstractEventSPtr event,
+            std::unordered_set<const Facet*>& facets);
+
+    /**
+     * Order of events in time: the higher offset comes first.
+     */
+    static bool isLaterEvent(AbstractEventSPtr event_1, AbstractEventSPtr event_2);
+
+    /**
+     * Returns the node of the event, an empty pointer for
+     * constant and save offset events.
+     */
+    static NodeSPtr getNode(AbstractEventSPtr event);
+
+    /**
+     * Encloses the offset of the event in an interval.
+     * The event point is reached by at least 4 facets at the same time.
+     * The 4 facets that fit the computed point best and are independent
+     * give a linear system in the point and the offset,
+     * which is solved in interval arithmetic of type T.
+     * offset is the current offset of the facets.
+     * Returns false if there are no such 4 facets.
+     */
+    template<class T>
+    static bool certifyOffset(AbstractEventSPtr event, double offset,
+            util::Interval<T>& result);
+
+    /**
+     * Compares the offsets of 2 events:
+     * 1 if event_1 comes first, -1 if event_2 comes first,
+     * 0 if they are at the same offset.
+     * Offsets that are closer than TIE_EPSILON are compared by their
+     * certified intervals, first in double and, if these overlap,
+     * in long double. If the intervals still overlap,
+     * the computed offsets decide.
+     * The facets of both events must not be modified concurrently.
+     */
+    static int compareEvents(AbstractEventSPtr event_1, AbstractEventSPtr event_2,
+            double offset);
+
+    /**
+     * Like compareEvents, but only by the certified intervals.
+     * 0 if the order cannot be certified.
+     */
+    static int certifyOrder(AbstractEventSPtr event_1, AbstractEventSPtr event_2,
+            double offset);
+
+    /**
+     * True if there is no result yet or if event comes before result
+     * by compareEvents. The scanning functions keep the event for which
+     * this is true, so events within the tie window of each other are
+     * already ordered by their certified offsets inside a scanner.
+     * On equal offsets, the result that was found first is kept.
+     */
+    static bool isNextEvent(AbstractEventSPtr event, AbstractEventSPtr result,
+            double offset);
+
+    /**
+     * TIE_EPSILON relative to the given offset.
+     */
+    static double tieWindow(double offset);
+
+    /**
+     * Relative distance of offsets below which the order of 2 events
+     * is certified by compareEvents.
+     */
+    static const double TIE_EPSILON;
+
     /**
      * Creates an offset polyhedron.
      * Negative offset points to the interior of the polyhedron.
      */
     static PolyhedronSPtr shiftFacets(PolyhedronSPtr polyhedron, double offset);
 
+    /**
+     * Like shiftFacets(polyhedron, offset) on the half-edge representation.
+     * The topology is copied, only points and planes are computed.
+     * The speeds are taken from the facets the mesh was created from.
+     * Vertices of a degree higher than 3 are computed from the first
+     * 3 facets around them, which are not always the ones shiftFacets uses.
+     * Returns an empty pointer if a vertex has less than 3 facets
+     * or could not be computed.
+     */
+    static HalfEdgeMeshSPtr shiftFacets(HalfEdgeMeshSPtr mesh, double offset);
+
+    /**
+     * Orders the incident edges and facets of a vertex by their slots
+     * in the polyhedron.
+     */
+    static bool isEdgeSlotLess(const EdgeHandle& edge_1, const EdgeHandle& edge_2);
+    static bool isFacetSlotLess(const FacetHandle& facet_1, const FacetHandle& facet_2);
+
+    /**
+     * Moves the facets of the given polyhedron from offset_prev to offset
+     * without copying it.
+     * Vertex positions are computed from the offset planes like in shiftFacets,
+     * the offset links of all elements point to the elements themselves.
+     * If kinetic is set, vertices that have an arc are evaluated in closed form
+     * (SkelVertexData::pointAt) instead. This replaces the intersection of
+     * three planes by a multiply-add, but every vertex is still moved,
+     * so a shift stays linear in the number of vertices.
+     * Points and planes that are not shared with anyone else are
+     * overwritten, shared ones are replaced.
+     * The incident edges and facets of the vertices are kept,
+     * only sorted by slot if an event appended to them.
+     * Returns false if a vertex could not be computed;
+     * the polyhedron stays unchanged in that case.
+     */
+    static bool shiftFacetsInPlace(PolyhedronSPtr polyhedron,
+            double offset_prev, double offset, bool kinetic);
+
     /**
      * Appends a node of an event to the skeleton.
      * It links all adjacent arcs and sheets to this node.
@@ -184,6 +409,12 @@ public:
     void handleEdgeSplitEvent(EdgeSplitEventSPtr event, PolyhedronSPtr polyhedron);
     void handlePierceEvent(PierceEventSPtr event, PolyhedronSPtr polyhedron);
 
+    /**
+     * Calls the handle function of the type of the event.
+     * Constant and save offset events are handled by run().
+     */
+    void handleEvent(AbstractEventSPtr event, PolyhedronSPtr polyhedron);
+
     StraightSkeletonSPtr getResult() const;
 
 protected:
@@ -191,15 +422,137 @@ protected:
     SimpleStraightSkel(PolyhedronSPtr polyhedron, ControllerSPtr controller);
     SimpleStraightSkel(PolyhedronSPtr polyhedron, ControllerSPtr controller, const std::list<double>& save_offsets);
 
+    /**
+     * Propagates one component of the wavefront of the parent.
+     * Shares the settings of the parent, but scans sequentially
+     * and does not write checkpoints or offset files.
+     */
+    SimpleStraightSkel(SimpleStraightSkel* parent);
+
+    /**
+     * Creates the vertex splitter, the event queue, the thread pool
+     * and the facet BVH that settings_ asks for
+     * and describes the settings in the configuration of the result.
+     */
+    void initSettings();
+
+    /**
+     * The event loop of run(), starting at the given offset and batch.
+     * If parallel_components is set and a polyhedron split event
+     * divides a single component of the wavefront,
+     * the components are propagated by propagateComponents.
+     */
+    void propagate(PolyhedronSPtr polyhedron, double offset, unsigned int i);
+
+    /**
+     * The mutex of the skeleton of the outermost parent.
+     * Skeleton elements (e.g. sheets) may be shared by components,
+     * so the event handlers of all components lock the same mutex.
+     */
+    SharedMutex& skelMutex();
+
+    /**
+     * Labels each vertex with the index of its component
+     * (vertices connected by edges).
+     * Returns the number of components.
+     */
+    static unsigned int labelComponents(PolyhedronSPtr polyhedron,
+            std::map<VertexSPtr, unsigned int>& labels);
+
+    /**
+     * Moves the vertices and edges with the given label from the facet
+     * to a new facet with the same plane and facet data.
+     */
+    static FacetSPtr splitFacet(FacetSPtr facet,
+            std::map<VertexSPtr, unsigned int>& labels, unsigned int label);
+
+    /**
+     * Moves each component of the polyhedron to its own polyhedron.
+     * Facets that touch several components are split.
+     * The order of the elements within a component is kept.
+     */
+    static std::vector<PolyhedronSPtr> splitComponents(PolyhedronSPtr polyhedron);
+
+    /**
+     * The components were part of a single component,
+     * so their interiors are disjoint and they never interact again.
+     * Each one is propagated on its own thread with its own event queue,
+     * the partial skeletons are merged by mergeComponents.
+     */
+    void propagateComponents(std::vector<PolyhedronSPtr>& components,
+            double offset, unsigned int i);
+
+    /**
+     * Appends the elements of the skeletons of the children.
+     * Events are merged by offset. Constant and save offset events
+     * of the components at the same offset are combined into one.
+     */
+    void mergeComponents(std::vector<SimpleStraightSkelSPtr>& children);
+
+    static PolyhedronSPtr mergePolyhedrons(
+            const std::list<PolyhedronSPtr>& polyhedrons);
+
     static FacetSPtr getFacetSrc(EdgeSPtr edge);
     static FacetSPtr getFacetDst(EdgeSPtr edge);
 
+    /**
+     * Elements of the polyhedron in the order of its lists.
+     * Shared read-only by the scanner threads.
+     */
+    struct ScanInput {
+        double offset;
+        double offset_min;
+        double epsilon;
+        int kernel;
+        FacetBVHSPtr facet_bvh;
+        std::vector<EdgeSPtr> edges;
+        std::vector<EdgeSPtr> edges_reflex;
+        std::vector<VertexSPtr> vertices;
+        std::vector<VertexSPtr> vertices_reflex;
+        std::vector<FacetSPtr> facets;
+    };
+
+    /**
+     * Runs one scanner (index of events in nextEvent) on the elements
+     * [begin, end) and stores the first event with the highest offset.
+     * If candidates is set, all events within epsilon of it are appended.
+     */
+    static void scanChunk(const ScanInput* input, unsigned int scanner,
+            unsigned int begin, unsigned int end, AbstractEventSPtr* result,
+            std::list<AbstractEventSPtr>* candidates);
+
+    /**
+     * Splits every scanner into chunks and runs them on the thread pool
+     * (or in the calling thread if there is none).
+     * The chunks are reduced in the order of the polyhedron,
+     * so the result equals the one of the sequential scanning functions.
+     */
+    void scanChunks(PolyhedronSPtr polyhedron, double offset,
+            AbstractEventSPtr events[], std::list<AbstractEventSPtr>* candidates);
+
+    /**
+     * Like nextEvent(polyhedron, offset).
+     * If candidates is set, it receives all events of the scanning functions
+     * within batch_epsilon of the next event (including itself).
+     */
+    AbstractEventSPtr nextEvent(PolyhedronSPtr polyhedron, double offset,
+            std::list<AbstractEventSPtr>* candidates);
+
     PolyhedronSPtr polyhedron_;
     ControllerSPtr controller_;
+    SkelSettingsSPtr settings_;
     std::list<double> save_offsets_;
     bool use_fast_vertex_splitter_;
     AbstractVertexSplitterSPtr vertex_splitter_;
-    int edge_event_;
+    EventQueueSPtr event_queue_;
+    util::ThreadPoolSPtr thread_pool_;
+    FacetBVHSPtr facet_bvh_;
+    db::_3d::CheckpointFileSPtr checkpoint_resume_;
+    double max_offset_;
+    unsigned int max_events_;
+    int kernel_;
+    unsigned int num_batches_;
+    SimpleStraightSkel* parent_;
     StraightSkeletonSPtr skel_result_;
 };
 
@@ -0,0 +1,375 @@
+/**
+ * @file   algo/3d/SkelSettings.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#include "algo/3d/SkelSettings.h"
+
+#include "debug.h"
+#include "algo/3d/AbstractSimpleSphericalSkel.h"
+#include "util/ptrs.h"
+#include "util/Configuration.h"
+#include <string>
+
+namespace algo { namespace _3d {
+
+const int SkelSettings::ANGLE_VERTEX_SPLITTER;
+const int SkelSettings::COMBI_VERTEX_SPLITTER;
+const int SkelSettings::CONVEX_VERTEX_SPLITTER;
+const int SkelSettings::VOLUME_VERTEX_SPLITTER;
+const int SkelSettings::WEIGHT_VERTEX_SPLITTER;
+const int SkelSettings::SPHERE_VERTEX_SPLITTER;
+const int SkelSettings::CONVEX_EDGE_EVENT;
+const int SkelSettings::REFLEX_EDGE_EVENT;
+const int SkelSettings::FLIP_EDGE_EVENT;
+const int SkelSettings::SPHERE_EDGE_EVENT;
+const int SkelSettings::SCAN_EVENT_SCHEDULER;
+const int SkelSettings::QUEUE_EVENT_SCHEDULER;
+const int SkelSettings::REBUILD_PROPAGATION;
+const int SkelSettings::INPLACE_PROPAGATION;
+const int SkelSettings::KINETIC_PROPAGATION;
+const int SkelSettings::SCAN_PIERCE_SEARCH;
+const int SkelSettings::BVH_PIERCE_SEARCH;
+
+SkelSettings::SkelSettings() {
+    vertex_splitter_ = CONVEX_VERTEX_SPLITTER;
+    edge_event_ = CONVEX_EDGE_EVENT;
+    event_scheduler_ = SCAN_EVENT_SCHEDULER;
+    propagation_ = REBUILD_PROPAGATION;
+    scanner_threads_ = 1;
+    pierce_search_ = BVH_PIERCE_SEARCH;
+    event_batching_ = false;
+    batch_epsilon_ = 0.0;
+    checkpoint_file_ = "checkpoint.bin";
+    checkpoint_events_ = 0;
+    checkpoint_seconds_ = 0.0;
+    parallel_components_ = false;
+    const_offset_ = 0.0;
+    screenshot_on_const_offset_event_ = false;
+    convex_optimization_ = -1;
+    volume_optimization_ = 1;
+    selected_combi_ = 0;
+    algo_sphericalskel_ = AbstractSimpleSphericalSkel::PROJ_SIMPLE_SPHERICAL_SKEL;
+    proj_const_offset_ = 0.0;
+    rot_const_offset_ = 0.0;
+    trans_const_offset_ = 0.0;
+}
+
+SkelSettings::~SkelSettings() {
+    // intentionally does nothing
+}
+
+SkelSettingsSPtr SkelSettings::create() {
+    SkelSettingsSPtr result = SkelSettingsSPtr(new SkelSettings());
+    util::ConfigurationSPtr config = util::Configuration::getInstance();
+    if (!config->isLoaded()) {
+        return result;
+    }
+    const char* section = "algo_3d_SimpleStraightSkel";
+
+    std::string s_vertex_splitter = config->getString(section, "vertex_splitter");
+    if (s_vertex_splitter.compare("AngleVertexSplitter") == 0) {
+        result->vertex_splitter_ = ANGLE_VERTEX_SPLITTER;
+    } else if (s_vertex_splitter.compare("CombiVertexSplitter") == 0) {
+        result->vertex_splitter_ = COMBI_VERTEX_SPLITTER;
+    } else if (s_vertex_splitter.compare("ConvexVertexSplitter") == 0) {
+        result->vertex_splitter_ = CONVEX_VERTEX_SPLITTER;
+    } else if (s_vertex_splitter.compare("VolumeVertexSplitter") == 0) {
+        result->vertex_splitter_ = VOLUME_VERTEX_SPLITTER;
+    } else if (s_vertex_splitter.compare("WeightVertexSplitter") == 0) {
+        result->vertex_splitter_ = WEIGHT_VERTEX_SPLITTER;
+    } else if (s_vertex_splitter.compare("SphereVertexSplitter") == 0) {
+        result->vertex_splitter_ = SPHERE_VERTEX_SPLITTER;
+    } else {
+        DEBUG_VAL("Warning: '" << s_vertex_splitter << "' not found.");
+        DEBUG_VAL("Using 'ConvexVertexSplitter'.");
+    }
+
+    std::string s_edge_event = config->getString(section, "edge_event");
+    if (s_edge_event.compare("convex") == 0) {
+        result->edge_event_ = CONVEX_EDGE_EVENT;
+    } else if (s_edge_event.compare("reflex") == 0) {
+        result->edge_event_ = REFLEX_EDGE_EVENT;
+    } else if (s_edge_event.compare("flip") == 0) {
+        result->edge_event_ = FLIP_EDGE_EVENT;
+    } else if (s_edge_event.compare("sphere") == 0) {
+        result->edge_event_ = SPHERE_EDGE_EVENT;
+    } else {
+        DEBUG_VAL("Warning: option '" << s_edge_event << "' not found.");
+        DEBUG_VAL("Using 'convex'.");
+    }
+
+    std::string s_event_scheduler = config->getString(section, "event_scheduler");
+    if (s_event_scheduler.compare("scan") == 0) {
+        result->event_scheduler_ = SCAN_EVENT_SCHEDULER;
+    } else if (s_event_scheduler.compare("queue") == 0) {
+        result->event_scheduler_ = QUEUE_EVENT_SCHEDULER;
+    } else {
+        DEBUG_VAL("Warning: option '" << s_event_scheduler << "' not found.");
+        DEBUG_VAL("Using 'scan'.");
+    }
+
+    std::string s_propagation = config->getString(section, "propagation");
+    if (s_propagation.compare("rebuild") == 0) {
+        result->propagation_ = REBUILD_PROPAGATION;
+    } else if (s_propagation.compare("inplace") == 0) {
+        result->propagation_ = INPLACE_PROPAGATION;
+    } else if (s_propagation.compare("kinetic") == 0) {
+        result->propagation_ = KINETIC_PROPAGATION;
+    } else {
+        DEBUG_VAL("Warning: option '" << s_propagation << "' not found.");
+        DEBUG_VAL("Using 'rebuild'.");
+    }
+
+    if (config->contains(section, "scanner_threads")) {
+        int scanner_threads = config->getInt(section, "scanner_threads");
+        if (scanner_threads < 0) {
+            DEBUG_VAL("Warning: scanner_threads=" << scanner_threads << " not valid.");
+            DEBUG_VAL("Using 1.");
+        } else {
+            result->scanner_threads_ = scanner_threads;
+        }
+    }
+
+    std::string s_pierce_search = config->getString(section, "pierce_search");
+    if (s_pierce_search.compare("scan") == 0) {
+        result->pierce_search_ = SCAN_PIERCE_SEARCH;
+    } else if (s_pierce_search.compare("bvh") == 0) {
+        result->pierce_search_ = BVH_PIERCE_SEARCH;
+    } else {
+        DEBUG_VAL("Warning: option '" << s_pierce_search << "' not found.");
+        DEBUG_VAL("Using 'bvh'.");
+    }
+
+    result->event_batching_ = config->getBool(section, "event_batching");
+    if (result->event_batching_ &&
+            result->event_scheduler_ == QUEUE_EVENT_SCHEDULER) {
+        // the queue returns one event, it does not collect the candidates
+        DEBUG_VAL("Warning: event_batching is not supported by event_scheduler=queue.");
+        DEBUG_VAL("Using event_batching=FALSE.");
+        result->event_batching_ = false;
+    }
+    double batch_epsilon = config->getDouble(section, "batch_epsilon");
+    if (batch_epsilon < 0.0) {
+        DEBUG_VAL("Warning: batch_epsilon=" << batch_epsilon << " not valid.");
+        DEBUG_VAL("Using 0.");
+    } else {
+        result->batch_epsilon_ = batch_epsilon;
+    }
+
+    if (config->contains(section, "checkpoint_file")) {
+        result->checkpoint_file_ = config->getString(section, "checkpoint_file");
+    }
+    int checkpoint_events = config->getInt(section, "checkpoint_events");
+    if (checkpoint_events < 0) {
+        DEBUG_VAL("Warning: checkpoint_events=" << checkpoint_events << " not valid.");
+        DEBUG_VAL("Using 0.");
+    } else {
+        result->checkpoint_events_ = checkpoint_events;
+    }
+    double checkpoint_seconds = config->getDouble(section, "checkpoint_seconds");
+    if (checkpoint_seconds < 0.0) {
+        DEBUG_VAL("Warning: checkpoint_seconds=" << checkpoint_seconds << " not valid.");
+        DEBUG_VAL("Using 0.");
+    } else {
+        result->checkpoint_seconds_ = checkpoint_seconds;
+    }
+
+    result->parallel_components_ = config->getBool(section, "parallel_components");
+
+    result->const_offset_ = config->getDouble(
+            "algo_3d_SimpleStraightSkel", "const_offset");
+    result->screenshot_on_const_offset_event_ = config->getBool(
+            "algo_3d_SimpleStraightSkel", "screenshot_on_const_offset_event");
+    result->convex_optimization_ = readOptimization(
+            "algo_3d_ConvexVertexSplitter", result->convex_optimization_);
+    result->volume_optimization_ = readOptimization(
+            "algo_3d_VolumeVertexSplitter", result->volume_optimization_);
+    result->selected_combi_ = config->getInt(
+            "algo_3d_CombiVertexSplitter", "selected_combi");
+    std::string s_algo_sphericalskel = config->getString(
+            "algo_3d_SphereVertexSplitter", "algo_sphericalskel");
+    if (s_algo_sphericalskel.compare("ProjSimpleSphericalSkel") == 0) {
+        result->algo_sphericalskel_ = AbstractSimpleSphericalSkel::PROJ_SIMPLE_SPHERICAL_SKEL;
+    } else if (s_algo_sphericalskel.compare("RotSimpleSphericalSkel") == 0) {
+        result->algo_sphericalskel_ = AbstractSimpleSphericalSkel::ROT_SIMPLE_SPHERICAL_SKEL;
+    } else if (s_algo_sphericalskel.compare("TransSimpleSphericalSkel") == 0) {
+        result->algo_sphericalskel_ = AbstractSimpleSphericalSkel::TRANS_SIMPLE_SPHERICAL_SKEL;
+    } else if (s_algo_sphericalskel.compare("SpeedSimpleSphericalSkel") == 0) {
+        result->algo_sphericalskel_ = AbstractSimpleSphericalSkel::SPEED_SIMPLE_SPHERICAL_SKEL;
+    } else {
+        DEBUG_VAL("Warning: " << s_algo_sphericalskel << " not found.");
+        DEBUG_VAL("Using ProjSimpleSphericalSkel.");
+    }
+    result->proj_const_offset_ = config->getDouble(
+            "algo_3d_ProjSimpleSphericalSkel", "const_offset");
+    result->rot_const_offset_ = config->getDouble(
+            "algo_3d_RotSimpleSphericalSkel", "const_offset");
+    result->trans_const_offset_ = config->getDouble(
+            "algo_3d_TransSimpleSphericalSkel", "const_offset");
+    return result;
+}
+
+int SkelSettings::readOptimization(const char* section, int optimization) {
+    int result = optimization;
+    std::string s_optimization = util::Configuration::getInstance()->getString(
+            section, "optimization");
+    if (s_optimization.compare("max") == 0) {
+        result = -1;
+    } else if (s_optimization.compare("min") == 0) {
+        result = 1;
+    }
+    return result;
+}
+
+int SkelSettings::getVertexSplitter() const {
+    return vertex_splitter_;
+}
+
+int SkelSettings::getEdgeEvent() const {
+    return edge_event_;
+}
+
+std::string SkelSettings::getEdgeEventName() const {
+    std::string result;
+    switch (edge_event_) {
+        case CONVEX_EDGE_EVENT:
+            result = "convex";
+            break;
+        case REFLEX_EDGE_EVENT:
+            result = "reflex";
+            break;
+        case FLIP_EDGE_EVENT:
+            result = "flip";
+            break;
+        case SPHERE_EDGE_EVENT:
+            result = "sphere";
+            break;
+    }
+    return result;
+}
+
+int SkelSettings::getEventScheduler() const {
+    return event_scheduler_;
+}
+
+std::string SkelSettings::getEventSchedulerName() const {
+    std::string result;
+    switch (event_scheduler_) {
+        case SCAN_EVENT_SCHEDULER:
+            result = "scan";
+            break;
+        case QUEUE_EVENT_SCHEDULER:
+            result = "queue";
+            break;
+    }
+    return result;
+}
+
+int SkelSettings::getPropagation() const {
+    return propagation_;
+}
+
+std::string SkelSettings::getPropagationName() const {
+    std::string result;
+    switch (propagation_) {
+        case REBUILD_PROPAGATION:
+            result = "rebuild";
+            break;
+        case INPLACE_PROPAGATION:
+            result = "inplace";
+            break;
+        case KINETIC_PROPAGATION:
+            result = "kinetic";
+            break;
+    }
+    return result;
+}
+
+unsigned int SkelSettings::getScannerThreads() const {
+    return scanner_threads_;
+}
+
+int SkelSettings::getPierceSearch() const {
+    return pierce_search_;
+}
+
+std::string SkelSettings::getPierceSearchName() const {
+    std::string result;
+    switch (pierce_search_) {
+        case SCAN_PIERCE_SEARCH:
+            result = "scan";
+            break;
+        case BVH_PIERCE_SEARCH:
+            result = "bvh";
+            break;
+    }
+    return result;
+}
+
+bool SkelSettings::getEventBatching() const {
+    return event_batching_;
+}
+
+double SkelSettings::getBatchEpsilon() const {
+    return batch_epsilon_;
+}
+
+std::string SkelSettings::getCheckpointFile() const {
+    return checkpoint_file_;
+}
+
+unsigned int SkelSettings::getCheckpointEvents() const {
+    return checkpoint_events_;
+}
+
+double SkelSettings::getCheckpointSeconds() const {
+    return checkpoint_seconds_;
+}
+
+bool SkelSettings::getParallelComponents() const {
+    return parallel_components_;
+}
+
+double SkelSettings::getConstOffset() const {
+    return const_offset_;
+}
+
+bool SkelSettings::getScreenshotOnConstOffsetEvent() const {
+    return screenshot_on_const_offset_event_;
+}
+
+int SkelSettings::getConvexOptimization() const {
+    return convex_optimization_;
+}
+
+int SkelSettings::getVolumeOptimization() const {
+    return volume_optimization_;
+}
+
+unsigned int SkelSettings::getSelectedCombi() const {
+    return selected_combi_;
+}
+
+int SkelSettings::getAlgoSphericalSkel() const {
+    return algo_sphericalskel_;
+}
+
+double SkelSettings::getSphericalConstOffset(int type) const {
+    double result = 0.0;
+    switch (type) {
+        case AbstractSimpleSphericalSkel::PROJ_SIMPLE_SPHERICAL_SKEL:
+            result = proj_const_offset_;
+            break;
+        case AbstractSimpleSphericalSkel::ROT_SIMPLE_SPHERICAL_SKEL:
+            result = rot_const_offset_;
+            break;
+        case AbstractSimpleSphericalSkel::TRANS_SIMPLE_SPHERICAL_SKEL:
+            result = trans_const_offset_;
+            break;
+    }
+    return result;
+}
+
+} }
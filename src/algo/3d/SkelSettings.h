@@ -0,0 +1,152 @@
+/**
+ * @file   algo/3d/SkelSettings.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef ALGO_3D_SKELSETTINGS_H
+#define ALGO_3D_SKELSETTINGS_H
+
+#include <string>
+
+#include "algo/3d/ptrs.h"
+
+namespace algo { namespace _3d {
+
+/**
+ * Options of the 3D straight skeleton. They are read from
+ * util::Configuration once when the settings are created
+ * and cannot be changed afterwards.
+ * SimpleStraightSkel passes its settings to the skeletons of its
+ * components and to the vertex splitters,
+ * which pass them to the spherical skeletons.
+ */
+class SkelSettings {
+public:
+    virtual ~SkelSettings();
+
+    /**
+     * Reads the settings from the configuration.
+     * Uses the defaults if the configuration is not loaded.
+     * Invalid values are replaced by the defaults with a warning.
+     */
+    static SkelSettingsSPtr create();
+
+    static const int ANGLE_VERTEX_SPLITTER = 1;
+    static const int COMBI_VERTEX_SPLITTER = 2;
+    static const int CONVEX_VERTEX_SPLITTER = 3;
+    static const int VOLUME_VERTEX_SPLITTER = 4;
+    static const int WEIGHT_VERTEX_SPLITTER = 5;
+    static const int SPHERE_VERTEX_SPLITTER = 6;
+    int getVertexSplitter() const;
+
+    /**
+     * Which vertices an edge event creates.
+     */
+    static const int CONVEX_EDGE_EVENT = 0;
+    static const int REFLEX_EDGE_EVENT = 1;
+    static const int FLIP_EDGE_EVENT = 2;
+    static const int SPHERE_EDGE_EVENT = 3;
+    int getEdgeEvent() const;
+    std::string getEdgeEventName() const;
+
+    /**
+     * SCAN_EVENT_SCHEDULER scans the whole polyhedron for every event,
+     * QUEUE_EVENT_SCHEDULER keeps the events in an EventQueue.
+     */
+    static const int SCAN_EVENT_SCHEDULER = 0;
+    static const int QUEUE_EVENT_SCHEDULER = 1;
+    int getEventScheduler() const;
+    std::string getEventSchedulerName() const;
+
+    /**
+     * How the wavefront is moved to the offset of the next event.
+     */
+    static const int REBUILD_PROPAGATION = 0;
+    static const int INPLACE_PROPAGATION = 1;
+    static const int KINETIC_PROPAGATION = 2;
+    int getPropagation() const;
+    std::string getPropagationName() const;
+
+    /**
+     * Number of threads that scan for events (0: one per core).
+     */
+    unsigned int getScannerThreads() const;
+
+    static const int SCAN_PIERCE_SEARCH = 0;
+    static const int BVH_PIERCE_SEARCH = 1;
+    int getPierceSearch() const;
+    std::string getPierceSearchName() const;
+
+    /**
+     * Always false with QUEUE_EVENT_SCHEDULER.
+     */
+    bool getEventBatching() const;
+    double getBatchEpsilon() const;
+
+    std::string getCheckpointFile() const;
+
+    /**
+     * A checkpoint is written after this many events (0: never).
+     */
+    unsigned int getCheckpointEvents() const;
+
+    /**
+     * A checkpoint is written after this many seconds (0: never).
+     */
+    double getCheckpointSeconds() const;
+
+    bool getParallelComponents() const;
+
+    double getConstOffset() const;
+    bool getScreenshotOnConstOffsetEvent() const;
+
+    /**
+     * -1 maximizes, 1 minimizes.
+     */
+    int getConvexOptimization() const;
+    int getVolumeOptimization() const;
+    unsigned int getSelectedCombi() const;
+
+    /**
+     * Type of the spherical skeleton of SphereVertexSplitter,
+     * one of AbstractSimpleSphericalSkel::*_SIMPLE_SPHERICAL_SKEL.
+     */
+    int getAlgoSphericalSkel() const;
+
+    /**
+     * Constant offset of the spherical skeleton of the given type.
+     */
+    double getSphericalConstOffset(int type) const;
+
+protected:
+    SkelSettings();
+
+    static int readOptimization(const char* section, int optimization);
+
+    int vertex_splitter_;
+    int edge_event_;
+    int event_scheduler_;
+    int propagation_;
+    unsigned int scanner_threads_;
+    int pierce_search_;
+    bool event_batching_;
+    double batch_epsilon_;
+    std::string checkpoint_file_;
+    unsigned int checkpoint_events_;
+    double checkpoint_seconds_;
+    bool parallel_components_;
+    double const_offset_;
+    bool screenshot_on_const_offset_event_;
+    int convex_optimization_;
+    int volume_optimization_;
+    unsigned int selected_combi_;
+    int algo_sphericalskel_;
+    double proj_const_offset_;
+    double rot_const_offset_;
+    double trans_const_offset_;
+};
+
+} }
+
+#endif /* ALGO_3D_SKELSETTINGS_H */
@@ -13,6 +13,7 @@
 #include "algo/3d/RotSimpleSphericalSkel.h"
 #include "algo/3d/TransSimpleSphericalSkel.h"
 #include "algo/3d/SpeedSimpleSphericalSkel.h"
+#include "algo/3d/SkelSettings.h"
 #include "data/3d/Vertex.h"
 #include "data/3d/Edge.h"
 #include "data/3d/Facet.h"
@@ -25,7 +26,6 @@
 #include "data/3d/skel/SkelVertexData.h"
 #include "data/3d/skel/SphericalSkelVertexData.h"
 #include "data/3d/skel/SphericalSkelEdgeData.h"
-#include "util/Configuration.h"
 #include <list>
 #include <map>
 
@@ -34,15 +34,24 @@ namespace algo { namespace _3d {
 SphereVertexSplitter::SphereVertexSplitter() {
     type_ = AbstractVertexSplitter::SPHERE_VERTEX_SPLITTER;
     controller_ = ControllerSPtr();
+    settings_ = SkelSettings::create();
 }
 
 SphereVertexSplitter::SphereVertexSplitter(ControllerSPtr controller) {
     type_ = AbstractVertexSplitter::SPHERE_VERTEX_SPLITTER;
     controller_ = controller;
+    settings_ = SkelSettings::create();
+}
+
+SphereVertexSplitter::SphereVertexSplitter(ControllerSPtr controller, SkelSettingsSPtr settings) {
+    type_ = AbstractVertexSplitter::SPHERE_VERTEX_SPLITTER;
+    controller_ = controller;
+    settings_ = settings;
 }
 
 SphereVertexSplitter::~SphereVertexSplitter() {
     controller_.reset();
+    settings_.reset();
 }
 
 SphereVertexSplitterSPtr SphereVertexSplitter::create() {
@@ -57,6 +66,13 @@ SphereVertexSplitterSPtr SphereVertexSplitter::create(ControllerSPtr controller)
     return result;
 }
 
+SphereVertexSplitterSPtr SphereVertexSplitter::create(ControllerSPtr controller,
+        SkelSettingsSPtr settings) {
+    SphereVertexSplitterSPtr result =
+            SphereVertexSplitterSPtr(new SphereVertexSplitter(controller, settings));
+    return result;
+}
+
 
 FacetSPtr SphereVertexSplitter::findFacet(EdgeSPtr edge_1, EdgeSPtr edge_2) {
     FacetSPtr result;
@@ -93,13 +109,10 @@ SphericalPolygonSPtr SphereVertexSplitter::intersectPolyhedron(VertexSPtr vertex
     SphericalPolygonSPtr result = SphericalPolygon::create(sphere);
 
     std::list<EdgeSPtr> edges;
-    std::list<EdgeWPtr>::iterator it_ew = vertex->edges().begin();
+    std::list<EdgeHandle>::iterator it_ew = vertex->edges().begin();
     while (it_ew != vertex->edges().end()) {
-        EdgeWPtr edge_wptr = *it_ew++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            edges.push_back(edge);
-        }
+        EdgeSPtr edge = (*it_ew++).lock();
+        edges.push_back(edge);
     }
 
     while (edges.size() > 0) {
@@ -172,25 +185,23 @@ PolyhedronSPtr SphereVertexSplitter::splitVertex(VertexSPtr vertex) {
     DEBUG_VAR(polygon->toString());
 
     AbstractSimpleSphericalSkelSPtr algo_sphericalskel;
-    util::ConfigurationSPtr config = util::Configuration::getInstance();
-    if (config->isLoaded()) {
-        std::string s_algo_sphericalskel = config->getString(
-                "algo_3d_SphereVertexSplitter", "algo_sphericalskel");
-        if (s_algo_sphericalskel.compare("ProjSimpleSphericalSkel") == 0) {
-            algo_sphericalskel = ProjSimpleSphericalSkel::create(polygon, controller_);
-        } else if (s_algo_sphericalskel.compare("RotSimpleSphericalSkel") == 0) {
-            algo_sphericalskel = RotSimpleSphericalSkel::create(polygon, controller_);
-        } else if (s_algo_sphericalskel.compare("TransSimpleSphericalSkel") == 0) {
-            algo_sphericalskel = TransSimpleSphericalSkel::create(polygon, controller_);
-        } else if (s_algo_sphericalskel.compare("SpeedSimpleSphericalSkel") == 0) {
-            algo_sphericalskel = SpeedSimpleSphericalSkel::create(polygon, controller_);
-        } else {
-            DEBUG_VAL("Warning: " << s_algo_sphericalskel << " not found.");
-            DEBUG_VAL("Using ProjSimpleSphericalSkel.");
-            algo_sphericalskel = ProjSimpleSphericalSkel::create(polygon, controller_);
-        }
-    } else {
-        algo_sphericalskel = ProjSimpleSphericalSkel::create(polygon, controller_);
+    switch (settings_->getAlgoSphericalSkel()) {
+        case AbstractSimpleSphericalSkel::ROT_SIMPLE_SPHERICAL_SKEL:
+            algo_sphericalskel = RotSimpleSphericalSkel::create(
+                    polygon, controller_, settings_);
+            break;
+        case AbstractSimpleSphericalSkel::TRANS_SIMPLE_SPHERICAL_SKEL:
+            algo_sphericalskel = TransSimpleSphericalSkel::create(
+                    polygon, controller_, settings_);
+            break;
+        case AbstractSimpleSphericalSkel::SPEED_SIMPLE_SPHERICAL_SKEL:
+            algo_sphericalskel = SpeedSimpleSphericalSkel::create(
+                    polygon, controller_);
+            break;
+        default:
+            algo_sphericalskel = ProjSimpleSphericalSkel::create(
+                    polygon, controller_, settings_);
+            break;
     }
     SphericalSkeletonSPtr sphericalskel = algo_sphericalskel->getResult();
     if (controller_) {
@@ -310,13 +321,10 @@ PolyhedronSPtr SphereVertexSplitter::splitVertex(VertexSPtr vertex) {
         }
     }
 
-    std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+    std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
     while (it_f != vertex->facets().end()) {
-        FacetWPtr facet_wptr = *it_f++;
-        if (!facet_wptr.expired()) {
-            FacetSPtr facet(facet_wptr);
-            facet->removeVertex(vertex);
-        }
+        FacetSPtr facet = (*it_f++).lock();
+        facet->removeVertex(vertex);
     }
     polyhedron->removeVertex(vertex);
     return polyhedron;
@@ -26,6 +26,8 @@ public:
 
     static SphereVertexSplitterSPtr create();
     static SphereVertexSplitterSPtr create(ControllerSPtr controller);
+    static SphereVertexSplitterSPtr create(ControllerSPtr controller,
+            SkelSettingsSPtr settings);
 
     static FacetSPtr findFacet(EdgeSPtr edge_1, EdgeSPtr edge_2);
 
@@ -36,7 +38,9 @@ public:
 protected:
     SphereVertexSplitter();
     SphereVertexSplitter(ControllerSPtr controller);
+    SphereVertexSplitter(ControllerSPtr controller, SkelSettingsSPtr settings);
     ControllerSPtr controller_;
+    SkelSettingsSPtr settings_;
 };
 
 } }
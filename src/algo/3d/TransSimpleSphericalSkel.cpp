@@ -10,6 +10,7 @@
 #include "typedefs_thread.h"
 #include "algo/Controller.h"
 #include "algo/3d/KernelWrapper.h"
+#include "algo/3d/SkelSettings.h"
 #include "data/3d/SphericalPolygon.h"
 #include "data/3d/CircularVertex.h"
 #include "data/3d/CircularEdge.h"
@@ -31,7 +32,6 @@
 #include "data/3d/skel/SphericalVertexEvent.h"
 #include "data/3d/skel/SphericalEdgeMergeEvent.h"
 #include "data/3d/skel/SphericalInversionEvent.h"
-#include "util/Configuration.h"
 #include <list>
 
 namespace algo { namespace _3d {
@@ -40,6 +40,7 @@ TransSimpleSphericalSkel::TransSimpleSphericalSkel(SphericalPolygonSPtr polygon)
     type_ = AbstractSimpleSphericalSkel::TRANS_SIMPLE_SPHERICAL_SKEL;
     polygon_ = polygon;
     controller_ = ControllerSPtr();
+    settings_ = SkelSettings::create();
     skel_result_ = SphericalSkeleton::create(polygon->getSphere());
     epsilon_ = 0.005;
 }
@@ -48,6 +49,17 @@ TransSimpleSphericalSkel::TransSimpleSphericalSkel(SphericalPolygonSPtr polygon,
     type_ = AbstractSimpleSphericalSkel::TRANS_SIMPLE_SPHERICAL_SKEL;
     polygon_ = polygon;
     controller_ = controller;
+    settings_ = SkelSettings::create();
+    skel_result_ = SphericalSkeleton::create(polygon->getSphere());
+    epsilon_ = 0.005;
+}
+
+TransSimpleSphericalSkel::TransSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+        SkelSettingsSPtr settings) {
+    type_ = AbstractSimpleSphericalSkel::TRANS_SIMPLE_SPHERICAL_SKEL;
+    polygon_ = polygon;
+    controller_ = controller;
+    settings_ = settings;
     skel_result_ = SphericalSkeleton::create(polygon->getSphere());
     epsilon_ = 0.005;
 }
@@ -64,6 +76,11 @@ TransSimpleSphericalSkelSPtr TransSimpleSphericalSkel::create(SphericalPolygonSP
     return TransSimpleSphericalSkelSPtr(new TransSimpleSphericalSkel(polygon, controller));
 }
 
+TransSimpleSphericalSkelSPtr TransSimpleSphericalSkel::create(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+        SkelSettingsSPtr settings) {
+    return TransSimpleSphericalSkelSPtr(new TransSimpleSphericalSkel(polygon, controller, settings));
+}
+
 void TransSimpleSphericalSkel::run() {
     if (controller_) {
         controller_->wait();
@@ -972,8 +989,8 @@ SphericalAbstractEventSPtr TransSimpleSphericalSkel::nextEvent(SphericalPolygonS
     for (unsigned int i = 0; i < 12; i++) {
         events[i] = SphericalAbstractEventSPtr();
     }
-    double const_offset = util::Configuration::getInstance()->getDouble(
-            "algo_3d_TransSimpleSphericalSkel", "const_offset");
+    double const_offset = settings_->getSphericalConstOffset(
+            AbstractSimpleSphericalSkel::TRANS_SIMPLE_SPHERICAL_SKEL);
     if (const_offset != 0.0) {
         events[0] = SphericalConstOffsetEvent::create(offset + const_offset);
     }
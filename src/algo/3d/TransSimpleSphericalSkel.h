@@ -24,6 +24,8 @@ public:
 
     static TransSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon);
     static TransSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon, ControllerSPtr controller);
+    static TransSimpleSphericalSkelSPtr create(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+            SkelSettingsSPtr settings);
 
     virtual void run();
 
@@ -72,6 +74,8 @@ public:
 protected:
     TransSimpleSphericalSkel(SphericalPolygonSPtr polygon);
     TransSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller);
+    TransSimpleSphericalSkel(SphericalPolygonSPtr polygon, ControllerSPtr controller,
+            SkelSettingsSPtr settings);
     double epsilon_;   // TODO: epsilon environment is not good
 };
 
@@ -9,6 +9,7 @@
 #include "debug.h"
 #include "algo/3d/SelfIntersection.h"
 #include "algo/3d/KernelWrapper.h"
+#include "algo/3d/SkelSettings.h"
 #include "data/2d/Vertex.h"
 #include "data/2d/Edge.h"
 #include "data/2d/Polygon.h"
@@ -16,25 +17,14 @@
 #include "data/3d/Edge.h"
 #include "data/3d/Facet.h"
 #include "data/3d/Polyhedron.h"
-#include "util/ptrs.h"
-#include "util/Configuration.h"
 #include <list>
 
 namespace algo { namespace _3d {
 
-VolumeVertexSplitter::VolumeVertexSplitter() {
+VolumeVertexSplitter::VolumeVertexSplitter(SkelSettingsSPtr settings) {
     type_ = AbstractVertexSplitter::VOLUME_VERTEX_SPLITTER;
-    optimization_ = 1;
-    util::ConfigurationSPtr config = util::Configuration::getInstance();
-    if (config->isLoaded()) {
-        std::string s_optimization = config->getString(
-                "algo_3d_VolumeVertexSplitter", "optimization");
-        if (s_optimization.compare("max") == 0) {
-            optimization_ = -1;
-        } else if (s_optimization.compare("min") == 0) {
-            optimization_ = 1;
-        }
-    }
+    selected_combi_ = settings->getSelectedCombi();
+    optimization_ = settings->getVolumeOptimization();
 }
 
 VolumeVertexSplitter::~VolumeVertexSplitter() {
@@ -42,8 +32,12 @@ VolumeVertexSplitter::~VolumeVertexSplitter() {
 }
 
 VolumeVertexSplitterSPtr VolumeVertexSplitter::create() {
+    return create(SkelSettings::create());
+}
+
+VolumeVertexSplitterSPtr VolumeVertexSplitter::create(SkelSettingsSPtr settings) {
     VolumeVertexSplitterSPtr result =
-            VolumeVertexSplitterSPtr(new VolumeVertexSplitter());
+            VolumeVertexSplitterSPtr(new VolumeVertexSplitter(settings));
     return result;
 }
 
@@ -74,7 +68,7 @@ double VolumeVertexSplitter::calcArea(FacetSPtr facet) {
 
 double VolumeVertexSplitter::calcSurfaceArea(PolyhedronSPtr polyhedron) {
     double result = 0.0;
-    std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         FacetSPtr facet = *it_f++;
         result += calcArea(facet);
@@ -84,7 +78,7 @@ double VolumeVertexSplitter::calcSurfaceArea(PolyhedronSPtr polyhedron) {
 
 
 void VolumeVertexSplitter::closeFacets(PolyhedronSPtr polyhedron) {
-    std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         FacetSPtr facet = *it_f++;
         VertexSPtr vertex_src = VertexSPtr();
@@ -117,14 +111,14 @@ int VolumeVertexSplitter::compareSurfaceAreas(PolyhedronSPtr polyhedron_1, Polyh
     PolyhedronSPtr polyhedron_2_c = polyhedron_2->clone();
 
     // set destinations of edges
-    std::list<EdgeSPtr>::iterator it_e1 = polyhedron_1_c->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e1 = polyhedron_1_c->edges().begin();
     while (it_e1 != polyhedron_1_c->edges().end()) {
         EdgeSPtr edge_1 = *it_e1++;
         VertexSPtr vertex_1_dst = edge_1->getVertexDst();
         if (vertex_1_dst->degree() > 1) {
             continue;
         }
-        std::list<EdgeSPtr>::iterator it_e2 = polyhedron_2_c->edges().begin();
+        util::SlotList<EdgeSPtr>::iterator it_e2 = polyhedron_2_c->edges().begin();
         while (it_e2 != polyhedron_2_c->edges().end()) {
             EdgeSPtr edge_2 = *it_e2++;
             VertexSPtr vertex_2_dst = edge_2->getVertexDst();
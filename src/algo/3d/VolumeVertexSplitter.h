@@ -22,6 +22,7 @@ public:
     virtual ~VolumeVertexSplitter();
 
     static VolumeVertexSplitterSPtr create();
+    static VolumeVertexSplitterSPtr create(SkelSettingsSPtr settings);
 
     /**
      * A = \frac{1}{2}\sum_{i=0}^{N-1} (x_i\ y_{i+1} - x_{i+1}\ y_i)
@@ -38,7 +39,7 @@ public:
     virtual std::string toString() const;
 
 protected:
-    VolumeVertexSplitter();
+    VolumeVertexSplitter(SkelSettingsSPtr settings);
     int optimization_;
 };
 
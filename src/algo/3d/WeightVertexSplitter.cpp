@@ -55,17 +55,14 @@ WeightVertexSplitterSPtr WeightVertexSplitter::create(ControllerSPtr controller)
 Plane3SPtr WeightVertexSplitter::createIntersectionPlane(VertexSPtr vertex) {
     Plane3SPtr result;
     Vector3SPtr normal = KernelFactory::createVector3(0.0, 0.0, 0.0);
-    std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+    std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
     while (it_e != vertex->edges().end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge(edge_wptr);
-            Vector3SPtr dir = KernelFactory::createVector3(edge->line());;
-            if (edge->getVertexSrc() != vertex) {
-                dir = KernelFactory::createVector3((*dir) * (-1));
-            }
-            normal = KernelFactory::createVector3((*normal) + (*dir));
+        EdgeSPtr edge = (*it_e++).lock();
+        Vector3SPtr dir = KernelFactory::createVector3(edge->line());;
+        if (edge->getVertexSrc() != vertex) {
+            dir = KernelFactory::createVector3((*dir) * (-1));
         }
+        normal = KernelFactory::createVector3((*normal) + (*dir));
     }
     normal = KernelFactory::createVector3((*normal) / vertex->degree());
     normal = KernelWrapper::normalize(normal);
@@ -12,6 +12,9 @@
 namespace algo { namespace _3d {
 
 class SimpleStraightSkel;
+class SkelSettings;
+class EventQueue;
+class FacetBVH;
 class AbstractVertexSplitter;
 class AngleVertexSplitter;
 class CombiVertexSplitter;
@@ -30,6 +33,12 @@ class GraphChecker;
 
 typedef SHARED_PTR<SimpleStraightSkel> SimpleStraightSkelSPtr;
 typedef WEAK_PTR<SimpleStraightSkel> SimpleStraightSkelWPtr;
+typedef SHARED_PTR<SkelSettings> SkelSettingsSPtr;
+typedef WEAK_PTR<SkelSettings> SkelSettingsWPtr;
+typedef SHARED_PTR<EventQueue> EventQueueSPtr;
+typedef WEAK_PTR<EventQueue> EventQueueWPtr;
+typedef SHARED_PTR<FacetBVH> FacetBVHSPtr;
+typedef WEAK_PTR<FacetBVH> FacetBVHWPtr;
 typedef SHARED_PTR<AbstractVertexSplitter> AbstractVertexSplitterSPtr;
 typedef WEAK_PTR<AbstractVertexSplitter> AbstractVertexSplitterWPtr;
 typedef SHARED_PTR<AngleVertexSplitter> AngleVertexSplitterSPtr;
@@ -19,10 +19,18 @@ namespace data { namespace _3d {
 Edge::Edge(VertexSPtr src, VertexSPtr dst) {
     vertex_src_ = src;
     vertex_dst_ = dst;
+    polyhedron_slot_ = util::SlotList<EdgeSPtr>::NONE;
     id_ = -1;
 }
 
 Edge::~Edge() {
+    // the vertices only hold handles to this edge
+    if (vertex_src_) {
+        vertex_src_->edges().remove(EdgeHandle(this));
+    }
+    if (vertex_dst_ && vertex_dst_ != vertex_src_) {
+        vertex_dst_->edges().remove(EdgeHandle(this));
+    }
     vertex_src_.reset();
     vertex_dst_.reset();
 }
@@ -30,6 +38,7 @@ Edge::~Edge() {
 Edge::Edge(const Edge& edge) {
     vertex_src_ = edge.vertex_src_->clone();
     vertex_dst_ = edge.vertex_dst_->clone();
+    polyhedron_slot_ = util::SlotList<EdgeSPtr>::NONE;
     id_ = -1;
 }
 
@@ -56,11 +65,11 @@ void Edge::setVertexSrc(VertexSPtr src) {
     this->vertex_src_ = src;
 }
 
-std::list<EdgeWPtr>::iterator Edge::getVertexSrcListIt() const {
+std::list<EdgeHandle>::iterator Edge::getVertexSrcListIt() const {
     return this->vertex_src_list_it_;
 }
 
-void Edge::setVertexSrcListIt(std::list<EdgeWPtr>::iterator list_it) {
+void Edge::setVertexSrcListIt(std::list<EdgeHandle>::iterator list_it) {
     this->vertex_src_list_it_ = list_it;
 }
 
@@ -73,11 +82,11 @@ void Edge::setVertexDst(VertexSPtr dst) {
     this->vertex_dst_ = dst;
 }
 
-std::list<EdgeWPtr>::iterator Edge::getVertexDstListIt() const {
+std::list<EdgeHandle>::iterator Edge::getVertexDstListIt() const {
     return this->vertex_dst_list_it_;
 }
 
-void Edge::setVertexDstListIt(std::list<EdgeWPtr>::iterator list_it) {
+void Edge::setVertexDstListIt(std::list<EdgeHandle>::iterator list_it) {
     this->vertex_dst_list_it_ = list_it;
 }
 
@@ -133,12 +142,12 @@ void Edge::setPolyhedron(PolyhedronSPtr polyhedron) {
     this->polyhedron_ = polyhedron;
 }
 
-std::list<EdgeSPtr>::iterator Edge::getPolyhedronListIt() const {
-    return this->polyhedron_list_it_;
+size_t Edge::getPolyhedronSlot() const {
+    return this->polyhedron_slot_;
 }
 
-void Edge::setPolyhedronListIt(std::list<EdgeSPtr>::iterator list_it) {
-    this->polyhedron_list_it_ = list_it;
+void Edge::setPolyhedronSlot(size_t slot) {
+    this->polyhedron_slot_ = slot;
 }
 
 EdgeDataSPtr Edge::getData() const {
@@ -301,17 +310,14 @@ EdgeSPtr Edge::next(VertexSPtr vertex) const {
     }
     if (facet) {
         std::list<EdgeSPtr> edges_possible;
-        std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+        std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
         while (it_e != vertex->edges().end()) {
-            EdgeWPtr edge_wptr = *it_e++;
-            if (!edge_wptr.expired()) {
-                EdgeSPtr edge(edge_wptr);
-                if (edge.get() == this) {
-                    continue;
-                }
-                if (edge->dst(facet) == vertex) {
-                    edges_possible.push_back(edge);
-                }
+            EdgeSPtr edge = (*it_e++).lock();
+            if (edge.get() == this) {
+                continue;
+            }
+            if (edge->dst(facet) == vertex) {
+                edges_possible.push_back(edge);
             }
         }
         if (edges_possible.size() == 1) {
@@ -346,17 +352,14 @@ EdgeSPtr Edge::prev(VertexSPtr vertex) const {
     }
     if (facet) {
         std::list<EdgeSPtr> edges_possible;
-        std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+        std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
         while (it_e != vertex->edges().end()) {
-            EdgeWPtr edge_wptr = *it_e++;
-            if (!edge_wptr.expired()) {
-                EdgeSPtr edge(edge_wptr);
-                if (edge.get() == this) {
-                    continue;
-                }
-                if (edge->src(facet) == vertex) {
-                    edges_possible.push_back(edge);
-                }
+            EdgeSPtr edge = (*it_e++).lock();
+            if (edge.get() == this) {
+                continue;
+            }
+            if (edge->src(facet) == vertex) {
+                edges_possible.push_back(edge);
             }
         }
         if (edges_possible.size() == 1) {
@@ -383,7 +386,7 @@ EdgeSPtr Edge::prev(VertexSPtr vertex) const {
 
 void Edge::invert() {
     VertexSPtr vertex_tmp_ = vertex_src_;
-    std::list<EdgeWPtr>::iterator vertex_tmp_list_it_ = vertex_src_list_it_;
+    std::list<EdgeHandle>::iterator vertex_tmp_list_it_ = vertex_src_list_it_;
     FacetWPtr facet_tmp_ = facet_l_;
     std::list<EdgeSPtr>::iterator facet_tmp_list_it_ = facet_l_list_it_;
 
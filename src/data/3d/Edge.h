@@ -23,13 +23,13 @@ public:
 
     VertexSPtr getVertexSrc() const;
     void setVertexSrc(VertexSPtr src);
-    std::list<EdgeWPtr>::iterator getVertexSrcListIt() const;
-    void setVertexSrcListIt(std::list<EdgeWPtr>::iterator list_it);
+    std::list<EdgeHandle>::iterator getVertexSrcListIt() const;
+    void setVertexSrcListIt(std::list<EdgeHandle>::iterator list_it);
 
     VertexSPtr getVertexDst() const;
     void setVertexDst(VertexSPtr dst);
-    std::list<EdgeWPtr>::iterator getVertexDstListIt() const;
-    void setVertexDstListIt(std::list<EdgeWPtr>::iterator list_it);
+    std::list<EdgeHandle>::iterator getVertexDstListIt() const;
+    void setVertexDstListIt(std::list<EdgeHandle>::iterator list_it);
 
     FacetSPtr getFacetL() const;
     void setFacetL(FacetSPtr facet);
@@ -43,10 +43,22 @@ public:
 
     PolyhedronSPtr getPolyhedron() const;
     void setPolyhedron(PolyhedronSPtr polyhedron);
-    std::list<EdgeSPtr>::iterator getPolyhedronListIt() const;
-    void setPolyhedronListIt(std::list<EdgeSPtr>::iterator list_it);
+    /**
+     * Slot of this edge in the SlotList of the polyhedron.
+     */
+    size_t getPolyhedronSlot() const;
+    void setPolyhedronSlot(size_t slot);
 
     EdgeDataSPtr getData() const;
+
+    /**
+     * The data without reference counting.
+     * Only valid as long as the data is set.
+     */
+    EdgeData* getDataPtr() const {
+        return data_.get();
+    }
+
     void setData(EdgeDataSPtr data);
     bool hasData() const;
 
@@ -103,15 +115,15 @@ protected:
     Edge(VertexSPtr src, VertexSPtr dst);
     Edge(const Edge& edge);
     VertexSPtr vertex_src_;
-    std::list<EdgeWPtr>::iterator vertex_src_list_it_;
+    std::list<EdgeHandle>::iterator vertex_src_list_it_;
     VertexSPtr vertex_dst_;
-    std::list<EdgeWPtr>::iterator vertex_dst_list_it_;
+    std::list<EdgeHandle>::iterator vertex_dst_list_it_;
     FacetWPtr facet_l_;
     std::list<EdgeSPtr>::iterator facet_l_list_it_;
     FacetWPtr facet_r_;
     std::list<EdgeSPtr>::iterator facet_r_list_it_;
     PolyhedronWPtr polyhedron_;
-    std::list<EdgeSPtr>::iterator polyhedron_list_it_;
+    size_t polyhedron_slot_;
     EdgeDataSPtr data_;
 
     int id_;
@@ -10,7 +10,11 @@
 
 namespace data { namespace _3d {
 
+const int EdgeData::EDGE_DATA;
+const int EdgeData::SKEL_EDGE_DATA;
+
 EdgeData::EdgeData() {
+    type_ = EDGE_DATA;
     highlight_ = false;
 }
 
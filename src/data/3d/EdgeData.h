@@ -26,8 +26,19 @@ public:
     bool isHighlight() const;
     void setHighlight(bool highlight);
 
+    static const int EDGE_DATA = 1;
+    static const int SKEL_EDGE_DATA = 2;
+
+    /**
+     * Identifies the subclass without RTTI.
+     */
+    int getType() const {
+        return type_;
+    }
+
 protected:
     EdgeData();
+    int type_;
     EdgeWPtr edge_;
     bool highlight_;
 };
@@ -22,10 +22,17 @@
 namespace data { namespace _3d {
 
 Facet::Facet() {
+    polyhedron_slot_ = util::SlotList<FacetSPtr>::NONE;
     this->id_ = -1;
 }
 
 Facet::~Facet() {
+    // the vertices only hold handles to this facet
+    std::list<VertexSPtr>::iterator it_v = vertices_.begin();
+    while (it_v != vertices_.end()) {
+        VertexSPtr vertex = *it_v++;
+        vertex->facets().remove(FacetHandle(this));
+    }
     triangles_.clear();
     edges_.clear();
     vertices_.clear();
@@ -318,12 +325,12 @@ void Facet::setPolyhedron(PolyhedronSPtr polyhedron) {
     this->polyhedron_ = polyhedron;
 }
 
-std::list<FacetSPtr>::iterator Facet::getPolyhedronListIt() const {
-    return this->polyhedron_list_it_;
+size_t Facet::getPolyhedronSlot() const {
+    return this->polyhedron_slot_;
 }
 
-void Facet::setPolyhedronListIt(std::list<FacetSPtr>::iterator list_it) {
-    this->polyhedron_list_it_ = list_it;
+void Facet::setPolyhedronSlot(size_t slot) {
+    this->polyhedron_slot_ = slot;
 }
 
 FacetDataSPtr Facet::getData() const {
@@ -357,49 +364,39 @@ std::list<TriangleSPtr>& Facet::triangles() {
 
 FacetSPtr Facet::next(VertexSPtr vertex) const {
     FacetSPtr result = FacetSPtr();
-    std::list<FacetWPtr>::const_iterator it_f = vertex->facets().begin();
+    std::list<FacetHandle>::const_iterator it_f = vertex->facets().begin();
     while (it_f != vertex->facets().end()) {
-        FacetWPtr facet_wptr = *it_f;
-        if (!facet_wptr.expired()) {
-            FacetSPtr facet(facet_wptr);
-            if (facet == shared_from_this()) {
-                if (vertex->degree() == 1) {
-                    result = facet;
-                }
-                break;
+        if (it_f->get() == this) {
+            if (vertex->degree() == 1) {
+                result = it_f->lock();
             }
+            break;
         }
         it_f++;
     }
     if (it_f != vertex->facets().end()) {
-        std::list<FacetWPtr>::const_iterator it_f_begin = it_f++;
+        std::list<FacetHandle>::const_iterator it_f_begin = it_f++;
         if (it_f == vertex->facets().end()) {
             it_f = vertex->facets().begin();
         }
         while (it_f != it_f_begin) {
-            FacetWPtr facet_wptr = *it_f++;
+            FacetHandle facet = *it_f++;
             if (it_f == vertex->facets().end()) {
                 it_f = vertex->facets().begin();
             }
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet(facet_wptr);
-                std::list<EdgeWPtr>::const_iterator it_e = vertex->edges().begin();
-                while (it_e != vertex->edges().end()) {
-                    EdgeWPtr edge_wptr = *it_e++;
-                    if (!edge_wptr.expired()) {
-                        EdgeSPtr edge(edge_wptr);
-                        FacetSPtr facet_l = edge->getFacetL();
-                        FacetSPtr facet_r = edge->getFacetR();
-                        if ((facet_l == shared_from_this() &&
-                                    facet_r == facet &&
-                                    edge->getVertexDst() == vertex) ||
-                                (facet_r == shared_from_this() &&
-                                    facet_l == facet &&
-                                    edge->getVertexSrc() == vertex)) {
-                            result = facet;
-                            break;
-                        }
-                    }
+            std::list<EdgeHandle>::const_iterator it_e = vertex->edges().begin();
+            while (it_e != vertex->edges().end()) {
+                EdgeHandle edge = *it_e++;
+                FacetSPtr facet_l = edge->getFacetL();
+                FacetSPtr facet_r = edge->getFacetR();
+                if ((facet_l.get() == this &&
+                            facet == facet_r &&
+                            edge->getVertexDst() == vertex) ||
+                        (facet_r.get() == this &&
+                            facet == facet_l &&
+                            edge->getVertexSrc() == vertex)) {
+                    result = facet.lock();
+                    break;
                 }
             }
         }
@@ -410,49 +407,39 @@ FacetSPtr Facet::next(VertexSPtr vertex) const {
 
 FacetSPtr Facet::prev(VertexSPtr vertex) const {
     FacetSPtr result = FacetSPtr();
-    std::list<FacetWPtr>::const_reverse_iterator it_f = vertex->facets().rbegin();
+    std::list<FacetHandle>::const_reverse_iterator it_f = vertex->facets().rbegin();
     while (it_f != vertex->facets().rend()) {
-        FacetWPtr facet_wptr = *it_f;
-        if (!facet_wptr.expired()) {
-            FacetSPtr facet(facet_wptr);
-            if (facet == shared_from_this()) {
-                if (vertex->degree() == 1) {
-                    result = facet;
-                }
-                break;
+        if (it_f->get() == this) {
+            if (vertex->degree() == 1) {
+                result = it_f->lock();
             }
+            break;
         }
         it_f++;
     }
     if (it_f != vertex->facets().rend()) {
-        std::list<FacetWPtr>::const_reverse_iterator it_f_begin = it_f++;
+        std::list<FacetHandle>::const_reverse_iterator it_f_begin = it_f++;
         if (it_f == vertex->facets().rend()) {
             it_f = vertex->facets().rbegin();
         }
         while (it_f != it_f_begin) {
-            FacetWPtr facet_wptr = *it_f++;
+            FacetHandle facet = *it_f++;
             if (it_f == vertex->facets().rend()) {
                 it_f = vertex->facets().rbegin();
             }
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet(facet_wptr);
-                std::list<EdgeWPtr>::const_iterator it_e = vertex->edges().begin();
-                while (it_e != vertex->edges().end()) {
-                    EdgeWPtr edge_wptr = *it_e++;
-                    if (!edge_wptr.expired()) {
-                        EdgeSPtr edge(edge_wptr);
-                        FacetSPtr facet_l = edge->getFacetL();
-                        FacetSPtr facet_r = edge->getFacetR();
-                        if ((facet_l == shared_from_this() &&
-                                    facet_r == facet &&
-                                    edge->getVertexSrc() == vertex) ||
-                                (facet_r == shared_from_this() &&
-                                    facet_l == facet &&
-                                    edge->getVertexDst() == vertex)) {
-                            result = facet;
-                            break;
-                        }
-                    }
+            std::list<EdgeHandle>::const_iterator it_e = vertex->edges().begin();
+            while (it_e != vertex->edges().end()) {
+                EdgeHandle edge = *it_e++;
+                FacetSPtr facet_l = edge->getFacetL();
+                FacetSPtr facet_r = edge->getFacetR();
+                if ((facet_l.get() == this &&
+                            facet == facet_r &&
+                            edge->getVertexSrc() == vertex) ||
+                        (facet_r.get() == this &&
+                            facet == facet_l &&
+                            edge->getVertexDst() == vertex)) {
+                    result = facet.lock();
+                    break;
                 }
             }
         }
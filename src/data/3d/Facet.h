@@ -61,10 +61,22 @@ public:
 
     PolyhedronSPtr getPolyhedron() const;
     void setPolyhedron(PolyhedronSPtr polyhedron);
-    std::list<FacetSPtr>::iterator getPolyhedronListIt() const;
-    void setPolyhedronListIt(std::list<FacetSPtr>::iterator list_it);
+    /**
+     * Slot of this facet in the SlotList of the polyhedron.
+     */
+    size_t getPolyhedronSlot() const;
+    void setPolyhedronSlot(size_t slot);
 
     FacetDataSPtr getData() const;
+
+    /**
+     * The data without reference counting.
+     * Only valid as long as the data is set.
+     */
+    FacetData* getDataPtr() const {
+        return data_.get();
+    }
+
     void setData(FacetDataSPtr data);
     bool hasData() const;
 
@@ -107,7 +119,7 @@ protected:
     std::list<EdgeSPtr> edges_;
     std::list<TriangleSPtr> triangles_;
     PolyhedronWPtr polyhedron_;
-    std::list<FacetSPtr>::iterator polyhedron_list_it_;
+    size_t polyhedron_slot_;
     FacetDataSPtr data_;
     int id_;
     Plane3SPtr plane_;
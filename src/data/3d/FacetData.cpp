@@ -10,7 +10,11 @@
 
 namespace data { namespace _3d {
 
+const int FacetData::FACET_DATA;
+const int FacetData::SKEL_FACET_DATA;
+
 FacetData::FacetData() {
+    type_ = FACET_DATA;
     highlight_ = false;
 }
 
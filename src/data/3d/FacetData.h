@@ -23,8 +23,19 @@ public:
     bool isHighlight() const;
     void setHighlight(bool highlight);
 
+    static const int FACET_DATA = 1;
+    static const int SKEL_FACET_DATA = 2;
+
+    /**
+     * Identifies the subclass without RTTI.
+     */
+    int getType() const {
+        return type_;
+    }
+
 protected:
     FacetData();
+    int type_;
     FacetWPtr facet_;
     bool highlight_;
 };
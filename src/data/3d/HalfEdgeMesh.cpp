@@ -0,0 +1,326 @@
+/**
+ * @file   data/3d/HalfEdgeMesh.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#include "data/3d/HalfEdgeMesh.h"
+
+#include "debug.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Polyhedron.h"
+#include <list>
+#include <map>
+
+namespace data { namespace _3d {
+
+const uint32_t HalfEdgeMesh::NONE;
+
+HalfEdgeMesh::HalfEdgeMesh() {
+    facet_begin_.push_back(0);
+}
+
+HalfEdgeMesh::~HalfEdgeMesh() {
+    // intentionally does nothing
+}
+
+HalfEdgeMeshSPtr HalfEdgeMesh::create() {
+    HalfEdgeMeshSPtr result = HalfEdgeMeshSPtr(new HalfEdgeMesh());
+    return result;
+}
+
+HalfEdgeMeshSPtr HalfEdgeMesh::create(PolyhedronSPtr polyhedron) {
+    HalfEdgeMeshSPtr result = HalfEdgeMeshSPtr(new HalfEdgeMesh());
+    std::map<VertexSPtr, uint32_t> vertex_ids;
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        vertex_ids[vertex] = result->vertices_.size();
+        result->vertices_.push_back(vertex);
+        result->points_.push_back(vertex->getPoint());
+        result->vertex_halfedge_.push_back(NONE);
+    }
+    std::map<EdgeSPtr, uint32_t> edge_ids;
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        edge_ids[edge] = result->edges_.size();
+        result->edges_.push_back(edge);
+        result->edge_halfedge_.push_back(NONE);
+    }
+    std::vector<uint32_t> edge_halfedge_r(result->edges_.size(), NONE);
+
+    result->facet_begin_.clear();
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        uint32_t f = result->facets_.size();
+        uint32_t begin = result->origin_.size();
+        result->facets_.push_back(facet);
+        result->planes_.push_back(facet->getPlane());
+        result->facet_begin_.push_back(begin);
+        std::multimap<uint32_t, uint32_t> origins;
+        std::vector<uint32_t> dests;
+        std::list<EdgeSPtr>::iterator it_e = facet->edges().begin();
+        while (it_e != facet->edges().end()) {
+            EdgeSPtr edge = *it_e++;
+            std::map<EdgeSPtr, uint32_t>::iterator it_id = edge_ids.find(edge);
+            if (it_id == edge_ids.end()) {
+                DEBUG_VAL("Warning: Edge of facet not in polyhedron.");
+                continue;
+            }
+            uint32_t e = it_id->second;
+            uint32_t v_src = vertex_ids[edge->getVertexSrc()];
+            uint32_t v_dst = vertex_ids[edge->getVertexDst()];
+            // an edge with the same facet on both sides is contained twice
+            bool left = (edge->getFacetL() == facet &&
+                    (edge->getFacetR() != facet ||
+                    result->edge_halfedge_[e] == NONE));
+            uint32_t h;
+            if (left) {
+                h = result->addHalfEdge(v_src, f, e);
+                result->edge_halfedge_[e] = h;
+                dests.push_back(v_dst);
+            } else {
+                h = result->addHalfEdge(v_dst, f, e);
+                edge_halfedge_r[e] = h;
+                dests.push_back(v_src);
+            }
+            origins.insert(std::pair<uint32_t, uint32_t>(result->origin_[h], h));
+        }
+        uint32_t end = result->origin_.size();
+        for (uint32_t h = begin; h < end; h++) {
+            uint32_t h_next = NONE;
+            std::pair<std::multimap<uint32_t, uint32_t>::iterator,
+                    std::multimap<uint32_t, uint32_t>::iterator> range =
+                    origins.equal_range(dests[h - begin]);
+            if (range.first != range.second) {
+                h_next = range.first->second;
+                range.first++;
+                if (range.first != range.second) {
+                    // the facet touches this vertex more than once
+                    EdgeSPtr edge_next = result->edges_[result->edge_[h]]->next(facet);
+                    std::multimap<uint32_t, uint32_t>::iterator it_o = origins.find(dests[h - begin]);
+                    while (it_o != range.second) {
+                        uint32_t h_candidate = it_o->second;
+                        it_o++;
+                        if (result->edges_[result->edge_[h_candidate]] == edge_next) {
+                            h_next = h_candidate;
+                            break;
+                        }
+                    }
+                }
+            }
+            result->next_[h] = h_next;
+            if (h_next != NONE) {
+                result->prev_[h_next] = h;
+            }
+        }
+    }
+    result->facet_begin_.push_back(result->origin_.size());
+
+    for (uint32_t e = 0; e < result->edges_.size(); e++) {
+        EdgeSPtr edge = result->edges_[e];
+        if (result->edge_halfedge_[e] == NONE) {
+            result->edge_halfedge_[e] = result->addHalfEdge(
+                    vertex_ids[edge->getVertexSrc()], NONE, e);
+        }
+        if (edge_halfedge_r[e] == NONE) {
+            edge_halfedge_r[e] = result->addHalfEdge(
+                    vertex_ids[edge->getVertexDst()], NONE, e);
+        }
+        result->twin_[result->edge_halfedge_[e]] = edge_halfedge_r[e];
+        result->twin_[edge_halfedge_r[e]] = result->edge_halfedge_[e];
+    }
+    for (uint32_t h = 0; h < result->origin_.size(); h++) {
+        uint32_t v = result->origin_[h];
+        if (result->vertex_halfedge_[v] == NONE) {
+            result->vertex_halfedge_[v] = h;
+        }
+    }
+    return result;
+}
+
+uint32_t HalfEdgeMesh::addHalfEdge(uint32_t origin, uint32_t facet, uint32_t edge) {
+    uint32_t result = origin_.size();
+    next_.push_back(NONE);
+    prev_.push_back(NONE);
+    twin_.push_back(NONE);
+    origin_.push_back(origin);
+    facet_.push_back(facet);
+    edge_.push_back(edge);
+    return result;
+}
+
+HalfEdgeMeshSPtr HalfEdgeMesh::clone() const {
+    HalfEdgeMeshSPtr result = HalfEdgeMeshSPtr(new HalfEdgeMesh(*this));
+    return result;
+}
+
+PolyhedronSPtr HalfEdgeMesh::toPolyhedron() const {
+    PolyhedronSPtr result = Polyhedron::create();
+    std::vector<VertexSPtr> vertices_c(points_.size());
+    for (uint32_t v = 0; v < points_.size(); v++) {
+        vertices_c[v] = Vertex::create(points_[v]);
+        result->addVertex(vertices_c[v]);
+    }
+    std::vector<EdgeSPtr> edges_c(edge_halfedge_.size());
+    for (uint32_t e = 0; e < edge_halfedge_.size(); e++) {
+        uint32_t h = edge_halfedge_[e];
+        edges_c[e] = Edge::create(vertices_c[origin_[h]], vertices_c[origin_[twin_[h]]]);
+        result->addEdge(edges_c[e]);
+    }
+    for (uint32_t f = 0; f < planes_.size(); f++) {
+        FacetSPtr facet_c = Facet::create();
+        facet_c->setPlane(planes_[f]);
+        for (uint32_t h = facet_begin_[f]; h < facet_begin_[f+1]; h++) {
+            EdgeSPtr edge_c = edges_c[edge_[h]];
+            if (edge_halfedge_[edge_[h]] == h) {
+                edge_c->setFacetL(facet_c);
+            } else {
+                edge_c->setFacetR(facet_c);
+            }
+            facet_c->addEdge(edge_c);
+        }
+        result->addFacet(facet_c);
+    }
+    return result;
+}
+
+uint32_t HalfEdgeMesh::numVertices() const {
+    return points_.size();
+}
+
+uint32_t HalfEdgeMesh::numHalfEdges() const {
+    return origin_.size();
+}
+
+uint32_t HalfEdgeMesh::numEdges() const {
+    return edge_halfedge_.size();
+}
+
+uint32_t HalfEdgeMesh::numFacets() const {
+    return planes_.size();
+}
+
+uint32_t HalfEdgeMesh::next(uint32_t halfedge) const {
+    return next_[halfedge];
+}
+
+uint32_t HalfEdgeMesh::prev(uint32_t halfedge) const {
+    return prev_[halfedge];
+}
+
+uint32_t HalfEdgeMesh::twin(uint32_t halfedge) const {
+    return twin_[halfedge];
+}
+
+uint32_t HalfEdgeMesh::origin(uint32_t halfedge) const {
+    return origin_[halfedge];
+}
+
+uint32_t HalfEdgeMesh::dest(uint32_t halfedge) const {
+    return origin_[twin_[halfedge]];
+}
+
+uint32_t HalfEdgeMesh::facet(uint32_t halfedge) const {
+    return facet_[halfedge];
+}
+
+uint32_t HalfEdgeMesh::edge(uint32_t halfedge) const {
+    return edge_[halfedge];
+}
+
+uint32_t HalfEdgeMesh::nextAround(uint32_t halfedge) const {
+    uint32_t result = NONE;
+    uint32_t h_prev = prev_[halfedge];
+    if (h_prev != NONE) {
+        result = twin_[h_prev];
+    }
+    return result;
+}
+
+uint32_t HalfEdgeMesh::vertexHalfEdge(uint32_t vertex) const {
+    return vertex_halfedge_[vertex];
+}
+
+uint32_t HalfEdgeMesh::edgeHalfEdge(uint32_t edge) const {
+    return edge_halfedge_[edge];
+}
+
+uint32_t HalfEdgeMesh::facetBegin(uint32_t facet) const {
+    return facet_begin_[facet];
+}
+
+uint32_t HalfEdgeMesh::facetEnd(uint32_t facet) const {
+    return facet_begin_[facet+1];
+}
+
+Point3SPtr HalfEdgeMesh::getPoint(uint32_t vertex) const {
+    return points_[vertex];
+}
+
+void HalfEdgeMesh::setPoint(uint32_t vertex, Point3SPtr point) {
+    points_[vertex] = point;
+}
+
+Plane3SPtr HalfEdgeMesh::getPlane(uint32_t facet) const {
+    return planes_[facet];
+}
+
+void HalfEdgeMesh::setPlane(uint32_t facet, Plane3SPtr plane) {
+    planes_[facet] = plane;
+}
+
+VertexSPtr HalfEdgeMesh::getVertex(uint32_t vertex) const {
+    VertexSPtr result;
+    if (vertex < vertices_.size()) {
+        result = vertices_[vertex];
+    }
+    return result;
+}
+
+EdgeSPtr HalfEdgeMesh::getEdge(uint32_t edge) const {
+    EdgeSPtr result;
+    if (edge < edges_.size()) {
+        result = edges_[edge];
+    }
+    return result;
+}
+
+FacetSPtr HalfEdgeMesh::getFacet(uint32_t facet) const {
+    FacetSPtr result;
+    if (facet < facets_.size()) {
+        result = facets_[facet];
+    }
+    return result;
+}
+
+bool HalfEdgeMesh::isConsistent() const {
+    bool result = true;
+    for (uint32_t h = 0; h < origin_.size(); h++) {
+        uint32_t h_twin = twin_[h];
+        if (h_twin == NONE || h_twin == h || twin_[h_twin] != h ||
+                edge_[h_twin] != edge_[h]) {
+            DEBUG_VAL("Error: Twin of half-edge " << h << " is inconsistent.");
+            result = false;
+            continue;
+        }
+        uint32_t h_next = next_[h];
+        if (h_next != NONE) {
+            if (prev_[h_next] != h || facet_[h_next] != facet_[h] ||
+                    origin_[h_next] != origin_[h_twin]) {
+                DEBUG_VAL("Error: Next of half-edge " << h << " is inconsistent.");
+                result = false;
+            }
+        } else if (facet_[h] != NONE) {
+            DEBUG_VAL("Error: Half-edge " << h << " has no next.");
+            result = false;
+        }
+    }
+    return result;
+}
+
+} }
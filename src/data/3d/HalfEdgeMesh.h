@@ -0,0 +1,126 @@
+/**
+ * @file   data/3d/HalfEdgeMesh.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef DATA_3D_HALFEDGEMESH_H
+#define DATA_3D_HALFEDGEMESH_H
+
+#include "data/3d/ptrs.h"
+#include <cstdint>
+#include <vector>
+
+namespace data { namespace _3d {
+
+/**
+ * Compact half-edge representation of a Polyhedron.
+ * Vertices, half-edges, edges and facets are referred to by indices
+ * into contiguous arrays, so next, prev, twin and origin are O(1).
+ * Every edge has two half-edges that are twins of each other.
+ * The half-edges of facet f are [facetBegin(f), facetEnd(f)),
+ * in the order of the edges of the facet (holes included).
+ * Half-edges of edges without a facet on one side follow after
+ * the half-edges of the last facet and have no next or prev.
+ * The elements of the polyhedron the mesh was created from are kept,
+ * so results can be mapped back to them.
+ */
+class HalfEdgeMesh {
+public:
+    virtual ~HalfEdgeMesh();
+
+    static const uint32_t NONE = 0xffffffff;
+
+    static HalfEdgeMeshSPtr create();
+    static HalfEdgeMeshSPtr create(PolyhedronSPtr polyhedron);
+
+    /**
+     * Same topology and elements of origin, points and planes are shared.
+     */
+    HalfEdgeMeshSPtr clone() const;
+
+    /**
+     * Creates a new polyhedron with the topology of this mesh.
+     * The order of the edges of each facet is kept.
+     */
+    PolyhedronSPtr toPolyhedron() const;
+
+    uint32_t numVertices() const;
+    uint32_t numHalfEdges() const;
+    uint32_t numEdges() const;
+    uint32_t numFacets() const;
+
+    uint32_t next(uint32_t halfedge) const;
+    uint32_t prev(uint32_t halfedge) const;
+    uint32_t twin(uint32_t halfedge) const;
+    uint32_t origin(uint32_t halfedge) const;
+    uint32_t dest(uint32_t halfedge) const;
+    uint32_t facet(uint32_t halfedge) const;
+    uint32_t edge(uint32_t halfedge) const;
+
+    /**
+     * The next half-edge with the same origin: twin(prev(halfedge)).
+     */
+    uint32_t nextAround(uint32_t halfedge) const;
+
+    /**
+     * One half-edge that starts at the given vertex.
+     */
+    uint32_t vertexHalfEdge(uint32_t vertex) const;
+
+    /**
+     * The half-edge of the edge that starts at the source vertex.
+     */
+    uint32_t edgeHalfEdge(uint32_t edge) const;
+
+    uint32_t facetBegin(uint32_t facet) const;
+    uint32_t facetEnd(uint32_t facet) const;
+
+    Point3SPtr getPoint(uint32_t vertex) const;
+    void setPoint(uint32_t vertex, Point3SPtr point);
+    Plane3SPtr getPlane(uint32_t facet) const;
+    void setPlane(uint32_t facet, Plane3SPtr plane);
+
+    /**
+     * Elements of origin, empty if the mesh was not created
+     * from a polyhedron.
+     */
+    VertexSPtr getVertex(uint32_t vertex) const;
+    EdgeSPtr getEdge(uint32_t edge) const;
+    FacetSPtr getFacet(uint32_t facet) const;
+
+    /**
+     * Checks that twin, next and prev are inverse to each other
+     * and that next stays in the facet.
+     */
+    bool isConsistent() const;
+
+protected:
+    HalfEdgeMesh();
+
+    uint32_t addHalfEdge(uint32_t origin, uint32_t facet, uint32_t edge);
+
+    // vertices
+    std::vector<Point3SPtr> points_;
+    std::vector<uint32_t> vertex_halfedge_;
+    // half-edges
+    std::vector<uint32_t> next_;
+    std::vector<uint32_t> prev_;
+    std::vector<uint32_t> twin_;
+    std::vector<uint32_t> origin_;
+    std::vector<uint32_t> facet_;
+    std::vector<uint32_t> edge_;
+    // edges
+    std::vector<uint32_t> edge_halfedge_;
+    // facets (facet_begin_ has one more entry than there are facets)
+    std::vector<uint32_t> facet_begin_;
+    std::vector<Plane3SPtr> planes_;
+    // elements of origin
+    std::vector<VertexSPtr> vertices_;
+    std::vector<EdgeSPtr> edges_;
+    std::vector<FacetSPtr> facets_;
+};
+
+} }
+
+#endif /* DATA_3D_HALFEDGEMESH_H */
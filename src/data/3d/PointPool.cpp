@@ -0,0 +1,183 @@
+/**
+ * @file   data/3d/PointPool.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#include "data/3d/PointPool.h"
+
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Polyhedron.h"
+#include <map>
+
+namespace data { namespace _3d {
+
+PointPool::PointPool() {
+    // intentionally does nothing
+}
+
+PointPool::~PointPool() {
+    // intentionally does nothing
+}
+
+PointPoolSPtr PointPool::create() {
+    PointPoolSPtr result = PointPoolSPtr(new PointPool());
+    return result;
+}
+
+PointPoolSPtr PointPool::create(PolyhedronSPtr polyhedron) {
+    PointPoolSPtr result = PointPoolSPtr(new PointPool());
+    size_t num_vertices = polyhedron->vertices().size();
+    result->x_.reserve(num_vertices);
+    result->y_.reserve(num_vertices);
+    result->z_.reserve(num_vertices);
+    result->vertices_.reserve(num_vertices);
+    result->vertex_point_.reserve(num_vertices);
+    std::map<Point3*, uint32_t> point_ids;
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        Point3SPtr point = vertex->getPoint();
+        uint32_t p;
+        std::map<Point3*, uint32_t>::iterator it_p = point_ids.find(point.get());
+        if (it_p != point_ids.end()) {
+            p = it_p->second;
+        } else {
+            p = result->addPoint(point);
+            point_ids[point.get()] = p;
+        }
+        result->vertices_.push_back(vertex);
+        result->vertex_point_.push_back(p);
+    }
+    return result;
+}
+
+uint32_t PointPool::addPoint(double x, double y, double z) {
+    uint32_t result = x_.size();
+    x_.push_back(x);
+    y_.push_back(y);
+    z_.push_back(z);
+    return result;
+}
+
+uint32_t PointPool::addPoint(Point3SPtr point) {
+    return addPoint((*point)[0], (*point)[1], (*point)[2]);
+}
+
+uint32_t PointPool::numPoints() const {
+    return x_.size();
+}
+
+double PointPool::getX(uint32_t point) const {
+    return x_[point];
+}
+
+double PointPool::getY(uint32_t point) const {
+    return y_[point];
+}
+
+double PointPool::getZ(uint32_t point) const {
+    return z_[point];
+}
+
+void PointPool::setPoint(uint32_t point, double x, double y, double z) {
+    x_[point] = x;
+    y_[point] = y;
+    z_[point] = z;
+}
+
+Point3SPtr PointPool::getPoint(uint32_t point) const {
+    return KernelFactory::createPoint3(x_[point], y_[point], z_[point]);
+}
+
+uint32_t PointPool::numVertices() const {
+    return vertices_.size();
+}
+
+VertexSPtr PointPool::getVertex(uint32_t vertex) const {
+    return vertices_[vertex];
+}
+
+uint32_t PointPool::pointIndex(uint32_t vertex) const {
+    return vertex_point_[vertex];
+}
+
+void PointPool::apply() const {
+    std::vector<Point3SPtr> points(x_.size());
+    for (uint32_t p = 0; p < x_.size(); p++) {
+        points[p] = getPoint(p);
+    }
+    for (uint32_t v = 0; v < vertices_.size(); v++) {
+        vertices_[v]->setPoint(points[vertex_point_[v]]);
+    }
+}
+
+void PointPool::translate(double x, double y, double z) {
+    size_t n = x_.size();
+    double* px = x_.data();
+    double* py = y_.data();
+    double* pz = z_.data();
+    for (size_t i = 0; i < n; i++) {
+        px[i] += x;
+    }
+    for (size_t i = 0; i < n; i++) {
+        py[i] += y;
+    }
+    for (size_t i = 0; i < n; i++) {
+        pz[i] += z;
+    }
+}
+
+void PointPool::scale(double x, double y, double z) {
+    size_t n = x_.size();
+    double* px = x_.data();
+    double* py = y_.data();
+    double* pz = z_.data();
+    for (size_t i = 0; i < n; i++) {
+        px[i] *= x;
+    }
+    for (size_t i = 0; i < n; i++) {
+        py[i] *= y;
+    }
+    for (size_t i = 0; i < n; i++) {
+        pz[i] *= z;
+    }
+}
+
+bool PointPool::boundingBox(double min[3], double max[3]) const {
+    size_t n = x_.size();
+    if (n == 0) {
+        return false;
+    }
+    const double* coords[3] = {x_.data(), y_.data(), z_.data()};
+    for (unsigned int j = 0; j < 3; j++) {
+        const double* c = coords[j];
+        double c_min = c[0];
+        double c_max = c[0];
+        for (size_t i = 1; i < n; i++) {
+            c_min = (c[i] < c_min) ? c[i] : c_min;
+            c_max = (c[i] > c_max) ? c[i] : c_max;
+        }
+        min[j] = c_min;
+        max[j] = c_max;
+    }
+    return true;
+}
+
+bool PointPool::isInsideBox(const double min[3], const double max[3]) const {
+    bool result = true;
+    size_t n = x_.size();
+    const double* coords[3] = {x_.data(), y_.data(), z_.data()};
+    for (unsigned int j = 0; j < 3 && result; j++) {
+        const double* c = coords[j];
+        unsigned int num_outside = 0;
+        for (size_t i = 0; i < n; i++) {
+            num_outside += (min[j] <= c[i] && c[i] <= max[j]) ? 0 : 1;
+        }
+        result = (num_outside == 0);
+    }
+    return result;
+}
+
+} }
@@ -0,0 +1,76 @@
+/**
+ * @file   data/3d/PointPool.h
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#ifndef DATA_3D_POINTPOOL_H
+#define DATA_3D_POINTPOOL_H
+
+#include "data/3d/ptrs.h"
+#include <cstdint>
+#include <vector>
+
+namespace data { namespace _3d {
+
+/**
+ * Coordinates of the vertices of a polyhedron in contiguous arrays
+ * (x[], y[] and z[]), so transformations run as plain loops.
+ * Vertices refer to their point by index.
+ * Vertices that share a point (see Vertex::isCoincident)
+ * refer to the same index and stay coincident when the points are
+ * written back to the polyhedron.
+ */
+class PointPool {
+public:
+    virtual ~PointPool();
+
+    static PointPoolSPtr create();
+    static PointPoolSPtr create(PolyhedronSPtr polyhedron);
+
+    uint32_t addPoint(double x, double y, double z);
+    uint32_t addPoint(Point3SPtr point);
+
+    uint32_t numPoints() const;
+    double getX(uint32_t point) const;
+    double getY(uint32_t point) const;
+    double getZ(uint32_t point) const;
+    void setPoint(uint32_t point, double x, double y, double z);
+    Point3SPtr getPoint(uint32_t point) const;
+
+    /**
+     * Vertices of the polyhedron the pool was created from.
+     */
+    uint32_t numVertices() const;
+    VertexSPtr getVertex(uint32_t vertex) const;
+    uint32_t pointIndex(uint32_t vertex) const;
+
+    /**
+     * Sets the points of the vertices to the coordinates of the pool.
+     * One point is created for each index.
+     */
+    void apply() const;
+
+    void translate(double x, double y, double z);
+    void scale(double x, double y, double z);
+
+    /**
+     * Returns false if there are no points.
+     */
+    bool boundingBox(double min[3], double max[3]) const;
+
+    bool isInsideBox(const double min[3], const double max[3]) const;
+
+protected:
+    PointPool();
+
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> z_;
+    std::vector<VertexSPtr> vertices_;
+    std::vector<uint32_t> vertex_point_;
+};
+
+} }
+
+#endif /* DATA_3D_POINTPOOL_H */
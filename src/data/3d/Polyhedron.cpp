@@ -12,8 +12,9 @@
 #include "data/3d/Facet.h"
 #include "data/3d/Triangle.h"
 #include "util/StringFactory.h"
+#include <cassert>
 #include <sstream>
-#include <map>
+#include <vector>
 
 namespace data { namespace _3d {
 
@@ -41,40 +42,44 @@ PolyhedronSPtr Polyhedron::create(unsigned int num_facets, FacetSPtr facets[]) {
 }
 
 PolyhedronSPtr Polyhedron::clone() const {
-    std::map<VertexSPtr, VertexSPtr> vertices_c;
-    std::map<EdgeSPtr, EdgeSPtr> edges_c;
     PolyhedronSPtr result = Polyhedron::create();
     result->setDescription(description_);
-    std::list<VertexSPtr>::const_iterator it_v = vertices_.begin();
+    result->vertices_.reserve(vertices_.size());
+    result->edges_.reserve(edges_.size());
+    result->facets_.reserve(facets_.size());
+    // the clone of an element is found by the slot of the element
+    std::vector<VertexSPtr> vertices_c(vertices_.numSlots());
+    std::vector<EdgeSPtr> edges_c(edges_.numSlots());
+    util::SlotList<VertexSPtr>::const_iterator it_v = vertices_.begin();
     while (it_v != vertices_.end()) {
-        VertexSPtr vertex = *it_v++;
+        const VertexSPtr& vertex = *it_v++;
         VertexSPtr vertex_c = vertex->clone();
         result->addVertex(vertex_c);
-        vertices_c[vertex] = vertex_c;
+        vertices_c[vertex->getPolyhedronSlot()] = vertex_c;
     }
-    std::list<EdgeSPtr>::const_iterator it_e = edges_.begin();
+    util::SlotList<EdgeSPtr>::const_iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
-        EdgeSPtr edge = *it_e++;
-        VertexSPtr src = vertices_c[edge->getVertexSrc()];
-        VertexSPtr dst = vertices_c[edge->getVertexDst()];
-        EdgeSPtr edge_c = Edge::create(src, dst);
+        const EdgeSPtr& edge = *it_e++;
+        EdgeSPtr edge_c = Edge::create(
+                vertices_c[slotOf(edge->getVertexSrc())],
+                vertices_c[slotOf(edge->getVertexDst())]);
         result->addEdge(edge_c);
-        edges_c[edge] = edge_c;
+        edges_c[edge->getPolyhedronSlot()] = edge_c;
     }
-    std::list<FacetSPtr>::const_iterator it_f = facets_.begin();
+    util::SlotList<FacetSPtr>::const_iterator it_f = facets_.begin();
     while (it_f != facets_.end()) {
-        FacetSPtr facet = *it_f++;
+        const FacetSPtr& facet = *it_f++;
         FacetSPtr facet_c = Facet::create();
         facet_c->setPlane(facet->getPlane());
         std::list<VertexSPtr>::const_iterator it_v = facet->vertices().begin();
         while (it_v != facet->vertices().end()) {
-            VertexSPtr vertex = *it_v++;
-            facet_c->addVertex(vertices_c[vertex]);
+            const VertexSPtr& vertex = *it_v++;
+            facet_c->addVertex(vertices_c[slotOf(vertex)]);
         }
         std::list<EdgeSPtr>::const_iterator it_e = facet->edges().begin();
         while (it_e != facet->edges().end()) {
-            EdgeSPtr edge = *it_e++;
-            EdgeSPtr edge_c = edges_c[edge];
+            const EdgeSPtr& edge = *it_e++;
+            EdgeSPtr edge_c = edges_c[slotOf(edge)];
             if (edge->getFacetL() == facet) {
                 edge_c->setFacetL(facet_c);
             }
@@ -88,7 +93,7 @@ PolyhedronSPtr Polyhedron::clone() const {
             TriangleSPtr triangle = *it_t++;
             VertexSPtr vertices_t_c[3];
             for (unsigned int i = 0; i < 3; i++) {
-                vertices_t_c[i] = vertices_c[triangle->getVertex(i)];
+                vertices_t_c[i] = vertices_c[slotOf(triangle->getVertex(i))];
             }
             Triangle::create(facet_c, vertices_t_c);
         }
@@ -97,33 +102,39 @@ PolyhedronSPtr Polyhedron::clone() const {
     return result;
 }
 
+size_t Polyhedron::slotOf(const VertexSPtr& vertex) const {
+    size_t result = vertex->getPolyhedronSlot();
+    assert(result < vertices_.numSlots() && vertices_.at(result) == vertex);
+    return result;
+}
+
+size_t Polyhedron::slotOf(const EdgeSPtr& edge) const {
+    size_t result = edge->getPolyhedronSlot();
+    assert(result < edges_.numSlots() && edges_.at(result) == edge);
+    return result;
+}
+
 void Polyhedron::addVertex(VertexSPtr vertex) {
-    std::list<VertexSPtr>::iterator it = vertices_.insert(vertices_.end(), vertex);
+    size_t slot = vertices_.push_back(vertex);
     vertex->setPolyhedron(shared_from_this());
-    vertex->setPolyhedronListIt(it);
+    vertex->setPolyhedronSlot(slot);
 }
 
 bool Polyhedron::removeVertex(VertexSPtr vertex) {
     bool result = false;
     if (vertex->getPolyhedron() == shared_from_this()) {
-        vertices_.erase(vertex->getPolyhedronListIt());
-        vertex->setPolyhedronListIt(std::list<VertexSPtr>::iterator());
+        vertices_.erase(vertex->getPolyhedronSlot());
+        vertex->setPolyhedronSlot(util::SlotList<VertexSPtr>::NONE);
         vertex->setPolyhedron(PolyhedronSPtr());
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet = FacetSPtr(facet_wptr);
-                this->removeFacet(facet);
-            }
+            FacetSPtr facet = (*it_f++).lock();
+            this->removeFacet(facet);
         }
-        std::list<EdgeWPtr>::iterator it_e = vertex->edges().begin();
+        std::list<EdgeHandle>::iterator it_e = vertex->edges().begin();
         while (it_e != vertex->edges().end()) {
-            EdgeWPtr edge_wptr = *it_e++;
-            if (!edge_wptr.expired()) {
-                EdgeSPtr edge = EdgeSPtr(edge_wptr);
-                this->removeEdge(edge);
-            }
+            EdgeSPtr edge = (*it_e++).lock();
+            this->removeEdge(edge);
         }
         result = true;
     }
@@ -132,7 +143,7 @@ bool Polyhedron::removeVertex(VertexSPtr vertex) {
 
 VertexSPtr Polyhedron::findVertex(VertexSPtr needle) {
     VertexSPtr result = VertexSPtr();
-    std::list<VertexSPtr>::iterator it_v = vertices_.begin();
+    util::SlotList<VertexSPtr>::iterator it_v = vertices_.begin();
     while (it_v != vertices_.end()) {
         VertexSPtr vertex = *it_v++;
         if (vertex->getPoint() == needle->getPoint()) {
@@ -144,9 +155,9 @@ VertexSPtr Polyhedron::findVertex(VertexSPtr needle) {
 }
 
 void Polyhedron::addEdge(EdgeSPtr edge) {
-    std::list<EdgeSPtr>::iterator it = edges_.insert(edges_.end(), edge);
+    size_t slot = edges_.push_back(edge);
     edge->setPolyhedron(shared_from_this());
-    edge->setPolyhedronListIt(it);
+    edge->setPolyhedronSlot(slot);
     VertexSPtr vertex = edge->getVertexSrc();
     if (vertex->getPolyhedron() != shared_from_this()) {
         this->addVertex(vertex);
@@ -160,8 +171,8 @@ void Polyhedron::addEdge(EdgeSPtr edge) {
 bool Polyhedron::removeEdge(EdgeSPtr edge) {
     bool result = false;
     if (edge->getPolyhedron() == shared_from_this()) {
-        edges_.erase(edge->getPolyhedronListIt());
-        edge->setPolyhedronListIt(std::list<EdgeSPtr>::iterator());
+        edges_.erase(edge->getPolyhedronSlot());
+        edge->setPolyhedronSlot(util::SlotList<EdgeSPtr>::NONE);
         edge->setPolyhedron(PolyhedronSPtr());
         FacetSPtr facet = edge->getFacetL();
         if (facet) {
@@ -180,7 +191,7 @@ bool Polyhedron::removeEdge(EdgeSPtr edge) {
 
 EdgeSPtr Polyhedron::findEdge(EdgeSPtr needle) {
     EdgeSPtr result = EdgeSPtr();
-    std::list<EdgeSPtr>::iterator it_e = edges_.begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
         EdgeSPtr edge = *it_e++;
         if (edge->getVertexSrc()->getPoint() ==
@@ -202,8 +213,8 @@ EdgeSPtr Polyhedron::findEdge(EdgeSPtr needle) {
 }
 
 void Polyhedron::addFacet(FacetSPtr facet) {
-    std::list<FacetSPtr>::iterator it_f = facets_.insert(facets_.end(), facet);
-    facet->setPolyhedronListIt(it_f);
+    size_t slot = facets_.push_back(facet);
+    facet->setPolyhedronSlot(slot);
     facet->setPolyhedron(shared_from_this());
     // add content of facet
     std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
@@ -225,9 +236,9 @@ void Polyhedron::addFacet(FacetSPtr facet) {
 bool Polyhedron::removeFacet(FacetSPtr facet) {
     bool result = false;
     if (facet->getPolyhedron() == shared_from_this()) {
-        facets_.erase(facet->getPolyhedronListIt());
+        facets_.erase(facet->getPolyhedronSlot());
         facet->setPolyhedron(PolyhedronSPtr());
-        facet->setPolyhedronListIt(std::list<FacetSPtr>::iterator());
+        facet->setPolyhedronSlot(util::SlotList<FacetSPtr>::NONE);
         std::list<EdgeSPtr>::iterator it_e = facet->edges().begin();
         while (it_e != facet->edges().end()) {
             EdgeSPtr edge = *it_e++;
@@ -243,8 +254,32 @@ bool Polyhedron::removeFacet(FacetSPtr facet) {
     return result;
 }
 
+void Polyhedron::moveVertex(VertexSPtr& vertex, size_t slot) {
+    vertex->setPolyhedronSlot(slot);
+}
+
+void Polyhedron::moveEdge(EdgeSPtr& edge, size_t slot) {
+    edge->setPolyhedronSlot(slot);
+}
+
+void Polyhedron::moveFacet(FacetSPtr& facet, size_t slot) {
+    facet->setPolyhedronSlot(slot);
+}
+
+void Polyhedron::compact() {
+    if (vertices_.numGaps() > 0) {
+        vertices_.compact(&Polyhedron::moveVertex);
+    }
+    if (edges_.numGaps() > 0) {
+        edges_.compact(&Polyhedron::moveEdge);
+    }
+    if (facets_.numGaps() > 0) {
+        facets_.compact(&Polyhedron::moveFacet);
+    }
+}
+
 void Polyhedron::initPlanes() {
-    std::list<FacetSPtr>::iterator it_f = facets_.begin();
+    util::SlotList<FacetSPtr>::iterator it_f = facets_.begin();
     while (it_f != facets_.end()) {
         FacetSPtr facet = *it_f++;
         facet->initPlane();
@@ -252,17 +287,17 @@ void Polyhedron::initPlanes() {
 }
 
 void Polyhedron::clearData() {
-    std::list<VertexSPtr>::iterator it_v = vertices_.begin();
+    util::SlotList<VertexSPtr>::iterator it_v = vertices_.begin();
     while (it_v != vertices_.end()) {
         VertexSPtr vertex = *it_v++;
         vertex->setData(VertexDataSPtr());
     }
-    std::list<EdgeSPtr>::iterator it_e = edges_.begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
         EdgeSPtr edge = *it_e++;
         edge->setData(EdgeDataSPtr());
     }
-    std::list<FacetSPtr>::iterator it_f = facets_.begin();
+    util::SlotList<FacetSPtr>::iterator it_f = facets_.begin();
     while (it_f != facets_.end()) {
         FacetSPtr facet = *it_f++;
         facet->setData(FacetDataSPtr());
@@ -273,22 +308,22 @@ SharedMutex& Polyhedron::mutex() {
     return this->mutex_;
 }
 
-std::list<VertexSPtr>& Polyhedron::vertices() {
+util::SlotList<VertexSPtr>& Polyhedron::vertices() {
     return this->vertices_;
 }
 
-std::list<EdgeSPtr>& Polyhedron::edges() {
+util::SlotList<EdgeSPtr>& Polyhedron::edges() {
     return this->edges_;
 }
 
-std::list<FacetSPtr>& Polyhedron::facets() {
+util::SlotList<FacetSPtr>& Polyhedron::facets() {
     return this->facets_;
 }
 
 bool Polyhedron::isConsistent() const {
     bool result = true;
 
-    std::list<VertexSPtr>::const_iterator it_v = vertices_.begin();
+    util::SlotList<VertexSPtr>::const_iterator it_v = vertices_.begin();
     while (it_v != vertices_.end()) {
         VertexSPtr vertex = *it_v++;
         if (vertex->getPolyhedron() != shared_from_this()) {
@@ -296,40 +331,30 @@ bool Polyhedron::isConsistent() const {
             result = false;
             break;
         }
-        std::list<EdgeWPtr>::const_iterator it_e = vertex->edges().begin();
+        std::list<EdgeHandle>::const_iterator it_e = vertex->edges().begin();
         while (it_e != vertex->edges().end()) {
-            EdgeWPtr edge_wptr = *it_e++;
-            if (edge_wptr.expired()) {
+            EdgeSPtr edge = (*it_e++).lock();
+            if (vertex != edge->getVertexSrc() &&
+                    vertex != edge->getVertexDst()) {
                 DEBUG_VAR(vertex->toString());
-            } else {
-                EdgeSPtr edge = EdgeSPtr(edge_wptr);
-                if (vertex != edge->getVertexSrc() &&
-                        vertex != edge->getVertexDst()) {
-                    DEBUG_VAR(vertex->toString());
-                    DEBUG_VAR(edge->toString());
-                    result = false;
-                    break;
-                }
+                DEBUG_VAR(edge->toString());
+                result = false;
+                break;
             }
         }
-        std::list<FacetWPtr>::const_iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::const_iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (facet_wptr.expired()) {
+            FacetSPtr facet = (*it_f++).lock();
+            if (!facet->containsVertex(vertex)) {
                 DEBUG_VAR(vertex->toString());
-            } else {
-                FacetSPtr facet = FacetSPtr(facet_wptr);
-                if (!facet->containsVertex(vertex)) {
-                    DEBUG_VAR(vertex->toString());
-                    DEBUG_VAR(facet->toString());
-                    result = false;
-                    break;
-                }
+                DEBUG_VAR(facet->toString());
+                result = false;
+                break;
             }
         }
     }
 
-    std::list<EdgeSPtr>::const_iterator it_e = edges_.begin();
+    util::SlotList<EdgeSPtr>::const_iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
         EdgeSPtr edge = *it_e++;
         if (edge->getPolyhedron() != shared_from_this()) {
@@ -349,13 +374,10 @@ bool Polyhedron::isConsistent() const {
             result = false;
             break;
         }
-        EdgeWPtr edge_wptr;
-        edge_wptr = *(edge->getVertexSrcListIt());
-        if (EdgeSPtr(edge_wptr) != edge) {
+        if (*(edge->getVertexSrcListIt()) != edge) {
             DEBUG_VAR(edge->toString());
         }
-        edge_wptr = *(edge->getVertexDstListIt());
-        if (EdgeSPtr(edge_wptr) != edge) {
+        if (*(edge->getVertexDstListIt()) != edge) {
             DEBUG_VAR(edge->toString());
         }
         if (edge->getFacetL()) {
@@ -365,8 +387,7 @@ bool Polyhedron::isConsistent() const {
                 result = false;
                 break;
             }
-            edge_wptr = *(edge->getFacetLListIt());
-            if (EdgeSPtr(edge_wptr) != edge) {
+            if (*(edge->getFacetLListIt()) != edge) {
                 DEBUG_VAR(edge->toString());
             }
         }
@@ -377,14 +398,13 @@ bool Polyhedron::isConsistent() const {
                 result = false;
                 break;
             }
-            edge_wptr = *(edge->getFacetRListIt());
-            if (EdgeSPtr(edge_wptr) != edge) {
+            if (*(edge->getFacetRListIt()) != edge) {
                 DEBUG_VAR(edge->toString());
             }
         }
     }
 
-    std::list<FacetSPtr>::const_iterator it_f = facets_.begin();
+    util::SlotList<FacetSPtr>::const_iterator it_f = facets_.begin();
     while (it_f != facets_.end()) {
         FacetSPtr facet = *it_f++;
         if (facet->getPolyhedron() != shared_from_this()) {
@@ -425,21 +445,22 @@ bool Polyhedron::isConsistent() const {
 }
 
 void Polyhedron::clear() {
-    std::list<FacetSPtr>::iterator it_f = facets_.begin();
+    util::SlotList<FacetSPtr>::iterator it_f = facets_.begin();
     while (it_f != facets_.end()) {
         FacetSPtr facet = *it_f++;
         this->removeFacet(facet);
     }
-    std::list<EdgeSPtr>::iterator it_e = edges_.begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
         EdgeSPtr edge = *it_e++;
         this->removeEdge(edge);
     }
-    std::list<VertexSPtr>::iterator it_v = vertices_.begin();
+    util::SlotList<VertexSPtr>::iterator it_v = vertices_.begin();
     while (it_v != vertices_.end()) {
         VertexSPtr vertex = *it_v++;
         this->removeVertex(vertex);
     }
+    compact();
 }
 
 int Polyhedron::getID() const {
@@ -451,7 +472,7 @@ void Polyhedron::setID(int id) {
 }
 
 void Polyhedron::resetAllIDs() {
-    std::list<FacetSPtr>::iterator it_f = facets_.begin();
+    util::SlotList<FacetSPtr>::iterator it_f = facets_.begin();
     while (it_f != facets_.end()) {
         FacetSPtr facet = *it_f++;
         std::list<TriangleSPtr>::iterator it_t = facet->triangles().begin();
@@ -461,12 +482,12 @@ void Polyhedron::resetAllIDs() {
         }
         facet->setID(-1);
     }
-    std::list<EdgeSPtr>::iterator it_e = edges_.begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
         EdgeSPtr edge = *it_e++;
         edge->setID(-1);
     }
-    std::list<VertexSPtr>::iterator it_v = vertices_.begin();
+    util::SlotList<VertexSPtr>::iterator it_v = vertices_.begin();
     while (it_v != vertices_.end()) {
         VertexSPtr vertex = *it_v++;
         vertex->setID(-1);
@@ -498,19 +519,19 @@ std::string Polyhedron::toString() const {
     sstr << "Edges:" + util::StringFactory::fromInteger(edges_.size()) + ", ";
     sstr << "Facets:" + util::StringFactory::fromInteger(facets_.size()) + ",\n";
 
-    std::list<FacetSPtr>::const_iterator it_f = facets_.begin();
+    util::SlotList<FacetSPtr>::const_iterator it_f = facets_.begin();
     while (it_f != facets_.end()) {
         FacetSPtr facet = *it_f++;
         sstr << facet->toString() << "\n";
     }
     sstr << ")";
 
-  /*std::list<EdgeSPtr>::iterator it_e = edges_.begin();
+  /*util::SlotList<EdgeSPtr>::iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
         EdgeSPtr edge = *it_e++;
         sstr << edge->toString() << "\n";
     }
-    std::list<VertexSPtr>::iterator it_v = vertices_.begin();
+    util::SlotList<VertexSPtr>::iterator it_v = vertices_.begin();
     while (it_v != vertices_.end()) {
         VertexSPtr vertex = *it_v++;
         sstr << vertex->toString() << "\n";
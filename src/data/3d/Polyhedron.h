@@ -9,6 +9,7 @@
 
 #include "data/3d/ptrs.h"
 #include "typedefs_thread.h"
+#include "util/SlotList.h"
 #include <list>
 #include <string>
 
@@ -21,6 +22,10 @@ public:
     static PolyhedronSPtr create();
     static PolyhedronSPtr create(unsigned int num_facets, FacetSPtr facets[]);
 
+    /**
+     * Copies the topology, points and planes are shared.
+     * Runs in O(n): the copies are looked up by the slots of the elements.
+     */
     PolyhedronSPtr clone() const;
 
     void addVertex(VertexSPtr vertex);
@@ -43,14 +48,20 @@ public:
     void addFacet(FacetSPtr facet);
     bool removeFacet(FacetSPtr facet);
 
+    /**
+     * Closes the gaps that removed elements left in the slot lists.
+     * Invalidates all iterators of vertices(), edges() and facets().
+     */
+    void compact();
+
     void initPlanes();
     void clearData();
 
     SharedMutex& mutex();
 
-    std::list<VertexSPtr>& vertices();
-    std::list<EdgeSPtr>& edges();
-    std::list<FacetSPtr>& facets();
+    util::SlotList<VertexSPtr>& vertices();
+    util::SlotList<EdgeSPtr>& edges();
+    util::SlotList<FacetSPtr>& facets();
 
     bool isConsistent() const;
     void clear();
@@ -68,10 +79,19 @@ public:
 
 protected:
     Polyhedron();
+
+    static void moveVertex(VertexSPtr& vertex, size_t slot);
+    static void moveEdge(EdgeSPtr& edge, size_t slot);
+    static void moveFacet(FacetSPtr& facet, size_t slot);
+    /**
+     * Slot of an element of this polyhedron.
+     */
+    size_t slotOf(const VertexSPtr& vertex) const;
+    size_t slotOf(const EdgeSPtr& edge) const;
     mutable SharedMutex mutex_;
-    std::list<VertexSPtr> vertices_;
-    std::list<EdgeSPtr> edges_;
-    std::list<FacetSPtr> facets_;
+    util::SlotList<VertexSPtr> vertices_;
+    util::SlotList<EdgeSPtr> edges_;
+    util::SlotList<FacetSPtr> facets_;
     int id_;
     std::string description_;
 };
@@ -18,6 +18,7 @@ namespace data { namespace _3d {
 
 Vertex::Vertex(Point3SPtr point) {
     this->point_ = point;
+    polyhedron_slot_ = util::SlotList<VertexSPtr>::NONE;
     this->id_ = -1;
 }
 
@@ -28,6 +29,7 @@ Vertex::~Vertex() {
 
 Vertex::Vertex(const Vertex& vertex) {
     point_ = vertex.point_;
+    polyhedron_slot_ = util::SlotList<VertexSPtr>::NONE;
     this->id_ = -1;
 }
 
@@ -50,14 +52,18 @@ void Vertex::setPoint(Point3SPtr point) {
     this->point_ = point;
 }
 
+bool Vertex::isCoincident(VertexSPtr vertex) const {
+    return (this->point_ == vertex->point_);
+}
+
 void Vertex::addEdge(EdgeSPtr edge) {
-    EdgeWPtr edge_wptr(edge);
-    std::list<EdgeWPtr>::iterator it = edges_.insert(edges_.end(), edge_wptr);
+    EdgeHandle edge_h(edge);
+    std::list<EdgeHandle>::iterator it = edges_.insert(edges_.end(), edge_h);
     VertexSPtr vertex_src = edge->getVertexSrc();
     VertexSPtr vertex_dst = edge->getVertexDst();
     if (vertex_src == shared_from_this() && vertex_dst == shared_from_this()) {
-        std::list<EdgeWPtr>::iterator it_e =
-                std::find(edges_.begin(), edges_.end(), edge_wptr);
+        std::list<EdgeHandle>::iterator it_e =
+                std::find(edges_.begin(), edges_.end(), edge_h);
         if (it_e == edge->getVertexSrcListIt()) {
             edge->setVertexDstListIt(it);
         } else {
@@ -74,11 +80,11 @@ bool Vertex::removeEdge(EdgeSPtr edge) {
     bool result = false;
     if (edge->getVertexSrc() == shared_from_this()) {
         edges_.erase(edge->getVertexSrcListIt());
-        edge->setVertexSrcListIt(std::list<EdgeWPtr>::iterator());
+        edge->setVertexSrcListIt(std::list<EdgeHandle>::iterator());
         result = true;
     } else if (edge->getVertexDst() == shared_from_this()) {
         edges_.erase(edge->getVertexDstListIt());
-        edge->setVertexDstListIt(std::list<EdgeWPtr>::iterator());
+        edge->setVertexDstListIt(std::list<EdgeHandle>::iterator());
         result = true;
     }
     return result;
@@ -86,13 +92,8 @@ bool Vertex::removeEdge(EdgeSPtr edge) {
 
 EdgeSPtr Vertex::firstEdge() const {
     EdgeSPtr result;
-    std::list<EdgeWPtr>::const_iterator it_e = edges_.begin();
-    while (it_e != edges_.end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            result = EdgeSPtr(edge_wptr);
-            break;
-        }
+    if (!edges_.empty()) {
+        result = edges_.front().lock();
     }
     DEBUG_SPTR(result);
     return result;
@@ -108,21 +109,18 @@ EdgeSPtr Vertex::getEdge(unsigned int i) {
 
 EdgeSPtr Vertex::findEdge(VertexSPtr dst) const {
     EdgeSPtr result = EdgeSPtr();
-    std::list<EdgeWPtr>::const_iterator it_e = edges_.begin();
+    std::list<EdgeHandle>::const_iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge = EdgeSPtr(edge_wptr);
-            if (edge->getVertexSrc().get() == this &&
-                    edge->getVertexDst() == dst) {
-                result = edge;
-                break;
-            }
-            if (edge->getVertexDst().get() == this &&
-                    edge->getVertexSrc() == dst) {
-                result = edge;
-                break;
-            }
+        EdgeHandle edge = *it_e++;
+        if (edge->getVertexSrc().get() == this &&
+                edge->getVertexDst() == dst) {
+            result = edge.lock();
+            break;
+        }
+        if (edge->getVertexDst().get() == this &&
+                edge->getVertexSrc() == dst) {
+            result = edge.lock();
+            break;
         }
     }
     return result;
@@ -130,50 +128,36 @@ EdgeSPtr Vertex::findEdge(VertexSPtr dst) const {
 
 EdgeSPtr Vertex::findEdge(FacetSPtr facet) const {
     EdgeSPtr result = EdgeSPtr();
-    std::list<EdgeWPtr>::const_iterator it_e = edges_.begin();
+    std::list<EdgeHandle>::const_iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge = EdgeSPtr(edge_wptr);
-            if (edge->src(facet).get() == this) {
-                result = edge;
-                break;
-            }
+        EdgeHandle edge = *it_e++;
+        if (edge->src(facet).get() == this) {
+            result = edge.lock();
+            break;
         }
     }
     return result;
 }
 
 void Vertex::addFacet(FacetSPtr facet) {
-    facets_.insert(facets_.end(), FacetWPtr(facet));
+    facets_.insert(facets_.end(), FacetHandle(facet));
 }
 
 bool Vertex::removeFacet(FacetSPtr facet) {
     bool result = false;
-    std::list<FacetWPtr>::iterator it = facets_.begin();
-    while (it != facets_.end()) {
-        std::list<FacetWPtr>::iterator it_current = it;
-        FacetWPtr facet_wptr = *it++;
-        if (!facet_wptr.expired()) {
-            if (facet_wptr.lock() == facet) {
-                facets_.erase(it_current);
-                result = true;
-                break;
-            }
-        }
+    std::list<FacetHandle>::iterator it = std::find(
+            facets_.begin(), facets_.end(), FacetHandle(facet));
+    if (it != facets_.end()) {
+        facets_.erase(it);
+        result = true;
     }
     return result;
 }
 
 FacetSPtr Vertex::firstFacet() const {
     FacetSPtr result;
-    std::list<FacetWPtr>::const_iterator it_f = facets_.begin();
-    while (it_f != facets_.end()) {
-        FacetWPtr facet_wptr = *it_f++;
-        if (!facet_wptr.expired()) {
-            result = FacetSPtr(facet_wptr);
-            break;
-        }
+    if (!facets_.empty()) {
+        result = facets_.front().lock();
     }
     DEBUG_SPTR(result);
     return result;
@@ -188,33 +172,23 @@ FacetSPtr Vertex::getFacet(unsigned int i) {
 }
 
 bool Vertex::containsEdge(EdgeSPtr edge) const {
-    EdgeWPtr edge_wptr = EdgeWPtr(edge);
     bool result = (edges_.end() !=
-            std::find(edges_.begin(), edges_.end(), edge_wptr));
+            std::find(edges_.begin(), edges_.end(), EdgeHandle(edge)));
     return result;
 }
 
 bool Vertex::containsFacet(FacetSPtr facet) const {
-    FacetWPtr facet_wptr = FacetWPtr(facet);
     bool result = (facets_.end() !=
-            std::find(facets_.begin(), facets_.end(), facet_wptr));
+            std::find(facets_.begin(), facets_.end(), FacetHandle(facet)));
     return result;
 }
 
 void Vertex::sortEdges() {
-    std::list<EdgeWPtr>::iterator it_e = edges_.begin();
-    while (it_e != edges_.end()) {
-        std::list<EdgeWPtr>::iterator it_current = it_e;
-        EdgeWPtr edge_wptr = *it_e++;
-        if (edge_wptr.expired()) {
-            edges_.erase(it_current);
-        }
-    }
     std::list<EdgeSPtr> tmp;
     std::list<EdgeSPtr>::iterator it_e_tmp = tmp.begin();
     if (edges_.size() > 0) {
         EdgeSPtr first = EdgeSPtr();
-        EdgeSPtr edge = EdgeSPtr(edges_.front());
+        EdgeSPtr edge = edges_.front().lock();
         while (edge != first) {
             if (!first) {
                 first = edge;
@@ -236,18 +210,10 @@ void Vertex::sortEdges() {
 }
 
 void Vertex::sortFacets() {
-    std::list<FacetWPtr>::iterator it_f = facets_.begin();
-    while (it_f != facets_.end()) {
-        std::list<FacetWPtr>::iterator it_current = it_f;
-        FacetWPtr facet_wptr = *it_f++;
-        if (facet_wptr.expired()) {
-            facets_.erase(it_current);
-        }
-    }
     std::list<FacetSPtr> tmp;
     std::list<FacetSPtr>::iterator it_f_tmp = tmp.begin();
     if (facets_.size() > 0) {
-        FacetSPtr facet = FacetSPtr(facets_.front());
+        FacetSPtr facet = facets_.front().lock();
         EdgeSPtr edge_first = findEdge(facet);
         EdgeSPtr edge;
         while (edge != edge_first) {
@@ -272,28 +238,12 @@ void Vertex::sortFacets() {
 }
 
 void Vertex::sort() {
-    std::list<EdgeWPtr>::iterator it_e = edges_.begin();
-    while (it_e != edges_.end()) {
-        std::list<EdgeWPtr>::iterator it_current = it_e;
-        EdgeWPtr edge_wptr = *it_e++;
-        if (edge_wptr.expired()) {
-            edges_.erase(it_current);
-        }
-    }
-    std::list<FacetWPtr>::iterator it_f = facets_.begin();
-    while (it_f != facets_.end()) {
-        std::list<FacetWPtr>::iterator it_current = it_f;
-        FacetWPtr facet_wptr = *it_f++;
-        if (facet_wptr.expired()) {
-            facets_.erase(it_current);
-        }
-    }
     std::list<EdgeSPtr> edges_tmp;
     std::list<EdgeSPtr>::iterator it_e_tmp = edges_tmp.begin();
     std::list<FacetSPtr> facets_tmp;
     std::list<FacetSPtr>::iterator it_f_tmp = facets_tmp.begin();
     if (edges_.size() > 0) {
-        EdgeSPtr edge_first = EdgeSPtr(edges_.front());
+        EdgeSPtr edge_first = edges_.front().lock();
         EdgeSPtr edge;
         FacetSPtr facet = edge_first->getFacetL();
         if (edge_first->getVertexDst() == shared_from_this()) {
@@ -343,12 +293,12 @@ void Vertex::setPolyhedron(PolyhedronSPtr polyhedron) {
     this->polyhedron_ = polyhedron;
 }
 
-std::list<VertexSPtr>::iterator Vertex::getPolyhedronListIt() const {
-    return this->polyhedron_list_it_;
+size_t Vertex::getPolyhedronSlot() const {
+    return this->polyhedron_slot_;
 }
 
-void Vertex::setPolyhedronListIt(std::list<VertexSPtr>::iterator list_it) {
-    this->polyhedron_list_it_ = list_it;
+void Vertex::setPolyhedronSlot(size_t slot) {
+    this->polyhedron_slot_ = slot;
 }
 
 VertexDataSPtr Vertex::getData() const {
@@ -368,11 +318,11 @@ bool Vertex::hasData() const {
     return result;
 }
 
-std::list<EdgeWPtr>& Vertex::edges() {
+std::list<EdgeHandle>& Vertex::edges() {
     return this->edges_;
 }
 
-std::list<FacetWPtr>& Vertex::facets() {
+std::list<FacetHandle>& Vertex::facets() {
     return this->facets_;
 }
 
@@ -538,15 +488,7 @@ void Vertex::setID(int id) {
 }
 
 unsigned int Vertex::degree() const {
-    unsigned int result = 0;
-    std::list<EdgeWPtr>::const_iterator it_e = edges_.begin();
-    while (it_e != edges_.end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            result++;
-        }
-    }
-    return result;
+    return edges_.size();
 }
 
 bool Vertex::isReflex() const {
@@ -554,14 +496,11 @@ bool Vertex::isReflex() const {
         return false;
     }
     bool result = true;
-    std::list<EdgeWPtr>::const_iterator it_e = edges_.begin();
+    std::list<EdgeHandle>::const_iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge = EdgeSPtr(edge_wptr);
-            if (!edge->isReflex()) {
-                result = false;
-            }
+        EdgeHandle edge = *it_e++;
+        if (!edge->isReflex()) {
+            result = false;
         }
     }
     return result;
@@ -572,14 +511,11 @@ bool Vertex::isConvex() const {
         return false;
     }
     bool result = true;
-    std::list<EdgeWPtr>::const_iterator it_e = edges_.begin();
+    std::list<EdgeHandle>::const_iterator it_e = edges_.begin();
     while (it_e != edges_.end()) {
-        EdgeWPtr edge_wptr = *it_e++;
-        if (!edge_wptr.expired()) {
-            EdgeSPtr edge = EdgeSPtr(edge_wptr);
-            if (edge->isReflex()) {
-                result = false;
-            }
+        EdgeHandle edge = *it_e++;
+        if (edge->isReflex()) {
+            result = false;
         }
     }
     return result;
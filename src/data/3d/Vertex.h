@@ -24,6 +24,13 @@ public:
     Point3SPtr getPoint() const;
     void setPoint(Point3SPtr point);
 
+    /**
+     * Vertices are coincident if they share the same point,
+     * e.g. both were placed on the point of a node by an event.
+     * The coordinates are not compared.
+     */
+    bool isCoincident(VertexSPtr vertex) const;
+
     void addEdge(EdgeSPtr edge);
     bool removeEdge(EdgeSPtr edge);
     EdgeSPtr firstEdge() const;
@@ -55,15 +62,31 @@ public:
 
     PolyhedronSPtr getPolyhedron() const;
     void setPolyhedron(PolyhedronSPtr polyhedron);
-    std::list<VertexSPtr>::iterator getPolyhedronListIt() const;
-    void setPolyhedronListIt(std::list<VertexSPtr>::iterator list_it);
+    /**
+     * Slot of this vertex in the SlotList of the polyhedron.
+     */
+    size_t getPolyhedronSlot() const;
+    void setPolyhedronSlot(size_t slot);
 
     VertexDataSPtr getData() const;
+
+    /**
+     * The data without reference counting.
+     * Only valid as long as the data is set.
+     */
+    VertexData* getDataPtr() const {
+        return data_.get();
+    }
+
     void setData(VertexDataSPtr data);
     bool hasData() const;
 
-    std::list<EdgeWPtr>& edges();
-    std::list<FacetWPtr>& facets();
+    /**
+     * Handles to the adjacent edges and facets.
+     * An edge or facet removes its handles when it is destroyed.
+     */
+    std::list<EdgeHandle>& edges();
+    std::list<FacetHandle>& facets();
 
     VertexSPtr next(FacetSPtr facet) const;
     VertexSPtr prev(FacetSPtr facet) const;
@@ -99,10 +122,10 @@ protected:
     Vertex(Point3SPtr point);
     Vertex(const Vertex& vertex);
     Point3SPtr point_;
-    std::list<EdgeWPtr> edges_;
-    std::list<FacetWPtr> facets_;
+    std::list<EdgeHandle> edges_;
+    std::list<FacetHandle> facets_;
     PolyhedronWPtr polyhedron_;
-    std::list<VertexSPtr>::iterator polyhedron_list_it_;
+    size_t polyhedron_slot_;
     VertexDataSPtr data_;
     int id_;
 };
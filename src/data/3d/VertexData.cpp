@@ -10,7 +10,11 @@
 
 namespace data { namespace _3d {
 
+const int VertexData::VERTEX_DATA;
+const int VertexData::SKEL_VERTEX_DATA;
+
 VertexData::VertexData() {
+    type_ = VERTEX_DATA;
     highlight_ = false;
 }
 
@@ -26,8 +26,19 @@ public:
     bool isHighlight() const;
     void setHighlight(bool highlight);
 
+    static const int VERTEX_DATA = 1;
+    static const int SKEL_VERTEX_DATA = 2;
+
+    /**
+     * Identifies the subclass without RTTI.
+     */
+    int getType() const {
+        return type_;
+    }
+
 protected:
     VertexData();
+    int type_;
     VertexWPtr vertex_;
     bool highlight_;
 };
@@ -8,6 +8,7 @@
 #define DATA_3D_PTRS_H
 
 #include "smarter_ptr.h"
+#include "util/Handle.h"
 
 #include "config.h"
 #ifdef USE_CGAL
@@ -53,6 +54,8 @@ class VertexData;
 class Edge;
 class EdgeData;
 class Triangle;
+class HalfEdgeMesh;
+class PointPool;
 
 class SphericalPolygon;
 class CircularVertex;
@@ -77,6 +80,7 @@ typedef SHARED_PTR<Polyhedron> PolyhedronSPtr;
 typedef WEAK_PTR<Polyhedron> PolyhedronWPtr;
 typedef SHARED_PTR<Facet> FacetSPtr;
 typedef WEAK_PTR<Facet> FacetWPtr;
+typedef util::Handle<Facet> FacetHandle;
 typedef SHARED_PTR<FacetData> FacetDataSPtr;
 typedef WEAK_PTR<FacetData> FacetDataWPtr;
 typedef SHARED_PTR<Vertex> VertexSPtr;
@@ -85,10 +89,15 @@ typedef SHARED_PTR<VertexData> VertexDataSPtr;
 typedef WEAK_PTR<VertexData> VertexDataWPtr;
 typedef SHARED_PTR<Edge> EdgeSPtr;
 typedef WEAK_PTR<Edge> EdgeWPtr;
+typedef util::Handle<Edge> EdgeHandle;
 typedef SHARED_PTR<EdgeData> EdgeDataSPtr;
 typedef WEAK_PTR<EdgeData> EdgeDataWPtr;
 typedef SHARED_PTR<Triangle> TriangleSPtr;
 typedef WEAK_PTR<Triangle> TriangleWPtr;
+typedef SHARED_PTR<HalfEdgeMesh> HalfEdgeMeshSPtr;
+typedef WEAK_PTR<HalfEdgeMesh> HalfEdgeMeshWPtr;
+typedef SHARED_PTR<PointPool> PointPoolSPtr;
+typedef WEAK_PTR<PointPool> PointPoolWPtr;
 
 typedef SHARED_PTR<SphericalPolygon> SphericalPolygonSPtr;
 typedef WEAK_PTR<SphericalPolygon> SphericalPolygonWPtr;
@@ -7,29 +7,50 @@
 #include "data/3d/skel/AbstractEvent.h"
 
 #include "debug.h"
+#include "data/3d/skel/PolyhedronSnapshot.h"
 #include "util/StringFactory.h"
+#include "util/SlotList.h"
 #include <sstream>
 
 namespace data { namespace _3d { namespace skel {
 
 AbstractEvent::AbstractEvent() {
     id_ = -1;
+    skel_slot_ = util::SlotList<AbstractEventSPtr>::NONE;
 }
 
 AbstractEvent::~AbstractEvent() {
     polyhedron_result_.reset();
+    snapshot_.reset();
     skel_.reset();
 }
 
 PolyhedronSPtr AbstractEvent::getPolyhedronResult() const {
     //DEBUG_SPTR(polyhedron_result_);
-    return polyhedron_result_;
+    PolyhedronSPtr result = polyhedron_result_;
+    if (!result && snapshot_) {
+        result = polyhedron_snapshot_.lock();
+        if (!result) {
+            result = snapshot_->toPolyhedron();
+            polyhedron_snapshot_ = result;
+        }
+    }
+    return result;
 }
 
 void AbstractEvent::setPolyhedronResult(PolyhedronSPtr polyhedron) {
     this->polyhedron_result_ = polyhedron;
 }
 
+PolyhedronSnapshotSPtr AbstractEvent::getSnapshot() const {
+    return this->snapshot_;
+}
+
+void AbstractEvent::setSnapshot(PolyhedronSnapshotSPtr snapshot) {
+    this->snapshot_ = snapshot;
+    this->polyhedron_snapshot_.reset();
+}
+
 StraightSkeletonSPtr AbstractEvent::getSkel() const {
     DEBUG_WPTR(skel_);
     if (this->skel_.expired())
@@ -42,12 +63,12 @@ void AbstractEvent::setSkel(StraightSkeletonSPtr skel) {
     this->skel_ = skel;
 }
 
-std::list<AbstractEventSPtr>::iterator AbstractEvent::getListIt() const {
-    return this->list_it_;
+size_t AbstractEvent::getSkelSlot() const {
+    return this->skel_slot_;
 }
 
-void AbstractEvent::setListIt(std::list<AbstractEventSPtr>::iterator list_it) {
-    this->list_it_ = list_it;
+void AbstractEvent::setSkelSlot(size_t slot) {
+    this->skel_slot_ = slot;
 }
 
 int AbstractEvent::getID() const {
@@ -18,12 +18,22 @@ class AbstractEvent {
 public:
     virtual ~AbstractEvent();
 
+    /**
+     * The polyhedron that was set, otherwise a polyhedron
+     * created from the snapshot.
+     * The created polyhedron is reused as long as someone holds it.
+     */
     PolyhedronSPtr getPolyhedronResult() const;
     void setPolyhedronResult(PolyhedronSPtr polyhedron);
+    PolyhedronSnapshotSPtr getSnapshot() const;
+    void setSnapshot(PolyhedronSnapshotSPtr snapshot);
     StraightSkeletonSPtr getSkel() const;
     void setSkel(StraightSkeletonSPtr skel);
-    std::list<AbstractEventSPtr>::iterator getListIt() const;
-    void setListIt(std::list<AbstractEventSPtr>::iterator list_it);
+    /**
+     * Slot of this event in the SlotList of the skeleton.
+     */
+    size_t getSkelSlot() const;
+    void setSkelSlot(size_t slot);
 
     int getID() const;
     void setID(int id);
@@ -81,8 +91,10 @@ protected:
     AbstractEvent();
 
     PolyhedronSPtr polyhedron_result_;
+    PolyhedronSnapshotSPtr snapshot_;
+    mutable PolyhedronWPtr polyhedron_snapshot_;
     StraightSkeletonWPtr skel_;
-    std::list<AbstractEventSPtr>::iterator list_it_;
+    size_t skel_slot_;
     int type_;
     int id_;
 };
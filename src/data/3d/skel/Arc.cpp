@@ -10,6 +10,8 @@
 #include "data/3d/KernelFactory.h"
 #include "debug.h"
 #include "util/StringFactory.h"
+#include "util/SlotList.h"
+#include <algorithm>
 
 namespace data { namespace _3d { namespace skel {
 
@@ -17,15 +19,24 @@ Arc::Arc(NodeSPtr node_src, Vector3SPtr direction) {
     node_src_ = node_src;
     direction_ = direction;
     id_ = -1;
+    skel_slot_ = util::SlotList<ArcSPtr>::NONE;
 }
 
 Arc::Arc(NodeSPtr node_src, NodeSPtr node_dst) {
     node_src_ = node_src;
     node_dst_ = node_dst;
     id_ = -1;
+    skel_slot_ = util::SlotList<ArcSPtr>::NONE;
 }
 
 Arc::~Arc() {
+    // the nodes only hold handles to this arc
+    if (node_src_) {
+        node_src_->arcs().remove(ArcHandle(this));
+    }
+    if (node_dst_ && node_dst_ != node_src_) {
+        node_dst_->arcs().remove(ArcHandle(this));
+    }
     node_src_.reset();
     node_dst_.reset();
     direction_.reset();
@@ -54,11 +65,11 @@ void Arc::setNodeSrc(NodeSPtr node_src) {
     this->node_src_ = node_src;
 }
 
-std::list<ArcWPtr>::iterator Arc::getNodeSrcListIt() const {
+std::list<ArcHandle>::iterator Arc::getNodeSrcListIt() const {
     return this->node_src_list_it_;
 }
 
-void Arc::setNodeSrcListIt(std::list<ArcWPtr>::iterator node_src_list_it) {
+void Arc::setNodeSrcListIt(std::list<ArcHandle>::iterator node_src_list_it) {
     this->node_src_list_it_ = node_src_list_it;
 }
 
@@ -71,11 +82,11 @@ void Arc::setNodeDst(NodeSPtr node_dst) {
     this->node_dst_ = node_dst;
 }
 
-std::list<ArcWPtr>::iterator Arc::getNodeDstListIt() const {
+std::list<ArcHandle>::iterator Arc::getNodeDstListIt() const {
     return this->node_dst_list_it_;
 }
 
-void Arc::setNodeDstListIt(std::list<ArcWPtr>::iterator node_dst_list_it) {
+void Arc::setNodeDstListIt(std::list<ArcHandle>::iterator node_dst_list_it) {
     this->node_dst_list_it_ = node_dst_list_it;
 }
 
@@ -100,12 +111,12 @@ void Arc::setSkel(StraightSkeletonSPtr skel) {
     this->skel_ = skel;
 }
 
-std::list<ArcSPtr>::iterator Arc::getListIt() const {
-    return this->list_it_;
+size_t Arc::getSkelSlot() const {
+    return this->skel_slot_;
 }
 
-void Arc::setListIt(std::list<ArcSPtr>::iterator list_it) {
-    this->list_it_ = list_it;
+void Arc::setSkelSlot(size_t slot) {
+    this->skel_slot_ = slot;
 }
 
 int Arc::getID() const {
@@ -117,28 +128,21 @@ void Arc::setID(int id) {
 }
 
 void Arc::addSheet(SheetSPtr sheet) {
-    sheets_.insert(sheets_.end(), SheetWPtr(sheet));
+    sheets_.insert(sheets_.end(), SheetHandle(sheet));
 }
 
 bool Arc::removeSheet(SheetSPtr sheet) {
     bool result = false;
-    SheetWPtr sheet_wptr;
-    std::list<SheetWPtr>::iterator it = sheets_.begin();
-    while (it != sheets_.end()) {
-        sheet_wptr = *it;
-        if (!sheet_wptr.expired()) {
-            if (sheet_wptr.lock() == sheet) {
-                sheets_.erase(it);
-                result = true;
-                break;
-            }
-        }
-        it++;
+    std::list<SheetHandle>::iterator it = std::find(
+            sheets_.begin(), sheets_.end(), SheetHandle(sheet));
+    if (it != sheets_.end()) {
+        sheets_.erase(it);
+        result = true;
     }
     return result;
 }
 
-std::list<SheetWPtr>& Arc::sheets() {
+std::list<SheetHandle>& Arc::sheets() {
     return this->sheets_;
 }
 
@@ -14,7 +14,7 @@
 
 namespace data { namespace _3d { namespace skel {
 
-class Arc {
+class Arc : public std::enable_shared_from_this<Arc> {
 public:
     virtual ~Arc();
     static ArcSPtr create(NodeSPtr node_src, Vector3SPtr direction);
@@ -22,18 +22,21 @@ public:
 
     NodeSPtr getNodeSrc() const;
     void setNodeSrc(NodeSPtr node_src);
-    std::list<ArcWPtr>::iterator getNodeSrcListIt() const;
-    void setNodeSrcListIt(std::list<ArcWPtr>::iterator node_src_list_it);
+    std::list<ArcHandle>::iterator getNodeSrcListIt() const;
+    void setNodeSrcListIt(std::list<ArcHandle>::iterator node_src_list_it);
     NodeSPtr getNodeDst() const;
     void setNodeDst(NodeSPtr node_dst);
-    std::list<ArcWPtr>::iterator getNodeDstListIt() const;
-    void setNodeDstListIt(std::list<ArcWPtr>::iterator node_dst_list_it);
+    std::list<ArcHandle>::iterator getNodeDstListIt() const;
+    void setNodeDstListIt(std::list<ArcHandle>::iterator node_dst_list_it);
     Vector3SPtr getDirection() const;
     void setDirection(Vector3SPtr direction);
     StraightSkeletonSPtr getSkel() const;
     void setSkel(StraightSkeletonSPtr skel);
-    std::list<ArcSPtr>::iterator getListIt() const;
-    void setListIt(std::list<ArcSPtr>::iterator list_it);
+    /**
+     * Slot of this arc in the SlotList of the skeleton.
+     */
+    size_t getSkelSlot() const;
+    void setSkelSlot(size_t slot);
 
     int getID() const;
     void setID(int id);
@@ -41,7 +44,7 @@ public:
     void addSheet(SheetSPtr sheet);
     bool removeSheet(SheetSPtr sheet);
 
-    std::list<SheetWPtr>& sheets();
+    std::list<SheetHandle>& sheets();
 
     Line3SPtr line() const;
 
@@ -53,13 +56,13 @@ protected:
     Arc(NodeSPtr node_src, Vector3SPtr direction);
     Arc(NodeSPtr node_src, NodeSPtr node_dst);
     NodeSPtr node_src_;
-    std::list<ArcWPtr>::iterator node_src_list_it_;
+    std::list<ArcHandle>::iterator node_src_list_it_;
     NodeSPtr node_dst_;
-    std::list<ArcWPtr>::iterator node_dst_list_it_;
+    std::list<ArcHandle>::iterator node_dst_list_it_;
     Vector3SPtr direction_;
-    std::list<SheetWPtr> sheets_; // every arc has 3 sheets
+    std::list<SheetHandle> sheets_; // every arc has 3 sheets
     StraightSkeletonWPtr skel_;
-    std::list<ArcSPtr>::iterator list_it_;
+    size_t skel_slot_;
     int id_;
 };
 
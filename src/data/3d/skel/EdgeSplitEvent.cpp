@@ -15,6 +15,7 @@ namespace data { namespace _3d { namespace skel {
 
 EdgeSplitEvent::EdgeSplitEvent() {
     type_ = AbstractEvent::EDGE_SPLIT_EVENT;
+    orientation_ = 0;
 }
 
 EdgeSplitEvent::~EdgeSplitEvent() {
@@ -63,6 +64,14 @@ void EdgeSplitEvent::setEdge2(EdgeSPtr edge2) {
     this->edge2_ = edge2;
 }
 
+int EdgeSplitEvent::getOrientation() const {
+    return orientation_;
+}
+
+void EdgeSplitEvent::setOrientation(int orientation) {
+    this->orientation_ = orientation;
+}
+
 void EdgeSplitEvent::setHighlight(bool highlight) {
     if (!edge1_->hasData()) {
         SkelEdgeData::create(edge1_);
@@ -24,12 +24,20 @@ public:
     void setEdge1(EdgeSPtr edge1);
     EdgeSPtr getEdge2() const;
     void setEdge2(EdgeSPtr edge2);
+    /**
+     * Orientation of the lines of both edges before they crash.
+     * At the offset of the event, both lines pass through the node,
+     * so it is determined when the event is found.
+     */
+    int getOrientation() const;
+    void setOrientation(int orientation);
     void setHighlight(bool highlight);
 protected:
     EdgeSplitEvent();
     NodeSPtr node_;
     EdgeSPtr edge1_;
     EdgeSPtr edge2_;
+    int orientation_;
 };
 
 } } }
@@ -8,8 +8,10 @@
 
 #include "data/3d/KernelFactory.h"
 #include "data/3d/skel/Arc.h"
+#include "data/3d/skel/Sheet.h"
 #include "debug.h"
 #include "util/StringFactory.h"
+#include "util/SlotList.h"
 #include <algorithm>
 
 namespace data { namespace _3d { namespace skel {
@@ -18,6 +20,7 @@ Node::Node(Point3SPtr point) {
     offset_ = 0.0;
     point_ = point;
     id_ = -1;
+    skel_slot_ = util::SlotList<NodeSPtr>::NONE;
 }
 
 Node::~Node() {
@@ -58,12 +61,12 @@ void Node::setSkel(StraightSkeletonSPtr skel) {
     this->skel_ = skel;
 }
 
-std::list<NodeSPtr>::iterator Node::getListIt() const {
-    return this->list_it_;
+size_t Node::getSkelSlot() const {
+    return this->skel_slot_;
 }
 
-void Node::setListIt(std::list<NodeSPtr>::iterator list_it) {
-    this->list_it_ = list_it;
+void Node::setSkelSlot(size_t slot) {
+    this->skel_slot_ = slot;
 }
 
 int Node::getID() const {
@@ -75,7 +78,7 @@ void Node::setID(int id) {
 }
 
 void Node::addArc(ArcSPtr arc) {
-    std::list<ArcWPtr>::iterator it = arcs_.insert(arcs_.end(), ArcWPtr(arc));
+    std::list<ArcHandle>::iterator it = arcs_.insert(arcs_.end(), ArcHandle(arc));
     if (arc->getNodeSrc() == shared_from_this()) {
         arc->setNodeSrcListIt(it);
     } else if (arc->hasNodeDst()) {
@@ -89,12 +92,12 @@ bool Node::removeArc(ArcSPtr arc) {
     bool result = false;
     if (arc->getNodeSrc() == shared_from_this()) {
         arcs_.erase(arc->getNodeSrcListIt());
-        arc->setNodeSrcListIt(std::list<ArcWPtr>::iterator());
+        arc->setNodeSrcListIt(std::list<ArcHandle>::iterator());
         result = true;
     } else if (arc->hasNodeDst()) {
         if (arc->getNodeDst() == shared_from_this()) {
             arcs_.erase(arc->getNodeDstListIt());
-            arc->setNodeDstListIt(std::list<ArcWPtr>::iterator());
+            arc->setNodeDstListIt(std::list<ArcHandle>::iterator());
             result = true;
         }
     }
@@ -102,79 +105,57 @@ bool Node::removeArc(ArcSPtr arc) {
 }
 
 void Node::addSheet(SheetSPtr sheet) {
-    sheets_.insert(sheets_.end(), SheetWPtr(sheet));
+    sheets_.insert(sheets_.end(), SheetHandle(sheet));
 }
 
 bool Node::removeSheet(SheetSPtr sheet) {
     bool result = false;
-    std::list<SheetWPtr>::iterator it = sheets_.begin();
-    while (it != sheets_.end()) {
-        std::list<SheetWPtr>::iterator it_current = it;
-        SheetWPtr sheet_wptr = *it++;
-        if (!sheet_wptr.expired()) {
-            if (sheet_wptr.lock() == sheet) {
-                sheets_.erase(it_current);
-                result = true;
-                break;
-            }
-        }
+    std::list<SheetHandle>::iterator it = std::find(
+            sheets_.begin(), sheets_.end(), SheetHandle(sheet));
+    if (it != sheets_.end()) {
+        sheets_.erase(it);
+        result = true;
     }
     return result;
 }
 
 bool Node::containsArc(ArcSPtr arc) const {
-    ArcWPtr arc_wptr = ArcWPtr(arc);
     bool result = (arcs_.end() !=
-            std::find(arcs_.begin(), arcs_.end(), arc_wptr));
+            std::find(arcs_.begin(), arcs_.end(), ArcHandle(arc)));
     return result;
 }
 
 bool Node::containsSheet(SheetSPtr sheet) const {
-    SheetWPtr sheet_wptr = SheetWPtr(sheet);
     bool result = (sheets_.end() !=
-            std::find(sheets_.begin(), sheets_.end(), sheet_wptr));
+            std::find(sheets_.begin(), sheets_.end(), SheetHandle(sheet)));
     return result;
 }
 
 void Node::clear() {
-    std::list<SheetWPtr>::iterator it_s = sheets_.begin();
+    std::list<SheetHandle>::iterator it_s = sheets_.begin();
     while (it_s != sheets_.end()) {
-        SheetWPtr sheet_wptr = *it_s++;
-        if (!sheet_wptr.expired()) {
-            SheetSPtr sheet = SheetSPtr(sheet_wptr);
-            removeSheet(sheet);
-        }
+        SheetSPtr sheet = (*it_s++).lock();
+        removeSheet(sheet);
     }
     sheets_.clear();
-    std::list<ArcWPtr>::iterator it_a = arcs_.begin();
+    std::list<ArcHandle>::iterator it_a = arcs_.begin();
     while (it_a != arcs_.end()) {
-        ArcWPtr arc_wptr = *it_a++;
-        if (!arc_wptr.expired()) {
-            ArcSPtr arc = ArcSPtr(arc_wptr);
-            removeArc(arc);
-        }
+        ArcSPtr arc = (*it_a++).lock();
+        removeArc(arc);
     }
     arcs_.clear();
 }
 
-std::list<ArcWPtr>& Node::arcs() {
+std::list<ArcHandle>& Node::arcs() {
     return this->arcs_;
 }
 
-std::list<SheetWPtr>& Node::sheets() {
+std::list<SheetHandle>& Node::sheets() {
     return this->sheets_;
 }
 
 unsigned int Node::degree() const {
-    unsigned int result = 0;
-    std::list<ArcWPtr>::const_iterator it_a = arcs_.begin();
-    while (it_a != arcs_.end()) {
-        ArcWPtr arc_wptr = *it_a++;
-        if (!arc_wptr.expired()) {
-            result++;
-        }
-    }
-    return result;
+    return arcs_.size();
 }
 
 double Node::getX() const {
@@ -26,8 +26,11 @@ public:
 
     StraightSkeletonSPtr getSkel() const;
     void setSkel(StraightSkeletonSPtr skel);
-    std::list<NodeSPtr>::iterator getListIt() const;
-    void setListIt(std::list<NodeSPtr>::iterator list_it);
+    /**
+     * Slot of this node in the SlotList of the skeleton.
+     */
+    size_t getSkelSlot() const;
+    void setSkelSlot(size_t slot);
 
     int getID() const;
     void setID(int id);
@@ -43,8 +46,15 @@ public:
 
     void clear();
 
-    std::list<ArcWPtr>& arcs();
-    std::list<SheetWPtr>& sheets();
+    /**
+     * Handles to the adjacent arcs and sheets.
+     * An arc or sheet removes its handles from its own nodes
+     * when it is destroyed. The node of an event that has not
+     * been handled yet also refers to arcs and sheets,
+     * which are kept alive by the straight skeleton.
+     */
+    std::list<ArcHandle>& arcs();
+    std::list<SheetHandle>& sheets();
 
     unsigned int degree() const;
 
@@ -58,10 +68,10 @@ protected:
     Node(Point3SPtr point);
     Point3SPtr point_;
     double offset_;
-    std::list<ArcWPtr> arcs_;
-    std::list<SheetWPtr> sheets_;
+    std::list<ArcHandle> arcs_;
+    std::list<SheetHandle> sheets_;
     StraightSkeletonWPtr skel_;
-    std::list<NodeSPtr>::iterator list_it_;
+    size_t skel_slot_;
     int id_;
 };
 
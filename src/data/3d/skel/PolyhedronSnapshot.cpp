@@ -0,0 +1,417 @@
+/**
+ * @file   data/3d/skel/PolyhedronSnapshot.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#include "data/3d/skel/PolyhedronSnapshot.h"
+
+#include "debug.h"
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Polyhedron.h"
+#include "data/3d/skel/SkelVertexData.h"
+#include "data/3d/skel/SkelFacetData.h"
+#include "data/3d/skel/Arc.h"
+#include <list>
+#include <map>
+#include <set>
+#include <sstream>
+#include <utility>
+
+namespace data { namespace _3d { namespace skel {
+
+const double PolyhedronSnapshot::TOLERANCE = 1e-9;
+
+const unsigned char PolyhedronSnapshot::FacetRecord::LEFT;
+const unsigned char PolyhedronSnapshot::FacetRecord::RIGHT;
+
+Point3SPtr PolyhedronSnapshot::VertexRecord::pointAt(double offset) const {
+    Point3SPtr result = origin;
+    if (velocity && offset != offset_birth) {
+        result = KernelFactory::createPoint3(
+                *origin + (*velocity * (offset_birth - offset)));
+    }
+    return result;
+}
+
+Plane3SPtr PolyhedronSnapshot::FacetRecord::planeAt(double offset) const {
+    Plane3SPtr result = plane;
+    if (plane && offset != offset_plane) {
+        double distance = (offset - offset_plane) * speed;
+#ifdef USE_CGAL
+        Vector3 v_norm = plane->orthogonal_vector();
+        Vector3 v_normal = v_norm / CGAL::sqrt(v_norm.squared_length());
+#else
+        Vector3 v_normal = plane->normal().normalize();
+#endif
+        Point3 p_trans = plane->point() + (v_normal * distance);
+        result = KernelFactory::createPlane3(Plane3(p_trans, v_normal));
+    }
+    return result;
+}
+
+bool PolyhedronSnapshot::FacetRecord::equals(const FacetRecord& other) const {
+    return (vertices == other.vertices && edges == other.edges &&
+            sides == other.sides && speed == other.speed);
+}
+
+
+/**
+ * Finds the records of the previous snapshot that can be taken over.
+ */
+class PolyhedronSnapshot::Builder {
+public:
+    Builder(double offset, PolyhedronSnapshotSPtr previous);
+
+    VertexRecordSPtr vertexRecord(VertexSPtr vertex);
+    EdgeRecordSPtr edgeRecord(EdgeSPtr edge);
+    FacetRecordSPtr facetRecord(FacetSPtr facet, bool& shared);
+
+protected:
+    void addPrevious(VertexRecordSPtr vertex);
+    void addPrevious(EdgeRecordSPtr edge);
+    bool isNear(Point3SPtr p, Point3SPtr q) const;
+
+    double offset_;
+    std::map<const Arc*, VertexRecordSPtr> prev_arcs_;
+    std::map<const Point3*, VertexRecordSPtr> prev_points_;
+    std::map<std::pair<VertexRecord*, VertexRecord*>, EdgeRecordSPtr> prev_edges_;
+    std::multimap<VertexRecord*, FacetRecordSPtr> prev_facets_;
+    std::map<Vertex*, VertexRecordSPtr> vertices_;
+    std::map<Edge*, EdgeRecordSPtr> edges_;
+    std::set<VertexRecord*> vertices_used_;
+    std::set<EdgeRecord*> edges_used_;
+};
+
+PolyhedronSnapshot::Builder::Builder(double offset, PolyhedronSnapshotSPtr previous) {
+    offset_ = offset;
+    if (!previous) {
+        return;
+    }
+    for (unsigned int i = 0; i < previous->facets_.size(); i++) {
+        FacetRecordSPtr facet = previous->facets_[i];
+        VertexRecord* first = 0;
+        if (facet->vertices.size() > 0) {
+            first = facet->vertices[0].get();
+        }
+        prev_facets_.insert(std::pair<VertexRecord*, FacetRecordSPtr>(first, facet));
+        for (unsigned int j = 0; j < facet->vertices.size(); j++) {
+            addPrevious(facet->vertices[j]);
+        }
+        for (unsigned int j = 0; j < facet->edges.size(); j++) {
+            addPrevious(facet->edges[j]);
+        }
+    }
+    for (unsigned int i = 0; i < previous->edges_loose_.size(); i++) {
+        addPrevious(previous->edges_loose_[i]);
+    }
+    for (unsigned int i = 0; i < previous->vertices_loose_.size(); i++) {
+        addPrevious(previous->vertices_loose_[i]);
+    }
+}
+
+void PolyhedronSnapshot::Builder::addPrevious(VertexRecordSPtr vertex) {
+    if (vertex->velocity) {
+        prev_arcs_[vertex->arc] = vertex;
+    } else {
+        prev_points_[vertex->origin.get()] = vertex;
+    }
+}
+
+void PolyhedronSnapshot::Builder::addPrevious(EdgeRecordSPtr edge) {
+    addPrevious(edge->src);
+    addPrevious(edge->dst);
+    prev_edges_[std::pair<VertexRecord*, VertexRecord*>(
+            edge->src.get(), edge->dst.get())] = edge;
+}
+
+bool PolyhedronSnapshot::Builder::isNear(Point3SPtr p, Point3SPtr q) const {
+    double dist_sq = 0.0;
+    double norm_sq = 0.0;
+    for (unsigned int i = 0; i < 3; i++) {
+        double diff = (*p)[i] - (*q)[i];
+        dist_sq += diff * diff;
+        norm_sq += (*q)[i] * (*q)[i];
+    }
+    return (dist_sq <= TOLERANCE * TOLERANCE * (1.0 + norm_sq));
+}
+
+PolyhedronSnapshot::VertexRecordSPtr PolyhedronSnapshot::Builder::vertexRecord(
+        VertexSPtr vertex) {
+    std::map<Vertex*, VertexRecordSPtr>::iterator it_v = vertices_.find(vertex.get());
+    if (it_v != vertices_.end()) {
+        return it_v->second;
+    }
+    VertexRecordSPtr result;
+    Point3SPtr point = vertex->getPoint();
+    SkelVertexData* data = 0;
+    if (vertex->hasData()) {
+        data = SkelVertexData::of(vertex);
+    }
+    if (data && data->hasKinematics()) {
+        // the trajectory is only taken if it leads to the actual point
+        const Arc* arc = data->getArc().get();
+        std::map<const Arc*, VertexRecordSPtr>::iterator it_a = prev_arcs_.find(arc);
+        if (it_a != prev_arcs_.end() &&
+                vertices_used_.find(it_a->second.get()) == vertices_used_.end()) {
+            if (isNear(it_a->second->pointAt(offset_), point)) {
+                result = it_a->second;
+            }
+        }
+        if (!result) {
+            VertexRecordSPtr record = VertexRecordSPtr(new VertexRecord());
+            record->arc = arc;
+            record->origin = data->getOrigin();
+            record->velocity = data->getVelocity();
+            record->offset_birth = data->getOffsetBirth();
+            if (isNear(record->pointAt(offset_), point)) {
+                result = record;
+            }
+        }
+    }
+    if (!result) {
+        // coincident vertices share their point, but not their record
+        std::map<const Point3*, VertexRecordSPtr>::iterator it_p =
+                prev_points_.find(point.get());
+        if (it_p != prev_points_.end() &&
+                vertices_used_.find(it_p->second.get()) == vertices_used_.end()) {
+            result = it_p->second;
+        } else {
+            result = VertexRecordSPtr(new VertexRecord());
+            result->arc = 0;
+            result->origin = point;
+            result->offset_birth = offset_;
+        }
+    }
+    vertices_[vertex.get()] = result;
+    vertices_used_.insert(result.get());
+    return result;
+}
+
+PolyhedronSnapshot::EdgeRecordSPtr PolyhedronSnapshot::Builder::edgeRecord(
+        EdgeSPtr edge) {
+    std::map<Edge*, EdgeRecordSPtr>::iterator it_e = edges_.find(edge.get());
+    if (it_e != edges_.end()) {
+        return it_e->second;
+    }
+    EdgeRecordSPtr result;
+    VertexRecordSPtr src = vertexRecord(edge->getVertexSrc());
+    VertexRecordSPtr dst = vertexRecord(edge->getVertexDst());
+    std::map<std::pair<VertexRecord*, VertexRecord*>, EdgeRecordSPtr>::iterator it_p =
+            prev_edges_.find(std::pair<VertexRecord*, VertexRecord*>(src.get(), dst.get()));
+    // two edges between the same vertices must not share a record
+    if (it_p != prev_edges_.end() &&
+            edges_used_.find(it_p->second.get()) == edges_used_.end()) {
+        result = it_p->second;
+    } else {
+        result = EdgeRecordSPtr(new EdgeRecord());
+        result->src = src;
+        result->dst = dst;
+    }
+    edges_[edge.get()] = result;
+    edges_used_.insert(result.get());
+    return result;
+}
+
+PolyhedronSnapshot::FacetRecordSPtr PolyhedronSnapshot::Builder::facetRecord(
+        FacetSPtr facet, bool& shared) {
+    FacetRecordSPtr result = FacetRecordSPtr(new FacetRecord());
+    result->plane = facet->getPlane();
+    result->offset_plane = offset_;
+    result->speed = 1.0;
+    if (facet->hasData()) {
+        SkelFacetData* data = SkelFacetData::of(facet);
+        if (data) {
+            result->speed = data->getSpeed();
+        }
+    }
+    std::list<VertexSPtr>::iterator it_v = facet->vertices().begin();
+    while (it_v != facet->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        result->vertices.push_back(vertexRecord(vertex));
+    }
+    std::list<EdgeSPtr>::iterator it_e = facet->edges().begin();
+    while (it_e != facet->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        unsigned char sides = 0;
+        if (edge->getFacetL() == facet) {
+            sides |= FacetRecord::LEFT;
+        }
+        if (edge->getFacetR() == facet) {
+            sides |= FacetRecord::RIGHT;
+        }
+        result->edges.push_back(edgeRecord(edge));
+        result->sides.push_back(sides);
+    }
+    shared = false;
+    VertexRecord* first = 0;
+    if (result->vertices.size() > 0) {
+        first = result->vertices[0].get();
+    }
+    std::pair<std::multimap<VertexRecord*, FacetRecordSPtr>::iterator,
+            std::multimap<VertexRecord*, FacetRecordSPtr>::iterator> range =
+            prev_facets_.equal_range(first);
+    while (range.first != range.second) {
+        std::multimap<VertexRecord*, FacetRecordSPtr>::iterator it_f = range.first++;
+        if (it_f->second->equals(*result)) {
+            result = it_f->second;
+            prev_facets_.erase(it_f);
+            shared = true;
+            break;
+        }
+    }
+    return result;
+}
+
+
+PolyhedronSnapshot::PolyhedronSnapshot() {
+    offset_ = 0.0;
+    num_vertices_ = 0;
+    num_edges_ = 0;
+    num_shared_facets_ = 0;
+}
+
+PolyhedronSnapshot::~PolyhedronSnapshot() {
+    facets_.clear();
+    edges_loose_.clear();
+    vertices_loose_.clear();
+}
+
+PolyhedronSnapshotSPtr PolyhedronSnapshot::create(PolyhedronSPtr polyhedron,
+        double offset) {
+    return create(polyhedron, offset, PolyhedronSnapshotSPtr());
+}
+
+PolyhedronSnapshotSPtr PolyhedronSnapshot::create(PolyhedronSPtr polyhedron,
+        double offset, PolyhedronSnapshotSPtr previous) {
+    PolyhedronSnapshotSPtr result = PolyhedronSnapshotSPtr(new PolyhedronSnapshot());
+    result->offset_ = offset;
+    Builder builder(offset, previous);
+    result->facets_.reserve(polyhedron->facets().size());
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        bool shared = false;
+        result->facets_.push_back(builder.facetRecord(facet, shared));
+        if (shared) {
+            result->num_shared_facets_++;
+        }
+    }
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        if (!edge->getFacetL() && !edge->getFacetR()) {
+            result->edges_loose_.push_back(builder.edgeRecord(edge));
+        }
+    }
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        if (vertex->edges().empty() && vertex->facets().empty()) {
+            result->vertices_loose_.push_back(builder.vertexRecord(vertex));
+        }
+    }
+    result->num_vertices_ = polyhedron->vertices().size();
+    result->num_edges_ = polyhedron->edges().size();
+    return result;
+}
+
+PolyhedronSPtr PolyhedronSnapshot::toPolyhedron() const {
+    PolyhedronSPtr result = Polyhedron::create();
+    std::map<VertexRecord*, VertexSPtr> vertices_c;
+    std::map<EdgeRecord*, EdgeSPtr> edges_c;
+    for (unsigned int i = 0; i < facets_.size(); i++) {
+        FacetRecordSPtr facet = facets_[i];
+        FacetSPtr facet_c = Facet::create();
+        facet_c->setPlane(facet->planeAt(offset_));
+        for (unsigned int j = 0; j < facet->vertices.size(); j++) {
+            facet_c->addVertex(toVertex(facet->vertices[j], vertices_c, result));
+        }
+        for (unsigned int j = 0; j < facet->edges.size(); j++) {
+            EdgeSPtr edge_c = toEdge(facet->edges[j], vertices_c, edges_c, result);
+            if (facet->sides[j] & FacetRecord::LEFT) {
+                edge_c->setFacetL(facet_c);
+            }
+            if (facet->sides[j] & FacetRecord::RIGHT) {
+                edge_c->setFacetR(facet_c);
+            }
+            facet_c->addEdge(edge_c);
+        }
+        result->addFacet(facet_c);
+    }
+    for (unsigned int i = 0; i < edges_loose_.size(); i++) {
+        toEdge(edges_loose_[i], vertices_c, edges_c, result);
+    }
+    for (unsigned int i = 0; i < vertices_loose_.size(); i++) {
+        toVertex(vertices_loose_[i], vertices_c, result);
+    }
+    return result;
+}
+
+VertexSPtr PolyhedronSnapshot::toVertex(VertexRecordSPtr vertex,
+        std::map<VertexRecord*, VertexSPtr>& vertices_c,
+        PolyhedronSPtr polyhedron) const {
+    VertexSPtr result;
+    std::map<VertexRecord*, VertexSPtr>::iterator it_v = vertices_c.find(vertex.get());
+    if (it_v != vertices_c.end()) {
+        result = it_v->second;
+    } else {
+        result = Vertex::create(vertex->pointAt(offset_));
+        polyhedron->addVertex(result);
+        vertices_c[vertex.get()] = result;
+    }
+    return result;
+}
+
+EdgeSPtr PolyhedronSnapshot::toEdge(EdgeRecordSPtr edge,
+        std::map<VertexRecord*, VertexSPtr>& vertices_c,
+        std::map<EdgeRecord*, EdgeSPtr>& edges_c,
+        PolyhedronSPtr polyhedron) const {
+    EdgeSPtr result;
+    std::map<EdgeRecord*, EdgeSPtr>::iterator it_e = edges_c.find(edge.get());
+    if (it_e != edges_c.end()) {
+        result = it_e->second;
+    } else {
+        VertexSPtr src = toVertex(edge->src, vertices_c, polyhedron);
+        VertexSPtr dst = toVertex(edge->dst, vertices_c, polyhedron);
+        result = Edge::create(src, dst);
+        polyhedron->addEdge(result);
+        edges_c[edge.get()] = result;
+    }
+    return result;
+}
+
+double PolyhedronSnapshot::getOffset() const {
+    return offset_;
+}
+
+unsigned int PolyhedronSnapshot::numVertices() const {
+    return num_vertices_;
+}
+
+unsigned int PolyhedronSnapshot::numEdges() const {
+    return num_edges_;
+}
+
+unsigned int PolyhedronSnapshot::numFacets() const {
+    return facets_.size();
+}
+
+unsigned int PolyhedronSnapshot::numSharedFacets() const {
+    return num_shared_facets_;
+}
+
+std::string PolyhedronSnapshot::toString() const {
+    std::stringstream sstr;
+    sstr << "PolyhedronSnapshot(offset=" << offset_ << ", "
+            << "#v=" << num_vertices_ << ", "
+            << "#e=" << num_edges_ << ", "
+            << "#f=" << facets_.size() << ", "
+            << "#f_shared=" << num_shared_facets_ << ")";
+    return sstr.str();
+}
+
+} } }
@@ -0,0 +1,128 @@
+/**
+ * @file   data/3d/skel/PolyhedronSnapshot.h
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#ifndef DATA_3D_SKEL_POLYHEDRONSNAPSHOT_H
+#define DATA_3D_SKEL_POLYHEDRONSNAPSHOT_H
+
+#include "data/3d/ptrs.h"
+#include "data/3d/skel/ptrs.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace data { namespace _3d { namespace skel {
+
+/**
+ * Immutable snapshot of the wavefront at one offset.
+ * Vertices, edges and facets are stored as records that are shared
+ * with the previous snapshot as long as they did not change:
+ * A moving vertex is recorded by its trajectory (origin, velocity and
+ * birth offset of its arc), which stays the same until an event
+ * replaces the vertex. So only the facets whose boundary changed
+ * since the previous snapshot need new records.
+ * The points of the vertices are computed when the snapshot is
+ * turned into a polyhedron again.
+ */
+class PolyhedronSnapshot {
+public:
+    virtual ~PolyhedronSnapshot();
+
+    static PolyhedronSnapshotSPtr create(PolyhedronSPtr polyhedron, double offset);
+
+    /**
+     * Records that did not change are taken from the previous snapshot.
+     */
+    static PolyhedronSnapshotSPtr create(PolyhedronSPtr polyhedron, double offset,
+            PolyhedronSnapshotSPtr previous);
+
+    /**
+     * Creates a new polyhedron without any data attached.
+     * The order of the vertices and edges of each facet is kept.
+     */
+    PolyhedronSPtr toPolyhedron() const;
+
+    double getOffset() const;
+
+    unsigned int numVertices() const;
+    unsigned int numEdges() const;
+    unsigned int numFacets() const;
+
+    /**
+     * Number of facet records that are shared with the previous snapshot.
+     */
+    unsigned int numSharedFacets() const;
+
+    std::string toString() const;
+
+    /**
+     * Relative distance up to which the trajectory of a vertex
+     * is accepted as its position.
+     */
+    static const double TOLERANCE;
+
+protected:
+    PolyhedronSnapshot();
+
+    class VertexRecord {
+    public:
+        /** key to find the record again; arcs live as long as the skeleton */
+        const Arc* arc;
+        Point3SPtr origin;
+        /** no velocity: the vertex stays at its origin */
+        Vector3SPtr velocity;
+        double offset_birth;
+        Point3SPtr pointAt(double offset) const;
+    };
+    typedef SHARED_PTR<VertexRecord> VertexRecordSPtr;
+
+    class EdgeRecord {
+    public:
+        VertexRecordSPtr src;
+        VertexRecordSPtr dst;
+    };
+    typedef SHARED_PTR<EdgeRecord> EdgeRecordSPtr;
+
+    class FacetRecord {
+    public:
+        static const unsigned char LEFT = 1;
+        static const unsigned char RIGHT = 2;
+        /** plane at offset_plane, moving with speed */
+        Plane3SPtr plane;
+        double offset_plane;
+        double speed;
+        std::vector<VertexRecordSPtr> vertices;
+        std::vector<EdgeRecordSPtr> edges;
+        /** LEFT and/or RIGHT for each edge */
+        std::vector<unsigned char> sides;
+        Plane3SPtr planeAt(double offset) const;
+        bool equals(const FacetRecord& other) const;
+    };
+    typedef SHARED_PTR<FacetRecord> FacetRecordSPtr;
+
+    class Builder;
+
+    VertexSPtr toVertex(VertexRecordSPtr vertex,
+            std::map<VertexRecord*, VertexSPtr>& vertices_c,
+            PolyhedronSPtr polyhedron) const;
+    EdgeSPtr toEdge(EdgeRecordSPtr edge,
+            std::map<VertexRecord*, VertexSPtr>& vertices_c,
+            std::map<EdgeRecord*, EdgeSPtr>& edges_c,
+            PolyhedronSPtr polyhedron) const;
+
+    double offset_;
+    std::vector<FacetRecordSPtr> facets_;
+    /** edges without facets */
+    std::vector<EdgeRecordSPtr> edges_loose_;
+    /** vertices without edges and facets */
+    std::vector<VertexRecordSPtr> vertices_loose_;
+    unsigned int num_vertices_;
+    unsigned int num_edges_;
+    unsigned int num_shared_facets_;
+};
+
+} } }
+
+#endif /* DATA_3D_SKEL_POLYHEDRONSNAPSHOT_H */
@@ -12,15 +12,28 @@
 #include "data/3d/skel/Node.h"
 #include "data/3d/skel/Arc.h"
 #include "util/StringFactory.h"
+#include "util/SlotList.h"
 #include <sstream>
 
 namespace data { namespace _3d { namespace skel {
 
 Sheet::Sheet() {
     id_ = -1;
+    skel_slot_ = util::SlotList<SheetSPtr>::NONE;
 }
 
 Sheet::~Sheet() {
+    // the nodes and arcs only hold handles to this sheet
+    std::list<NodeSPtr>::iterator it_n = nodes_.begin();
+    while (it_n != nodes_.end()) {
+        NodeSPtr node = *it_n++;
+        node->sheets().remove(SheetHandle(this));
+    }
+    std::list<ArcSPtr>::iterator it_a = arcs_.begin();
+    while (it_a != arcs_.end()) {
+        ArcSPtr arc = *it_a++;
+        arc->sheets().remove(SheetHandle(this));
+    }
     facet_b_.reset();
     facet_f_.reset();
 }
@@ -60,12 +73,12 @@ void Sheet::setSkel(StraightSkeletonSPtr skel) {
     this->skel_ = skel;
 }
 
-std::list<SheetSPtr>::iterator Sheet::getListIt() const {
-    return this->list_it_;
+size_t Sheet::getSkelSlot() const {
+    return this->skel_slot_;
 }
 
-void Sheet::setListIt(std::list<SheetSPtr>::iterator list_it) {
-    this->list_it_ = list_it;
+void Sheet::setSkelSlot(size_t slot) {
+    this->skel_slot_ = slot;
 }
 
 int Sheet::getID() const {
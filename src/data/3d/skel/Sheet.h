@@ -27,8 +27,11 @@ public:
 
     StraightSkeletonSPtr getSkel() const;
     void setSkel(StraightSkeletonSPtr skel);
-    std::list<SheetSPtr>::iterator getListIt() const;
-    void setListIt(std::list<SheetSPtr>::iterator list_it);
+    /**
+     * Slot of this sheet in the SlotList of the skeleton.
+     */
+    size_t getSkelSlot() const;
+    void setSkelSlot(size_t slot);
 
     int getID() const;
     void setID(int id);
@@ -54,7 +57,7 @@ protected:
     std::list<ArcSPtr> arcs_;
     std::list<NodeSPtr> nodes_;
     StraightSkeletonWPtr skel_;
-    std::list<SheetSPtr>::iterator list_it_;
+    size_t skel_slot_;
     Plane3SPtr plane_;
     int id_;
 };
@@ -12,6 +12,7 @@
 namespace data { namespace _3d { namespace skel {
 
 SkelEdgeData::SkelEdgeData() {
+    type_ = SKEL_EDGE_DATA;
     // intentionally does nothing
 }
 
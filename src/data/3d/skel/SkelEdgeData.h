@@ -9,6 +9,7 @@
 
 #include "data/3d/ptrs.h"
 #include "data/3d/EdgeData.h"
+#include "data/3d/Edge.h"
 #include "data/3d/skel/ptrs.h"
 
 namespace data { namespace _3d { namespace skel {
@@ -19,6 +20,14 @@ public:
 
     static SkelEdgeDataSPtr create(EdgeSPtr edge);
 
+    /**
+     * Typed access to the data of the edge,
+     * without RTTI and without touching reference counts.
+     * Returns 0 if the edge has no SkelEdgeData.
+     */
+    static SkelEdgeData* of(const EdgeSPtr& edge);
+    static SkelEdgeData* of(const Edge* edge);
+
     SheetSPtr getSheet() const;
     void setSheet(SheetSPtr sheet);
     EdgeSPtr getOffsetEdge() const;
@@ -37,6 +46,20 @@ protected:
     FacetWPtr facet_origin_;
 };
 
+
+inline SkelEdgeData* SkelEdgeData::of(const EdgeSPtr& edge) {
+    return of(edge.get());
+}
+
+inline SkelEdgeData* SkelEdgeData::of(const Edge* edge) {
+    SkelEdgeData* result = 0;
+    EdgeData* data = edge->getDataPtr();
+    if (data && data->getType() == EdgeData::SKEL_EDGE_DATA) {
+        result = static_cast<SkelEdgeData*>(data);
+    }
+    return result;
+}
+
 } } }
 
 #endif /* DATA_3D_SKEL_SKELEDGEDATA_H */
@@ -12,6 +12,7 @@
 namespace data { namespace _3d { namespace skel {
 
 SkelFacetData::SkelFacetData() {
+    type_ = SKEL_FACET_DATA;
     speed_ = 1.0;
 }
 
@@ -60,4 +61,9 @@ void SkelFacetData::setSpeed(double speed) {
     speed_ = speed;
 }
 
+void SkelFacetData::setUnitPlane(Plane3SPtr plane, const Plane3& unit_plane) {
+    unit_plane_key_ = plane;
+    unit_plane_ = unit_plane;
+}
+
 } } }
@@ -9,6 +9,7 @@
 
 #include "data/3d/ptrs.h"
 #include "data/3d/FacetData.h"
+#include "data/3d/Facet.h"
 #include "data/3d/skel/ptrs.h"
 
 namespace data { namespace _3d { namespace skel {
@@ -19,6 +20,14 @@ public:
 
     static SkelFacetDataSPtr create(FacetSPtr facet);
 
+    /**
+     * Typed access to the data of the facet,
+     * without RTTI and without touching reference counts.
+     * Returns 0 if the facet has no SkelFacetData.
+     */
+    static SkelFacetData* of(const FacetSPtr& facet);
+    static SkelFacetData* of(const Facet* facet);
+
     FacetSPtr getOffsetFacet() const;
     void setOffsetFacet(FacetSPtr offset_facet);
 
@@ -28,13 +37,50 @@ public:
     double getSpeed() const;
     void setSpeed(double speed);
 
+    /**
+     * The plane of the facet with a unit normal.
+     * Offset planes are derived from it by moving it along its normal
+     * (see SimpleStraightSkel::offsetPlane).
+     * It belongs to the plane object it was set for:
+     * After the facet got a new plane, hasUnitPlane returns false
+     * until the unit plane is set again.
+     */
+    bool hasUnitPlane(const Plane3SPtr& plane) const;
+    const Plane3& getUnitPlane() const;
+    void setUnitPlane(Plane3SPtr plane, const Plane3& unit_plane);
+
 protected:
     SkelFacetData();
     FacetWPtr offset_facet_;
     FacetWPtr facet_origin_;
     double speed_;
+    /** keeps the plane alive, so its address is not reused */
+    Plane3SPtr unit_plane_key_;
+    Plane3 unit_plane_;
 };
 
+
+inline SkelFacetData* SkelFacetData::of(const FacetSPtr& facet) {
+    return of(facet.get());
+}
+
+inline SkelFacetData* SkelFacetData::of(const Facet* facet) {
+    SkelFacetData* result = 0;
+    FacetData* data = facet->getDataPtr();
+    if (data && data->getType() == FacetData::SKEL_FACET_DATA) {
+        result = static_cast<SkelFacetData*>(data);
+    }
+    return result;
+}
+
+inline bool SkelFacetData::hasUnitPlane(const Plane3SPtr& plane) const {
+    return (unit_plane_key_ && unit_plane_key_ == plane);
+}
+
+inline const Plane3& SkelFacetData::getUnitPlane() const {
+    return unit_plane_;
+}
+
 } } }
 
 #endif /* DATA_3D_SKEL_SKELFACETDATA_H */
@@ -8,11 +8,14 @@
 
 #include "debug.h"
 #include "data/3d/Vertex.h"
+#include "data/3d/skel/Arc.h"
+#include "data/3d/skel/Node.h"
 
 namespace data { namespace _3d { namespace skel {
 
 SkelVertexData::SkelVertexData() {
-    // intentionally does nothing
+    type_ = SKEL_VERTEX_DATA;
+    offset_birth_ = 0.0;
 }
 
 SkelVertexData::~SkelVertexData() {
@@ -36,6 +39,17 @@ ArcSPtr SkelVertexData::getArc() const {
 
 void SkelVertexData::setArc(ArcSPtr arc) {
     this->arc_ = arc;
+    this->origin_.reset();
+    this->velocity_.reset();
+    this->offset_birth_ = 0.0;
+    if (arc) {
+        NodeSPtr node_src = arc->getNodeSrc();
+        if (node_src) {
+            this->origin_ = node_src->getPoint();
+            this->velocity_ = arc->getDirection();
+            this->offset_birth_ = node_src->getOffset();
+        }
+    }
 }
 
 NodeSPtr SkelVertexData::getNode() const {
@@ -62,4 +76,28 @@ void SkelVertexData::setOffsetVertex(VertexSPtr offset_vertex) {
     this->offset_vertex_ = offset_vertex;
 }
 
+Point3SPtr SkelVertexData::getOrigin() const {
+    return this->origin_;
+}
+
+Vector3SPtr SkelVertexData::getVelocity() const {
+    return this->velocity_;
+}
+
+double SkelVertexData::getOffsetBirth() const {
+    return this->offset_birth_;
+}
+
+bool SkelVertexData::hasKinematics() const {
+    return (this->origin_ && this->velocity_);
+}
+
+std::optional<Point3> SkelVertexData::pointAt(double offset) const {
+    std::optional<Point3> result;
+    if (hasKinematics()) {
+        result = *origin_ + (*velocity_ * (offset_birth_ - offset));
+    }
+    return result;
+}
+
 } } }
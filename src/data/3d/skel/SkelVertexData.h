@@ -9,7 +9,9 @@
 
 #include "data/3d/ptrs.h"
 #include "data/3d/VertexData.h"
+#include "data/3d/Vertex.h"
 #include "data/3d/skel/ptrs.h"
+#include <optional>
 
 namespace data { namespace _3d { namespace skel {
 
@@ -19,20 +21,56 @@ public:
 
     static SkelVertexDataSPtr create(VertexSPtr vertex);
 
+    /**
+     * Typed access to the data of the vertex,
+     * without RTTI and without touching reference counts.
+     * Returns 0 if the vertex has no SkelVertexData.
+     */
+    static SkelVertexData* of(const VertexSPtr& vertex);
+
     ArcSPtr getArc() const;
+
+    /**
+     * Also takes origin, velocity and birth offset of the vertex from the arc.
+     */
     void setArc(ArcSPtr arc);
     NodeSPtr getNode() const;
     void setNode(NodeSPtr node);
     VertexSPtr getOffsetVertex() const;
     void setOffsetVertex(VertexSPtr offset_vertex);
 
+    Point3SPtr getOrigin() const;
+    Vector3SPtr getVelocity() const;
+    double getOffsetBirth() const;
+    bool hasKinematics() const;
+
+    /**
+     * Position of the vertex at the given offset:
+     * origin + velocity * (offset_birth - offset)
+     * Returns nothing if the vertex has no arc.
+     */
+    std::optional<Point3> pointAt(double offset) const;
+
 protected:
     SkelVertexData();
     ArcWPtr arc_;
     NodeWPtr node_;
     VertexWPtr offset_vertex_;
+    Point3SPtr origin_;
+    Vector3SPtr velocity_;
+    double offset_birth_;
 };
 
+
+inline SkelVertexData* SkelVertexData::of(const VertexSPtr& vertex) {
+    SkelVertexData* result = 0;
+    VertexData* data = vertex->getDataPtr();
+    if (data && data->getType() == VertexData::SKEL_VERTEX_DATA) {
+        result = static_cast<SkelVertexData*>(data);
+    }
+    return result;
+}
+
 } } }
 
 #endif /* DATA_3D_SKEL_SKELVERTEXDATA_H */
@@ -32,89 +32,120 @@ StraightSkeletonSPtr StraightSkeleton::create() {
 }
 
 void StraightSkeleton::addEvent(AbstractEventSPtr event) {
-    std::list<AbstractEventSPtr>::iterator it = events_.insert(events_.end(), event);
+    size_t slot = events_.push_back(event);
     event->setSkel(shared_from_this());
-    event->setListIt(it);
+    event->setSkelSlot(slot);
 }
 
 bool StraightSkeleton::removeEvent(AbstractEventSPtr event) {
     bool result = false;
     if (event->getSkel() == shared_from_this()) {
-        events_.erase(event->getListIt());
+        events_.erase(event->getSkelSlot());
         event->setSkel(StraightSkeletonSPtr());
-        event->setListIt(std::list<AbstractEventSPtr>::iterator());
+        event->setSkelSlot(util::SlotList<AbstractEventSPtr>::NONE);
     }
     return result;
 }
 
 void StraightSkeleton::addNode(NodeSPtr node) {
-    std::list<NodeSPtr>::iterator it = nodes_.insert(nodes_.end(), node);
+    size_t slot = nodes_.push_back(node);
     node->setSkel(shared_from_this());
-    node->setListIt(it);
+    node->setSkelSlot(slot);
 }
 
 bool StraightSkeleton::removeNode(NodeSPtr node) {
     bool result = false;
     if (node->getSkel() == shared_from_this()) {
-        nodes_.erase(node->getListIt());
+        nodes_.erase(node->getSkelSlot());
         node->setSkel(StraightSkeletonSPtr());
-        node->setListIt(std::list<NodeSPtr>::iterator());
+        node->setSkelSlot(util::SlotList<NodeSPtr>::NONE);
         result = true;
     }
     return result;
 }
 
 void StraightSkeleton::addArc(ArcSPtr arc) {
-    std::list<ArcSPtr>::iterator it = arcs_.insert(arcs_.end(), arc);
+    size_t slot = arcs_.push_back(arc);
     arc->setSkel(shared_from_this());
-    arc->setListIt(it);
+    arc->setSkelSlot(slot);
 }
 
 bool StraightSkeleton::removeArc(ArcSPtr arc) {
     bool result = false;
     if (arc->getSkel() == shared_from_this()) {
-        arcs_.erase(arc->getListIt());
+        arcs_.erase(arc->getSkelSlot());
         arc->setSkel(StraightSkeletonSPtr());
-        arc->setListIt(std::list<ArcSPtr>::iterator());
+        arc->setSkelSlot(util::SlotList<ArcSPtr>::NONE);
         result = true;
     }
     return result;
 }
 
 void StraightSkeleton::addSheet(SheetSPtr sheet) {
-    std::list<SheetSPtr>::iterator it = sheets_.insert(sheets_.end(), sheet);
+    size_t slot = sheets_.push_back(sheet);
     sheet->setSkel(shared_from_this());
-    sheet->setListIt(it);
+    sheet->setSkelSlot(slot);
 }
 
 bool StraightSkeleton::removeSheet(SheetSPtr sheet) {
     bool result = false;
     if (sheet->getSkel() == shared_from_this()) {
-        sheets_.erase(sheet->getListIt());
+        sheets_.erase(sheet->getSkelSlot());
         sheet->setSkel(StraightSkeletonSPtr());
-        sheet->setListIt(std::list<SheetSPtr>::iterator());
+        sheet->setSkelSlot(util::SlotList<SheetSPtr>::NONE);
         result = true;
     }
     return result;
 }
 
+void StraightSkeleton::moveEvent(AbstractEventSPtr& event, size_t slot) {
+    event->setSkelSlot(slot);
+}
+
+void StraightSkeleton::moveNode(NodeSPtr& node, size_t slot) {
+    node->setSkelSlot(slot);
+}
+
+void StraightSkeleton::moveArc(ArcSPtr& arc, size_t slot) {
+    arc->setSkelSlot(slot);
+}
+
+void StraightSkeleton::moveSheet(SheetSPtr& sheet, size_t slot) {
+    sheet->setSkelSlot(slot);
+}
+
+void StraightSkeleton::compact() {
+    if (events_.numGaps() > 0) {
+        events_.compact(&StraightSkeleton::moveEvent);
+    }
+    if (nodes_.numGaps() > 0) {
+        nodes_.compact(&StraightSkeleton::moveNode);
+    }
+    if (arcs_.numGaps() > 0) {
+        arcs_.compact(&StraightSkeleton::moveArc);
+    }
+    if (sheets_.numGaps() > 0) {
+        sheets_.compact(&StraightSkeleton::moveSheet);
+    }
+}
+
 SharedMutex& StraightSkeleton::mutex() {
     return this->mutex_;
 }
 
-std::list<AbstractEventSPtr>& StraightSkeleton::events() {
+util::SlotList<AbstractEventSPtr>& StraightSkeleton::events() {
     return this->events_;
 }
 
-std::list<NodeSPtr>& StraightSkeleton::nodes() {
+util::SlotList<NodeSPtr>& StraightSkeleton::nodes() {
     return this->nodes_;
 }
 
-std::list<ArcSPtr>& StraightSkeleton::arcs() {
+util::SlotList<ArcSPtr>& StraightSkeleton::arcs() {
     return this->arcs_;
 }
 
-std::list<SheetSPtr>& StraightSkeleton::sheets() {
+util::SlotList<SheetSPtr>& StraightSkeleton::sheets() {
     return this->sheets_;
 }
 
@@ -135,22 +166,22 @@ void StraightSkeleton::setID(int id) {
 }
 
 void StraightSkeleton::resetAllIDs() {
-    std::list<AbstractEventSPtr>::iterator it_e = events_.begin();
+    util::SlotList<AbstractEventSPtr>::iterator it_e = events_.begin();
     while (it_e != events_.end()) {
         AbstractEventSPtr event = *it_e++;
         event->setID(-1);
     }
-    std::list<SheetSPtr>::iterator it_s = sheets_.begin();
+    util::SlotList<SheetSPtr>::iterator it_s = sheets_.begin();
     while (it_s != sheets_.end()) {
         SheetSPtr sheet = *it_s++;
         sheet->setID(-1);
     }
-    std::list<ArcSPtr>::iterator it_a = arcs_.begin();
+    util::SlotList<ArcSPtr>::iterator it_a = arcs_.begin();
     while (it_a != arcs_.end()) {
         ArcSPtr arc = *it_a++;
         arc->setID(-1);
     }
-    std::list<NodeSPtr>::iterator it_n = nodes_.begin();
+    util::SlotList<NodeSPtr>::iterator it_n = nodes_.begin();
     while (it_n != nodes_.end()) {
         NodeSPtr node = *it_n++;
         node->setID(-1);
@@ -173,7 +204,7 @@ void StraightSkeleton::appendConfig(const std::string& config) {
 bool StraightSkeleton::isConsistent() const {
     bool result = true;
 
-    std::list<NodeSPtr>::const_iterator it_n = nodes_.begin();
+    util::SlotList<NodeSPtr>::const_iterator it_n = nodes_.begin();
     while (it_n != nodes_.end()) {
         NodeSPtr node = *it_n++;
         if (node->getSkel() != shared_from_this()) {
@@ -181,59 +212,49 @@ bool StraightSkeleton::isConsistent() const {
             result = false;
             break;
         }
-        std::list<ArcWPtr>::const_iterator it_a = node->arcs().begin();
+        std::list<ArcHandle>::const_iterator it_a = node->arcs().begin();
         while (it_a != node->arcs().end()) {
-            ArcWPtr arc_wptr = *it_a++;
-            if (arc_wptr.expired()) {
+            ArcSPtr arc = (*it_a++).lock();
+            if (node != arc->getNodeSrc() && node != arc->getNodeDst()) {
                 DEBUG_VAR(node->toString());
-            } else {
-                ArcSPtr arc = ArcSPtr(arc_wptr);
-                if (node != arc->getNodeSrc() && node != arc->getNodeDst()) {
-                    DEBUG_VAR(node->toString());
-                    DEBUG_VAR(arc->toString());
-                    result = false;
-                    break;
-                }
+                DEBUG_VAR(arc->toString());
+                result = false;
+                break;
             }
         }
-        std::list<SheetWPtr>::const_iterator it_s = node->sheets().begin();
+        std::list<SheetHandle>::const_iterator it_s = node->sheets().begin();
         while (it_s != node->sheets().end()) {
-            SheetWPtr sheet_wptr = *it_s++;
-            if (sheet_wptr.expired()) {
+            SheetSPtr sheet = (*it_s++).lock();
+            std::list<NodeSPtr> nodes = sheet->nodes();
+            if (nodes.end() ==
+                    std::find(nodes.begin(), nodes.end(), node)) {
                 DEBUG_VAR(node->toString());
-            } else {
-                SheetSPtr sheet = SheetSPtr(sheet_wptr);
-                std::list<NodeSPtr> nodes = sheet->nodes();
-                if (nodes.end() ==
-                        std::find(nodes.begin(), nodes.end(), node)) {
-                    DEBUG_VAR(node->toString());
-                    DEBUG_VAR(sheet->toString());
-                    result = false;
-                    break;
-                }
+                DEBUG_VAR(sheet->toString());
+                result = false;
+                break;
             }
         }
     }
 
-    std::list<ArcSPtr>::const_iterator it_a = arcs_.begin();
+    util::SlotList<ArcSPtr>::const_iterator it_a = arcs_.begin();
     while (it_a != arcs_.end()) {
         ArcSPtr arc = *it_a++;
-        ArcWPtr arc_wptr(arc);
+        ArcHandle arc_h(arc);
         if (arc->getSkel() != shared_from_this()) {
             DEBUG_VAR(arc->toString());
             result = false;
             break;
         }
-        std::list<ArcWPtr> warcs = arc->getNodeSrc()->arcs();
-        if (warcs.end() == std::find(warcs.begin(), warcs.end(), arc_wptr)) {
+        std::list<ArcHandle> harcs = arc->getNodeSrc()->arcs();
+        if (harcs.end() == std::find(harcs.begin(), harcs.end(), arc_h)) {
             DEBUG_VAR(arc->toString());
             DEBUG_VAR(arc->getNodeSrc()->toString());
             result = false;
             break;
         }
         if (arc->hasNodeDst()) {
-            warcs = arc->getNodeDst()->arcs();
-            if (warcs.end() == std::find(warcs.begin(), warcs.end(), arc_wptr)) {
+            harcs = arc->getNodeDst()->arcs();
+            if (harcs.end() == std::find(harcs.begin(), harcs.end(), arc_h)) {
                 DEBUG_VAR(arc->toString());
                 DEBUG_VAR(arc->getNodeDst()->toString());
                 result = false;
@@ -241,22 +262,17 @@ bool StraightSkeleton::isConsistent() const {
             }
         }
         unsigned int num_sheets = 0;
-        std::list<SheetWPtr>::const_iterator it_s = arc->sheets().begin();
+        std::list<SheetHandle>::const_iterator it_s = arc->sheets().begin();
         while (it_s != arc->sheets().end()) {
-            SheetWPtr sheet_wptr = *it_s++;
-            if (sheet_wptr.expired()) {
+            SheetSPtr sheet = (*it_s++).lock();
+            num_sheets++;
+            std::list<ArcSPtr> arcs = sheet->arcs();
+            if (arcs.end() ==
+                    std::find(arcs.begin(), arcs.end(), arc)) {
                 DEBUG_VAR(arc->toString());
-            } else {
-                SheetSPtr sheet = SheetSPtr(sheet_wptr);
-                num_sheets++;
-                std::list<ArcSPtr> arcs = sheet->arcs();
-                if (arcs.end() ==
-                        std::find(arcs.begin(), arcs.end(), arc)) {
-                    DEBUG_VAR(arc->toString());
-                    DEBUG_VAR(sheet->toString());
-                    result = false;
-                    break;
-                }
+                DEBUG_VAR(sheet->toString());
+                result = false;
+                break;
             }
         }
         if (num_sheets != 3) {
@@ -266,10 +282,10 @@ bool StraightSkeleton::isConsistent() const {
         }
     }
 
-    std::list<SheetSPtr>::const_iterator it_s = sheets_.begin();
+    util::SlotList<SheetSPtr>::const_iterator it_s = sheets_.begin();
     while (it_s != sheets_.end()) {
         SheetSPtr sheet = *it_s++;
-        SheetWPtr sheet_wptr(sheet);
+        SheetHandle sheet_h(sheet);
         if (sheet->getSkel() != shared_from_this()) {
             DEBUG_VAR(sheet->toString());
             result = false;
@@ -278,9 +294,9 @@ bool StraightSkeleton::isConsistent() const {
         std::list<NodeSPtr>::const_iterator it_n = sheet->nodes().begin();
         while (it_n != sheet->nodes().end()) {
             NodeSPtr node = *it_n++;
-            std::list<SheetWPtr> wsheets = node->sheets();
-            if (wsheets.end() == std::find(
-                    wsheets.begin(), wsheets.end(), sheet_wptr)) {
+            std::list<SheetHandle> hsheets = node->sheets();
+            if (hsheets.end() == std::find(
+                    hsheets.begin(), hsheets.end(), sheet_h)) {
                 DEBUG_VAR(sheet->toString());
                 DEBUG_VAR(node->toString());
                 result = false;
@@ -290,9 +306,9 @@ bool StraightSkeleton::isConsistent() const {
         std::list<ArcSPtr>::const_iterator it_a = sheet->arcs().begin();
         while (it_a != sheet->arcs().end()) {
             ArcSPtr arc = *it_a++;
-            std::list<SheetWPtr> wsheets = arc->sheets();
-            if (wsheets.end() == std::find(
-                    wsheets.begin(), wsheets.end(), sheet_wptr)) {
+            std::list<SheetHandle> hsheets = arc->sheets();
+            if (hsheets.end() == std::find(
+                    hsheets.begin(), hsheets.end(), sheet_h)) {
                 DEBUG_VAR(sheet->toString());
                 DEBUG_VAR(arc->toString());
                 result = false;
@@ -306,7 +322,7 @@ bool StraightSkeleton::isConsistent() const {
 
 int StraightSkeleton::countEvents(int type) const {
     int result = 0;
-    std::list<AbstractEventSPtr>::const_iterator it_e = events_.begin();
+    util::SlotList<AbstractEventSPtr>::const_iterator it_e = events_.begin();
     while (it_e != events_.end()) {
         AbstractEventSPtr event = *it_e++;
         if (event->getType() == type) {
@@ -10,6 +10,7 @@
 #include "typedefs_thread.h"
 #include "data/3d/ptrs.h"
 #include "data/3d/skel/ptrs.h"
+#include "util/SlotList.h"
 #include <list>
 #include <string>
 
@@ -33,11 +34,17 @@ public:
     void addSheet(SheetSPtr sheet);
     bool removeSheet(SheetSPtr sheet);
 
+    /**
+     * Closes the gaps that removed elements left in the slot lists.
+     * Invalidates all iterators of events(), nodes(), arcs() and sheets().
+     */
+    void compact();
+
     SharedMutex& mutex();
-    std::list<AbstractEventSPtr>& events();
-    std::list<NodeSPtr>& nodes();
-    std::list<ArcSPtr>& arcs();
-    std::list<SheetSPtr>& sheets();
+    util::SlotList<AbstractEventSPtr>& events();
+    util::SlotList<NodeSPtr>& nodes();
+    util::SlotList<ArcSPtr>& arcs();
+    util::SlotList<SheetSPtr>& sheets();
 
     PolyhedronSPtr getPolyhedron() const;
     void setPolyhedron(PolyhedronSPtr polyhedron);
@@ -63,12 +70,17 @@ public:
 
 protected:
     StraightSkeleton();
+
+    static void moveEvent(AbstractEventSPtr& event, size_t slot);
+    static void moveNode(NodeSPtr& node, size_t slot);
+    static void moveArc(ArcSPtr& arc, size_t slot);
+    static void moveSheet(SheetSPtr& sheet, size_t slot);
     PolyhedronSPtr polyhedron_;
     mutable SharedMutex mutex_;
-    std::list<AbstractEventSPtr> events_;
-    std::list<NodeSPtr> nodes_;
-    std::list<ArcSPtr> arcs_;
-    std::list<SheetSPtr> sheets_;
+    util::SlotList<AbstractEventSPtr> events_;
+    util::SlotList<NodeSPtr> nodes_;
+    util::SlotList<ArcSPtr> arcs_;
+    util::SlotList<SheetSPtr> sheets_;
     int id_;
     std::string config_;
     std::string description_;
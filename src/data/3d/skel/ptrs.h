@@ -8,6 +8,7 @@
 #define DATA_3D_SKEL_PTRS_H
 
 #include "smarter_ptr.h"
+#include "util/Handle.h"
 
 /*
  * forward declare classes
@@ -66,14 +67,18 @@ class SphericalSkelVertexData;
 
 class SphericalOffset;
 
+class PolyhedronSnapshot;
+
 typedef SHARED_PTR<StraightSkeleton> StraightSkeletonSPtr;
 typedef WEAK_PTR<StraightSkeleton> StraightSkeletonWPtr;
 typedef SHARED_PTR<Node> NodeSPtr;
 typedef WEAK_PTR<Node> NodeWPtr;
 typedef SHARED_PTR<Arc> ArcSPtr;
 typedef WEAK_PTR<Arc> ArcWPtr;
+typedef util::Handle<Arc> ArcHandle;
 typedef SHARED_PTR<Sheet> SheetSPtr;
 typedef WEAK_PTR<Sheet> SheetWPtr;
+typedef util::Handle<Sheet> SheetHandle;
 
 typedef SHARED_PTR<AbstractEvent> AbstractEventSPtr;
 typedef WEAK_PTR<AbstractEvent> AbstractEventWPtr;
@@ -108,6 +113,9 @@ typedef WEAK_PTR<EdgeSplitEvent> EdgeSplitEventWPtr;
 typedef SHARED_PTR<PierceEvent> PierceEventSPtr;
 typedef WEAK_PTR<PierceEvent> PierceEventWPtr;
 
+typedef SHARED_PTR<PolyhedronSnapshot> PolyhedronSnapshotSPtr;
+typedef WEAK_PTR<PolyhedronSnapshot> PolyhedronSnapshotWPtr;
+
 typedef SHARED_PTR<SkelEdgeData> SkelEdgeDataSPtr;
 typedef WEAK_PTR<SkelEdgeData> SkelEdgeDataWPtr;
 typedef SHARED_PTR<SkelVertexData> SkelVertexDataSPtr;
@@ -19,8 +19,7 @@ PointDAO::PointDAO() {
 }
 
 PointDAO::~PointDAO() {
-    point_ids_.clear();
-    points_.clear();
+    // the static caches are destroyed with the translation unit
 }
 
 std::string PointDAO::getTableSchema() const {
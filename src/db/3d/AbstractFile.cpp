@@ -55,7 +55,7 @@ bool AbstractFile::hasCoplanarFacets(EdgeSPtr edge, double epsilon) {
 int AbstractFile::mergeCoplanarFacets(PolyhedronSPtr polyhedron, double epsilon) {
     int result = 0;
     std::list<EdgeSPtr> edges_toremove;
-    std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         EdgeSPtr edge = *it_e++;
         if (hasCoplanarFacets(edge, epsilon)) {
@@ -65,9 +65,9 @@ int AbstractFile::mergeCoplanarFacets(PolyhedronSPtr polyhedron, double epsilon)
     if (edges_toremove.size() > 0) {
         DEBUG_PRINT("Adjacent facets of the following edges are detected to be coplanar and will be merged.");
     }
-    it_e = edges_toremove.begin();
-    while (it_e != edges_toremove.end()) {
-        EdgeSPtr edge = *it_e++;
+    std::list<EdgeSPtr>::iterator it_r = edges_toremove.begin();
+    while (it_r != edges_toremove.end()) {
+        EdgeSPtr edge = *it_r++;
         DEBUG_VAR(edge->toString());
         FacetSPtr facet_l = edge->getFacetL();
         FacetSPtr facet_r = edge->getFacetR();
@@ -91,24 +91,21 @@ int AbstractFile::mergeCoplanarFacets(PolyhedronSPtr polyhedron, double epsilon)
 int AbstractFile::removeVerticesDegLt3(PolyhedronSPtr polyhedron) {
     int result = 0;
     std::list<VertexSPtr> vertices_toremove;
-    std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
     while (it_v != polyhedron->vertices().end()) {
         VertexSPtr vertex = *it_v++;
         if (vertex->degree() < 3) {
             vertices_toremove.push_back(vertex);
         }
     }
-    it_v = vertices_toremove.begin();
-    while (it_v != vertices_toremove.end()) {
-        VertexSPtr vertex = *it_v++;
+    std::list<VertexSPtr>::iterator it_r = vertices_toremove.begin();
+    while (it_r != vertices_toremove.end()) {
+        VertexSPtr vertex = *it_r++;
         DEBUG_VAR(vertex->toString());
-        std::list<FacetWPtr>::iterator it_f = vertex->facets().begin();
+        std::list<FacetHandle>::iterator it_f = vertex->facets().begin();
         while (it_f != vertex->facets().end()) {
-            FacetWPtr facet_wptr = *it_f++;
-            if (!facet_wptr.expired()) {
-                FacetSPtr facet(facet_wptr);
-                facet->removeVertex(vertex);
-            }
+            FacetSPtr facet = (*it_f++).lock();
+            facet->removeVertex(vertex);
         }
         // there should be no vertices of degree = 1
         if (vertex->degree() == 2) {
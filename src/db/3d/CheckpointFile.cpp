@@ -0,0 +1,888 @@
+/**
+ * @file   db/3d/CheckpointFile.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#include "db/3d/CheckpointFile.h"
+
+#include "debug.h"
+#include "typedefs_thread.h"
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Polyhedron.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Triangle.h"
+#include "data/3d/skel/StraightSkeleton.h"
+#include "data/3d/skel/Node.h"
+#include "data/3d/skel/Arc.h"
+#include "data/3d/skel/Sheet.h"
+#include "data/3d/skel/SkelVertexData.h"
+#include "data/3d/skel/SkelEdgeData.h"
+#include "data/3d/skel/SkelFacetData.h"
+#include "data/3d/skel/AbstractEvent.h"
+#include "data/3d/skel/ConstOffsetEvent.h"
+#include "data/3d/skel/SaveOffsetEvent.h"
+#include "data/3d/skel/EdgeEvent.h"
+#include "data/3d/skel/EdgeMergeEvent.h"
+#include "data/3d/skel/TriangleEvent.h"
+#include "data/3d/skel/DblEdgeMergeEvent.h"
+#include "data/3d/skel/DblTriangleEvent.h"
+#include "data/3d/skel/TetrahedronEvent.h"
+#include "data/3d/skel/VertexEvent.h"
+#include "data/3d/skel/FlipVertexEvent.h"
+#include "data/3d/skel/SurfaceEvent.h"
+#include "data/3d/skel/PolyhedronSplitEvent.h"
+#include "data/3d/skel/SplitMergeEvent.h"
+#include "data/3d/skel/EdgeSplitEvent.h"
+#include "data/3d/skel/PierceEvent.h"
+#include <exception>
+#include <fstream>
+#include <sstream>
+
+namespace db { namespace _3d {
+
+CheckpointFile::CheckpointFile() {
+    offset_ = 0.0;
+    num_batches_ = 0;
+}
+
+CheckpointFile::~CheckpointFile() {
+    input_.reset();
+    polyhedron_.reset();
+    skel_.reset();
+    save_offsets_.clear();
+}
+
+CheckpointFileSPtr CheckpointFile::create() {
+    return CheckpointFileSPtr(new CheckpointFile());
+}
+
+PolyhedronSPtr CheckpointFile::getInput() const {
+    return input_;
+}
+
+void CheckpointFile::setInput(PolyhedronSPtr input) {
+    input_ = input;
+}
+
+PolyhedronSPtr CheckpointFile::getPolyhedron() const {
+    return polyhedron_;
+}
+
+void CheckpointFile::setPolyhedron(PolyhedronSPtr polyhedron) {
+    polyhedron_ = polyhedron;
+}
+
+StraightSkeletonSPtr CheckpointFile::getSkel() const {
+    return skel_;
+}
+
+void CheckpointFile::setSkel(StraightSkeletonSPtr skel) {
+    skel_ = skel;
+}
+
+double CheckpointFile::getOffset() const {
+    return offset_;
+}
+
+void CheckpointFile::setOffset(double offset) {
+    offset_ = offset;
+}
+
+unsigned int CheckpointFile::getNumBatches() const {
+    return num_batches_;
+}
+
+void CheckpointFile::setNumBatches(unsigned int num_batches) {
+    num_batches_ = num_batches;
+}
+
+std::list<double>& CheckpointFile::saveOffsets() {
+    return save_offsets_;
+}
+
+void CheckpointFile::writeInt(std::ostream& os, int value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void CheckpointFile::writeDouble(std::ostream& os, double value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void CheckpointFile::writeString(std::ostream& os, const std::string& value) {
+    writeInt(os, value.size());
+    os.write(value.data(), value.size());
+}
+
+int CheckpointFile::readInt(std::istream& is) {
+    int result = 0;
+    is.read(reinterpret_cast<char*>(&result), sizeof(result));
+    if (!is.good()) {
+        throw std::runtime_error("Unexpected end of checkpoint file.");
+    }
+    return result;
+}
+
+double CheckpointFile::readDouble(std::istream& is) {
+    double result = 0.0;
+    is.read(reinterpret_cast<char*>(&result), sizeof(result));
+    if (!is.good()) {
+        throw std::runtime_error("Unexpected end of checkpoint file.");
+    }
+    return result;
+}
+
+std::string CheckpointFile::readString(std::istream& is) {
+    int size = readInt(is);
+    if (size < 0) {
+        throw std::runtime_error("Invalid string in checkpoint file.");
+    }
+    std::string result(size, '\0');
+    if (size > 0) {
+        is.read(&result[0], size);
+        if (!is.good()) {
+            throw std::runtime_error("Unexpected end of checkpoint file.");
+        }
+    }
+    return result;
+}
+
+int CheckpointFile::readIndex(std::istream& is, unsigned int size) {
+    int result = readInt(is);
+    if (result < -1 || result >= (int)size) {
+        std::stringstream whatstream;
+        whatstream << "Index=" << result << " does not exist.";
+        throw std::runtime_error(whatstream.str());
+    }
+    return result;
+}
+
+void CheckpointFile::writePlane(std::ostream& os, Plane3SPtr plane) {
+    writeInt(os, plane ? 1 : 0);
+    if (plane) {
+#ifdef USE_CGAL
+        writeDouble(os, plane->a());
+        writeDouble(os, plane->b());
+        writeDouble(os, plane->c());
+        writeDouble(os, plane->d());
+#else
+        writeDouble(os, plane->getA());
+        writeDouble(os, plane->getB());
+        writeDouble(os, plane->getC());
+        writeDouble(os, plane->getD());
+#endif
+    }
+}
+
+Plane3SPtr CheckpointFile::readPlane(std::istream& is) {
+    Plane3SPtr result = Plane3SPtr();
+    if (readInt(is) != 0) {
+        double a = readDouble(is);
+        double b = readDouble(is);
+        double c = readDouble(is);
+        double d = readDouble(is);
+        result = KernelFactory::createPlane3(a, b, c, d);
+    }
+    return result;
+}
+
+NodeSPtr CheckpointFile::getNode(AbstractEventSPtr event) {
+    NodeSPtr result = NodeSPtr();
+    if (event->getType() == AbstractEvent::EDGE_EVENT) {
+        result = std::dynamic_pointer_cast<EdgeEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::EDGE_MERGE_EVENT) {
+        result = std::dynamic_pointer_cast<EdgeMergeEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::TRIANGLE_EVENT) {
+        result = std::dynamic_pointer_cast<TriangleEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::DBL_EDGE_MERGE_EVENT) {
+        result = std::dynamic_pointer_cast<DblEdgeMergeEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::DBL_TRIANGLE_EVENT) {
+        result = std::dynamic_pointer_cast<DblTriangleEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::TETRAHEDRON_EVENT) {
+        result = std::dynamic_pointer_cast<TetrahedronEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::VERTEX_EVENT) {
+        result = std::dynamic_pointer_cast<VertexEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::FLIP_VERTEX_EVENT) {
+        result = std::dynamic_pointer_cast<FlipVertexEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::SURFACE_EVENT) {
+        result = std::dynamic_pointer_cast<SurfaceEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+        result = std::dynamic_pointer_cast<PolyhedronSplitEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::SPLIT_MERGE_EVENT) {
+        result = std::dynamic_pointer_cast<SplitMergeEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::EDGE_SPLIT_EVENT) {
+        result = std::dynamic_pointer_cast<EdgeSplitEvent>(event)->getNode();
+    } else if (event->getType() == AbstractEvent::PIERCE_EVENT) {
+        result = std::dynamic_pointer_cast<PierceEvent>(event)->getNode();
+    }
+    return result;
+}
+
+AbstractEventSPtr CheckpointFile::createEvent(int type, double offset, NodeSPtr node) {
+    AbstractEventSPtr result = AbstractEventSPtr();
+    if (type == AbstractEvent::CONST_OFFSET_EVENT) {
+        result = ConstOffsetEvent::create(offset);
+    } else if (type == AbstractEvent::SAVE_OFFSET_EVENT) {
+        result = SaveOffsetEvent::create(offset);
+    } else if (type == AbstractEvent::EDGE_EVENT) {
+        EdgeEventSPtr event = EdgeEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::EDGE_MERGE_EVENT) {
+        EdgeMergeEventSPtr event = EdgeMergeEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::TRIANGLE_EVENT) {
+        TriangleEventSPtr event = TriangleEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::DBL_EDGE_MERGE_EVENT) {
+        DblEdgeMergeEventSPtr event = DblEdgeMergeEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::DBL_TRIANGLE_EVENT) {
+        DblTriangleEventSPtr event = DblTriangleEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::TETRAHEDRON_EVENT) {
+        TetrahedronEventSPtr event = TetrahedronEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::VERTEX_EVENT) {
+        VertexEventSPtr event = VertexEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::FLIP_VERTEX_EVENT) {
+        FlipVertexEventSPtr event = FlipVertexEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::SURFACE_EVENT) {
+        SurfaceEventSPtr event = SurfaceEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+        PolyhedronSplitEventSPtr event = PolyhedronSplitEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::SPLIT_MERGE_EVENT) {
+        SplitMergeEventSPtr event = SplitMergeEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::EDGE_SPLIT_EVENT) {
+        EdgeSplitEventSPtr event = EdgeSplitEvent::create();
+        event->setNode(node);
+        result = event;
+    } else if (type == AbstractEvent::PIERCE_EVENT) {
+        PierceEventSPtr event = PierceEvent::create();
+        event->setNode(node);
+        result = event;
+    } else {
+        std::stringstream whatstream;
+        whatstream << "Event type=" << type << " does not exist.";
+        throw std::runtime_error(whatstream.str());
+    }
+    return result;
+}
+
+void CheckpointFile::writePolyhedron(std::ostream& os,
+        PolyhedronSPtr polyhedron, StraightSkeletonSPtr skel,
+        const std::map<Point3SPtr, int>& point_ids) {
+    std::vector<VertexSPtr> vertices;
+    std::map<VertexSPtr, int> vertex_ids;
+    std::vector<EdgeSPtr> edges;
+    std::map<EdgeSPtr, int> edge_ids;
+    std::vector<FacetSPtr> facets;
+    std::map<FacetSPtr, int> facet_ids;
+    std::vector<NodeSPtr> nodes;
+    std::map<NodeSPtr, int> node_ids;
+    std::vector<ArcSPtr> arcs;
+    std::map<ArcSPtr, int> arc_ids;
+    std::vector<SheetSPtr> sheets;
+    std::map<SheetSPtr, int> sheet_ids;
+
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        VertexSPtr vertex = *it_v++;
+        append(vertex, vertices, vertex_ids);
+    }
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        append(edge, edges, edge_ids);
+    }
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        append(facet, facets, facet_ids);
+    }
+    unsigned int num_facets_polyhedron = facets.size();
+    for (unsigned int i = 0; i < edges.size(); i++) {
+        append(edges[i]->getFacetL(), facets, facet_ids);
+        append(edges[i]->getFacetR(), facets, facet_ids);
+    }
+    if (skel) {
+        util::SlotList<NodeSPtr>::iterator it_n = skel->nodes().begin();
+        while (it_n != skel->nodes().end()) {
+            NodeSPtr node = *it_n++;
+            append(node, nodes, node_ids);
+        }
+        util::SlotList<ArcSPtr>::iterator it_a = skel->arcs().begin();
+        while (it_a != skel->arcs().end()) {
+            ArcSPtr arc = *it_a++;
+            append(arc, arcs, arc_ids);
+        }
+        util::SlotList<SheetSPtr>::iterator it_s = skel->sheets().begin();
+        while (it_s != skel->sheets().end()) {
+            SheetSPtr sheet = *it_s++;
+            append(sheet, sheets, sheet_ids);
+            append(sheet->getFacetB(), facets, facet_ids);
+            append(sheet->getFacetF(), facets, facet_ids);
+        }
+        // facets.size() grows while the origins are appended
+        for (unsigned int i = 0; i < facets.size(); i++) {
+            SkelFacetDataSPtr data = std::dynamic_pointer_cast<SkelFacetData>(
+                    facets[i]->getData());
+            if (data) {
+                append(data->getFacetOrigin(), facets, facet_ids);
+            }
+        }
+    }
+
+    writeString(os, polyhedron->getDescription());
+    writeInt(os, num_facets_polyhedron);
+    writeInt(os, facets.size());
+    for (unsigned int i = 0; i < facets.size(); i++) {
+        writeInt(os, facets[i]->getID());
+        writePlane(os, facets[i]->getPlane());
+    }
+    writeInt(os, vertices.size());
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        writeInt(os, indexOf(vertices[i]->getPoint(), point_ids));
+        writeInt(os, vertices[i]->getID());
+    }
+    writeInt(os, edges.size());
+    for (unsigned int i = 0; i < edges.size(); i++) {
+        EdgeSPtr edge = edges[i];
+        writeInt(os, indexOf(edge->getVertexSrc(), vertex_ids));
+        writeInt(os, indexOf(edge->getVertexDst(), vertex_ids));
+        writeInt(os, indexOf(edge->getFacetL(), facet_ids));
+        writeInt(os, indexOf(edge->getFacetR(), facet_ids));
+        writeInt(os, edge->getID());
+    }
+    for (unsigned int i = 0; i < num_facets_polyhedron; i++) {
+        FacetSPtr facet = facets[i];
+        writeInt(os, facet->vertices().size());
+        std::list<VertexSPtr>::iterator it_fv = facet->vertices().begin();
+        while (it_fv != facet->vertices().end()) {
+            VertexSPtr vertex = *it_fv++;
+            writeInt(os, indexOf(vertex, vertex_ids));
+        }
+        writeInt(os, facet->edges().size());
+        std::list<EdgeSPtr>::iterator it_fe = facet->edges().begin();
+        while (it_fe != facet->edges().end()) {
+            EdgeSPtr edge = *it_fe++;
+            writeInt(os, indexOf(edge, edge_ids));
+        }
+        writeInt(os, facet->triangles().size());
+        std::list<TriangleSPtr>::iterator it_t = facet->triangles().begin();
+        while (it_t != facet->triangles().end()) {
+            TriangleSPtr triangle = *it_t++;
+            for (unsigned int k = 0; k < 3; k++) {
+                writeInt(os, indexOf(triangle->getVertex(k), vertex_ids));
+            }
+        }
+    }
+    // the order of the adjacency lists of the vertices
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        std::vector<int> indices;
+        std::list<EdgeHandle>::iterator it_ew = vertices[i]->edges().begin();
+        while (it_ew != vertices[i]->edges().end()) {
+            int index = indexOf((*it_ew++).lock(), edge_ids);
+            if (index >= 0) {
+                indices.push_back(index);
+            }
+        }
+        writeInt(os, indices.size());
+        for (unsigned int j = 0; j < indices.size(); j++) {
+            writeInt(os, indices[j]);
+        }
+        indices.clear();
+        std::list<FacetHandle>::iterator it_fw = vertices[i]->facets().begin();
+        while (it_fw != vertices[i]->facets().end()) {
+            int index = indexOf((*it_fw++).lock(), facet_ids);
+            if (index >= 0) {
+                indices.push_back(index);
+            }
+        }
+        writeInt(os, indices.size());
+        for (unsigned int j = 0; j < indices.size(); j++) {
+            writeInt(os, indices[j]);
+        }
+    }
+
+    writeInt(os, skel ? 1 : 0);
+    if (!skel) {
+        return;
+    }
+    writeInt(os, nodes.size());
+    for (unsigned int i = 0; i < nodes.size(); i++) {
+        writeInt(os, indexOf(nodes[i]->getPoint(), point_ids));
+        writeDouble(os, nodes[i]->getOffset());
+        writeInt(os, nodes[i]->getID());
+    }
+    writeInt(os, arcs.size());
+    for (unsigned int i = 0; i < arcs.size(); i++) {
+        ArcSPtr arc = arcs[i];
+        writeInt(os, indexOf(arc->getNodeSrc(), node_ids));
+        if (arc->hasNodeDst()) {
+            writeInt(os, indexOf(arc->getNodeDst(), node_ids));
+            writeInt(os, 0);
+        } else {
+            writeInt(os, -1);
+            Vector3SPtr direction = arc->getDirection();
+            writeInt(os, direction ? 1 : 0);
+            if (direction) {
+                for (unsigned int k = 0; k < 3; k++) {
+                    writeDouble(os, (*direction)[k]);
+                }
+            }
+        }
+        writeInt(os, arc->getID());
+    }
+    writeInt(os, sheets.size());
+    for (unsigned int i = 0; i < sheets.size(); i++) {
+        SheetSPtr sheet = sheets[i];
+        writeInt(os, indexOf(sheet->getFacetB(), facet_ids));
+        writeInt(os, indexOf(sheet->getFacetF(), facet_ids));
+        writePlane(os, sheet->getPlane());
+        writeInt(os, sheet->nodes().size());
+        std::list<NodeSPtr>::iterator it_n = sheet->nodes().begin();
+        while (it_n != sheet->nodes().end()) {
+            NodeSPtr node = *it_n++;
+            writeInt(os, indexOf(node, node_ids));
+        }
+        writeInt(os, sheet->arcs().size());
+        std::list<ArcSPtr>::iterator it_a = sheet->arcs().begin();
+        while (it_a != sheet->arcs().end()) {
+            ArcSPtr arc = *it_a++;
+            writeInt(os, indexOf(arc, arc_ids));
+        }
+        writeInt(os, sheet->getID());
+    }
+    writeInt(os, skel->events().size());
+    util::SlotList<AbstractEventSPtr>::iterator it_ev = skel->events().begin();
+    while (it_ev != skel->events().end()) {
+        AbstractEventSPtr event = *it_ev++;
+        writeInt(os, event->getType());
+        writeDouble(os, event->getOffset());
+        writeInt(os, indexOf(getNode(event), node_ids));
+        writeInt(os, event->getID());
+    }
+    // the order of the adjacency lists of the nodes and arcs
+    for (unsigned int i = 0; i < nodes.size(); i++) {
+        std::vector<int> indices;
+        std::list<ArcHandle>::iterator it_aw = nodes[i]->arcs().begin();
+        while (it_aw != nodes[i]->arcs().end()) {
+            int index = indexOf((*it_aw++).lock(), arc_ids);
+            if (index >= 0) {
+                indices.push_back(index);
+            }
+        }
+        writeInt(os, indices.size());
+        for (unsigned int j = 0; j < indices.size(); j++) {
+            writeInt(os, indices[j]);
+        }
+        indices.clear();
+        std::list<SheetHandle>::iterator it_sw = nodes[i]->sheets().begin();
+        while (it_sw != nodes[i]->sheets().end()) {
+            int index = indexOf((*it_sw++).lock(), sheet_ids);
+            if (index >= 0) {
+                indices.push_back(index);
+            }
+        }
+        writeInt(os, indices.size());
+        for (unsigned int j = 0; j < indices.size(); j++) {
+            writeInt(os, indices[j]);
+        }
+    }
+    for (unsigned int i = 0; i < arcs.size(); i++) {
+        std::vector<int> indices;
+        std::list<SheetHandle>::iterator it_sw = arcs[i]->sheets().begin();
+        while (it_sw != arcs[i]->sheets().end()) {
+            int index = indexOf((*it_sw++).lock(), sheet_ids);
+            if (index >= 0) {
+                indices.push_back(index);
+            }
+        }
+        writeInt(os, indices.size());
+        for (unsigned int j = 0; j < indices.size(); j++) {
+            writeInt(os, indices[j]);
+        }
+    }
+    // skeleton data
+    for (unsigned int i = 0; i < vertices.size(); i++) {
+        SkelVertexDataSPtr data = std::dynamic_pointer_cast<SkelVertexData>(
+                vertices[i]->getData());
+        writeInt(os, data ? 1 : 0);
+        if (data) {
+            writeInt(os, indexOf(data->getNode(), node_ids));
+            writeInt(os, indexOf(data->getArc(), arc_ids));
+        }
+    }
+    for (unsigned int i = 0; i < edges.size(); i++) {
+        SkelEdgeDataSPtr data = std::dynamic_pointer_cast<SkelEdgeData>(
+                edges[i]->getData());
+        writeInt(os, data ? 1 : 0);
+        if (data) {
+            writeInt(os, indexOf(data->getSheet(), sheet_ids));
+        }
+    }
+    for (unsigned int i = 0; i < facets.size(); i++) {
+        SkelFacetDataSPtr data = std::dynamic_pointer_cast<SkelFacetData>(
+                facets[i]->getData());
+        writeInt(os, data ? 1 : 0);
+        if (data) {
+            writeDouble(os, data->getSpeed());
+            writeInt(os, indexOf(data->getFacetOrigin(), facet_ids));
+        }
+    }
+    writeString(os, skel->getDescription());
+}
+
+PolyhedronSPtr CheckpointFile::readPolyhedron(std::istream& is,
+        const std::vector<Point3SPtr>& points, StraightSkeletonSPtr skel) {
+    PolyhedronSPtr result = Polyhedron::create();
+    result->setDescription(readString(is));
+    int num_facets_polyhedron = readInt(is);
+    int num_facets = readInt(is);
+    if (num_facets_polyhedron < 0 || num_facets_polyhedron > num_facets) {
+        throw std::runtime_error("Invalid number of facets in checkpoint file.");
+    }
+    std::vector<FacetSPtr> facets;
+    for (int i = 0; i < num_facets; i++) {
+        FacetSPtr facet = Facet::create();
+        facet->setID(readInt(is));
+        facet->setPlane(readPlane(is));
+        facets.push_back(facet);
+    }
+    int num_vertices = readInt(is);
+    std::vector<VertexSPtr> vertices;
+    for (int i = 0; i < num_vertices; i++) {
+        int index = readIndex(is, points.size());
+        VertexSPtr vertex = Vertex::create(
+                index >= 0 ? points[index] : Point3SPtr());
+        vertex->setID(readInt(is));
+        result->addVertex(vertex);
+        vertices.push_back(vertex);
+    }
+    int num_edges = readInt(is);
+    std::vector<EdgeSPtr> edges;
+    for (int i = 0; i < num_edges; i++) {
+        int index_src = readIndex(is, vertices.size());
+        int index_dst = readIndex(is, vertices.size());
+        if (index_src < 0 || index_dst < 0) {
+            throw std::runtime_error("Edge without vertex in checkpoint file.");
+        }
+        EdgeSPtr edge = Edge::create(vertices[index_src], vertices[index_dst]);
+        int index_l = readIndex(is, facets.size());
+        if (index_l >= 0) {
+            edge->setFacetL(facets[index_l]);
+        }
+        int index_r = readIndex(is, facets.size());
+        if (index_r >= 0) {
+            edge->setFacetR(facets[index_r]);
+        }
+        edge->setID(readInt(is));
+        result->addEdge(edge);
+        edges.push_back(edge);
+    }
+    for (int i = 0; i < num_facets_polyhedron; i++) {
+        FacetSPtr facet = facets[i];
+        int num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            int index = readIndex(is, vertices.size());
+            if (index >= 0) {
+                facet->addVertex(vertices[index]);
+            }
+        }
+        num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            int index = readIndex(is, edges.size());
+            if (index >= 0) {
+                facet->addEdge(edges[index]);
+            }
+        }
+        num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            VertexSPtr vertices_t[3];
+            for (unsigned int k = 0; k < 3; k++) {
+                int index = readIndex(is, vertices.size());
+                if (index < 0) {
+                    throw std::runtime_error("Triangle without vertex in checkpoint file.");
+                }
+                vertices_t[k] = vertices[index];
+            }
+            Triangle::create(facet, vertices_t);
+        }
+        result->addFacet(facet);
+    }
+    for (int i = 0; i < num_vertices; i++) {
+        VertexSPtr vertex = vertices[i];
+        vertex->edges().clear();
+        int num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            int index = readIndex(is, edges.size());
+            if (index >= 0) {
+                vertex->addEdge(edges[index]);
+            }
+        }
+        vertex->facets().clear();
+        num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            int index = readIndex(is, facets.size());
+            if (index >= 0) {
+                vertex->addFacet(facets[index]);
+            }
+        }
+    }
+
+    if (readInt(is) == 0) {
+        return result;
+    }
+    if (!skel) {
+        throw std::runtime_error("Unexpected straight skeleton in checkpoint file.");
+    }
+    int num_nodes = readInt(is);
+    std::vector<NodeSPtr> nodes;
+    for (int i = 0; i < num_nodes; i++) {
+        int index = readIndex(is, points.size());
+        NodeSPtr node = Node::create(index >= 0 ? points[index] : Point3SPtr());
+        node->setOffset(readDouble(is));
+        node->setID(readInt(is));
+        skel->addNode(node);
+        nodes.push_back(node);
+    }
+    int num_arcs = readInt(is);
+    std::vector<ArcSPtr> arcs;
+    for (int i = 0; i < num_arcs; i++) {
+        int index_src = readIndex(is, nodes.size());
+        if (index_src < 0) {
+            throw std::runtime_error("Arc without node in checkpoint file.");
+        }
+        int index_dst = readIndex(is, nodes.size());
+        Vector3SPtr direction = Vector3SPtr();
+        if (readInt(is) != 0) {
+            double x = readDouble(is);
+            double y = readDouble(is);
+            double z = readDouble(is);
+            direction = KernelFactory::createVector3(x, y, z);
+        }
+        ArcSPtr arc = Arc::create(nodes[index_src], direction);
+        if (index_dst >= 0) {
+            arc->setNodeDst(nodes[index_dst]);
+        }
+        arc->setID(readInt(is));
+        skel->addArc(arc);
+        arcs.push_back(arc);
+    }
+    int num_sheets = readInt(is);
+    std::vector<SheetSPtr> sheets;
+    for (int i = 0; i < num_sheets; i++) {
+        SheetSPtr sheet = Sheet::create();
+        int index = readIndex(is, facets.size());
+        if (index >= 0) {
+            sheet->setFacetB(facets[index]);
+        }
+        index = readIndex(is, facets.size());
+        if (index >= 0) {
+            sheet->setFacetF(facets[index]);
+        }
+        sheet->setPlane(readPlane(is));
+        int num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            index = readIndex(is, nodes.size());
+            if (index >= 0) {
+                sheet->addNode(nodes[index]);
+            }
+        }
+        num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            index = readIndex(is, arcs.size());
+            if (index >= 0) {
+                sheet->addArc(arcs[index]);
+            }
+        }
+        sheet->setID(readInt(is));
+        skel->addSheet(sheet);
+        sheets.push_back(sheet);
+    }
+    int num_events = readInt(is);
+    for (int i = 0; i < num_events; i++) {
+        int type = readInt(is);
+        double offset = readDouble(is);
+        int index = readIndex(is, nodes.size());
+        AbstractEventSPtr event = createEvent(type, offset,
+                index >= 0 ? nodes[index] : NodeSPtr());
+        event->setID(readInt(is));
+        skel->addEvent(event);
+    }
+    for (int i = 0; i < num_nodes; i++) {
+        NodeSPtr node = nodes[i];
+        node->arcs().clear();
+        int num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            int index = readIndex(is, arcs.size());
+            if (index >= 0) {
+                node->addArc(arcs[index]);
+            }
+        }
+        node->sheets().clear();
+        num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            int index = readIndex(is, sheets.size());
+            if (index >= 0) {
+                node->addSheet(sheets[index]);
+            }
+        }
+    }
+    for (int i = 0; i < num_arcs; i++) {
+        ArcSPtr arc = arcs[i];
+        arc->sheets().clear();
+        int num = readInt(is);
+        for (int j = 0; j < num; j++) {
+            int index = readIndex(is, sheets.size());
+            if (index >= 0) {
+                arc->addSheet(sheets[index]);
+            }
+        }
+    }
+    for (int i = 0; i < num_vertices; i++) {
+        if (readInt(is) != 0) {
+            SkelVertexDataSPtr data = SkelVertexData::create(vertices[i]);
+            int index = readIndex(is, nodes.size());
+            if (index >= 0) {
+                data->setNode(nodes[index]);
+            }
+            index = readIndex(is, arcs.size());
+            if (index >= 0) {
+                // also restores the kinematics of the vertex
+                data->setArc(arcs[index]);
+            }
+        }
+    }
+    for (int i = 0; i < num_edges; i++) {
+        if (readInt(is) != 0) {
+            SkelEdgeDataSPtr data = SkelEdgeData::create(edges[i]);
+            int index = readIndex(is, sheets.size());
+            if (index >= 0) {
+                data->setSheet(sheets[index]);
+            }
+        }
+    }
+    for (int i = 0; i < num_facets; i++) {
+        if (readInt(is) != 0) {
+            SkelFacetDataSPtr data = SkelFacetData::create(facets[i]);
+            data->setSpeed(readDouble(is));
+            int index = readIndex(is, facets.size());
+            data->setFacetOrigin(index >= 0 ? facets[index] : FacetSPtr());
+        }
+    }
+    skel->setDescription(readString(is));
+    return result;
+}
+
+CheckpointFileSPtr CheckpointFile::load(const std::string& filename) {
+    CheckpointFileSPtr result = CheckpointFileSPtr();
+    std::ifstream ifs(filename.c_str(), std::ios::in | std::ios::binary);
+    if (ifs.is_open()) {
+        try {
+            if (readInt(ifs) != MAGIC) {
+                throw std::runtime_error("'" + filename + "' is not a checkpoint file.");
+            }
+            if (readInt(ifs) != VERSION) {
+                throw std::runtime_error("Version of '" + filename + "' is not supported.");
+            }
+            CheckpointFileSPtr checkpoint = CheckpointFile::create();
+            checkpoint->setOffset(readDouble(ifs));
+            checkpoint->setNumBatches(readInt(ifs));
+            int num_save_offsets = readInt(ifs);
+            for (int i = 0; i < num_save_offsets; i++) {
+                checkpoint->saveOffsets().push_back(readDouble(ifs));
+            }
+            int num_points = readInt(ifs);
+            std::vector<Point3SPtr> points;
+            for (int i = 0; i < num_points; i++) {
+                double x = readDouble(ifs);
+                double y = readDouble(ifs);
+                double z = readDouble(ifs);
+                points.push_back(KernelFactory::createPoint3(x, y, z));
+            }
+            checkpoint->setInput(
+                    readPolyhedron(ifs, points, StraightSkeletonSPtr()));
+            StraightSkeletonSPtr skel = StraightSkeleton::create();
+            skel->setPolyhedron(checkpoint->getInput());
+            checkpoint->setPolyhedron(readPolyhedron(ifs, points, skel));
+            checkpoint->setSkel(skel);
+            result = checkpoint;
+        } catch (std::exception& e) {
+            DEBUG_VAL("Error: " << e.what());
+        }
+        ifs.close();
+    }
+    return result;
+}
+
+bool CheckpointFile::save(const std::string& filename) const {
+    bool result = false;
+    if (!(input_ && polyhedron_ && skel_)) {
+        return false;
+    }
+    std::ofstream ofs(filename.c_str(), std::ios::out | std::ios::binary);
+    if (ofs.is_open()) {
+        ReadLock l_input(input_->mutex());
+        ReadLock l_polyhedron(polyhedron_->mutex());
+        ReadLock l_skel(skel_->mutex());
+        writeInt(ofs, MAGIC);
+        writeInt(ofs, VERSION);
+        writeDouble(ofs, offset_);
+        writeInt(ofs, num_batches_);
+        writeInt(ofs, save_offsets_.size());
+        std::list<double>::const_iterator it_o = save_offsets_.begin();
+        while (it_o != save_offsets_.end()) {
+            writeDouble(ofs, *it_o++);
+        }
+        // points are shared by both polyhedrons and the nodes
+        std::vector<Point3SPtr> points;
+        std::map<Point3SPtr, int> point_ids;
+        util::SlotList<VertexSPtr>::iterator it_v = input_->vertices().begin();
+        while (it_v != input_->vertices().end()) {
+            VertexSPtr vertex = *it_v++;
+            append(vertex->getPoint(), points, point_ids);
+        }
+        it_v = polyhedron_->vertices().begin();
+        while (it_v != polyhedron_->vertices().end()) {
+            VertexSPtr vertex = *it_v++;
+            append(vertex->getPoint(), points, point_ids);
+        }
+        util::SlotList<NodeSPtr>::iterator it_n = skel_->nodes().begin();
+        while (it_n != skel_->nodes().end()) {
+            NodeSPtr node = *it_n++;
+            append(node->getPoint(), points, point_ids);
+        }
+        writeInt(ofs, points.size());
+        for (unsigned int i = 0; i < points.size(); i++) {
+            for (unsigned int k = 0; k < 3; k++) {
+                writeDouble(ofs, (*points[i])[k]);
+            }
+        }
+        writePolyhedron(ofs, input_, StraightSkeletonSPtr(), point_ids);
+        writePolyhedron(ofs, polyhedron_, skel_, point_ids);
+        ofs.close();
+        result = !ofs.fail();
+    }
+    return result;
+}
+
+} }
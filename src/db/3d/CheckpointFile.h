@@ -0,0 +1,155 @@
+/**
+ * @file   db/3d/CheckpointFile.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef DB_3D_CHECKPOINTFILE_H
+#define DB_3D_CHECKPOINTFILE_H
+
+#include "data/3d/ptrs.h"
+#include "data/3d/skel/ptrs.h"
+#include "db/3d/ptrs.h"
+#include <iostream>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace db { namespace _3d {
+
+using namespace data::_3d;
+using namespace data::_3d::skel;
+
+/**
+ * Binary file that stores the state of algo::_3d::SimpleStraightSkel
+ * between two events: the input polyhedron, the wavefront polyhedron
+ * with its skeleton data, the partial straight skeleton and the offset.
+ * Points shared by vertices and nodes are stored once,
+ * GraphChecker relies on this.
+ * Offset links of the skeleton data are not stored,
+ * they are set again when the wavefront is shifted.
+ * Neither is the facet origin of edges, which is used
+ * while vertices are split only.
+ * Events are stored with their type and node only (like EventDAO),
+ * so offset polyhedrons of constant offset events are lost.
+ * Values are written in the byte order of the machine.
+ */
+class CheckpointFile {
+public:
+    virtual ~CheckpointFile();
+
+    static CheckpointFileSPtr create();
+
+    /**
+     * Returns an empty pointer if the file cannot be read.
+     */
+    static CheckpointFileSPtr load(const std::string& filename);
+
+    bool save(const std::string& filename) const;
+
+    PolyhedronSPtr getInput() const;
+    void setInput(PolyhedronSPtr input);
+    PolyhedronSPtr getPolyhedron() const;
+    void setPolyhedron(PolyhedronSPtr polyhedron);
+    StraightSkeletonSPtr getSkel() const;
+    void setSkel(StraightSkeletonSPtr skel);
+
+    double getOffset() const;
+    void setOffset(double offset);
+    unsigned int getNumBatches() const;
+    void setNumBatches(unsigned int num_batches);
+    std::list<double>& saveOffsets();
+
+    static const int MAGIC = 0x534b4350;  // "SKCP"
+    static const int VERSION = 1;
+
+protected:
+    CheckpointFile();
+
+    static void writeInt(std::ostream& os, int value);
+    static void writeDouble(std::ostream& os, double value);
+    static void writeString(std::ostream& os, const std::string& value);
+    static int readInt(std::istream& is);
+    static double readDouble(std::istream& is);
+    static std::string readString(std::istream& is);
+
+    /**
+     * Reads an index that has to be smaller than size.
+     * -1 is allowed for a missing element.
+     */
+    static int readIndex(std::istream& is, unsigned int size);
+
+    static void writePlane(std::ostream& os, Plane3SPtr plane);
+    static Plane3SPtr readPlane(std::istream& is);
+
+    /**
+     * Appends the element if it is not contained yet.
+     * Returns the index of the element or -1 for an empty pointer.
+     */
+    template<class T>
+    static int append(const T& element, std::vector<T>& elements,
+            std::map<T, int>& ids) {
+        if (!element) {
+            return -1;
+        }
+        typename std::map<T, int>::const_iterator it = ids.find(element);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        int result = elements.size();
+        elements.push_back(element);
+        ids[element] = result;
+        return result;
+    }
+
+    /**
+     * Returns -1 if the element is not contained.
+     */
+    template<class T>
+    static int indexOf(const T& element, const std::map<T, int>& ids) {
+        int result = -1;
+        if (element) {
+            typename std::map<T, int>::const_iterator it = ids.find(element);
+            if (it != ids.end()) {
+                result = it->second;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Returns the node of events that have one.
+     */
+    static NodeSPtr getNode(AbstractEventSPtr event);
+    static AbstractEventSPtr createEvent(int type, double offset, NodeSPtr node);
+
+    /**
+     * Writes the polyhedron and, if skel is set,
+     * the skeleton with the skeleton data of the polyhedron.
+     * Facets that are referenced by the skeleton data only
+     * are stored with their plane and data.
+     * Points are referenced by their index in the point table of the file.
+     */
+    static void writePolyhedron(std::ostream& os,
+            PolyhedronSPtr polyhedron, StraightSkeletonSPtr skel,
+            const std::map<Point3SPtr, int>& point_ids);
+
+    /**
+     * Counterpart of writePolyhedron.
+     * skel receives the skeleton if it was written.
+     */
+    static PolyhedronSPtr readPolyhedron(std::istream& is,
+            const std::vector<Point3SPtr>& points, StraightSkeletonSPtr skel);
+
+    PolyhedronSPtr input_;
+    PolyhedronSPtr polyhedron_;
+    StraightSkeletonSPtr skel_;
+    double offset_;
+    unsigned int num_batches_;
+    std::list<double> save_offsets_;
+};
+
+} }
+
+#endif /* DB_3D_CHECKPOINTFILE_H */
@@ -24,6 +24,7 @@
 #include "db/SQLiteStmt.h"
 #include "db/3d/NodeDAO.h"
 #include "db/3d/StraightSkeletonDAO.h"
+#include <iostream>
 
 namespace db { namespace _3d {
 
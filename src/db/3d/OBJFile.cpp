@@ -145,7 +145,7 @@ PolyhedronSPtr OBJFile::load(const std::string& filename) {
         }
         ifs.close();
         result->setDescription("filename='"+filename+"'; ");
-        std::list<EdgeSPtr>::iterator it_e = result->edges().begin();
+        util::SlotList<EdgeSPtr>::iterator it_e = result->edges().begin();
         while (it_e != result->edges().end()) {
             EdgeSPtr edge = *it_e++;
             if (!(edge->getFacetL() && edge->getFacetR())) {
@@ -173,7 +173,7 @@ bool OBJFile::save(const std::string& filename, PolyhedronSPtr polyhedron) {
     if (ofs.is_open()) {
         WriteLock l(polyhedron->mutex());
         unsigned int vertex_id = 0;
-        std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+        util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
         while (it_v != polyhedron->vertices().end()) {
             VertexSPtr vertex = *it_v++;
             vertex_id++;
@@ -183,7 +183,7 @@ bool OBJFile::save(const std::string& filename, PolyhedronSPtr polyhedron) {
                         << vertex->getZ() << "\n";
         }
         unsigned int facet_id = 0;
-        std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+        util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
         while (it_f != polyhedron->facets().end()) {
             FacetSPtr facet = *it_f++;
             facet->makeFirstConvex();
@@ -71,7 +71,7 @@ int PolyhedronDAO::insert(PolyhedronSPtr polyhedron) {
     int polyhedronid = createPolyhedronID(polyhedron);
     if (polyhedronid > 0) {
         VertexDAOSPtr dao_vertex = DAOFactory::getVertexDAO();
-        std::list<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+        util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
         while (it_v != polyhedron->vertices().end()) {
             VertexSPtr vertex = *it_v++;
             if (vertex->getID() > 0) {
@@ -81,7 +81,7 @@ int PolyhedronDAO::insert(PolyhedronSPtr polyhedron) {
             }
         }
         EdgeDAOSPtr dao_edge = DAOFactory::getEdgeDAO();
-        std::list<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+        util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
         while (it_e != polyhedron->edges().end()) {
             EdgeSPtr edge = *it_e++;
             if (edge->getID() > 0) {
@@ -91,7 +91,7 @@ int PolyhedronDAO::insert(PolyhedronSPtr polyhedron) {
             }
         }
         FacetDAOSPtr dao_facet = DAOFactory::getFacetDAO();
-        std::list<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+        util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
         while (it_f != polyhedron->facets().end()) {
             FacetSPtr facet = *it_f++;
             if (facet->getID() > 0) {
@@ -248,7 +248,7 @@ PolyhedronSPtr PolyhedronDAO::find(int polyhedronid) {
                 }
                 stmt_e->close();
             }
-            std::list<FacetSPtr>::iterator it_f = result->facets().begin();
+            util::SlotList<FacetSPtr>::iterator it_f = result->facets().begin();
             while (it_f != result->facets().end()) {
                 FacetSPtr facet = *it_f++;
                 facet->makeFirstConvex();
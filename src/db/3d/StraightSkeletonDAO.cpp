@@ -110,7 +110,7 @@ int StraightSkeletonDAO::insert(StraightSkeletonSPtr skel) {
     int skelid = createSkelID(skel);
     if (skelid > 0) {
         NodeDAOSPtr dao_node = DAOFactory::getNodeDAO();
-        std::list<NodeSPtr>::iterator it_n = skel->nodes().begin();
+        util::SlotList<NodeSPtr>::iterator it_n = skel->nodes().begin();
         while (it_n != skel->nodes().end()) {
             NodeSPtr node = *it_n++;
             if (node->getID() > 0) {
@@ -120,7 +120,7 @@ int StraightSkeletonDAO::insert(StraightSkeletonSPtr skel) {
             }
         }
         ArcDAOSPtr dao_arc = DAOFactory::getArcDAO();
-        std::list<ArcSPtr>::iterator it_a = skel->arcs().begin();
+        util::SlotList<ArcSPtr>::iterator it_a = skel->arcs().begin();
         while (it_a != skel->arcs().end()) {
             ArcSPtr arc = *it_a++;
             if (arc->getID() > 0) {
@@ -130,7 +130,7 @@ int StraightSkeletonDAO::insert(StraightSkeletonSPtr skel) {
             }
         }
         SheetDAOSPtr dao_sheet = DAOFactory::getSheetDAO();
-        std::list<SheetSPtr>::iterator it_s = skel->sheets().begin();
+        util::SlotList<SheetSPtr>::iterator it_s = skel->sheets().begin();
         while (it_s != skel->sheets().end()) {
             SheetSPtr sheet = *it_s++;
             if (sheet->getID() > 0) {
@@ -140,7 +140,7 @@ int StraightSkeletonDAO::insert(StraightSkeletonSPtr skel) {
             }
         }
         EventDAOSPtr dao_event = DAOFactory::getEventDAO();
-        std::list<AbstractEventSPtr>::iterator it_e = skel->events().begin();
+        util::SlotList<AbstractEventSPtr>::iterator it_e = skel->events().begin();
         while (it_e != skel->events().end()) {
             AbstractEventSPtr event = *it_e++;
             if (event->getID() > 0) {
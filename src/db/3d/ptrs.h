@@ -20,6 +20,8 @@ class SheetDAO;
 class EventDAO;
 class StraightSkeletonDAO;
 
+class CheckpointFile;
+
 typedef SHARED_PTR<PointDAO> PointDAOSPtr;
 typedef WEAK_PTR<PointDAO> PointDAOWPtr;
 typedef SHARED_PTR<PlaneDAO> PlaneDAOSPtr;
@@ -47,6 +49,9 @@ typedef WEAK_PTR<EventDAO> EventDAOWPtr;
 typedef SHARED_PTR<StraightSkeletonDAO> StraightSkeletonDAOSPtr;
 typedef WEAK_PTR<StraightSkeletonDAO> StraightSkeletonDAOWPtr;
 
+typedef SHARED_PTR<CheckpointFile> CheckpointFileSPtr;
+typedef WEAK_PTR<CheckpointFile> CheckpointFileWPtr;
+
 } }
 
 #endif /* DB_3D_PTRS_H */
@@ -8,18 +8,6 @@
 
 namespace kernel {
 
-Line2::Line2() {
-    this->a_ = 0.0;
-    this->b_ = 0.0;
-    this->c_ = 0.0;
-}
-
-Line2::Line2(const Line2& orig) {
-    this->a_ = orig.a_;
-    this->b_ = orig.b_;
-    this->c_ = orig.c_;
-}
-
 Line2::Line2(const Point2& p, const Point2& q) {
     a_ = p.getY() - q.getY();
     b_ = q.getX() - p.getX();
@@ -32,16 +20,6 @@ Line2::Line2(const Point2& p, const Vector2& direction) {
     c_ = - a_*p.getX() - b_*p.getY();
 }
 
-Line2::Line2(double a, double b, double c) {
-    a_ = a;
-    b_ = b;
-    c_ = c;
-}
-
-Line2::~Line2() {
-    // intentionally does nothing
-}
-
 double Line2::getA() const {
     return this->a_;
 }
@@ -17,12 +17,10 @@ namespace kernel {
  */
 class Line2 {
 public:
-    Line2();
-    Line2(const Line2& orig);
+    constexpr Line2() : a_(0.0), b_(0.0), c_(0.0) {}
     Line2(const Point2& p, const Point2& q);
     Line2(const Point2& p, const Vector2& direction);
-    Line2(double a, double b, double c);
-    virtual ~Line2();
+    constexpr Line2(double a, double b, double c) : a_(a), b_(b), c_(c) {}
     double getA() const;
     double getB() const;
     double getC() const;
@@ -14,19 +14,17 @@ namespace kernel {
 
 class Line3 {
 public:
-    Line3();
-    Line3(const Line3& orig);
+    constexpr Line3() : p_(), dir_() {}
     Line3(const Point3& p, const Point3& q);
-    Line3(const Point3& p, const Vector3& dir);
-    virtual ~Line3();
+    constexpr Line3(const Point3& p, const Vector3& dir) : p_(p), dir_(dir) {}
     Point3 point() const;
     Vector3 direction() const;
     Line3 opposite() const;
     bool hasOn(const Point3& point) const;
     bool operator==(const Line3& l) const;
 protected:
-    Point3* p_;
-    Vector3* dir_;
+    Point3 p_;
+    Vector3 dir_;
 };
 
 }
@@ -6,21 +6,9 @@
 
 #include "kernel/Plane3.h"
 
-namespace kernel {
-
-Plane3::Plane3() {
-    this->a_ = 0.0;
-    this->b_ = 0.0;
-    this->c_ = 0.0;
-    this->d_ = 0.0;
-}
+#include "kernel/predicates.h"
 
-Plane3::Plane3(const Plane3& orig) {
-    this->a_ = orig.a_;
-    this->b_ = orig.b_;
-    this->c_ = orig.c_;
-    this->d_ = orig.d_;
-}
+namespace kernel {
 
 /*!
  *                        ^(-1)
@@ -45,17 +33,6 @@ Plane3::Plane3(const Point3& p, const Vector3& normal) {
     d_ = - a_*p.getX() - b_*p.getY() - c_*p.getZ();
 }
 
-Plane3::Plane3(double a, double b, double c, double d) {
-    this->a_ = a;
-    this->b_ = b;
-    this->c_ = c;
-    this->d_ = d;
-}
-
-Plane3::~Plane3() {
-    // intentionally does nothing
-}
-
 double Plane3::getA() const {
     return this->a_;
 }
@@ -96,17 +73,7 @@ Plane3 Plane3::opposite() const {
 }
 
 int Plane3::side(const Point3& p) const {
-    int result = 0;
-    double x = p.getX();
-    double y = p.getY();
-    double z = p.getZ();
-    double dist = a_*x + b_*y + c_*z + d_;
-    if (dist > 0.0) {
-        result = 1;
-    } else if (dist < 0.0) {
-        result = -1;
-    }
-    return result;
+    return kernel::side(*this, p);
 }
 
 bool Plane3::operator==(const Plane3& plane) const {
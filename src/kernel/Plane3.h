@@ -17,12 +17,10 @@ namespace kernel {
  */
 class Plane3 {
 public:
-    Plane3();
-    Plane3(const Plane3& orig);
+    constexpr Plane3() : a_(0.0), b_(0.0), c_(0.0), d_(0.0) {}
     Plane3(const Point3& p, const Point3& q, const Point3& r);
     Plane3(const Point3& p, const Vector3& normal);
-    Plane3(double a, double b, double c, double d);
-    virtual ~Plane3();
+    constexpr Plane3(double a, double b, double c, double d) : a_(a), b_(b), c_(c), d_(d) {}
     double getA() const;
     double getB() const;
     double getC() const;
@@ -30,6 +28,9 @@ public:
     Vector3 normal() const;
     Point3 point() const;
     Plane3 opposite() const;
+    /*!
+     * Exact sign of a*x + b*y + c*z + d (see predicates.h).
+     */
     int side(const Point3& p) const;
     bool operator==(const Plane3& plane) const;
 protected:
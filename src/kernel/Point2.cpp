@@ -10,25 +10,6 @@
 
 namespace kernel {
 
-Point2::Point2() {
-    this->x_ = 0.0;
-    this->y_ = 0.0;
-}
-
-Point2::Point2(double x, double y) {
-    this->x_ = x;
-    this->y_ = y;
-}
-
-Point2::Point2(const Point2& orig) {
-    this->x_ = orig.x_;
-    this->y_ = orig.y_;
-}
-
-Point2::~Point2() {
-    // intentionally does nothing
-}
-
 double Point2::getX(void) const {
     return this->x_;
 }
@@ -13,10 +13,8 @@ namespace kernel {
 
 class Point2 {
 public:
-    Point2();
-    Point2(double x, double y);
-    Point2(const Point2& orig);
-    virtual ~Point2();
+    constexpr Point2() : x_(0.0), y_(0.0) {}
+    constexpr Point2(double x, double y) : x_(x), y_(y) {}
     double getX(void) const;
     double getY(void) const;
     double operator[](unsigned int i) const;
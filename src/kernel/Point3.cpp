@@ -10,28 +10,6 @@
 
 namespace kernel {
 
-Point3::Point3() {
-    this->x_ = 0.0;
-    this->y_ = 0.0;
-    this->z_ = 0.0;
-}
-
-Point3::Point3(double x, double y, double z) {
-    this->x_ = x;
-    this->y_ = y;
-    this->z_ = z;
-}
-
-Point3::Point3(const Point3& orig) {
-    this->x_ = orig.x_;
-    this->y_ = orig.y_;
-    this->z_ = orig.z_;
-}
-
-Point3::~Point3() {
-    // intentionally does nothing
-}
-
 double Point3::getX(void) const {
     return this->x_;
 }
@@ -13,10 +13,8 @@ namespace kernel {
 
 class Point3 {
 public:
-    Point3();
-    Point3(double x, double y, double z);
-    Point3(const Point3& orig);
-    virtual ~Point3();
+    constexpr Point3() : x_(0.0), y_(0.0), z_(0.0) {}
+    constexpr Point3(double x, double y, double z) : x_(x), y_(y), z_(z) {}
     double getX(void) const;
     double getY(void) const;
     double getZ(void) const;
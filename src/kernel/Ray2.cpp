@@ -8,24 +8,4 @@
 
 namespace kernel {
 
-Ray2::Ray2() {
-    this->point_ = new Point2();
-    this->direction_ = new Vector2();
-}
-
-Ray2::Ray2(const Point2& point, const Vector2& direction) {
-    this->point_ = new Point2(point);
-    this->direction_ = new Vector2(direction);
-}
-
-Ray2::Ray2(const Ray2& orig) {
-    this->point_ = new Point2(*(orig.point_));
-    this->direction_ = new Vector2(*(orig.direction_));
-}
-
-Ray2::~Ray2() {
-    delete this->point_;
-    delete this->direction_;
-}
-
 }
@@ -14,13 +14,12 @@ namespace kernel {
 
 class Ray2 {
 public:
-    Ray2();
-    Ray2(const Point2& point, const Vector2& direction);
-    Ray2(const Ray2& orig);
-    virtual ~Ray2();
+    constexpr Ray2() : point_(), direction_() {}
+    constexpr Ray2(const Point2& point, const Vector2& direction) :
+            point_(point), direction_(direction) {}
 protected:
-    Point2* point_;
-    Vector2* direction_;
+    Point2 point_;
+    Vector2 direction_;
 };
 
 }
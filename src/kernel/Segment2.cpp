@@ -13,15 +13,6 @@ Segment2::Segment2(const Point2& p, const Point2& q) {
     this->q_ = &q;
 }
 
-Segment2::Segment2(const Segment2& orig) {
-    this->p_ = orig.p_;
-    this->q_ = orig.q_;
-}
-
-Segment2::~Segment2() {
-    // intentionally does nothing
-}
-
 const Point2& Segment2::getP() const {
     return *(this->p_);
 }
@@ -15,8 +15,6 @@ namespace kernel {
 class Segment2 {
 public:
     Segment2(const Point2& p, const Point2& q);
-    Segment2(const Segment2& orig);
-    virtual ~Segment2();
     const Point2& getP() const;
     const Point2& getQ() const;
     void setP(const Point2& p);
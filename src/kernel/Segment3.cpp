@@ -13,15 +13,6 @@ Segment3::Segment3(const Point3& p, const Point3& q) {
     this->q_ = &q;
 }
 
-Segment3::Segment3(const Segment3& orig) {
-    this->p_ = orig.p_;
-    this->q_ = orig.q_;
-}
-
-Segment3::~Segment3() {
-    // intentionally does nothing
-}
-
 const Point3& Segment3::getP() const {
     return *(this->p_);
 }
@@ -15,8 +15,6 @@ namespace kernel {
 class Segment3 {
 public:
     Segment3(const Point3& p, const Point3& q);
-    Segment3(const Segment3& orig);
-    virtual ~Segment3();
     const Point3& getP() const;
     const Point3& getQ() const;
     void setP(const Point3& p);
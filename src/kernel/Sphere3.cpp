@@ -13,15 +13,6 @@ Sphere3::Sphere3(const Point3& center, double radius) {
     this->radius_ = radius;
 }
 
-Sphere3::Sphere3(const Sphere3& orig) {
-    this->center_ = orig.center_;
-    this->radius_ = orig.radius_;
-}
-
-Sphere3::~Sphere3() {
-    // intentionally does nothing
-}
-
 const Point3& Sphere3::getCenter() const {
     return *(this->center_);
 }
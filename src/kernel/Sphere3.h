@@ -13,9 +13,7 @@ namespace kernel {
 
 class Sphere3 {
 public:
-    Sphere3(const Sphere3& orig);
     Sphere3(const Point3& center, double radius);
-    virtual ~Sphere3();
     const Point3& getCenter() const;
     double getRadius() const;
     void setCenter(const Point3& center);
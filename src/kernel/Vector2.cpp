@@ -11,27 +11,6 @@
 
 namespace kernel {
 
-Vector2::Vector2() {
-    for (int i = 0; i < 2; i++) {
-        this->v_[i] = 0.0;
-    }
-}
-
-Vector2::Vector2(double x, double y) {
-    this->v_[0] = x;
-    this->v_[1] = y;
-}
-
-Vector2::Vector2(const Vector2& orig) {
-    for (int i = 0; i < 2; i++) {
-        this->v_[i] = orig.v_[i];
-    }
-}
-
-Vector2::~Vector2() {
-    // intentionally does nothing
-}
-
 double Vector2::operator[](unsigned int i) const {
     if (i >= 2) {
         throw std::out_of_range("Index out of bounds.");
@@ -11,10 +11,8 @@ namespace kernel {
 
 class Vector2 {
 public:
-    Vector2();
-    Vector2(double x, double y);
-    Vector2(const Vector2& orig);
-    virtual ~Vector2();
+    constexpr Vector2() : v_{0.0, 0.0} {}
+    constexpr Vector2(double x, double y) : v_{x, y} {}
 
     double operator[](unsigned int i) const;
     double squared_length(void) const;
@@ -11,28 +11,6 @@
 
 namespace kernel {
 
-Vector3::Vector3() {
-    for (int i = 0; i < 3; i++) {
-        this->v_[i] = 0.0;
-    }
-}
-
-Vector3::Vector3(double x, double y, double z) {
-    this->v_[0] = x;
-    this->v_[1] = y;
-    this->v_[2] = z;
-}
-
-Vector3::Vector3(const Vector3& orig) {
-    for (int i = 0; i < 3; i++) {
-        this->v_[i] = orig.v_[i];
-    }
-}
-
-Vector3::~Vector3() {
-    // intentionally does nothing
-}
-
 double Vector3::operator[](unsigned int i) const {
     if (i >= 3) {
         throw std::out_of_range("Index out of bounds.");
@@ -11,10 +11,8 @@ namespace kernel {
 
 class Vector3 {
 public:
-    Vector3();
-    Vector3(double x, double y, double z);
-    Vector3(const Vector3& orig);
-    virtual ~Vector3();
+    constexpr Vector3() : v_{0.0, 0.0, 0.0} {}
+    constexpr Vector3(double x, double y, double z) : v_{x, y, z} {}
 
     double operator[](unsigned int i) const;
     double squared_length(void) const;
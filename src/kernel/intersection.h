@@ -12,6 +12,7 @@
 #include "kernel/Point3.h"
 #include "kernel/Line3.h"
 #include "kernel/Plane3.h"
+#include <optional>
 
 namespace kernel {
 
@@ -21,6 +22,17 @@ Point3* intersection(const Plane3* p1, const Plane3* p2, const Plane3* p3);
 Line3* intersection(const Plane3* p1, const Plane3* p2);
 Point3* intersection(const Plane3* plane, const Line3* line);
 
+/*
+ * The following return their result by value and do not allocate.
+ * Passing the same object more than once results in no intersection,
+ * just like passing the same pointer to the functions above.
+ */
+std::optional<Point2> intersection(const Line2& l1, const Line2& l2);
+
+std::optional<Point3> intersection(const Plane3& p1, const Plane3& p2, const Plane3& p3);
+std::optional<Line3> intersection(const Plane3& p1, const Plane3& p2);
+std::optional<Point3> intersection(const Plane3& plane, const Line3& line);
+
 }
 
 #endif /* INTERSECTION_H */
@@ -0,0 +1,238 @@
+/**
+ * @file   kernel/intersection_batch.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#include "kernel/intersection_batch.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define KERNEL_X86_SIMD
+    #include <immintrin.h>
+#endif
+
+namespace kernel {
+
+static SimdLevel detectSimdLevel() {
+    SimdLevel result = SIMD_SCALAR;
+#ifdef KERNEL_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        result = SIMD_AVX2;
+    } else if (__builtin_cpu_supports("sse2")) {
+        result = SIMD_SSE2;
+    }
+#endif
+    return result;
+}
+
+SimdLevel simdLevelSupported() {
+    static const SimdLevel result = detectSimdLevel();
+    return result;
+}
+
+const char* simdLevelName(SimdLevel level) {
+    const char* result = "scalar";
+    if (level == SIMD_SSE2) {
+        result = "sse2";
+    } else if (level == SIMD_AVX2) {
+        result = "avx2";
+    }
+    return result;
+}
+
+/*!
+ * Triple i, computed like intersection(const Plane3&, const Plane3&, const Plane3&).
+ */
+static inline unsigned char intersectionScalar(size_t i, const PlaneTriples& planes,
+        double* x, double* y, double* z) {
+    double a1 = planes.a[0][i], b1 = planes.b[0][i], c1 = planes.c[0][i], d1 = planes.d[0][i];
+    double a2 = planes.a[1][i], b2 = planes.b[1][i], c2 = planes.c[1][i], d2 = planes.d[1][i];
+    double a3 = planes.a[2][i], b3 = planes.b[2][i], c3 = planes.c[2][i], d3 = planes.d[2][i];
+    // Sarrus
+    double det = a1 * b2 * c3
+            + b1 * c2 * a3
+            + c1 * a2 * b3
+            - a3 * b2 * c1
+            - b3 * c2 * a1
+            - c3 * a2 * b1;
+    if (det == 0.0) {
+        return 0;
+    }
+    x[i] = (-(b2*c3 - c2*b3) * d1
+            - (c1*b3 - b1*c3) * d2
+            - (b1*c2 - c1*b2) * d3)
+                / det;
+    y[i] = (-(c2*a3 - a2*c3) * d1
+            - (a1*c3 - c1*a3) * d2
+            - (c1*a2 - a1*c2) * d3)
+                / det;
+    z[i] = (-(a2*b3 - b2*a3) * d1
+            - (b1*a3 - a1*b3) * d2
+            - (a1*b2 - b1*a2) * d3)
+                / det;
+    return 1;
+}
+
+static size_t intersectionScalar(size_t begin, size_t n, const PlaneTriples& planes,
+        double* x, double* y, double* z, unsigned char* valid) {
+    size_t result = 0;
+    for (size_t i = begin; i < n; i++) {
+        valid[i] = intersectionScalar(i, planes, x, y, z);
+        result += valid[i];
+    }
+    return result;
+}
+
+#ifdef KERNEL_X86_SIMD
+
+/*
+ * The vectorized versions do the same operations in the same order
+ * as the scalar one. There is no FMA, so the results are the same.
+ */
+
+__attribute__((target("sse2")))
+static size_t intersectionSSE2(size_t n, const PlaneTriples& planes,
+        double* x, double* y, double* z, unsigned char* valid) {
+    size_t result = 0;
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d sign = _mm_set1_pd(-0.0);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d a1 = _mm_loadu_pd(planes.a[0] + i);
+        __m128d b1 = _mm_loadu_pd(planes.b[0] + i);
+        __m128d c1 = _mm_loadu_pd(planes.c[0] + i);
+        __m128d d1 = _mm_loadu_pd(planes.d[0] + i);
+        __m128d a2 = _mm_loadu_pd(planes.a[1] + i);
+        __m128d b2 = _mm_loadu_pd(planes.b[1] + i);
+        __m128d c2 = _mm_loadu_pd(planes.c[1] + i);
+        __m128d d2 = _mm_loadu_pd(planes.d[1] + i);
+        __m128d a3 = _mm_loadu_pd(planes.a[2] + i);
+        __m128d b3 = _mm_loadu_pd(planes.b[2] + i);
+        __m128d c3 = _mm_loadu_pd(planes.c[2] + i);
+        __m128d d3 = _mm_loadu_pd(planes.d[2] + i);
+
+        __m128d det = _mm_mul_pd(_mm_mul_pd(a1, b2), c3);
+        det = _mm_add_pd(det, _mm_mul_pd(_mm_mul_pd(b1, c2), a3));
+        det = _mm_add_pd(det, _mm_mul_pd(_mm_mul_pd(c1, a2), b3));
+        det = _mm_sub_pd(det, _mm_mul_pd(_mm_mul_pd(a3, b2), c1));
+        det = _mm_sub_pd(det, _mm_mul_pd(_mm_mul_pd(b3, c2), a1));
+        det = _mm_sub_pd(det, _mm_mul_pd(_mm_mul_pd(c3, a2), b1));
+
+        __m128d t1 = _mm_xor_pd(_mm_sub_pd(_mm_mul_pd(b2, c3), _mm_mul_pd(c2, b3)), sign);
+        __m128d t2 = _mm_sub_pd(_mm_mul_pd(c1, b3), _mm_mul_pd(b1, c3));
+        __m128d t3 = _mm_sub_pd(_mm_mul_pd(b1, c2), _mm_mul_pd(c1, b2));
+        __m128d px = _mm_sub_pd(_mm_sub_pd(_mm_mul_pd(t1, d1),
+                _mm_mul_pd(t2, d2)), _mm_mul_pd(t3, d3));
+        t1 = _mm_xor_pd(_mm_sub_pd(_mm_mul_pd(c2, a3), _mm_mul_pd(a2, c3)), sign);
+        t2 = _mm_sub_pd(_mm_mul_pd(a1, c3), _mm_mul_pd(c1, a3));
+        t3 = _mm_sub_pd(_mm_mul_pd(c1, a2), _mm_mul_pd(a1, c2));
+        __m128d py = _mm_sub_pd(_mm_sub_pd(_mm_mul_pd(t1, d1),
+                _mm_mul_pd(t2, d2)), _mm_mul_pd(t3, d3));
+        t1 = _mm_xor_pd(_mm_sub_pd(_mm_mul_pd(a2, b3), _mm_mul_pd(b2, a3)), sign);
+        t2 = _mm_sub_pd(_mm_mul_pd(b1, a3), _mm_mul_pd(a1, b3));
+        t3 = _mm_sub_pd(_mm_mul_pd(a1, b2), _mm_mul_pd(b1, a2));
+        __m128d pz = _mm_sub_pd(_mm_sub_pd(_mm_mul_pd(t1, d1),
+                _mm_mul_pd(t2, d2)), _mm_mul_pd(t3, d3));
+
+        _mm_storeu_pd(x + i, _mm_div_pd(px, det));
+        _mm_storeu_pd(y + i, _mm_div_pd(py, det));
+        _mm_storeu_pd(z + i, _mm_div_pd(pz, det));
+        int mask = _mm_movemask_pd(_mm_cmpneq_pd(det, zero));
+        valid[i] = mask & 1;
+        valid[i+1] = (mask >> 1) & 1;
+        result += valid[i] + valid[i+1];
+    }
+    result += intersectionScalar(i, n, planes, x, y, z, valid);
+    return result;
+}
+
+__attribute__((target("avx2")))
+static size_t intersectionAVX2(size_t n, const PlaneTriples& planes,
+        double* x, double* y, double* z, unsigned char* valid) {
+    size_t result = 0;
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d a1 = _mm256_loadu_pd(planes.a[0] + i);
+        __m256d b1 = _mm256_loadu_pd(planes.b[0] + i);
+        __m256d c1 = _mm256_loadu_pd(planes.c[0] + i);
+        __m256d d1 = _mm256_loadu_pd(planes.d[0] + i);
+        __m256d a2 = _mm256_loadu_pd(planes.a[1] + i);
+        __m256d b2 = _mm256_loadu_pd(planes.b[1] + i);
+        __m256d c2 = _mm256_loadu_pd(planes.c[1] + i);
+        __m256d d2 = _mm256_loadu_pd(planes.d[1] + i);
+        __m256d a3 = _mm256_loadu_pd(planes.a[2] + i);
+        __m256d b3 = _mm256_loadu_pd(planes.b[2] + i);
+        __m256d c3 = _mm256_loadu_pd(planes.c[2] + i);
+        __m256d d3 = _mm256_loadu_pd(planes.d[2] + i);
+
+        __m256d det = _mm256_mul_pd(_mm256_mul_pd(a1, b2), c3);
+        det = _mm256_add_pd(det, _mm256_mul_pd(_mm256_mul_pd(b1, c2), a3));
+        det = _mm256_add_pd(det, _mm256_mul_pd(_mm256_mul_pd(c1, a2), b3));
+        det = _mm256_sub_pd(det, _mm256_mul_pd(_mm256_mul_pd(a3, b2), c1));
+        det = _mm256_sub_pd(det, _mm256_mul_pd(_mm256_mul_pd(b3, c2), a1));
+        det = _mm256_sub_pd(det, _mm256_mul_pd(_mm256_mul_pd(c3, a2), b1));
+
+        __m256d t1 = _mm256_xor_pd(_mm256_sub_pd(
+                _mm256_mul_pd(b2, c3), _mm256_mul_pd(c2, b3)), sign);
+        __m256d t2 = _mm256_sub_pd(_mm256_mul_pd(c1, b3), _mm256_mul_pd(b1, c3));
+        __m256d t3 = _mm256_sub_pd(_mm256_mul_pd(b1, c2), _mm256_mul_pd(c1, b2));
+        __m256d px = _mm256_sub_pd(_mm256_sub_pd(_mm256_mul_pd(t1, d1),
+                _mm256_mul_pd(t2, d2)), _mm256_mul_pd(t3, d3));
+        t1 = _mm256_xor_pd(_mm256_sub_pd(
+                _mm256_mul_pd(c2, a3), _mm256_mul_pd(a2, c3)), sign);
+        t2 = _mm256_sub_pd(_mm256_mul_pd(a1, c3), _mm256_mul_pd(c1, a3));
+        t3 = _mm256_sub_pd(_mm256_mul_pd(c1, a2), _mm256_mul_pd(a1, c2));
+        __m256d py = _mm256_sub_pd(_mm256_sub_pd(_mm256_mul_pd(t1, d1),
+                _mm256_mul_pd(t2, d2)), _mm256_mul_pd(t3, d3));
+        t1 = _mm256_xor_pd(_mm256_sub_pd(
+                _mm256_mul_pd(a2, b3), _mm256_mul_pd(b2, a3)), sign);
+        t2 = _mm256_sub_pd(_mm256_mul_pd(b1, a3), _mm256_mul_pd(a1, b3));
+        t3 = _mm256_sub_pd(_mm256_mul_pd(a1, b2), _mm256_mul_pd(b1, a2));
+        __m256d pz = _mm256_sub_pd(_mm256_sub_pd(_mm256_mul_pd(t1, d1),
+                _mm256_mul_pd(t2, d2)), _mm256_mul_pd(t3, d3));
+
+        _mm256_storeu_pd(x + i, _mm256_div_pd(px, det));
+        _mm256_storeu_pd(y + i, _mm256_div_pd(py, det));
+        _mm256_storeu_pd(z + i, _mm256_div_pd(pz, det));
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(det, zero, _CMP_NEQ_UQ));
+        for (unsigned int j = 0; j < 4; j++) {
+            valid[i+j] = (mask >> j) & 1;
+            result += valid[i+j];
+        }
+    }
+    result += intersectionScalar(i, n, planes, x, y, z, valid);
+    return result;
+}
+
+#endif
+
+size_t intersection(size_t n, const PlaneTriples& planes,
+        double* x, double* y, double* z, unsigned char* valid) {
+    return intersection(n, planes, x, y, z, valid, simdLevelSupported());
+}
+
+size_t intersection(size_t n, const PlaneTriples& planes,
+        double* x, double* y, double* z, unsigned char* valid,
+        SimdLevel level) {
+    size_t result = 0;
+    if (level > simdLevelSupported()) {
+        level = simdLevelSupported();
+    }
+#ifdef KERNEL_X86_SIMD
+    if (level == SIMD_AVX2) {
+        result = intersectionAVX2(n, planes, x, y, z, valid);
+    } else if (level == SIMD_SSE2) {
+        result = intersectionSSE2(n, planes, x, y, z, valid);
+    } else {
+        result = intersectionScalar(0, n, planes, x, y, z, valid);
+    }
+#else
+    result = intersectionScalar(0, n, planes, x, y, z, valid);
+#endif
+    return result;
+}
+
+}
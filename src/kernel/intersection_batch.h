@@ -0,0 +1,67 @@
+/**
+ * @file   kernel/intersection_batch.h
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#ifndef INTERSECTION_BATCH_H
+#define INTERSECTION_BATCH_H
+
+#include <cstddef>
+
+namespace kernel {
+
+/*!
+ * Instruction sets the batched intersection can use.
+ */
+enum SimdLevel {
+    SIMD_SCALAR = 0,
+    SIMD_SSE2 = 1,
+    SIMD_AVX2 = 2
+};
+
+/*!
+ * The best instruction set the CPU supports, detected once at runtime.
+ */
+SimdLevel simdLevelSupported();
+
+const char* simdLevelName(SimdLevel level);
+
+/*!
+ * Coefficients of n triples of planes in separate arrays (SoA):
+ * a[j][i]*x + b[j][i]*y + c[j][i]*z + d[j][i] = 0
+ * is plane j (0, 1 or 2) of triple i.
+ */
+class PlaneTriples {
+public:
+    const double* a[3];
+    const double* b[3];
+    const double* c[3];
+    const double* d[3];
+};
+
+/*!
+ * Intersects the 3 planes of each of n triples.
+ * The arithmetic is the same as the one of
+ * intersection(const Plane3&, const Plane3&, const Plane3&),
+ * so the points are the same bit by bit.
+ * valid[i] is 0 if the determinant of triple i is 0,
+ * x[i], y[i] and z[i] are undefined then.
+ * Unlike the function for a single triple, planes that are equal up
+ * to a factor are not rejected unless their determinant is 0.
+ * Returns the number of valid triples.
+ */
+size_t intersection(size_t n, const PlaneTriples& planes,
+        double* x, double* y, double* z, unsigned char* valid);
+
+/*!
+ * Same as above, but with the given instruction set
+ * (or the best supported one below it).
+ */
+size_t intersection(size_t n, const PlaneTriples& planes,
+        double* x, double* y, double* z, unsigned char* valid,
+        SimdLevel level);
+
+}
+
+#endif /* INTERSECTION_BATCH_H */
@@ -0,0 +1,234 @@
+/**
+ * @file   kernel/predicates.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#include "kernel/predicates.h"
+
+#include <cmath>
+
+namespace kernel {
+
+/*!
+ * Half of the machine epsilon: |fl(a op b) - (a op b)| <= EPS*|a op b|
+ */
+static const double EPS = 1.1102230246251565e-16;    // 2^-53
+
+/*!
+ * 2^27 + 1, splits a double into two halves of 26 bits.
+ */
+static const double SPLITTER = 134217729.0;
+
+/*!
+ * Error bound of the dot product of length 4 (gamma_4),
+ * enlarged for the rounding of the magnitude itself.
+ */
+static const double SIDE_ERRBOUND = (4.0 + 32.0 * EPS) * EPS;
+
+/*!
+ * Error bound of orient3d (Shewchuk's o3derrboundA).
+ */
+static const double ORIENTATION_ERRBOUND = (7.0 + 56.0 * EPS) * EPS;
+
+/*!
+ * Maximal number of components of an expansion.
+ * The orientation has 24 products of 3 factors with 4 components each.
+ */
+static const unsigned int EXPANSION_MAX = 96;
+
+/*!
+ * a + b = x + y exactly
+ */
+static inline void twoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double b_virt = x - a;
+    double a_virt = x - b_virt;
+    double b_roundoff = b - b_virt;
+    double a_roundoff = a - a_virt;
+    y = a_roundoff + b_roundoff;
+}
+
+static inline void split(double a, double& a_hi, double& a_lo) {
+    double c = SPLITTER * a;
+    double a_big = c - a;
+    a_hi = c - a_big;
+    a_lo = a - a_hi;
+}
+
+/*!
+ * a * b = x + y exactly
+ */
+static inline void twoProduct(double a, double b, double& x, double& y) {
+    x = a * b;
+    double a_hi, a_lo, b_hi, b_lo;
+    split(a, a_hi, a_lo);
+    split(b, b_hi, b_lo);
+    double err1 = x - (a_hi * b_hi);
+    double err2 = err1 - (a_lo * b_hi);
+    double err3 = err2 - (a_hi * b_lo);
+    y = (a_lo * b_lo) - err3;
+}
+
+/*!
+ * Exact sum of doubles.
+ * The components are non-overlapping and sorted by magnitude,
+ * zeros are eliminated (Shewchuk's Grow-Expansion).
+ */
+class Expansion {
+public:
+    Expansion() : length_(0) {}
+
+    void add(double b) {
+        double q = b;
+        unsigned int length = 0;
+        for (unsigned int i = 0; i < length_; i++) {
+            double sum, err;
+            twoSum(q, components_[i], sum, err);
+            q = sum;
+            if (err != 0.0) {
+                components_[length++] = err;
+            }
+        }
+        if (q != 0.0) {
+            components_[length++] = q;
+        }
+        length_ = length;
+    }
+
+    /*!
+     * Adds sign * a * b * c.
+     */
+    void addProduct(double sign, double a, double b, double c) {
+        double ab, ab_err;
+        twoProduct(a, b, ab, ab_err);
+        double x, y;
+        twoProduct(ab, c, x, y);
+        add(sign * y);
+        add(sign * x);
+        twoProduct(ab_err, c, x, y);
+        add(sign * y);
+        add(sign * x);
+    }
+
+    int sign() const {
+        int result = 0;
+        if (length_ > 0) {
+            double most_significant = components_[length_-1];
+            if (most_significant > 0.0) {
+                result = 1;
+            } else if (most_significant < 0.0) {
+                result = -1;
+            }
+        }
+        return result;
+    }
+
+protected:
+    double components_[EXPANSION_MAX + 1];
+    unsigned int length_;
+};
+
+static int sideExact(const Plane3& plane, const Point3& point) {
+    Expansion sum;
+    double x, y;
+    twoProduct(plane.getA(), point.getX(), x, y);
+    sum.add(y);
+    sum.add(x);
+    twoProduct(plane.getB(), point.getY(), x, y);
+    sum.add(y);
+    sum.add(x);
+    twoProduct(plane.getC(), point.getZ(), x, y);
+    sum.add(y);
+    sum.add(x);
+    sum.add(plane.getD());
+    return sum.sign();
+}
+
+int side(const Plane3& plane, const Point3& point) {
+    double ax = plane.getA() * point.getX();
+    double by = plane.getB() * point.getY();
+    double cz = plane.getC() * point.getZ();
+    double d = plane.getD();
+    double dist = ax + by + cz + d;
+    double errbound = SIDE_ERRBOUND * (fabs(ax) + fabs(by) + fabs(cz) + fabs(d));
+    int result = 0;
+    if (dist > errbound) {
+        result = 1;
+    } else if (-dist > errbound) {
+        result = -1;
+    } else {
+        result = sideExact(plane, point);
+    }
+    return result;
+}
+
+/*!
+ * Adds sign * |p, q, r| (the determinant of the coordinates).
+ */
+static void addDeterminant(Expansion& sum, double sign,
+        const Point3& p, const Point3& q, const Point3& r) {
+    sum.addProduct(sign, p.getX(), q.getY(), r.getZ());
+    sum.addProduct(sign, q.getX(), r.getY(), p.getZ());
+    sum.addProduct(sign, r.getX(), p.getY(), q.getZ());
+    sum.addProduct(-sign, r.getX(), q.getY(), p.getZ());
+    sum.addProduct(-sign, q.getX(), p.getY(), r.getZ());
+    sum.addProduct(-sign, p.getX(), r.getY(), q.getZ());
+}
+
+/*!
+ *     |pa-pd|   |pa 1|
+ *     |pb-pd| = |pb 1|
+ *     |pc-pd|   |pc 1|
+ *               |pd 1|
+ * The 4x4 determinant is expanded along the last column,
+ * so no difference of coordinates has to be rounded.
+ */
+static int orientationExact(const Point3& pa, const Point3& pb, const Point3& pc,
+        const Point3& pd) {
+    Expansion sum;
+    addDeterminant(sum, -1.0, pb, pc, pd);
+    addDeterminant(sum, 1.0, pa, pc, pd);
+    addDeterminant(sum, -1.0, pa, pb, pd);
+    addDeterminant(sum, 1.0, pa, pb, pc);
+    return sum.sign();
+}
+
+int orientation(const Point3& pa, const Point3& pb, const Point3& pc,
+        const Point3& pd) {
+    double adx = pa.getX() - pd.getX();
+    double bdx = pb.getX() - pd.getX();
+    double cdx = pc.getX() - pd.getX();
+    double ady = pa.getY() - pd.getY();
+    double bdy = pb.getY() - pd.getY();
+    double cdy = pc.getY() - pd.getY();
+    double adz = pa.getZ() - pd.getZ();
+    double bdz = pb.getZ() - pd.getZ();
+    double cdz = pc.getZ() - pd.getZ();
+
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+
+    double det = adz * (bdxcdy - cdxbdy)
+            + bdz * (cdxady - adxcdy)
+            + cdz * (adxbdy - bdxady);
+    double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * fabs(adz)
+            + (fabs(cdxady) + fabs(adxcdy)) * fabs(bdz)
+            + (fabs(adxbdy) + fabs(bdxady)) * fabs(cdz);
+    double errbound = ORIENTATION_ERRBOUND * permanent;
+    int result = 0;
+    if (det > errbound) {
+        result = 1;
+    } else if (-det > errbound) {
+        result = -1;
+    } else {
+        result = orientationExact(pa, pb, pc, pd);
+    }
+    return result;
+}
+
+}
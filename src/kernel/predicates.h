@@ -0,0 +1,40 @@
+/**
+ * @file   kernel/predicates.h
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#ifndef PREDICATES_H
+#define PREDICATES_H
+
+#include "kernel/Point3.h"
+#include "kernel/Plane3.h"
+
+namespace kernel {
+
+/*!
+ * Filtered exact predicates.
+ * The result is evaluated in doubles first, together with a bound
+ * of its rounding error. Only if the sign is not certain,
+ * it is evaluated again with exact expansion arithmetic
+ * (J. R. Shewchuk: Adaptive Precision Floating-Point Arithmetic
+ * and Fast Robust Geometric Predicates, 1997).
+ * The input coordinates are taken as exact. Overflow and underflow
+ * in the products are not handled.
+ */
+
+/*!
+ * Sign of a*x + b*y + c*z + d.
+ */
+int side(const Plane3& plane, const Point3& point);
+
+/*!
+ * Sign of the determinant |pa-pd, pb-pd, pc-pd|.
+ * Positive if pc is on the positive side of Plane3(pd, pa, pb).
+ */
+int orientation(const Point3& pa, const Point3& pb, const Point3& pc,
+        const Point3& pd);
+
+}
+
+#endif /* PREDICATES_H */
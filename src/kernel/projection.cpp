@@ -11,24 +11,37 @@
 namespace kernel {
 
 Point2* projection(const Line2* line, const Point2* point) {
-    Point2 p_line = line->point();
-    Vector2 normal = line->normal().normalize();
-    Point2 result = *point - (normal * ((*point - p_line) * normal));
-    return new Point2(result);
+    return new Point2(projection(*line, *point));
 }
 
 Point3* projection(const Plane3* plane, const Point3* point) {
-    Point3 p_plane = plane->point();
-    Vector3 normal = plane->normal().normalize();
-    Point3 result = *point - (normal * ((*point - p_plane) * normal));
-    return new Point3(result);
+    return new Point3(projection(*plane, *point));
 }
 
 Point3* projection(const Line3* line, const Point3* point) {
-    Point3 p_line = line->point();
-    Vector3 dir = line->direction().normalize();
-    Point3 result = *point - ((*point - p_line) - (dir * ((*point - p_line) * dir)));
-    return new Point3(result);
+    return new Point3(projection(*line, *point));
+}
+
+
+Point2 projection(const Line2& line, const Point2& point) {
+    Point2 p_line = line.point();
+    Vector2 normal = line.normal().normalize();
+    Point2 result = point - (normal * ((point - p_line) * normal));
+    return result;
+}
+
+Point3 projection(const Plane3& plane, const Point3& point) {
+    Point3 p_plane = plane.point();
+    Vector3 normal = plane.normal().normalize();
+    Point3 result = point - (normal * ((point - p_plane) * normal));
+    return result;
+}
+
+Point3 projection(const Line3& line, const Point3& point) {
+    Point3 p_line = line.point();
+    Vector3 dir = line.direction().normalize();
+    Point3 result = point - ((point - p_line) - (dir * ((point - p_line) * dir)));
+    return result;
 }
 
 }
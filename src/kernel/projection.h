@@ -20,6 +20,11 @@ Point2* projection(const Line2* line, const Point2* point);
 Point3* projection(const Plane3* plane, const Point3* point);
 Point3* projection(const Line3* line, const Point3* point);
 
+Point2 projection(const Line2& line, const Point2& point);
+
+Point3 projection(const Plane3& plane, const Point3& point);
+Point3 projection(const Line3& line, const Point3& point);
+
 }
 
 #endif /* PROJECTION_H */
@@ -0,0 +1,61 @@
+/**
+ * @file   kernel/traits.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#include "kernel/traits.h"
+
+#include "kernel/predicates.h"
+
+namespace kernel {
+
+static int sign(double value) {
+    int result = 0;
+    if (value > 0.0) {
+        result = 1;
+    } else if (value < 0.0) {
+        result = -1;
+    }
+    return result;
+}
+
+const char* FastTraits::name() {
+    return "fast";
+}
+
+int FastTraits::side(const Plane3& plane, const Point3& point) {
+    return sign(plane.getA() * point.getX() + plane.getB() * point.getY() +
+            plane.getC() * point.getZ() + plane.getD());
+}
+
+int FastTraits::orientation(const Point3& pa, const Point3& pb,
+        const Point3& pc, const Point3& pd) {
+    double adx = pa.getX() - pd.getX();
+    double bdx = pb.getX() - pd.getX();
+    double cdx = pc.getX() - pd.getX();
+    double ady = pa.getY() - pd.getY();
+    double bdy = pb.getY() - pd.getY();
+    double cdy = pc.getY() - pd.getY();
+    double adz = pa.getZ() - pd.getZ();
+    double bdz = pb.getZ() - pd.getZ();
+    double cdz = pc.getZ() - pd.getZ();
+    return sign(adz * (bdx * cdy - cdx * bdy)
+            + bdz * (cdx * ady - adx * cdy)
+            + cdz * (adx * bdy - bdx * ady));
+}
+
+const char* ExactTraits::name() {
+    return "exact";
+}
+
+int ExactTraits::side(const Plane3& plane, const Point3& point) {
+    return kernel::side(plane, point);
+}
+
+int ExactTraits::orientation(const Point3& pa, const Point3& pb,
+        const Point3& pc, const Point3& pd) {
+    return kernel::orientation(pa, pb, pc, pd);
+}
+
+}
@@ -0,0 +1,47 @@
+/**
+ * @file   kernel/traits.h
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#ifndef TRAITS_H
+#define TRAITS_H
+
+#include "kernel/Point3.h"
+#include "kernel/Plane3.h"
+
+namespace kernel {
+
+/*!
+ * Traits that select how the predicates of the kernel are evaluated.
+ * Algorithms that are templated on the traits are compiled for both,
+ * so the precision can be chosen at runtime.
+ * The constructions (intersections, bisectors, ...) are the same.
+ */
+
+/*!
+ * Predicates evaluated in doubles only.
+ * The sign may be wrong if the result is close to zero.
+ */
+class FastTraits {
+public:
+    static const char* name();
+    static int side(const Plane3& plane, const Point3& point);
+    static int orientation(const Point3& pa, const Point3& pb,
+            const Point3& pc, const Point3& pd);
+};
+
+/*!
+ * Filtered exact predicates (see predicates.h).
+ */
+class ExactTraits {
+public:
+    static const char* name();
+    static int side(const Plane3& plane, const Point3& point);
+    static int orientation(const Point3& pa, const Point3& pb,
+            const Point3& pc, const Point3& pd);
+};
+
+}
+
+#endif /* TRAITS_H */
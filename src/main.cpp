@@ -20,6 +20,7 @@
 #include "data/3d/ptrs.h"
 #include "data/3d/KernelFactory.h"
 #include "data/3d/Polyhedron.h"
+#include "data/3d/skel/StraightSkeleton.h"
 
 #include "db/2d/ptrs.h"
 #include "db/2d/DAOFactory.h"
@@ -32,6 +33,7 @@
 #include "db/3d/StraightSkeletonDAO.h"
 #include "db/3d/OBJFile.h"
 #include "db/3d/FLMAFile.h"
+#include "db/3d/CheckpointFile.h"
 
 #include "algo/ptrs.h"
 #include "algo/Controller.h"
@@ -45,12 +47,18 @@
 #include "algo/3d/PolyhedronTransformation.h"
 #include "algo/3d/SimpleStraightSkel.h"
 #include "algo/3d/GraphChecker.h"
+#include "algo/3d/KernelWrapper.h"
 
 #include "ui/gl/ptrs.h"
 #include "ui/gl/MainOpenGLWindow.h"
 
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <iostream>
 #include <list>
 #include <string>
@@ -69,6 +77,10 @@ void printUsage(const char* argv0) {
     std::cout << "    load filename.obj" << std::endl;
     std::cout << "    import filename.obj" << std::endl;
     std::cout << "    skel SkelID" << std::endl;
+    std::cout << "    --resume checkpoint.bin" << std::endl;
+    std::cout << "    --max-offset -1.0" << std::endl;
+    std::cout << "    --max-events 100" << std::endl;
+    std::cout << "    --kernel fast|exact|fallback" << std::endl;
     std::cout << std::endl;
     std::cout << "  general options:" << std::endl;
     std::cout << "    --no-window" << std::endl;
@@ -110,6 +122,54 @@ const char* getOption(const char* option, int argc, const char* argv[]) {
     return result;
 }
 
+/**
+ * Returns false if str is not a complete, finite floating point number.
+ */
+bool parseDouble(const char* str, double& value) {
+    char* end = 0;
+    errno = 0;
+    double result = strtod(str, &end);
+    if (end == str || *end != '\0' || errno == ERANGE || !std::isfinite(result)) {
+        return false;
+    }
+    value = result;
+    return true;
+}
+
+/**
+ * Returns false if str is not a complete non-negative integer
+ * that fits into an unsigned int.
+ */
+bool parseUnsigned(const char* str, unsigned int& value) {
+    if (!isdigit((unsigned char)str[0])) {
+        return false;
+    }
+    char* end = 0;
+    errno = 0;
+    unsigned long result = strtoul(str, &end, 10);
+    if (*end != '\0' || errno == ERANGE || result > UINT_MAX) {
+        return false;
+    }
+    value = (unsigned int)result;
+    return true;
+}
+
+/**
+ * Returns false if the algorithm threw an exception
+ * or the straight skeleton is not consistent.
+ */
+bool runSkel3d(algo::_3d::SimpleStraightSkelSPtr algoskel3d) {
+    bool result = true;
+    try {
+        algoskel3d->run();
+        result = algoskel3d->getResult()->isConsistent();
+    } catch (std::exception& e) {
+        std::cout << "Error: " << e.what() << std::endl;
+        result = false;
+    }
+    return result;
+}
+
 std::list<double> parseCSV(const char* csv) {
     std::list<double> values;
     std::vector<std::string> str_vals = util::StringFuncs::split(csv, ",", false);
@@ -156,6 +216,46 @@ int main(int argc, const char* argv[]) {
         }
     }
 
+    int result = EXIT_SUCCESS;
+
+    // fallback: the fast kernel first, the exact kernel if that run fails.
+    // Only a thrown exception or an inconsistent skeleton counts as failure,
+    // a failed assertion still aborts and an endless loop is not detected.
+    bool kernel_fallback = false;
+    int kernel = algo::_3d::KernelWrapper::KERNEL_EXACT;
+    const char* chr_kernel = getOption("--kernel", argc, argv);
+    if (chr_kernel) {
+        if (strcmp("fast", chr_kernel) == 0) {
+            kernel = algo::_3d::KernelWrapper::KERNEL_FAST;
+        } else if (strcmp("exact", chr_kernel) == 0) {
+            kernel = algo::_3d::KernelWrapper::KERNEL_EXACT;
+        } else if (strcmp("fallback", chr_kernel) == 0) {
+            kernel = algo::_3d::KernelWrapper::KERNEL_FAST;
+            kernel_fallback = true;
+        } else {
+            std::cout << "Error: Unknown kernel '" << chr_kernel << "'." << std::endl;
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    DEBUG_VAL("Kernel: " << algo::_3d::KernelWrapper::getKernelName(kernel));
+
+    double max_offset = 0.0;
+    const char* chr_max_offset = getOption("--max-offset", argc, argv);
+    // offsets of the wavefront are negative
+    if (chr_max_offset && (!parseDouble(chr_max_offset, max_offset) || max_offset > 0.0)) {
+        std::cout << "Error: Invalid max offset '" << chr_max_offset << "'." << std::endl;
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    unsigned int max_events = 0;
+    const char* chr_max_events = getOption("--max-events", argc, argv);
+    if (chr_max_events && !parseUnsigned(chr_max_events, max_events)) {
+        std::cout << "Error: Invalid max events '" << chr_max_events << "'." << std::endl;
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
     bool rand_move_points = false;
     bool rand_move_points_when_degenerated = false;
     double rand_move_points_range = 0.001;
@@ -186,6 +286,7 @@ int main(int argc, const char* argv[]) {
     data::_2d::skel::StraightSkeletonSPtr skel2d;
     data::_3d::PolyhedronSPtr polyhedron;
     data::_3d::skel::StraightSkeletonSPtr skel3d;
+    db::_3d::CheckpointFileSPtr checkpoint;
     if (num_dims == 2) {
         db::_2d::PolygonDAOSPtr polygon_dao =
                 db::_2d::DAOFactory::getPolygonDAO();
@@ -257,7 +358,19 @@ int main(int argc, const char* argv[]) {
     } else if (num_dims == 3) {
         db::_3d::PolyhedronDAOSPtr polyhedron_dao =
                 db::_3d::DAOFactory::getPolyhedronDAO();
-        if (strcmp("test", argv[2]) == 0) {
+        const char* chr_resume = getOption("--resume", argc, argv);
+        if (chr_resume) {
+            checkpoint = db::_3d::CheckpointFile::load(chr_resume);
+            if (!checkpoint) {
+                std::cout << "Error: Unable to resume from '" << chr_resume << "'." << std::endl;
+                return EXIT_FAILURE;
+            }
+            polyhedron = checkpoint->getInput();
+            // the input of the checkpoint has already been transformed
+            rand_move_points = false;
+            rand_move_points_when_degenerated = false;
+            translate_and_scale_polyhedron = false;
+        } else if (strcmp("test", argv[2]) == 0) {
             data::_3d::Point3SPtr p1 =
                     data::_3d::KernelFactory::createPoint3(-5.0, -5.0, -5.0);
             data::_3d::Point3SPtr p2 =
@@ -418,12 +531,40 @@ int main(int argc, const char* argv[]) {
     } else if (num_dims == 3) {
         algoskel3d = algo::_3d::SimpleStraightSkel::create(
                 polyhedron, controller, save_offsets);
+        algoskel3d->setKernel(kernel);
+        if (checkpoint) {
+            algoskel3d->resume(checkpoint);
+        }
+        if (chr_max_offset) {
+            algoskel3d->setMaxOffset(max_offset);
+        }
+        if (chr_max_events) {
+            algoskel3d->setMaxEvents(max_events);
+        }
         if (window) {
             window->setPolyhedron(polyhedron);
             if (skel3d) {
                 window->setSkel3d(skel3d);
             }
             thread_algo = algoskel3d->startThread();
+        } else if (kernel_fallback) {
+            if (!runSkel3d(algoskel3d)) {
+                // starts again with the input polyhedron, also after --resume
+                std::cout << "Warning: Retrying with the exact kernel." << std::endl;
+                algoskel3d = algo::_3d::SimpleStraightSkel::create(
+                        polyhedron, controller, save_offsets);
+                algoskel3d->setKernel(algo::_3d::KernelWrapper::KERNEL_EXACT);
+                if (chr_max_offset) {
+                    algoskel3d->setMaxOffset(max_offset);
+                }
+                if (chr_max_events) {
+                    algoskel3d->setMaxEvents(max_events);
+                }
+                if (!runSkel3d(algoskel3d)) {
+                    std::cout << "Error: The exact kernel failed too." << std::endl;
+                    result = EXIT_FAILURE;
+                }
+            }
         } else {
             algoskel3d->run();
         }
@@ -482,5 +623,5 @@ int main(int argc, const char* argv[]) {
         thread_window->join();
     }
 
-    return EXIT_SUCCESS;
+    return result;
 }
@@ -241,8 +241,9 @@ void MainOpenGLWindow::saveLastPoly() {
             ReadLock l(skel_3d_->mutex());
             if (skel_3d_->events().size() > 0) {
                 data::_3d::skel::AbstractEventSPtr event = skel_3d_->events().back();
-                if (event->getPolyhedronResult()) {
-                    polyhedron = event->getPolyhedronResult();
+                PolyhedronSPtr polyhedron_event = event->getPolyhedronResult();
+                if (polyhedron_event) {
+                    polyhedron = polyhedron_event;
                 }
             }
         }
@@ -359,7 +360,7 @@ void MainOpenGLWindow::printScreen() {
                     }
                     if (toggle_poly_ >= 3) {
                         ReadLock l(skel_3d_->mutex());
-                        std::list<data::_3d::skel::AbstractEventSPtr>::reverse_iterator it_e =
+                        util::SlotList<data::_3d::skel::AbstractEventSPtr>::reverse_iterator it_e =
                                 skel_3d_->events().rbegin();
                         while (it_e != skel_3d_->events().rend()) {
                             data::_3d::skel::AbstractEventSPtr event = *it_e++;
@@ -407,8 +408,9 @@ void MainOpenGLWindow::printCutPattern() {
             ReadLock l(skel_3d_->mutex());
             if (skel_3d_->events().size() > 0) {
                 data::_3d::skel::AbstractEventSPtr event = skel_3d_->events().back();
-                if (event->getPolyhedronResult()) {
-                    polyhedron = event->getPolyhedronResult();
+                PolyhedronSPtr polyhedron_event = event->getPolyhedronResult();
+                if (polyhedron_event) {
+                    polyhedron = polyhedron_event;
                 }
             }
         }
@@ -658,7 +660,7 @@ void MainOpenGLWindow::drawPolyhedron(PolyhedronSPtr polyhedron, bool bold, bool
     ReadLock l(polyhedron->mutex());
     vec4f color_begin;
     getColor(color_begin);
-    std::list<data::_3d::VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    util::SlotList<data::_3d::VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
     while (it_v != polyhedron->vertices().end()) {
         data::_3d::VertexSPtr vertex = *it_v++;
         if (highlight_ && vertex->hasData()) {
@@ -678,12 +680,12 @@ void MainOpenGLWindow::drawPolyhedron(PolyhedronSPtr polyhedron, bool bold, bool
     if (vertices_only) {
         return;
     }
-    std::list<data::_3d::EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<data::_3d::EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         data::_3d::EdgeSPtr edge = *it_e++;
         data::_3d::VertexSPtr vertex_src = edge->getVertexSrc();
         data::_3d::VertexSPtr vertex_dst = edge->getVertexDst();
-        if (vertex_src->getPoint() == vertex_dst->getPoint()) {
+        if (vertex_src->isCoincident(vertex_dst)) {
             continue;
         }
         if (highlight_ && edge->hasData()) {
@@ -730,7 +732,7 @@ void MainOpenGLWindow::drawPolyhedron(PolyhedronSPtr polyhedron, bool bold, bool
         return;
     }
     setColor(c_trans_grey);
-    std::list<data::_3d::FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<data::_3d::FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         data::_3d::FacetSPtr facet = *it_f++;
         std::list<data::_3d::TriangleSPtr>::iterator it_t = facet->triangles().begin();
@@ -771,14 +773,14 @@ void MainOpenGLWindow::drawSkel3d(data::_3d::skel::StraightSkeletonSPtr skel_3d)
     vec4f color_begin;
     getColor(color_begin);
     if (toggle_skel_) {
-        std::list<data::_3d::skel::NodeSPtr>::iterator it_n = skel_3d->nodes().begin();
+        util::SlotList<data::_3d::skel::NodeSPtr>::iterator it_n = skel_3d->nodes().begin();
         while (it_n != skel_3d->nodes().end()) {
             data::_3d::skel::NodeSPtr node = *it_n++;
             vec3f p;
             convert(node->getPoint(), p);
             drawSphere(p, 0.1f * thickness_/scale_);
         }
-        std::list<data::_3d::skel::ArcSPtr>::iterator it_a = skel_3d->arcs().begin();
+        util::SlotList<data::_3d::skel::ArcSPtr>::iterator it_a = skel_3d->arcs().begin();
         while (it_a != skel_3d->arcs().end()) {
             data::_3d::skel::ArcSPtr arc = *it_a++;
             data::_3d::skel::NodeSPtr node = arc->getNodeSrc();
@@ -801,13 +803,16 @@ void MainOpenGLWindow::drawSkel3d(data::_3d::skel::StraightSkeletonSPtr skel_3d)
             }
         }
     }
+    std::list<PolyhedronSPtr> polyhedrons_events;
     if (toggle_poly_ >= 3) {
         setColor(c_white);
         bool vertices_only = false;
-        std::list<data::_3d::skel::AbstractEventSPtr>::reverse_iterator it_e = skel_3d->events().rbegin();
+        util::SlotList<data::_3d::skel::AbstractEventSPtr>::reverse_iterator it_e = skel_3d->events().rbegin();
         while (it_e != skel_3d->events().rend()) {
             data::_3d::skel::AbstractEventSPtr event = *it_e++;
-            drawPolyhedron(event->getPolyhedronResult(), false, vertices_only);
+            PolyhedronSPtr polyhedron = event->getPolyhedronResult();
+            drawPolyhedron(polyhedron, false, vertices_only);
+            polyhedrons_events.push_back(polyhedron);
             if (toggle_poly_ == 4) {
                 vertices_only = true;
             } else if (toggle_poly_ == 5) {
@@ -815,6 +820,7 @@ void MainOpenGLWindow::drawSkel3d(data::_3d::skel::StraightSkeletonSPtr skel_3d)
             }
         }
     }
+    polyhedrons_events_.swap(polyhedrons_events);
     setColor(color_begin);
 }
 
@@ -826,7 +832,7 @@ void MainOpenGLWindow::drawColoredNodes(data::_3d::skel::StraightSkeletonSPtr sk
     ReadLock l(skel_3d->mutex());
     vec4f color_begin;
     getColor(color_begin);
-    std::list<data::_3d::skel::AbstractEventSPtr>::iterator it_e = skel_3d->events().begin();
+    util::SlotList<data::_3d::skel::AbstractEventSPtr>::iterator it_e = skel_3d->events().begin();
     while (it_e != skel_3d->events().end()) {
         data::_3d::skel::AbstractEventSPtr event = *it_e++;
         data::_3d::skel::NodeSPtr node;
@@ -108,6 +108,8 @@ protected:
     data::_2d::mesh::MeshSPtr mesh_2d_;
     PolyhedronSPtr polyhedron_;
     data::_3d::skel::StraightSkeletonSPtr skel_3d_;
+    /** keeps the polyhedrons created from snapshots alive between frames */
+    std::list<PolyhedronSPtr> polyhedrons_events_;
     SphericalPolygonSPtr sphericalpolygon_;
     data::_3d::skel::SphericalSkeletonSPtr sphericalskel_;
     bool toggle_roof_;
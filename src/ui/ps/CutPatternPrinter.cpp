@@ -36,7 +36,7 @@ void CutPatternPrinter::printCutPattern(PolyhedronSPtr polyhedron, const std::st
     }
     ReadLock l(polyhedron->mutex());
     unsigned int i = 0;
-    std::list<data::_3d::FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<data::_3d::FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         data::_3d::FacetSPtr facet = *it_f++;
         data::_2d::PolygonSPtr polygon2 = facet->toPolygon();
@@ -148,7 +148,7 @@ void SpacePSPrinter::printPolyhedron(PolyhedronSPtr polyhedron, std::ostream& ou
         return;
     }
     ReadLock l(polyhedron->mutex());
-    std::list<data::_3d::EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    util::SlotList<data::_3d::EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
     while (it_e != polyhedron->edges().end()) {
         data::_3d::EdgeSPtr edge = *it_e++;
         data::_3d::VertexSPtr vertex_src = edge->getVertexSrc();
@@ -168,7 +168,7 @@ void SpacePSPrinter::printPolyhedron(PolyhedronSPtr polyhedron, std::ostream& ou
 std::list<data::_3d::FacetSPtr> SpacePSPrinter::getFacetsToShade(PolyhedronSPtr polyhedron) {
     std::list<data::_3d::FacetSPtr> result;
     std::list<data::_3d::FacetSPtr> temp;
-    std::list<data::_3d::FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    util::SlotList<data::_3d::FacetSPtr>::iterator it_f = polyhedron->facets().begin();
     while (it_f != polyhedron->facets().end()) {
         data::_3d::FacetSPtr facet = *it_f++;
         data::_3d::Plane3SPtr plane = facet->plane();
@@ -192,9 +192,9 @@ std::list<data::_3d::FacetSPtr> SpacePSPrinter::getFacetsToShade(PolyhedronSPtr
     while (temp.size() > 0) {
         float max_dist = 0.0f;
         std::list<data::_3d::FacetSPtr>::iterator it_max_f = temp.begin();
-        it_f = temp.begin();
-        while (it_f != temp.end()) {
-            data::_3d::FacetSPtr facet = *it_f;
+        std::list<data::_3d::FacetSPtr>::iterator it_t = temp.begin();
+        while (it_t != temp.end()) {
+            data::_3d::FacetSPtr facet = *it_t;
             vec3f center = {0.0f, 0.0f, 0.0f};
             std::list<data::_3d::VertexSPtr>::iterator it_v = facet->vertices().begin();
             while (it_v != facet->vertices().end()) {
@@ -210,10 +210,10 @@ std::list<data::_3d::FacetSPtr> SpacePSPrinter::getFacetsToShade(PolyhedronSPtr
             }
             float dist = scalar(diff, diff);
             if (dist > max_dist || max_dist == 0.0f) {
-                it_max_f = it_f;
+                it_max_f = it_t;
                 max_dist = dist;
             }
-            it_f++;
+            it_t++;
         }
         result.push_back(*it_max_f);
         temp.erase(it_max_f);
@@ -290,7 +290,7 @@ void SpacePSPrinter::printPolyhedronShade(PolyhedronSPtr polyhedron,
 
 void SpacePSPrinter::printSkel(data::_3d::skel::StraightSkeletonSPtr skel, std::ostream& out) {
     ReadLock l(skel->mutex());
-    std::list<data::_3d::skel::ArcSPtr>::iterator it_a = skel->arcs().begin();
+    util::SlotList<data::_3d::skel::ArcSPtr>::iterator it_a = skel->arcs().begin();
     while (it_a != skel->arcs().end()) {
         data::_3d::skel::ArcSPtr arc = *it_a++;
         if (!arc->hasNodeDst()) {
@@ -0,0 +1,83 @@
+/**
+ * @file   util/Handle.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef UTIL_HANDLE_H
+#define UTIL_HANDLE_H
+
+#include "smarter_ptr.h"
+
+namespace util {
+
+/**
+ * Non-owning reference to an object that is owned by someone else.
+ * Replaces WeakPtr in adjacency lists:
+ * Comparing and dereferencing a Handle are plain loads,
+ * no reference counts are touched.
+ * A Handle cannot expire. Whoever owns the object has to remove
+ * all handles to it before it is destroyed.
+ */
+template<class T> class Handle {
+public:
+    Handle() {
+        ptr_ = 0;
+    }
+
+    Handle(T* ptr) {
+        ptr_ = ptr;
+    }
+
+    Handle(const std::shared_ptr<T>& sptr) {
+        ptr_ = sptr.get();
+    }
+
+    T* get() const {
+        return ptr_;
+    }
+
+    T& operator*() const {
+        return *ptr_;
+    }
+
+    T* operator->() const {
+        return ptr_;
+    }
+
+    /**
+     * A shared pointer to the object.
+     * This increments the reference count, so use it only
+     * where the object has to be kept alive.
+     */
+    SHARED_PTR<T> lock() const {
+        SHARED_PTR<T> result;
+        if (ptr_) {
+            result = SHARED_PTR<T>(ptr_->shared_from_this());
+        }
+        return result;
+    }
+
+    bool operator==(const Handle<T>& other) const {
+        return (ptr_ == other.ptr_);
+    }
+
+    bool operator!=(const Handle<T>& other) const {
+        return (ptr_ != other.ptr_);
+    }
+
+    bool operator==(const std::shared_ptr<T>& other) const {
+        return (ptr_ == other.get());
+    }
+
+    bool operator!=(const std::shared_ptr<T>& other) const {
+        return (ptr_ != other.get());
+    }
+
+protected:
+    T* ptr_;
+};
+
+}
+
+#endif /* UTIL_HANDLE_H */
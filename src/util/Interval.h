@@ -0,0 +1,153 @@
+/**
+ * @file   util/Interval.h
+ * @author Gernot Walzl
+ * @date   2026-10-18
+ */
+
+#ifndef UTIL_INTERVAL_H
+#define UTIL_INTERVAL_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace util {
+
+/**
+ * Closed interval [lower, upper] that encloses an exact value.
+ * Every operation rounds to nearest and then widens the bounds by one
+ * unit in the last place, so the exact result of the operation on any
+ * values inside the operands stays inside the result.
+ * T is double or long double; long double gives tighter bounds.
+ */
+template<class T> class Interval {
+public:
+    Interval() {
+        lower_ = 0;
+        upper_ = 0;
+    }
+
+    Interval(T value) {
+        lower_ = value;
+        upper_ = value;
+    }
+
+    Interval(T lower, T upper) {
+        lower_ = lower;
+        upper_ = upper;
+    }
+
+    T lower() const {
+        return lower_;
+    }
+
+    T upper() const {
+        return upper_;
+    }
+
+    T width() const {
+        return upper_ - lower_;
+    }
+
+    /**
+     * Smallest absolute value inside the interval.
+     */
+    T mignitude() const {
+        T result = 0;
+        if (lower_ > 0) {
+            result = lower_;
+        } else if (upper_ < 0) {
+            result = -upper_;
+        }
+        return result;
+    }
+
+    bool containsZero() const {
+        return (lower_ <= 0 && upper_ >= 0);
+    }
+
+    /**
+     * False if a bound is infinite or not a number.
+     */
+    bool isBounded() const {
+        return (std::isfinite(lower_) && std::isfinite(upper_));
+    }
+
+    /**
+     * Every value inside this interval is greater than
+     * every value inside the other one.
+     */
+    bool isGreater(const Interval<T>& other) const {
+        return (lower_ > other.upper_);
+    }
+
+    bool overlaps(const Interval<T>& other) const {
+        return (lower_ <= other.upper_ && other.lower_ <= upper_);
+    }
+
+    Interval<T> operator-() const {
+        return Interval<T>(-upper_, -lower_);
+    }
+
+    Interval<T> operator+(const Interval<T>& other) const {
+        return Interval<T>(down(lower_ + other.lower_), up(upper_ + other.upper_));
+    }
+
+    Interval<T> operator-(const Interval<T>& other) const {
+        return Interval<T>(down(lower_ - other.upper_), up(upper_ - other.lower_));
+    }
+
+    Interval<T> operator*(const Interval<T>& other) const {
+        T p0 = lower_ * other.lower_;
+        T p1 = lower_ * other.upper_;
+        T p2 = upper_ * other.lower_;
+        T p3 = upper_ * other.upper_;
+        return Interval<T>(down(std::min(std::min(p0, p1), std::min(p2, p3))),
+                up(std::max(std::max(p0, p1), std::max(p2, p3))));
+    }
+
+    /**
+     * Division by an interval that contains zero gives
+     * the unbounded interval.
+     */
+    Interval<T> operator/(const Interval<T>& other) const {
+        if (other.containsZero()) {
+            return Interval<T>(-std::numeric_limits<T>::infinity(),
+                    std::numeric_limits<T>::infinity());
+        }
+        T q0 = lower_ / other.lower_;
+        T q1 = lower_ / other.upper_;
+        T q2 = upper_ / other.lower_;
+        T q3 = upper_ / other.upper_;
+        return Interval<T>(down(std::min(std::min(q0, q1), std::min(q2, q3))),
+                up(std::max(std::max(q0, q1), std::max(q2, q3))));
+    }
+
+    /**
+     * Negative parts of the interval are cut off.
+     */
+    Interval<T> sqrt() const {
+        T lower = (lower_ > 0) ? down(std::sqrt(lower_)) : 0;
+        if (lower < 0) {
+            lower = 0;
+        }
+        T upper = (upper_ > 0) ? up(std::sqrt(upper_)) : 0;
+        return Interval<T>(lower, upper);
+    }
+
+protected:
+    static T down(T value) {
+        return std::nextafter(value, -std::numeric_limits<T>::infinity());
+    }
+
+    static T up(T value) {
+        return std::nextafter(value, std::numeric_limits<T>::infinity());
+    }
+
+    T lower_;
+    T upper_;
+};
+
+}
+
+#endif /* UTIL_INTERVAL_H */
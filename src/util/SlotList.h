@@ -0,0 +1,345 @@
+/**
+ * @file   util/SlotList.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef UTIL_SLOTLIST_H
+#define UTIL_SLOTLIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace util {
+
+template<class T> class SlotList;
+
+/**
+ * Bidirectional iterator over the occupied slots of a SlotList.
+ * Stays valid when elements are added or removed,
+ * but not when the list is compacted.
+ */
+template<class T, class V, class L> class SlotListIterator {
+public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef V* pointer;
+    typedef V& reference;
+
+    SlotListIterator() {
+        list_ = 0;
+        slot_ = SlotList<T>::NONE;
+    }
+
+    SlotListIterator(L* list, size_t slot) {
+        list_ = list;
+        slot_ = slot;
+    }
+
+    template<class V2, class L2>
+    SlotListIterator(const SlotListIterator<T, V2, L2>& other) {
+        list_ = other.getList();
+        slot_ = other.slot();
+    }
+
+    V& operator*() const {
+        return list_->at(slot_);
+    }
+
+    V* operator->() const {
+        return &(list_->at(slot_));
+    }
+
+    SlotListIterator& operator++() {
+        slot_ = list_->nextSlot(slot_);
+        return *this;
+    }
+
+    SlotListIterator operator++(int) {
+        SlotListIterator result = *this;
+        slot_ = list_->nextSlot(slot_);
+        return result;
+    }
+
+    SlotListIterator& operator--() {
+        slot_ = list_->prevSlot(slot_);
+        return *this;
+    }
+
+    SlotListIterator operator--(int) {
+        SlotListIterator result = *this;
+        slot_ = list_->prevSlot(slot_);
+        return result;
+    }
+
+    template<class V2, class L2>
+    bool operator==(const SlotListIterator<T, V2, L2>& other) const {
+        return slot_ == other.slot();
+    }
+
+    template<class V2, class L2>
+    bool operator!=(const SlotListIterator<T, V2, L2>& other) const {
+        return slot_ != other.slot();
+    }
+
+    size_t slot() const {
+        return slot_;
+    }
+
+    L* getList() const {
+        return list_;
+    }
+
+protected:
+    L* list_;
+    size_t slot_;
+};
+
+
+/**
+ * Replacement for a std::list of shared pointers.
+ * The elements are stored in one contiguous array of slots,
+ * so iterating is a linear scan.
+ * An element keeps its slot until the list is compacted,
+ * so the slot may be stored at the element to remove it in O(1).
+ * Removing an element only empties its slot (tombstone),
+ * which keeps the order of the remaining elements
+ * and the iterators that point to them.
+ * compact() closes the gaps and has to be called where
+ * no iterators are in use.
+ */
+template<class T> class SlotList {
+public:
+    typedef T value_type;
+    typedef SlotListIterator<T, T, SlotList<T> > iterator;
+    typedef SlotListIterator<T, const T, const SlotList<T> > const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /**
+     * Slot of elements that are not in a list. Also the slot of end().
+     */
+    static const size_t NONE = (size_t)-1;
+
+    SlotList() {
+        size_ = 0;
+        first_ = 0;
+    }
+
+    /**
+     * Appends the element. Returns its slot.
+     */
+    size_t push_back(const T& element) {
+        size_t result = slots_.size();
+        slots_.push_back(element);
+        if (size_ == 0) {
+            first_ = result;
+        }
+        size_++;
+        return result;
+    }
+
+    /**
+     * Empties the slot and returns an iterator to the next element.
+     */
+    iterator erase(size_t slot) {
+        if (slot < slots_.size() && slots_[slot]) {
+            slots_[slot] = T();
+            size_--;
+            if (slot == first_) {
+                first_ = findNext(slot);
+            }
+        }
+        return iterator(this, nextSlot(slot));
+    }
+
+    iterator erase(iterator it) {
+        return erase(it.slot());
+    }
+
+    /**
+     * Moves the element to the end of the list. Returns its new slot.
+     */
+    size_t moveToBack(size_t slot) {
+        T element = slots_[slot];
+        erase(slot);
+        return push_back(element);
+    }
+
+    void clear() {
+        slots_.clear();
+        size_ = 0;
+        first_ = 0;
+    }
+
+    /**
+     * Moves all elements to the front, keeping their order.
+     * moved is called for each element whose slot changed.
+     * Invalidates all iterators.
+     */
+    void compact(void (*moved)(T& element, size_t slot)) {
+        size_t dst = 0;
+        for (size_t src = 0; src < slots_.size(); src++) {
+            if (slots_[src]) {
+                if (src != dst) {
+                    slots_[dst] = slots_[src];
+                    slots_[src] = T();
+                    if (moved) {
+                        moved(slots_[dst], dst);
+                    }
+                }
+                dst++;
+            }
+        }
+        slots_.resize(dst);
+        first_ = 0;
+    }
+
+    /**
+     * Number of empty slots.
+     */
+    size_t numGaps() const {
+        return slots_.size() - size_;
+    }
+
+    /**
+     * Number of slots, occupied or not.
+     * Every slot of an element is less than this.
+     */
+    size_t numSlots() const {
+        return slots_.size();
+    }
+
+    void reserve(size_t num_slots) {
+        slots_.reserve(num_slots);
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    T& at(size_t slot) {
+        return slots_[slot];
+    }
+
+    const T& at(size_t slot) const {
+        return slots_[slot];
+    }
+
+    T& front() {
+        return slots_[first_];
+    }
+
+    const T& front() const {
+        return slots_[first_];
+    }
+
+    T& back() {
+        return slots_[prevSlot(NONE)];
+    }
+
+    const T& back() const {
+        return slots_[prevSlot(NONE)];
+    }
+
+    iterator begin() {
+        return iterator(this, firstSlot());
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, firstSlot());
+    }
+
+    iterator end() {
+        return iterator(this, NONE);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, NONE);
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * The occupied slot after the given one, NONE if there is none.
+     */
+    size_t nextSlot(size_t slot) const {
+        size_t result = NONE;
+        if (slot != NONE) {
+            result = findNext(slot);
+            if (result >= slots_.size()) {
+                result = NONE;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * The occupied slot before the given one.
+     * The slot before NONE is the last occupied slot.
+     */
+    size_t prevSlot(size_t slot) const {
+        size_t result = NONE;
+        size_t i = slot;
+        if (slot == NONE) {
+            i = slots_.size();
+        }
+        while (i > 0) {
+            i--;
+            if (slots_[i]) {
+                result = i;
+                break;
+            }
+        }
+        return result;
+    }
+
+protected:
+    size_t firstSlot() const {
+        size_t result = NONE;
+        if (size_ > 0) {
+            result = first_;
+        }
+        return result;
+    }
+
+    size_t findNext(size_t slot) const {
+        size_t result = slot + 1;
+        while (result < slots_.size() && !slots_[result]) {
+            result++;
+        }
+        return result;
+    }
+
+    std::vector<T> slots_;
+    size_t size_;
+
+    /** the first occupied slot, if there is any */
+    size_t first_;
+};
+
+template<class T> const size_t SlotList<T>::NONE;
+
+}
+
+#endif /* UTIL_SLOTLIST_H */
@@ -0,0 +1,104 @@
+/**
+ * @file   util/ThreadPool.cpp
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#include "util/ThreadPool.h"
+
+namespace util {
+
+ThreadPool::ThreadPool(unsigned int num_threads) {
+    tasks_ = 0;
+    next_task_ = 0;
+    num_done_ = 0;
+    batch_ = 0;
+    stop_ = false;
+    if (num_threads == 0) {
+        num_threads = std::thread::hardware_concurrency();
+    }
+    for (unsigned int i = 1; i < num_threads; i++) {
+        threads_.push_back(ThreadSPtr(new std::thread(
+                std::bind(&ThreadPool::work, this))));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cond_work_.notify_all();
+    for (unsigned int i = 0; i < threads_.size(); i++) {
+        threads_[i]->join();
+    }
+    threads_.clear();
+}
+
+ThreadPoolSPtr ThreadPool::create(unsigned int num_threads) {
+    return ThreadPoolSPtr(new ThreadPool(num_threads));
+}
+
+unsigned int ThreadPool::size() const {
+    return threads_.size() + 1;
+}
+
+void ThreadPool::run(std::vector<Task>& tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_ = &tasks;
+    next_task_ = 0;
+    num_done_ = 0;
+    exception_ = std::exception_ptr();
+    batch_++;
+    cond_work_.notify_all();
+    runTasks(lock);
+    while (num_done_ < tasks.size()) {
+        cond_done_.wait(lock);
+    }
+    tasks_ = 0;
+    if (exception_) {
+        std::exception_ptr exception = exception_;
+        exception_ = std::exception_ptr();
+        std::rethrow_exception(exception);
+    }
+}
+
+void ThreadPool::work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    unsigned long batch_done = 0;
+    while (!stop_) {
+        if (tasks_ && batch_done != batch_) {
+            batch_done = batch_;
+            runTasks(lock);
+        } else {
+            cond_work_.wait(lock);
+        }
+    }
+}
+
+void ThreadPool::runTasks(std::unique_lock<std::mutex>& lock) {
+    std::vector<Task>* tasks = tasks_;
+    while (next_task_ < tasks->size()) {
+        unsigned int i = next_task_++;
+        lock.unlock();
+        std::exception_ptr exception;
+        try {
+            (*tasks)[i]();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        lock.lock();
+        if (exception && !exception_) {
+            exception_ = exception;
+        }
+        num_done_++;
+        if (num_done_ == tasks->size()) {
+            cond_done_.notify_all();
+        }
+    }
+}
+
+}
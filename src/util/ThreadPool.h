@@ -0,0 +1,67 @@
+/**
+ * @file   util/ThreadPool.h
+ * @author Gernot Walzl
+ * @date   2026-10-17
+ */
+
+#ifndef UTIL_THREADPOOL_H
+#define UTIL_THREADPOOL_H
+
+#include "util/ptrs.h"
+#include "typedefs_thread.h"
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace util {
+
+/**
+ * A fixed number of worker threads that run batches of tasks.
+ * The calling thread takes part in the work.
+ */
+class ThreadPool {
+public:
+    typedef std::function<void()> Task;
+
+    virtual ~ThreadPool();
+
+    /**
+     * num_threads includes the calling thread.
+     * 0 uses one thread per hardware thread.
+     */
+    static ThreadPoolSPtr create(unsigned int num_threads);
+
+    unsigned int size() const;
+
+    /**
+     * Runs all tasks and returns when every task has finished.
+     * The first exception thrown by a task is rethrown.
+     */
+    void run(std::vector<Task>& tasks);
+
+protected:
+    ThreadPool(unsigned int num_threads);
+
+    void work();
+
+    /**
+     * Executes tasks of the current batch until none is left.
+     */
+    void runTasks(std::unique_lock<std::mutex>& lock);
+
+    std::vector<ThreadSPtr> threads_;
+    std::mutex mutex_;
+    std::condition_variable cond_work_;
+    std::condition_variable cond_done_;
+    std::vector<Task>* tasks_;
+    unsigned int next_task_;
+    unsigned int num_done_;
+    unsigned long batch_;
+    std::exception_ptr exception_;
+    bool stop_;
+};
+
+}
+
+#endif /* UTIL_THREADPOOL_H */
@@ -16,6 +16,11 @@ class Configuration;
 typedef SHARED_PTR<Configuration> ConfigurationSPtr;
 typedef WEAK_PTR<Configuration> ConfigurationWPtr;
 
+class ThreadPool;
+
+typedef SHARED_PTR<ThreadPool> ThreadPoolSPtr;
+typedef WEAK_PTR<ThreadPool> ThreadPoolWPtr;
+
 }
 
 #endif /* UTIL_PTRS_H */
@@ -10,6 +10,8 @@ using algo::_2d::KernelWrapper;
 using data::_2d::KernelFactory;
 using data::_2d::Point2SPtr;
 using data::_2d::Line2SPtr;
+using data::_2d::Point2;
+using data::_2d::Line2;
 
 BOOST_AUTO_TEST_CASE(testIntersection) {
     Point2SPtr p = KernelFactory::createPoint2(1.0, 0.0);
@@ -52,4 +54,20 @@ BOOST_AUTO_TEST_CASE(testOffsetLine) {
     BOOST_CHECK(*expected == *result);
 }
 
+BOOST_AUTO_TEST_CASE(testIntersectionValue) {
+    Point2SPtr p = KernelFactory::createPoint2(1.0, 0.0);
+    Point2SPtr q = KernelFactory::createPoint2(3.0, 2.0);
+    Line2SPtr line1 = KernelFactory::createLine2(p, q);
+    p = KernelFactory::createPoint2(1.0, 2.0);
+    q = KernelFactory::createPoint2(3.0, 0.0);
+    Line2SPtr line2 = KernelFactory::createLine2(p, q);
+    std::optional<Point2> result = KernelWrapper::intersection(*line1, *line2);
+    BOOST_REQUIRE(result);
+    BOOST_CHECK(Point2(2.0, 1.0) == *result);
+    BOOST_CHECK(!KernelWrapper::intersection(*line1, *line1));
+    Line2 offset_line = KernelWrapper::offsetLine(*line1, 1.0);
+    BOOST_CHECK(*KernelWrapper::offsetLine(line1, 1.0) == offset_line);
+    BOOST_CHECK(!KernelWrapper::intersection(*line1, offset_line));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <thread>
 
 #include "algo/3d/KernelWrapper.h"
 #include "data/3d/ptrs.h"
@@ -10,6 +11,8 @@ using algo::_3d::KernelWrapper;
 using data::_3d::KernelFactory;
 using data::_3d::Point3SPtr;
 using data::_3d::Plane3SPtr;
+using data::_3d::Point3;
+using data::_3d::Plane3;
 
 BOOST_AUTO_TEST_CASE(testOffsetPlane) {
     Point3SPtr p = KernelFactory::createPoint3(1.0, 1.0, 1.0);
@@ -24,4 +27,76 @@ BOOST_AUTO_TEST_CASE(testOffsetPlane) {
     BOOST_CHECK(*expected == *result);
 }
 
+BOOST_AUTO_TEST_CASE(testIntersectionValue) {
+    Point3SPtr o = KernelFactory::createPoint3(0.0, 0.0, 0.0);
+    Point3SPtr x = KernelFactory::createPoint3(1.0, 0.0, 0.0);
+    Point3SPtr y = KernelFactory::createPoint3(0.0, 1.0, 0.0);
+    Point3SPtr z = KernelFactory::createPoint3(0.0, 0.0, 1.0);
+    Plane3SPtr plane_xy = KernelFactory::createPlane3(o, x, y);
+    Plane3SPtr plane_yz = KernelFactory::createPlane3(o, y, z);
+    Plane3SPtr plane_zx = KernelFactory::createPlane3(o, z, x);
+    Plane3 offset_xy = KernelWrapper::offsetPlane(*plane_xy, 1.0);
+    Plane3 offset_yz = KernelWrapper::offsetPlane(*plane_yz, 2.0);
+    Plane3 offset_zx = KernelWrapper::offsetPlane(*plane_zx, 3.0);
+    BOOST_CHECK(*KernelWrapper::offsetPlane(plane_xy, 1.0) == offset_xy);
+    std::optional<Point3> result = KernelWrapper::intersection(
+            offset_xy, offset_yz, offset_zx);
+    BOOST_REQUIRE(result);
+    Point3SPtr expected = KernelWrapper::intersection(
+            KernelWrapper::offsetPlane(plane_xy, 1.0),
+            KernelWrapper::offsetPlane(plane_yz, 2.0),
+            KernelWrapper::offsetPlane(plane_zx, 3.0));
+    BOOST_CHECK(*expected == *result);
+    BOOST_CHECK_EQUAL(KernelWrapper::side(KernelWrapper::offsetPlane(plane_xy, 1.0), o),
+            KernelWrapper::side(offset_xy, *o));
+    BOOST_CHECK(KernelWrapper::side(offset_xy, *o) != 0);
+    // the same plane twice does not intersect
+    BOOST_CHECK(!KernelWrapper::intersection(offset_xy, offset_xy, offset_zx));
+    BOOST_CHECK(!KernelWrapper::intersection(offset_xy, offset_xy));
+}
+
+BOOST_AUTO_TEST_CASE(testKernel) {
+    // 1 + 1e-17 - 1 is 0 in doubles
+    Plane3SPtr plane = KernelFactory::createPlane3(1.0, 1.0, 0.0, -1.0);
+    Point3SPtr point = KernelFactory::createPoint3(1.0, 1e-17, 0.0);
+    Point3SPtr point_clear = KernelFactory::createPoint3(1.0, 1.0, 0.0);
+    BOOST_CHECK_EQUAL(KernelWrapper::KERNEL_EXACT, KernelWrapper::getKernel());
+    BOOST_CHECK_EQUAL(1, KernelWrapper::side(plane, point));
+    BOOST_CHECK_EQUAL(1, KernelWrapper::side(plane, point_clear));
+    BOOST_CHECK_EQUAL(1, KernelWrapper::side(*plane, *point, KernelWrapper::KERNEL_EXACT));
+#ifndef USE_CGAL
+    BOOST_CHECK_EQUAL("fast", KernelWrapper::getKernelName(KernelWrapper::KERNEL_FAST));
+    BOOST_CHECK_EQUAL(0, KernelWrapper::side(*plane, *point, KernelWrapper::KERNEL_FAST));
+#endif
+    BOOST_CHECK_EQUAL(1, KernelWrapper::side(*plane, *point_clear, KernelWrapper::KERNEL_FAST));
+}
+
+static void checkThreadKernel(int* result) {
+    *result = KernelWrapper::getKernel();
+}
+
+BOOST_AUTO_TEST_CASE(testKernelScope) {
+    Plane3SPtr plane = KernelFactory::createPlane3(1.0, 1.0, 0.0, -1.0);
+    Point3SPtr point = KernelFactory::createPoint3(1.0, 1e-17, 0.0);
+    {
+        KernelWrapper::Scope scope(KernelWrapper::KERNEL_FAST);
+        BOOST_CHECK_EQUAL(KernelWrapper::KERNEL_FAST, KernelWrapper::getKernel());
+#ifndef USE_CGAL
+        BOOST_CHECK_EQUAL(0, KernelWrapper::side(plane, point));
+#endif
+        {
+            KernelWrapper::Scope scope_inner(KernelWrapper::KERNEL_EXACT);
+            BOOST_CHECK_EQUAL(1, KernelWrapper::side(plane, point));
+        }
+        BOOST_CHECK_EQUAL(KernelWrapper::KERNEL_FAST, KernelWrapper::getKernel());
+        // other threads keep their own kernel
+        int kernel_other = 0;
+        std::thread other(checkThreadKernel, &kernel_other);
+        other.join();
+        BOOST_CHECK_EQUAL(KernelWrapper::KERNEL_EXACT, kernel_other);
+    }
+    BOOST_CHECK_EQUAL(KernelWrapper::KERNEL_EXACT, KernelWrapper::getKernel());
+    BOOST_CHECK_EQUAL(1, KernelWrapper::side(plane, point));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,7 @@
 #include "algo/3d/PolyhedronBuilder.h"
 #include "data/3d/ptrs.h"
 #include "data/3d/KernelFactory.h"
+#include "data/3d/Polyhedron.h"
 
 BOOST_AUTO_TEST_SUITE(PolyhedronBuilderTest)
 
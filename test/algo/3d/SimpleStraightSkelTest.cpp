@@ -0,0 +1,540 @@
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include "algo/3d/EventQueue.h"
+#include "algo/3d/KernelWrapper.h"
+#include "algo/3d/PolyhedronTransformation.h"
+#include "algo/3d/SimpleStraightSkel.h"
+#include "data/3d/ptrs.h"
+#include "data/3d/HalfEdgeMesh.h"
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Polyhedron.h"
+#include "data/3d/skel/ptrs.h"
+#include "data/3d/skel/AbstractEvent.h"
+#include "data/3d/skel/Node.h"
+#include "data/3d/skel/PierceEvent.h"
+#include "data/3d/skel/TetrahedronEvent.h"
+#include "data/3d/skel/StraightSkeleton.h"
+#include "data/3d/skel/SkelVertexData.h"
+#include "data/3d/skel/SkelFacetData.h"
+#include "db/3d/CheckpointFile.h"
+#include "db/3d/OBJFile.h"
+#include "util/Configuration.h"
+#include "util/Interval.h"
+
+BOOST_AUTO_TEST_SUITE(SimpleStraightSkelTest)
+
+using algo::_3d::EventQueue;
+using algo::_3d::EventQueueSPtr;
+using algo::_3d::KernelWrapper;
+using algo::_3d::PolyhedronTransformation;
+using algo::_3d::SimpleStraightSkel;
+using algo::_3d::SimpleStraightSkelSPtr;
+using data::_3d::EdgeSPtr;
+using data::_3d::FacetSPtr;
+using data::_3d::HalfEdgeMesh;
+using data::_3d::HalfEdgeMeshSPtr;
+using data::_3d::KernelFactory;
+using data::_3d::Plane3;
+using data::_3d::Plane3SPtr;
+using data::_3d::Point3SPtr;
+using data::_3d::PolyhedronSPtr;
+using data::_3d::VertexSPtr;
+using data::_3d::skel::SkelFacetData;
+using data::_3d::skel::SkelVertexData;
+using data::_3d::skel::SkelVertexDataSPtr;
+using data::_3d::skel::AbstractEvent;
+using data::_3d::skel::AbstractEventSPtr;
+using data::_3d::skel::PierceEvent;
+using data::_3d::skel::PierceEventSPtr;
+using data::_3d::skel::StraightSkeletonSPtr;
+using db::_3d::CheckpointFile;
+using db::_3d::CheckpointFileSPtr;
+using db::_3d::OBJFile;
+using util::Configuration;
+using util::Interval;
+
+static const char* EDGE_EVENT_OBJ =
+        "v 9.3045 9.66443 -4.83318\n"
+        "v 9.26746 9.66433 -5.05332\n"
+        "v 9.29157 9.68018 -4.92582\n"
+        "v 9.23021 9.66433 -5.01706\n"
+        "v 9.19591 9.65878 -5.03653\n"
+        "v 9.328091 9.664459 -4.784012\n"
+        "v 9.121927 9.605461 -4.968911\n"
+        "v 9.118991 9.664244 -5.128160\n"
+        "v 9.323335 9.66433 -5.10771\n"
+        "v 9.3 9.4 -5.0\n"
+        "f 3 1 2\n" "f 5 3 2 4\n" "f 1 3 5 7 6\n" "f 4 8 7 5\n"
+        "f 8 4 2 1 6 9\n" "f 9 6 10\n" "f 6 7 10\n" "f 7 8 10\n"
+        "f 8 9 10\n";
+
+static const char* POLYHEDRON_SPLIT_EVENT_OBJ =
+        "v -7 -5 0\n"
+        "v -7 5.5 0\n"
+        "v 9 5.5 0\n"
+        "v 9 -5 0\n"
+        "v 0 -1 0\n"
+        "v 0 1 8\n"
+        "f 1 2 3 4 5\n" "f 1 6 2\n" "f 2 6 3\n"
+        "f 4 3 6\n" "f 4 6 5\n" "f 6 1 5\n";
+
+// 2 tetrahedra, the second one is larger by a factor of 1 + 1e-12.
+// The first one collapses first, but within the tie window of the second.
+static const char* TETRAHEDRA_OBJ =
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 0 1 0\n"
+        "v 0 0 1\n"
+        "v 10 0 0\n"
+        "v 11.000000000001 0 0\n"
+        "v 10 1.000000000001 0\n"
+        "v 10 0 1.000000000001\n"
+        "f 1 3 2\n" "f 1 2 4\n" "f 1 4 3\n" "f 2 3 4\n"
+        "f 5 7 6\n" "f 5 6 8\n" "f 5 8 7\n" "f 6 7 8\n";
+
+static const char* CHECKPOINT_FILE = "SimpleStraightSkelTest.bin";
+
+static PolyhedronSPtr loadOBJ(const char* obj) {
+    const std::string filename = "SimpleStraightSkelTest.obj";
+    std::ofstream ofs(filename.c_str());
+    ofs << obj;
+    ofs.close();
+    PolyhedronSPtr result = OBJFile::load(filename);
+    std::remove(filename.c_str());
+    return result;
+}
+
+/**
+ * Options of SimpleStraightSkel that are set in the configuration.
+ */
+struct SkelOptions {
+    SkelOptions(const std::string& scheduler = "scan",
+            const std::string& propagation = "rebuild") :
+        scheduler(scheduler), propagation(propagation), scanner_threads(1),
+        pierce_search("bvh"), event_batching(false), checkpoint_events(0),
+        parallel_components(false) {
+    }
+    std::string scheduler;
+    std::string propagation;
+    int scanner_threads;
+    std::string pierce_search;
+    bool event_batching;
+    int checkpoint_events;
+    bool parallel_components;
+};
+
+static void configure(const SkelOptions& options) {
+    std::stringstream config;
+    config << "[algo_3d_SimpleStraightSkel]" << std::endl
+            << "const_offset = 0.0" << std::endl
+            << "vertex_splitter = ConvexVertexSplitter" << std::endl
+            << "edge_event = convex" << std::endl
+            << "event_scheduler = " << options.scheduler << std::endl
+            << "propagation = " << options.propagation << std::endl
+            << "scanner_threads = " << options.scanner_threads << std::endl
+            << "pierce_search = " << options.pierce_search << std::endl
+            << "event_batching = " << (options.event_batching ? "TRUE" : "FALSE") << std::endl
+            << "batch_epsilon = 0.000000001" << std::endl
+            << "checkpoint_events = " << options.checkpoint_events << std::endl
+            << "checkpoint_seconds = 0" << std::endl
+            << "checkpoint_file = " << CHECKPOINT_FILE << std::endl
+            << "parallel_components = " << (options.parallel_components ? "TRUE" : "FALSE") << std::endl;
+    Configuration::getInstance()->parse(config);
+}
+
+/**
+ * Loads a model in res/polyhedrons.
+ * Degenerated models are moved randomly like main does
+ * (with the same seed every time), unless rand_move is false.
+ */
+static PolyhedronSPtr loadModel(const std::string& model, bool rand_move = true) {
+    PolyhedronSPtr result = OBJFile::load(
+            std::string(RES_DIR) + "/polyhedrons/" + model);
+    BOOST_REQUIRE(result);
+    if (rand_move && !PolyhedronTransformation::doAll3PlanesIntersect(result)) {
+        PolyhedronTransformation::randMovePoints(result, 0.001);
+        result = SimpleStraightSkel::shiftFacets(result, 0.0);
+        result->clearData();
+    }
+    return result;
+}
+
+static SimpleStraightSkelSPtr createSkel(const SkelOptions& options,
+        PolyhedronSPtr polyhedron) {
+    configure(options);
+    return SimpleStraightSkel::create(polyhedron);
+}
+
+static std::list<AbstractEventSPtr> eventList(StraightSkeletonSPtr skel) {
+    return std::list<AbstractEventSPtr>(skel->events().begin(), skel->events().end());
+}
+
+static std::list<AbstractEventSPtr> runSkel(const SkelOptions& options,
+        PolyhedronSPtr polyhedron) {
+    SimpleStraightSkelSPtr algo = createSkel(options, polyhedron);
+    algo->run();
+    return eventList(algo->getResult());
+}
+
+static void checkEqualEvents(std::list<AbstractEventSPtr>& events_expected,
+        std::list<AbstractEventSPtr>& events_result) {
+    BOOST_CHECK(events_expected.size() > 0);
+    BOOST_CHECK_EQUAL(events_expected.size(), events_result.size());
+    std::list<AbstractEventSPtr>::iterator it_expected = events_expected.begin();
+    std::list<AbstractEventSPtr>::iterator it_result = events_result.begin();
+    while (it_expected != events_expected.end() && it_result != events_result.end()) {
+        AbstractEventSPtr event_expected = *it_expected++;
+        AbstractEventSPtr event_result = *it_result++;
+        BOOST_CHECK_EQUAL(event_expected->getType(), event_result->getType());
+        BOOST_CHECK_CLOSE(event_expected->getOffset(), event_result->getOffset(), 0.001);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testEventQueue) {
+    std::list<AbstractEventSPtr> events_scan = runSkel(
+            SkelOptions("scan"), loadOBJ(EDGE_EVENT_OBJ));
+    std::list<AbstractEventSPtr> events_queue = runSkel(
+            SkelOptions("queue"), loadOBJ(EDGE_EVENT_OBJ));
+    checkEqualEvents(events_scan, events_queue);
+}
+
+BOOST_AUTO_TEST_CASE(testEventQueueModels) {
+    const char* models[] = {
+        "DblEdgeMergeEvent.obj", "DblTriangleEvent.obj", "EdgeEvent.obj",
+        "EdgeEvent_noflip.obj", "EdgeMergeEvent.obj", "EdgeSplitEvent.obj",
+        "FlipVertexEvent.obj", "PierceEvent.obj", "PierceEvent2.obj",
+        "PolyhedronSplitEvent.obj", "SplitMergeEvent.obj",
+        "SplitMergeEvent_reflex.obj", "SurfaceEvent.obj",
+        "SurfaceEvent_reflex.obj", "SurfaceEvent_topol.obj",
+        "TetrahedronEvent.obj", "TriangleEvent.obj", "VertexEvent.obj",
+        "VertexEvent_topol.obj"
+    };
+    const char* propagations[] = {"rebuild", "inplace"};
+    for (unsigned int i = 0; i < 19; i++) {
+        for (unsigned int j = 0; j < 2; j++) {
+            BOOST_TEST_MESSAGE(models[i] << " " << propagations[j]);
+            std::string model = std::string("events/") + models[i];
+            std::list<AbstractEventSPtr> events_scan = runSkel(
+                    SkelOptions("scan", propagations[j]), loadModel(model));
+            std::list<AbstractEventSPtr> events_queue = runSkel(
+                    SkelOptions("queue", propagations[j]), loadModel(model));
+            checkEqualEvents(events_scan, events_queue);
+        }
+    }
+}
+
+/**
+ * The pierce event on top of the queue becomes invalid,
+ * but its vertex pierces a copy of the facet at the same offset.
+ * top() has to scan the vertex again before it chooses the next event.
+ */
+BOOST_AUTO_TEST_CASE(testEventQueueRescan) {
+    const char* models[] = {"PierceEvent.obj", "PierceEvent2.obj"};
+    for (unsigned int i = 0; i < 2; i++) {
+        BOOST_TEST_MESSAGE(models[i]);
+        PolyhedronSPtr polyhedron = loadModel(std::string("events/") + models[i]);
+        SimpleStraightSkelSPtr algo = createSkel(SkelOptions("queue"), polyhedron);
+        BOOST_REQUIRE(algo->init(polyhedron));
+        EventQueueSPtr queue = EventQueue::create();
+        queue->init(polyhedron, 0.0);
+        AbstractEventSPtr event_top = queue->top(0.0);
+        BOOST_REQUIRE(event_top);
+        BOOST_REQUIRE(event_top->getType() == AbstractEvent::PIERCE_EVENT);
+        PierceEventSPtr pierce = std::dynamic_pointer_cast<PierceEvent>(event_top);
+        FacetSPtr facet_copy = pierce->getFacet()->clone();
+        polyhedron->addFacet(facet_copy);
+        pierce->getFacet()->setPlane(KernelWrapper::opposite(pierce->getFacet()->plane()));
+        BOOST_CHECK(!SimpleStraightSkel::nextPierceEvent(
+                pierce->getVertex(), pierce->getFacet(), 0.0));
+        AbstractEventSPtr result = queue->top(0.0);
+        BOOST_REQUIRE(result);
+        BOOST_REQUIRE(result->getType() == AbstractEvent::PIERCE_EVENT);
+        PierceEventSPtr pierce_copy = std::dynamic_pointer_cast<PierceEvent>(result);
+        BOOST_CHECK(pierce_copy->getVertex() == pierce->getVertex());
+        BOOST_CHECK(pierce_copy->getFacet() == facet_copy);
+        BOOST_CHECK_CLOSE(pierce_copy->getOffset(), pierce->getOffset(), 0.001);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testInPlacePropagation) {
+    std::list<AbstractEventSPtr> events_rebuild = runSkel(
+            SkelOptions("scan", "rebuild"), loadOBJ(EDGE_EVENT_OBJ));
+    std::list<AbstractEventSPtr> events_inplace = runSkel(
+            SkelOptions("scan", "inplace"), loadOBJ(EDGE_EVENT_OBJ));
+    checkEqualEvents(events_rebuild, events_inplace);
+}
+
+BOOST_AUTO_TEST_CASE(testInPlacePropagationModels) {
+    const char* models[] = {"events/EdgeSplitEvent.obj", "culver_iron_maiden.obj"};
+    for (unsigned int i = 0; i < 2; i++) {
+        BOOST_TEST_MESSAGE(models[i]);
+        std::list<AbstractEventSPtr> events_rebuild = runSkel(
+                SkelOptions("scan", "rebuild"), loadModel(models[i]));
+        std::list<AbstractEventSPtr> events_inplace = runSkel(
+                SkelOptions("scan", "inplace"), loadModel(models[i]));
+        checkEqualEvents(events_rebuild, events_inplace);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testKineticPropagation) {
+    std::list<AbstractEventSPtr> events_rebuild = runSkel(
+            SkelOptions("scan", "rebuild"), loadOBJ(EDGE_EVENT_OBJ));
+    std::list<AbstractEventSPtr> events_kinetic = runSkel(
+            SkelOptions("scan", "kinetic"), loadOBJ(EDGE_EVENT_OBJ));
+    checkEqualEvents(events_rebuild, events_kinetic);
+}
+
+BOOST_AUTO_TEST_CASE(testKineticPropagationModels) {
+    const char* models[] = {"events/EdgeSplitEvent.obj", "culver_iron_maiden.obj"};
+    for (unsigned int i = 0; i < 2; i++) {
+        BOOST_TEST_MESSAGE(models[i]);
+        std::list<AbstractEventSPtr> events_rebuild = runSkel(
+                SkelOptions("scan", "rebuild"), loadModel(models[i]));
+        std::list<AbstractEventSPtr> events_kinetic = runSkel(
+                SkelOptions("scan", "kinetic"), loadModel(models[i]));
+        checkEqualEvents(events_rebuild, events_kinetic);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testScannerThreads) {
+    const char* models[] = {"events/PierceEvent2.obj", "connected_tunnel.obj"};
+    SkelOptions options_parallel;
+    options_parallel.scanner_threads = 4;
+    for (unsigned int i = 0; i < 2; i++) {
+        BOOST_TEST_MESSAGE(models[i]);
+        std::list<AbstractEventSPtr> events_sequential = runSkel(
+                SkelOptions(), loadModel(models[i]));
+        std::list<AbstractEventSPtr> events_parallel = runSkel(
+                options_parallel, loadModel(models[i]));
+        checkEqualEvents(events_sequential, events_parallel);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testPierceSearch) {
+    const char* models[] = {"events/PierceEvent.obj", "events/PierceEvent2.obj",
+            "connected_tunnel.obj"};
+    SkelOptions options_scan;
+    options_scan.pierce_search = "scan";
+    SkelOptions options_bvh;
+    options_bvh.pierce_search = "bvh";
+    for (unsigned int i = 0; i < 3; i++) {
+        BOOST_TEST_MESSAGE(models[i]);
+        std::list<AbstractEventSPtr> events_scan = runSkel(
+                options_scan, loadModel(models[i]));
+        std::list<AbstractEventSPtr> events_bvh = runSkel(
+                options_bvh, loadModel(models[i]));
+        checkEqualEvents(events_scan, events_bvh);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testEventBatching) {
+    // the two tetrahedron events at the end are simultaneous and independent,
+    // they would not be after moving the points randomly
+    SkelOptions options_batch;
+    options_batch.event_batching = true;
+    std::list<AbstractEventSPtr> events_single = runSkel(
+            SkelOptions(), loadModel("Schoenhardt.obj", false));
+    SimpleStraightSkelSPtr algo = createSkel(options_batch,
+            loadModel("Schoenhardt.obj", false));
+    algo->run();
+    std::list<AbstractEventSPtr> events_batch = eventList(algo->getResult());
+    checkEqualEvents(events_single, events_batch);
+    BOOST_CHECK(algo->getNumBatches() < events_batch.size());
+}
+
+BOOST_AUTO_TEST_CASE(testCheckpoint) {
+    SkelOptions options;
+    options.checkpoint_events = 5;
+    std::list<AbstractEventSPtr> events_full = runSkel(options, loadOBJ(EDGE_EVENT_OBJ));
+    BOOST_REQUIRE(events_full.size() > 5);
+    CheckpointFileSPtr checkpoint = CheckpointFile::load(CHECKPOINT_FILE);
+    std::remove(CHECKPOINT_FILE);
+    BOOST_REQUIRE(checkpoint);
+    BOOST_CHECK(checkpoint->getSkel()->events().size() < events_full.size());
+    SimpleStraightSkelSPtr algo = SimpleStraightSkel::create(checkpoint->getInput());
+    algo->resume(checkpoint);
+    algo->run();
+    std::list<AbstractEventSPtr> events_resumed = eventList(algo->getResult());
+    checkEqualEvents(events_full, events_resumed);
+}
+
+BOOST_AUTO_TEST_CASE(testMaxEvents) {
+    std::list<AbstractEventSPtr> events_full = runSkel(
+            SkelOptions(), loadOBJ(EDGE_EVENT_OBJ));
+    BOOST_REQUIRE(events_full.size() > 3);
+    SimpleStraightSkelSPtr algo = createSkel(SkelOptions(), loadOBJ(EDGE_EVENT_OBJ));
+    algo->setMaxEvents(3);
+    algo->run();
+    std::list<AbstractEventSPtr> events_partial = eventList(algo->getResult());
+    events_full.resize(3);
+    checkEqualEvents(events_full, events_partial);
+}
+
+BOOST_AUTO_TEST_CASE(testMaxOffset) {
+    std::list<AbstractEventSPtr> events_full = runSkel(
+            SkelOptions(), loadOBJ(EDGE_EVENT_OBJ));
+    BOOST_REQUIRE(events_full.size() > 3);
+    std::list<AbstractEventSPtr>::iterator it_e = events_full.begin();
+    std::advance(it_e, 3);
+    double offset_3 = (*it_e)->getOffset();
+    std::advance(it_e, -1);
+    double offset_2 = (*it_e)->getOffset();
+    SimpleStraightSkelSPtr algo = createSkel(SkelOptions(), loadOBJ(EDGE_EVENT_OBJ));
+    algo->setMaxOffset((offset_2 + offset_3) / 2.0);
+    algo->run();
+    std::list<AbstractEventSPtr> events_partial = eventList(algo->getResult());
+    events_full.resize(3);
+    checkEqualEvents(events_full, events_partial);
+}
+
+BOOST_AUTO_TEST_CASE(testKernel) {
+    SkelOptions options;
+    options.scanner_threads = 4;
+    std::list<AbstractEventSPtr> events_exact = runSkel(
+            options, loadModel("events/PierceEvent2.obj"));
+    SimpleStraightSkelSPtr algo = createSkel(options, loadModel("events/PierceEvent2.obj"));
+    BOOST_CHECK_EQUAL(KernelWrapper::KERNEL_EXACT, algo->getKernel());
+    algo->setKernel(KernelWrapper::KERNEL_FAST);
+    algo->run();
+    std::list<AbstractEventSPtr> events_fast = eventList(algo->getResult());
+    checkEqualEvents(events_exact, events_fast);
+    // the kernel of the skeleton does not leak into the calling thread
+    BOOST_CHECK_EQUAL(KernelWrapper::KERNEL_EXACT, KernelWrapper::getKernel());
+}
+
+BOOST_AUTO_TEST_CASE(testParallelComponents) {
+    SkelOptions options_parallel;
+    options_parallel.parallel_components = true;
+    std::list<AbstractEventSPtr> events_sequential = runSkel(
+            SkelOptions(), loadOBJ(POLYHEDRON_SPLIT_EVENT_OBJ));
+    std::list<AbstractEventSPtr> events_parallel = runSkel(
+            options_parallel, loadOBJ(POLYHEDRON_SPLIT_EVENT_OBJ));
+    int num_splits = 0;
+    std::list<AbstractEventSPtr>::iterator it_e = events_sequential.begin();
+    while (it_e != events_sequential.end()) {
+        AbstractEventSPtr event = *it_e++;
+        if (event->getType() == AbstractEvent::POLYHEDRON_SPLIT_EVENT) {
+            num_splits++;
+        }
+    }
+    BOOST_CHECK(num_splits > 0);
+    checkEqualEvents(events_sequential, events_parallel);
+}
+
+BOOST_AUTO_TEST_CASE(testShiftFacetsHalfEdgeMesh) {
+    PolyhedronSPtr polyhedron = loadOBJ(EDGE_EVENT_OBJ);
+    HalfEdgeMeshSPtr mesh = HalfEdgeMesh::create(polyhedron);
+    BOOST_REQUIRE(mesh->isConsistent());
+    HalfEdgeMeshSPtr mesh_offset = SimpleStraightSkel::shiftFacets(mesh, -0.01);
+    BOOST_REQUIRE(mesh_offset);
+    PolyhedronSPtr polyhedron_offset = SimpleStraightSkel::shiftFacets(polyhedron, -0.01);
+    BOOST_REQUIRE(polyhedron_offset);
+    BOOST_CHECK_EQUAL(polyhedron_offset->vertices().size(), mesh_offset->numVertices());
+    unsigned int num_compared = 0;
+    for (uint32_t v = 0; v < mesh_offset->numVertices(); v++) {
+        if (mesh->getVertex(v)->degree() != 3) {
+            // the first 3 facets of vertices of higher degree may differ
+            continue;
+        }
+        num_compared++;
+        SkelVertexData* data = SkelVertexData::of(mesh->getVertex(v));
+        BOOST_REQUIRE(data);
+        VertexSPtr vertex_offset = data->getOffsetVertex();
+        BOOST_CHECK_SMALL(KernelWrapper::distance(
+                vertex_offset->getPoint(), mesh_offset->getPoint(v)), 1e-9);
+    }
+    BOOST_CHECK(num_compared > 0);
+}
+
+BOOST_AUTO_TEST_CASE(testCertifyOffset) {
+    PolyhedronSPtr polyhedron = loadOBJ(EDGE_EVENT_OBJ);
+    SimpleStraightSkelSPtr algo = createSkel(SkelOptions(), polyhedron);
+    BOOST_REQUIRE(algo->init(polyhedron));
+    AbstractEventSPtr event = algo->nextEvent(polyhedron, 0.0);
+    BOOST_REQUIRE(event);
+    Interval<double> interval;
+    BOOST_REQUIRE(SimpleStraightSkel::certifyOffset(event, 0.0, interval));
+    BOOST_CHECK(interval.lower() <= interval.upper());
+    BOOST_CHECK_SMALL(interval.lower() - event->getOffset(), 1e-9);
+    BOOST_CHECK_SMALL(interval.upper() - event->getOffset(), 1e-9);
+    Interval<long double> interval_precise;
+    BOOST_REQUIRE(SimpleStraightSkel::certifyOffset(event, 0.0, interval_precise));
+    BOOST_CHECK(interval_precise.width() <= (long double)interval.width());
+    BOOST_CHECK_EQUAL(0, SimpleStraightSkel::compareEvents(event, event, 0.0));
+    BOOST_CHECK_EQUAL(0, SimpleStraightSkel::certifyOrder(event, event, 0.0));
+    BOOST_CHECK_EQUAL(SimpleStraightSkel::TIE_EPSILON, SimpleStraightSkel::tieWindow(-0.5));
+    BOOST_CHECK_EQUAL(2.0 * SimpleStraightSkel::TIE_EPSILON, SimpleStraightSkel::tieWindow(-2.0));
+}
+
+BOOST_AUTO_TEST_CASE(testCertifiedTie) {
+    PolyhedronSPtr polyhedron = loadOBJ(TETRAHEDRA_OBJ);
+    BOOST_REQUIRE(polyhedron);
+    SimpleStraightSkelSPtr algo = createSkel(SkelOptions(), polyhedron);
+    BOOST_REQUIRE(algo->init(polyhedron));
+    Point3SPtr origin = KernelFactory::createPoint3(0.0, 0.0, 0.0);
+    AbstractEventSPtr event_small;
+    AbstractEventSPtr event_large;
+    util::SlotList<EdgeSPtr>::iterator it_e = polyhedron->edges().begin();
+    while (it_e != polyhedron->edges().end()) {
+        EdgeSPtr edge = *it_e++;
+        AbstractEventSPtr event = SimpleStraightSkel::nextTetrahedronEvent(edge, 0.0);
+        BOOST_REQUIRE(event);
+        if (KernelWrapper::distance(SimpleStraightSkel::getNode(event)->getPoint(), origin) < 5.0) {
+            event_small = event;
+        } else {
+            event_large = event;
+        }
+    }
+    BOOST_REQUIRE(event_small && event_large);
+    double diff = event_small->getOffset() - event_large->getOffset();
+    BOOST_CHECK(fabs(diff) < SimpleStraightSkel::TIE_EPSILON);
+    BOOST_CHECK_EQUAL(1, SimpleStraightSkel::certifyOrder(event_small, event_large, 0.0));
+    BOOST_CHECK_EQUAL(-1, SimpleStraightSkel::certifyOrder(event_large, event_small, 0.0));
+    // the scanner returns the certified first event
+    AbstractEventSPtr result = SimpleStraightSkel::nextTetrahedronEvent(polyhedron, 0.0);
+    BOOST_REQUIRE(result);
+    BOOST_CHECK(KernelWrapper::distance(SimpleStraightSkel::getNode(result)->getPoint(), origin) < 5.0);
+    // rounded offsets in the wrong order do not change the certified order
+    SimpleStraightSkel::getNode(event_large)->setOffset(
+            event_small->getOffset() + 0.5 * SimpleStraightSkel::TIE_EPSILON);
+    BOOST_CHECK_EQUAL(1, SimpleStraightSkel::compareEvents(event_small, event_large, 0.0));
+    BOOST_CHECK(SimpleStraightSkel::isNextEvent(event_small, event_large, 0.0));
+    BOOST_CHECK(!SimpleStraightSkel::isNextEvent(event_large, event_small, 0.0));
+}
+
+BOOST_AUTO_TEST_CASE(testOffsetPlane) {
+    PolyhedronSPtr polyhedron = loadOBJ(EDGE_EVENT_OBJ);
+    SimpleStraightSkelSPtr algo = createSkel(SkelOptions(), polyhedron);
+    BOOST_REQUIRE(algo->init(polyhedron));
+    util::SlotList<FacetSPtr>::iterator it_f = polyhedron->facets().begin();
+    while (it_f != polyhedron->facets().end()) {
+        FacetSPtr facet = *it_f++;
+        SkelFacetData* data = SkelFacetData::of(facet);
+        BOOST_REQUIRE(data);
+        BOOST_CHECK(data->hasUnitPlane(facet->plane()));
+        Plane3 expected = KernelWrapper::offsetPlane(*facet->plane(),
+                -0.5 * data->getSpeed());
+        Plane3 result = SimpleStraightSkel::offsetPlane(facet.get(), -0.5);
+        BOOST_CHECK_SMALL(KernelWrapper::distance(result, expected.point()), 1e-12);
+        // a new plane is not found in the cache, but gives the same result
+        Plane3SPtr plane = KernelFactory::createPlane3(*facet->plane());
+        facet->setPlane(plane);
+        BOOST_CHECK(!data->hasUnitPlane(plane));
+        result = SimpleStraightSkel::offsetPlane(facet.get(), -0.5);
+        BOOST_CHECK_SMALL(KernelWrapper::distance(result, expected.point()), 1e-12);
+        SimpleStraightSkel::initUnitPlane(facet);
+        BOOST_CHECK(data->hasUnitPlane(plane));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,57 @@
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include "algo/3d/ptrs.h"
+#include "algo/3d/SkelSettings.h"
+#include "util/Configuration.h"
+
+BOOST_AUTO_TEST_SUITE(SkelSettingsTest)
+
+using algo::_3d::SkelSettings;
+using algo::_3d::SkelSettingsSPtr;
+using util::Configuration;
+
+BOOST_AUTO_TEST_CASE(testCreate) {
+    std::stringstream config;
+    config << "[algo_3d_SimpleStraightSkel]" << std::endl
+            << "vertex_splitter = VolumeVertexSplitter" << std::endl
+            << "edge_event = flip" << std::endl
+            << "event_scheduler = queue" << std::endl
+            << "propagation = kinetic" << std::endl
+            << "scanner_threads = 4" << std::endl
+            << "pierce_search = scan" << std::endl
+            << "event_batching = TRUE" << std::endl
+            << "batch_epsilon = 0.5" << std::endl
+            << "checkpoint_file = test.bin" << std::endl
+            << "checkpoint_events = 10" << std::endl
+            << "checkpoint_seconds = -1" << std::endl
+            << "parallel_components = TRUE" << std::endl;
+    Configuration::getInstance()->parse(config);
+    SkelSettingsSPtr settings = SkelSettings::create();
+    BOOST_CHECK_EQUAL(SkelSettings::VOLUME_VERTEX_SPLITTER, settings->getVertexSplitter());
+    BOOST_CHECK_EQUAL(SkelSettings::FLIP_EDGE_EVENT, settings->getEdgeEvent());
+    BOOST_CHECK_EQUAL("flip", settings->getEdgeEventName());
+    BOOST_CHECK_EQUAL(SkelSettings::QUEUE_EVENT_SCHEDULER, settings->getEventScheduler());
+    BOOST_CHECK_EQUAL(SkelSettings::KINETIC_PROPAGATION, settings->getPropagation());
+    BOOST_CHECK_EQUAL(4u, settings->getScannerThreads());
+    BOOST_CHECK_EQUAL(SkelSettings::SCAN_PIERCE_SEARCH, settings->getPierceSearch());
+    // the event queue does not batch events
+    BOOST_CHECK(!settings->getEventBatching());
+    BOOST_CHECK_EQUAL(0.5, settings->getBatchEpsilon());
+    BOOST_CHECK_EQUAL("test.bin", settings->getCheckpointFile());
+    BOOST_CHECK_EQUAL(10u, settings->getCheckpointEvents());
+    // invalid values fall back to the defaults
+    BOOST_CHECK_EQUAL(0.0, settings->getCheckpointSeconds());
+    BOOST_CHECK(settings->getParallelComponents());
+
+    // the settings do not change with the configuration
+    std::stringstream config_other;
+    config_other << "[algo_3d_SimpleStraightSkel]" << std::endl
+            << "propagation = unknown" << std::endl;
+    Configuration::getInstance()->parse(config_other);
+    SkelSettingsSPtr settings_other = SkelSettings::create();
+    BOOST_CHECK_EQUAL(SkelSettings::REBUILD_PROPAGATION, settings_other->getPropagation());
+    BOOST_CHECK_EQUAL(SkelSettings::KINETIC_PROPAGATION, settings->getPropagation());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
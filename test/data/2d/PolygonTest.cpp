@@ -8,6 +8,7 @@
 #include "data/2d/Edge.h"
 
 using namespace data::_2d;
+using std::list;
 
 BOOST_AUTO_TEST_SUITE(PolygonTest)
 
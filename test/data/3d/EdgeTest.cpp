@@ -24,4 +24,17 @@ BOOST_AUTO_TEST_CASE(testConstructor) {
     BOOST_CHECK(result == expected);
 }
 
+BOOST_AUTO_TEST_CASE(testDestructor) {
+    Point3SPtr p = KernelFactory::createPoint3(-1.0, -1.0, -1.0);
+    Point3SPtr q = KernelFactory::createPoint3(1.0, 1.0, -1.0);
+    VertexSPtr src = Vertex::create(p);
+    VertexSPtr dst = Vertex::create(q);
+    EdgeSPtr edge = Edge::create(src, dst);
+    BOOST_CHECK_EQUAL(1u, src->edges().size());
+    BOOST_CHECK_EQUAL(1u, dst->edges().size());
+    edge.reset();
+    BOOST_CHECK_EQUAL(0u, src->edges().size());
+    BOOST_CHECK_EQUAL(0u, dst->edges().size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -5,8 +5,14 @@
 #include "data/3d/KernelFactory.h"
 #include "data/3d/Vertex.h"
 #include "data/3d/Edge.h"
+#include "data/2d/KernelFactory.h"
+#include "data/2d/Polygon.h"
+#include "data/2d/Vertex.h"
+#include "data/2d/Edge.h"
+#include <list>
 
 using namespace data::_3d;
+using std::list;
 
 BOOST_AUTO_TEST_SUITE(FacetTest)
 
@@ -0,0 +1,85 @@
+#include <boost/test/unit_test.hpp>
+
+#include "data/3d/HalfEdgeMesh.h"
+#include "data/3d/ptrs.h"
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Polyhedron.h"
+
+
+using namespace data::_3d;
+
+BOOST_AUTO_TEST_SUITE(HalfEdgeMeshTest)
+
+static PolyhedronSPtr createTetrahedron() {
+    const unsigned int num_vertices = 4;
+    const unsigned int num_edges = 6;
+    const unsigned int num_facets = 4;
+    Point3SPtr points[num_vertices];
+    points[0] = KernelFactory::createPoint3(-1.0, -1.0, -1.0);
+    points[1] = KernelFactory::createPoint3(1.0, 1.0, -1.0);
+    points[2] = KernelFactory::createPoint3(1.0, -1.0, 1.0);
+    points[3] = KernelFactory::createPoint3(-1.0, 1.0, 1.0);
+    VertexSPtr vertices[num_vertices];
+    for (unsigned int i = 0; i < num_vertices; i++) {
+        vertices[i] = Vertex::create(points[i]);
+    }
+    EdgeSPtr edges[num_edges];
+    edges[0] = Edge::create(vertices[0], vertices[1]);
+    edges[1] = Edge::create(vertices[1], vertices[2]);
+    edges[2] = Edge::create(vertices[2], vertices[0]);
+    edges[3] = Edge::create(vertices[2], vertices[3]);
+    edges[4] = Edge::create(vertices[3], vertices[0]);
+    edges[5] = Edge::create(vertices[3], vertices[1]);
+    FacetSPtr facets[num_facets];
+    facets[0] = Facet::create(3, edges);
+    facets[1] = Facet::create(3, &(edges[2]));
+    EdgeSPtr edges2[] = {edges[4], edges[5], edges[0]};
+    facets[2] = Facet::create(3, edges2);
+    EdgeSPtr edges3[] = {edges[5], edges[3], edges[1]};
+    facets[3] = Facet::create(3, edges3);
+    return Polyhedron::create(num_facets, facets);
+}
+
+BOOST_AUTO_TEST_CASE(testCreate) {
+    PolyhedronSPtr polyhedron = createTetrahedron();
+    HalfEdgeMeshSPtr mesh = HalfEdgeMesh::create(polyhedron);
+    BOOST_CHECK_EQUAL(4u, mesh->numVertices());
+    BOOST_CHECK_EQUAL(6u, mesh->numEdges());
+    BOOST_CHECK_EQUAL(12u, mesh->numHalfEdges());
+    BOOST_CHECK_EQUAL(4u, mesh->numFacets());
+    BOOST_CHECK(mesh->isConsistent());
+    for (uint32_t h = 0; h < mesh->numHalfEdges(); h++) {
+        BOOST_CHECK_EQUAL(h, mesh->prev(mesh->next(h)));
+        BOOST_CHECK_EQUAL(h, mesh->twin(mesh->twin(h)));
+        BOOST_CHECK_EQUAL(mesh->dest(h), mesh->origin(mesh->next(h)));
+        BOOST_CHECK_EQUAL(mesh->origin(h), mesh->origin(mesh->nextAround(h)));
+        FacetSPtr facet = mesh->getFacet(mesh->facet(h));
+        EdgeSPtr edge = mesh->getEdge(mesh->edge(h));
+        BOOST_CHECK(edge->next(facet) == mesh->getEdge(mesh->edge(mesh->next(h))));
+        BOOST_CHECK(edge->prev(facet) == mesh->getEdge(mesh->edge(mesh->prev(h))));
+        BOOST_CHECK(edge->src(facet) == mesh->getVertex(mesh->origin(h)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testToPolyhedron) {
+    PolyhedronSPtr polyhedron = createTetrahedron();
+    HalfEdgeMeshSPtr mesh = HalfEdgeMesh::create(polyhedron);
+    PolyhedronSPtr result = mesh->toPolyhedron();
+    BOOST_CHECK(result->isConsistent());
+    BOOST_CHECK_EQUAL(polyhedron->vertices().size(), result->vertices().size());
+    BOOST_CHECK_EQUAL(polyhedron->edges().size(), result->edges().size());
+    BOOST_CHECK_EQUAL(polyhedron->facets().size(), result->facets().size());
+    HalfEdgeMeshSPtr mesh_2 = HalfEdgeMesh::create(result);
+    BOOST_CHECK(mesh_2->isConsistent());
+    for (uint32_t h = 0; h < mesh->numHalfEdges(); h++) {
+        BOOST_CHECK_EQUAL(mesh->next(h), mesh_2->next(h));
+        BOOST_CHECK_EQUAL(mesh->twin(h), mesh_2->twin(h));
+        BOOST_CHECK_EQUAL(mesh->origin(h), mesh_2->origin(h));
+        BOOST_CHECK_EQUAL(mesh->facet(h), mesh_2->facet(h));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+#include <boost/test/unit_test.hpp>
+
+#include "data/3d/PointPool.h"
+#include "data/3d/ptrs.h"
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Polyhedron.h"
+
+using namespace data::_3d;
+
+BOOST_AUTO_TEST_SUITE(PointPoolTest)
+
+BOOST_AUTO_TEST_CASE(testCreate) {
+    Point3SPtr point = KernelFactory::createPoint3(1.0, 2.0, 3.0);
+    VertexSPtr vertex_1 = Vertex::create(point);
+    VertexSPtr vertex_2 = Vertex::create(point);
+    VertexSPtr vertex_3 = Vertex::create(KernelFactory::createPoint3(1.0, 2.0, 3.0));
+    PolyhedronSPtr polyhedron = Polyhedron::create();
+    polyhedron->addVertex(vertex_1);
+    polyhedron->addVertex(vertex_2);
+    polyhedron->addVertex(vertex_3);
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    BOOST_CHECK_EQUAL(3u, points->numVertices());
+    BOOST_CHECK_EQUAL(2u, points->numPoints());
+    BOOST_CHECK_EQUAL(points->pointIndex(0), points->pointIndex(1));
+    BOOST_CHECK(points->pointIndex(0) != points->pointIndex(2));
+    BOOST_CHECK_EQUAL(2.0, points->getY(points->pointIndex(2)));
+}
+
+BOOST_AUTO_TEST_CASE(testTransform) {
+    Point3SPtr point = KernelFactory::createPoint3(1.0, 2.0, 3.0);
+    VertexSPtr vertex_1 = Vertex::create(point);
+    VertexSPtr vertex_2 = Vertex::create(point);
+    VertexSPtr vertex_3 = Vertex::create(KernelFactory::createPoint3(-1.0, 0.0, 1.0));
+    PolyhedronSPtr polyhedron = Polyhedron::create();
+    polyhedron->addVertex(vertex_1);
+    polyhedron->addVertex(vertex_2);
+    polyhedron->addVertex(vertex_3);
+    PointPoolSPtr points = PointPool::create(polyhedron);
+    points->scale(2.0, 2.0, 2.0);
+    points->translate(1.0, 0.0, -1.0);
+    points->apply();
+    BOOST_CHECK(vertex_1->isCoincident(vertex_2));
+    BOOST_CHECK(!vertex_1->isCoincident(vertex_3));
+    BOOST_CHECK_EQUAL(3.0, vertex_1->getX());
+    BOOST_CHECK_EQUAL(4.0, vertex_1->getY());
+    BOOST_CHECK_EQUAL(5.0, vertex_1->getZ());
+    BOOST_CHECK_EQUAL(-1.0, vertex_3->getX());
+    BOOST_CHECK_EQUAL(0.0, vertex_3->getY());
+    BOOST_CHECK_EQUAL(1.0, vertex_3->getZ());
+}
+
+BOOST_AUTO_TEST_CASE(testBoundingBox) {
+    PointPoolSPtr points = PointPool::create();
+    double box_min[3];
+    double box_max[3];
+    BOOST_CHECK(!points->boundingBox(box_min, box_max));
+    points->addPoint(1.0, -2.0, 3.0);
+    points->addPoint(-1.0, 2.0, 0.0);
+    points->addPoint(0.5, 0.0, 4.0);
+    BOOST_REQUIRE(points->boundingBox(box_min, box_max));
+    BOOST_CHECK_EQUAL(-1.0, box_min[0]);
+    BOOST_CHECK_EQUAL(-2.0, box_min[1]);
+    BOOST_CHECK_EQUAL(0.0, box_min[2]);
+    BOOST_CHECK_EQUAL(1.0, box_max[0]);
+    BOOST_CHECK_EQUAL(2.0, box_max[1]);
+    BOOST_CHECK_EQUAL(4.0, box_max[2]);
+    BOOST_CHECK(points->isInsideBox(box_min, box_max));
+    box_max[2] = 3.5;
+    BOOST_CHECK(!points->isInsideBox(box_min, box_max));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
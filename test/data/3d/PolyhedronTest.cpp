@@ -44,4 +44,52 @@ BOOST_AUTO_TEST_CASE(testConstructor) {
     BOOST_CHECK(polyhedron->isConsistent());
 }
 
+BOOST_AUTO_TEST_CASE(testClone) {
+    const unsigned int num_vertices = 4;
+    const unsigned int num_edges = 6;
+    const unsigned int num_facets = 4;
+    Point3SPtr points[num_vertices];
+    points[0] = KernelFactory::createPoint3(-1.0, -1.0, -1.0);
+    points[1] = KernelFactory::createPoint3(1.0, 1.0, -1.0);
+    points[2] = KernelFactory::createPoint3(1.0, -1.0, 1.0);
+    points[3] = KernelFactory::createPoint3(-1.0, 1.0, 1.0);
+    VertexSPtr vertices[num_vertices];
+    for (unsigned int i = 0; i < num_vertices; i++) {
+        vertices[i] = Vertex::create(points[i]);
+    }
+    EdgeSPtr edges[num_edges];
+    edges[0] = Edge::create(vertices[0], vertices[1]);
+    edges[1] = Edge::create(vertices[1], vertices[2]);
+    edges[2] = Edge::create(vertices[2], vertices[0]);
+    edges[3] = Edge::create(vertices[2], vertices[3]);
+    edges[4] = Edge::create(vertices[3], vertices[0]);
+    edges[5] = Edge::create(vertices[3], vertices[1]);
+    FacetSPtr facets[num_facets];
+    facets[0] = Facet::create(3, edges);
+    facets[1] = Facet::create(3, &(edges[2]));
+    EdgeSPtr edges2[] = {edges[4], edges[5], edges[0]};
+    facets[2] = Facet::create(3, edges2);
+    EdgeSPtr edges3[] = {edges[5], edges[3], edges[1]};
+    facets[3] = Facet::create(3, edges3);
+    PolyhedronSPtr polyhedron = Polyhedron::create();
+    // leaves a gap in the slots of the vertices
+    VertexSPtr vertex_removed = Vertex::create(KernelFactory::createPoint3(0.0, 0.0, 0.0));
+    polyhedron->addVertex(vertex_removed);
+    for (unsigned int i = 0; i < num_facets; i++) {
+        polyhedron->addFacet(facets[i]);
+    }
+    polyhedron->removeVertex(vertex_removed);
+    PolyhedronSPtr polyhedron_c = polyhedron->clone();
+    BOOST_CHECK(polyhedron_c->isConsistent());
+    BOOST_CHECK_EQUAL(num_vertices, polyhedron_c->vertices().size());
+    BOOST_CHECK_EQUAL(num_edges, polyhedron_c->edges().size());
+    BOOST_CHECK_EQUAL(num_facets, polyhedron_c->facets().size());
+    for (unsigned int i = 0; i < num_vertices; i++) {
+        // the points are shared
+        VertexSPtr vertex_c = polyhedron_c->findVertex(vertices[i]);
+        BOOST_CHECK(vertex_c);
+        BOOST_CHECK(vertex_c != vertices[i]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
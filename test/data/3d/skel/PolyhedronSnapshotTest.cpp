@@ -0,0 +1,146 @@
+#include <boost/test/unit_test.hpp>
+
+#include "data/3d/skel/PolyhedronSnapshot.h"
+#include "data/3d/skel/SkelVertexData.h"
+#include "data/3d/skel/Node.h"
+#include "data/3d/skel/Arc.h"
+#include "data/3d/skel/ConstOffsetEvent.h"
+#include "data/3d/ptrs.h"
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+#include "data/3d/Polyhedron.h"
+
+using namespace data::_3d;
+using namespace data::_3d::skel;
+
+BOOST_AUTO_TEST_SUITE(PolyhedronSnapshotTest)
+
+static PolyhedronSPtr createTetrahedron(VertexSPtr vertices[]) {
+    const unsigned int num_vertices = 4;
+    const unsigned int num_edges = 6;
+    const unsigned int num_facets = 4;
+    Point3SPtr points[num_vertices];
+    points[0] = KernelFactory::createPoint3(-1.0, -1.0, -1.0);
+    points[1] = KernelFactory::createPoint3(1.0, 1.0, -1.0);
+    points[2] = KernelFactory::createPoint3(1.0, -1.0, 1.0);
+    points[3] = KernelFactory::createPoint3(-1.0, 1.0, 1.0);
+    for (unsigned int i = 0; i < num_vertices; i++) {
+        vertices[i] = Vertex::create(points[i]);
+    }
+    EdgeSPtr edges[num_edges];
+    edges[0] = Edge::create(vertices[0], vertices[1]);
+    edges[1] = Edge::create(vertices[1], vertices[2]);
+    edges[2] = Edge::create(vertices[2], vertices[0]);
+    edges[3] = Edge::create(vertices[2], vertices[3]);
+    edges[4] = Edge::create(vertices[3], vertices[0]);
+    edges[5] = Edge::create(vertices[3], vertices[1]);
+    FacetSPtr facets[num_facets];
+    facets[0] = Facet::create(3, edges);
+    facets[1] = Facet::create(3, &(edges[2]));
+    EdgeSPtr edges2[] = {edges[4], edges[5], edges[0]};
+    facets[2] = Facet::create(3, edges2);
+    EdgeSPtr edges3[] = {edges[5], edges[3], edges[1]};
+    facets[3] = Facet::create(3, edges3);
+    PolyhedronSPtr result = Polyhedron::create(num_facets, facets);
+    result->initPlanes();
+    return result;
+}
+
+static bool containsPoint(PolyhedronSPtr polyhedron, double x, double y, double z) {
+    bool result = false;
+    util::SlotList<VertexSPtr>::iterator it_v = polyhedron->vertices().begin();
+    while (it_v != polyhedron->vertices().end()) {
+        Point3SPtr point = (*it_v++)->getPoint();
+        if ((*point)[0] == x && (*point)[1] == y && (*point)[2] == z) {
+            result = true;
+            break;
+        }
+    }
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(testToPolyhedron) {
+    VertexSPtr vertices[4];
+    PolyhedronSPtr polyhedron = createTetrahedron(vertices);
+    PolyhedronSnapshotSPtr snapshot = PolyhedronSnapshot::create(polyhedron, 0.0);
+    BOOST_CHECK_EQUAL(4u, snapshot->numVertices());
+    BOOST_CHECK_EQUAL(6u, snapshot->numEdges());
+    BOOST_CHECK_EQUAL(4u, snapshot->numFacets());
+    BOOST_CHECK_EQUAL(0u, snapshot->numSharedFacets());
+    PolyhedronSPtr result = snapshot->toPolyhedron();
+    BOOST_CHECK_EQUAL(4u, result->vertices().size());
+    BOOST_CHECK_EQUAL(6u, result->edges().size());
+    BOOST_CHECK_EQUAL(4u, result->facets().size());
+    BOOST_CHECK(result->isConsistent());
+    for (unsigned int i = 0; i < 4; i++) {
+        Point3SPtr point = vertices[i]->getPoint();
+        BOOST_CHECK(containsPoint(result, (*point)[0], (*point)[1], (*point)[2]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testShared) {
+    VertexSPtr vertices[4];
+    PolyhedronSPtr polyhedron = createTetrahedron(vertices);
+    PolyhedronSnapshotSPtr snapshot_1 = PolyhedronSnapshot::create(polyhedron, 0.0);
+    PolyhedronSnapshotSPtr snapshot_2 =
+            PolyhedronSnapshot::create(polyhedron, 0.0, snapshot_1);
+    BOOST_CHECK_EQUAL(4u, snapshot_2->numSharedFacets());
+    // only the facet opposite of the moved vertex stays the same
+    vertices[3]->setPoint(KernelFactory::createPoint3(-1.0, 1.0, 2.0));
+    PolyhedronSnapshotSPtr snapshot_3 =
+            PolyhedronSnapshot::create(polyhedron, 0.0, snapshot_2);
+    BOOST_CHECK_EQUAL(1u, snapshot_3->numSharedFacets());
+    BOOST_CHECK(snapshot_3->toPolyhedron()->isConsistent());
+}
+
+BOOST_AUTO_TEST_CASE(testTrajectory) {
+    VertexSPtr vertices[4];
+    PolyhedronSPtr polyhedron = createTetrahedron(vertices);
+    NodeSPtr node = Node::create(KernelFactory::createPoint3(-1.0, 1.0, 1.0));
+    ArcSPtr arc = Arc::create(node, KernelFactory::createVector3(0.0, 0.0, 1.0));
+    SkelVertexDataSPtr data = SkelVertexData::create(vertices[3]);
+    data->setArc(arc);
+    PolyhedronSnapshotSPtr snapshot_1 = PolyhedronSnapshot::create(polyhedron, 0.0);
+    // the vertex moves along its arc
+    vertices[3]->setPoint(KernelFactory::createPoint3(-1.0, 1.0, 2.0));
+    PolyhedronSnapshotSPtr snapshot_2 =
+            PolyhedronSnapshot::create(polyhedron, -1.0, snapshot_1);
+    BOOST_CHECK_EQUAL(4u, snapshot_2->numSharedFacets());
+    PolyhedronSPtr result_1 = snapshot_1->toPolyhedron();
+    PolyhedronSPtr result_2 = snapshot_2->toPolyhedron();
+    BOOST_CHECK(containsPoint(result_1, -1.0, 1.0, 1.0));
+    BOOST_CHECK(!containsPoint(result_2, -1.0, 1.0, 1.0));
+    BOOST_CHECK(containsPoint(result_2, -1.0, 1.0, 2.0));
+}
+
+BOOST_AUTO_TEST_CASE(testCoincidentVertices) {
+    VertexSPtr vertices[4];
+    PolyhedronSPtr polyhedron = createTetrahedron(vertices);
+    Point3SPtr point = KernelFactory::createPoint3(3.0, 3.0, 3.0);
+    polyhedron->addVertex(Vertex::create(point));
+    PolyhedronSnapshotSPtr snapshot_1 = PolyhedronSnapshot::create(polyhedron, 0.0);
+    // a second vertex at the same point is another vertex
+    polyhedron->addVertex(Vertex::create(point));
+    PolyhedronSnapshotSPtr snapshot_2 =
+            PolyhedronSnapshot::create(polyhedron, 0.0, snapshot_1);
+    BOOST_CHECK_EQUAL(6u, snapshot_2->numVertices());
+    BOOST_CHECK_EQUAL(6u, snapshot_2->toPolyhedron()->vertices().size());
+}
+
+BOOST_AUTO_TEST_CASE(testPolyhedronResult) {
+    VertexSPtr vertices[4];
+    PolyhedronSPtr polyhedron = createTetrahedron(vertices);
+    AbstractEventSPtr event = ConstOffsetEvent::create(-1.0);
+    event->setSnapshot(PolyhedronSnapshot::create(polyhedron, -1.0));
+    // the created polyhedron is reused while it is held
+    PolyhedronSPtr result_1 = event->getPolyhedronResult();
+    PolyhedronSPtr result_2 = event->getPolyhedronResult();
+    BOOST_CHECK(result_1);
+    BOOST_CHECK(result_1 == result_2);
+    event->setSnapshot(PolyhedronSnapshot::create(polyhedron, -1.0));
+    BOOST_CHECK(event->getPolyhedronResult() != result_1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,45 @@
+#include <boost/test/unit_test.hpp>
+
+#include "data/3d/skel/SkelVertexData.h"
+#include "data/3d/skel/SkelEdgeData.h"
+#include "data/3d/skel/SkelFacetData.h"
+#include "data/3d/ptrs.h"
+#include "data/3d/KernelFactory.h"
+#include "data/3d/Vertex.h"
+#include "data/3d/VertexData.h"
+#include "data/3d/Edge.h"
+#include "data/3d/Facet.h"
+
+using namespace data::_3d;
+using namespace data::_3d::skel;
+
+BOOST_AUTO_TEST_SUITE(SkelVertexDataTest)
+
+BOOST_AUTO_TEST_CASE(testOf) {
+    Point3SPtr p = KernelFactory::createPoint3(-1.0, -1.0, -1.0);
+    Point3SPtr q = KernelFactory::createPoint3(1.0, 1.0, -1.0);
+    VertexSPtr src = Vertex::create(p);
+    VertexSPtr dst = Vertex::create(q);
+    BOOST_CHECK(SkelVertexData::of(src) == 0);
+    VertexData::create(src);
+    BOOST_CHECK_EQUAL(VertexData::VERTEX_DATA, src->getData()->getType());
+    BOOST_CHECK(SkelVertexData::of(src) == 0);
+    SkelVertexDataSPtr data = SkelVertexData::create(src);
+    BOOST_CHECK_EQUAL(VertexData::SKEL_VERTEX_DATA, data->getType());
+    BOOST_CHECK(SkelVertexData::of(src) == data.get());
+    BOOST_CHECK(SkelVertexData::of(dst) == 0);
+
+    EdgeSPtr edge = Edge::create(src, dst);
+    BOOST_CHECK(SkelEdgeData::of(edge) == 0);
+    SkelEdgeDataSPtr edge_data = SkelEdgeData::create(edge);
+    BOOST_CHECK(SkelEdgeData::of(edge) == edge_data.get());
+
+    FacetSPtr facet = Facet::create();
+    BOOST_CHECK(SkelFacetData::of(facet) == 0);
+    SkelFacetDataSPtr facet_data = SkelFacetData::create(facet);
+    facet_data->setSpeed(2.0);
+    BOOST_CHECK(SkelFacetData::of(facet) == facet_data.get());
+    BOOST_CHECK_EQUAL(2.0, SkelFacetData::of(facet)->getSpeed());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
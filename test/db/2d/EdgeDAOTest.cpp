@@ -4,7 +4,13 @@
 #include "data/2d/ptrs.h"
 #include "db/2d/ptrs.h"
 #include "db/2d/DAOFactory.h"
+#include "data/2d/KernelFactory.h"
+#include "data/2d/Polygon.h"
+#include "data/2d/Vertex.h"
+#include "data/2d/Edge.h"
+#include "db/2d/VertexDAO.h"
 
+using namespace data::_2d;
 using namespace db::_2d;
 
 BOOST_AUTO_TEST_SUITE(EdgeDAOTest)
@@ -1,12 +1,15 @@
 #include <boost/test/unit_test.hpp>
 
 #include "kernel/intersection.h"
+#include "kernel/intersection_batch.h"
 #include "kernel/Point2.h"
 #include "kernel/Line2.h"
 #include "kernel/Point3.h"
 #include "kernel/Plane3.h"
 #include "kernel/Line3.h"
 #include "kernel/Vector3.h"
+#include <cstdlib>
+#include <vector>
 
 using kernel::intersection;
 using kernel::Point2;
@@ -15,6 +18,8 @@ using kernel::Point3;
 using kernel::Plane3;
 using kernel::Line3;
 using kernel::Vector3;
+using kernel::PlaneTriples;
+using kernel::SimdLevel;
 
 BOOST_AUTO_TEST_SUITE(IntersectionTest)
 
@@ -146,4 +151,46 @@ BOOST_AUTO_TEST_CASE(testIntersectionPlanesNone) {
     BOOST_CHECK(0 == result);
 }
 
+BOOST_AUTO_TEST_CASE(testIntersectionBatch) {
+    // not a multiple of the vector width, to cover the remainder
+    const size_t n = 67;
+    std::vector<double> coeffs[12];
+    srand(0);
+    for (unsigned int k = 0; k < 12; k++) {
+        for (size_t i = 0; i < n; i++) {
+            coeffs[k].push_back(2.0*((double)rand()/(double)RAND_MAX) - 1.0);
+        }
+    }
+    // the normals of triple 5 are parallel to the xy-plane
+    for (unsigned int j = 0; j < 3; j++) {
+        coeffs[4*j+2][5] = 0.0;
+    }
+    PlaneTriples planes;
+    for (unsigned int j = 0; j < 3; j++) {
+        planes.a[j] = &(coeffs[4*j][0]);
+        planes.b[j] = &(coeffs[4*j+1][0]);
+        planes.c[j] = &(coeffs[4*j+2][0]);
+        planes.d[j] = &(coeffs[4*j+3][0]);
+    }
+    for (int level = kernel::SIMD_SCALAR; level <= kernel::simdLevelSupported(); level++) {
+        std::vector<double> x(n), y(n), z(n);
+        std::vector<unsigned char> valid(n);
+        size_t num_valid = intersection(n, planes, &x[0], &y[0], &z[0], &valid[0],
+                (SimdLevel)level);
+        BOOST_CHECK_EQUAL(n-1, num_valid);
+        for (size_t i = 0; i < n; i++) {
+            Plane3 p1(coeffs[0][i], coeffs[1][i], coeffs[2][i], coeffs[3][i]);
+            Plane3 p2(coeffs[4][i], coeffs[5][i], coeffs[6][i], coeffs[7][i]);
+            Plane3 p3(coeffs[8][i], coeffs[9][i], coeffs[10][i], coeffs[11][i]);
+            std::optional<Point3> point = intersection(p1, p2, p3);
+            BOOST_CHECK_EQUAL((bool)point, valid[i] != 0);
+            if (point && valid[i]) {
+                BOOST_CHECK_EQUAL(point->getX(), x[i]);
+                BOOST_CHECK_EQUAL(point->getY(), y[i]);
+                BOOST_CHECK_EQUAL(point->getZ(), z[i]);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
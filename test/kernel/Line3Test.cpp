@@ -3,6 +3,7 @@
 #include "kernel/Line3.h"
 #include "kernel/Point3.h"
 #include "kernel/Vector3.h"
+#include <type_traits>
 
 using kernel::Line3;
 using kernel::Point3;
@@ -35,5 +36,20 @@ BOOST_AUTO_TEST_CASE(testHasOn) {
     BOOST_CHECK(!l.hasOn(isnot));
 }
 
+BOOST_AUTO_TEST_CASE(testCopy) {
+    BOOST_CHECK(std::is_trivially_copyable<Line3>::value);
+    Point3 p(1.0, 1.0, 1.0);
+    Point3 q(1.0, 2.0, 3.0);
+
+    Line3 l(p, q);
+    Line3 copy;
+    copy = l;
+    l = l.opposite();
+
+    BOOST_CHECK(p == copy.point());
+    BOOST_CHECK(Vector3(0.0, 1.0, 2.0) == copy.direction());
+    BOOST_CHECK(Vector3(0.0, -1.0, -2.0) == l.direction());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
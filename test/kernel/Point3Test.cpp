@@ -1,6 +1,8 @@
 #include <boost/test/unit_test.hpp>
 
 #include "kernel/Point3.h"
+#include <cstring>
+#include <type_traits>
 
 using kernel::Point3;
 using kernel::Vector3;
@@ -28,5 +30,19 @@ BOOST_AUTO_TEST_CASE(testOperator) {
     BOOST_CHECK_CLOSE(v[2], 3.0, e);
 }
 
+BOOST_AUTO_TEST_CASE(testLayout) {
+    BOOST_CHECK(std::is_trivially_copyable<Point3>::value);
+    BOOST_CHECK(std::is_standard_layout<Point3>::value);
+    BOOST_CHECK_EQUAL(3*sizeof(double), sizeof(Point3));
+    BOOST_CHECK_EQUAL(3*sizeof(double), sizeof(Vector3));
+
+    constexpr Point3 origin;
+    constexpr Point3 points[] = {Point3(1.0, 2.0, 3.0), Point3(4.0, 5.0, 6.0)};
+    Point3 copied[2];
+    std::memcpy(copied, points, sizeof(points));
+    BOOST_CHECK(copied[1] == points[1]);
+    BOOST_CHECK(origin == Point3(0.0, 0.0, 0.0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,53 @@
+#include <boost/test/unit_test.hpp>
+
+#include "kernel/predicates.h"
+#include "kernel/Point3.h"
+#include "kernel/Plane3.h"
+#include <cmath>
+
+using kernel::side;
+using kernel::orientation;
+using kernel::Point3;
+using kernel::Plane3;
+
+BOOST_AUTO_TEST_SUITE(PredicatesTest)
+
+BOOST_AUTO_TEST_CASE(testSide) {
+    Plane3 plane(0.0, 0.0, 1.0, -1.0);
+    BOOST_CHECK_EQUAL(1, side(plane, Point3(0.0, 0.0, 2.0)));
+    BOOST_CHECK_EQUAL(-1, side(plane, Point3(0.0, 0.0, 0.0)));
+    BOOST_CHECK_EQUAL(0, side(plane, Point3(5.0, 3.0, 1.0)));
+
+    // 1e16 + 1 is rounded to 1e16 in doubles
+    plane = Plane3(1.0, 1.0, 0.0, -1.0e16);
+    BOOST_CHECK_EQUAL(1, side(plane, Point3(1.0e16, 1.0, 0.0)));
+    BOOST_CHECK_EQUAL(-1, side(plane, Point3(1.0e16, -1.0, 0.0)));
+    BOOST_CHECK_EQUAL(0, side(plane, Point3(1.0e16, 0.0, 0.0)));
+    BOOST_CHECK_EQUAL(1, plane.side(Point3(1.0e16, 1.0, 0.0)));
+}
+
+BOOST_AUTO_TEST_CASE(testOrientation) {
+    Point3 pa(1.0, 0.0, 0.0);
+    Point3 pb(0.0, 1.0, 0.0);
+    Point3 pc(0.0, 0.0, 1.0);
+    Point3 pd(0.0, 0.0, 0.0);
+    BOOST_CHECK_EQUAL(1, orientation(pa, pb, pc, pd));
+    BOOST_CHECK_EQUAL(-1, orientation(pb, pa, pc, pd));
+    BOOST_CHECK_EQUAL(Plane3(pd, pa, pb).side(pc), orientation(pa, pb, pc, pd));
+
+    // on the plane z = x + y, the differences to pd are rounded
+    const double t = ldexp(1.0, 53);
+    pa = Point3(t - 1.0, 1.0, t);
+    pb = Point3(1.0, t - 1.0, t);
+    pc = Point3(3.0, 5.0, 8.0);
+    pd = Point3(0.5, 0.25, 0.75);
+    BOOST_CHECK_EQUAL(0, orientation(pa, pb, pc, pd));
+    BOOST_CHECK_EQUAL(0, orientation(pd, pc, pb, pa));
+    pd = Point3(0.5, 0.25, 0.75 + ldexp(1.0, -50));
+    BOOST_CHECK_EQUAL(-1, orientation(pa, pb, pc, pd));
+    BOOST_CHECK_EQUAL(1, orientation(pb, pa, pc, pd));
+    pd = Point3(0.5, 0.25, 0.75 - ldexp(1.0, -50));
+    BOOST_CHECK_EQUAL(1, orientation(pa, pb, pc, pd));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,56 @@
+#include <boost/test/unit_test.hpp>
+
+#include "util/Interval.h"
+
+using util::Interval;
+
+BOOST_AUTO_TEST_SUITE(IntervalTest)
+
+BOOST_AUTO_TEST_CASE(testArithmetic) {
+    Interval<double> a(1.0, 2.0);
+    Interval<double> b(-3.0, 4.0);
+    Interval<double> sum = a + b;
+    BOOST_CHECK(sum.lower() <= -2.0 && sum.upper() >= 6.0);
+    Interval<double> diff = a - b;
+    BOOST_CHECK(diff.lower() <= -3.0 && diff.upper() >= 5.0);
+    Interval<double> prod = a * b;
+    BOOST_CHECK(prod.lower() <= -6.0 && prod.upper() >= 8.0);
+    Interval<double> quot = b / a;
+    BOOST_CHECK(quot.lower() <= -3.0 && quot.upper() >= 4.0);
+    BOOST_CHECK(!(a / b).isBounded());
+    BOOST_CHECK(b.containsZero());
+    BOOST_CHECK(!a.containsZero());
+    BOOST_CHECK_EQUAL(1.0, a.mignitude());
+    BOOST_CHECK_EQUAL(0.0, b.mignitude());
+}
+
+BOOST_AUTO_TEST_CASE(testEnclosure) {
+    // 0.1 is not representable, the sum of 10 intervals has to contain 1
+    Interval<double> tenth = Interval<double>(1.0) / Interval<double>(10.0);
+    Interval<double> sum;
+    for (int i = 0; i < 10; i++) {
+        sum = sum + tenth;
+    }
+    BOOST_CHECK(sum.lower() < 1.0 && sum.upper() > 1.0);
+    BOOST_CHECK(sum.width() < 1e-14);
+    Interval<double> root = Interval<double>(2.0).sqrt();
+    BOOST_CHECK((root * root).lower() <= 2.0);
+    BOOST_CHECK((root * root).upper() >= 2.0);
+    Interval<long double> tenth_precise =
+            Interval<long double>(1.0) / Interval<long double>(10.0);
+    BOOST_CHECK(tenth_precise.width() <= (long double)tenth.width());
+}
+
+BOOST_AUTO_TEST_CASE(testOrder) {
+    Interval<double> a(1.0, 2.0);
+    Interval<double> b(2.5, 3.0);
+    Interval<double> c(1.5, 2.5);
+    BOOST_CHECK(b.isGreater(a));
+    BOOST_CHECK(!a.isGreater(b));
+    BOOST_CHECK(!b.isGreater(c));
+    BOOST_CHECK(a.overlaps(c));
+    BOOST_CHECK(b.overlaps(c));
+    BOOST_CHECK(!a.overlaps(b));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+#include <boost/test/unit_test.hpp>
+
+#include "util/SlotList.h"
+#include <memory>
+#include <vector>
+
+using util::SlotList;
+
+BOOST_AUTO_TEST_SUITE(SlotListTest)
+
+typedef std::shared_ptr<int> IntSPtr;
+
+static std::vector<int> toVector(SlotList<IntSPtr>& list) {
+    std::vector<int> result;
+    SlotList<IntSPtr>::iterator it = list.begin();
+    while (it != list.end()) {
+        result.push_back(**it++);
+    }
+    return result;
+}
+
+static std::vector<size_t> moved_slots;
+
+static void moved(IntSPtr& element, size_t slot) {
+    moved_slots.push_back(slot);
+}
+
+BOOST_AUTO_TEST_CASE(testPushBack) {
+    SlotList<IntSPtr> list;
+    BOOST_CHECK(list.empty());
+    BOOST_CHECK(list.begin() == list.end());
+    for (int i = 0; i < 4; i++) {
+        BOOST_CHECK_EQUAL((size_t)i, list.push_back(IntSPtr(new int(i))));
+    }
+    BOOST_CHECK_EQUAL(4u, list.size());
+    BOOST_CHECK_EQUAL(0, *list.front());
+    BOOST_CHECK_EQUAL(3, *list.back());
+    std::vector<int> values = toVector(list);
+    BOOST_REQUIRE_EQUAL(4u, values.size());
+    for (int i = 0; i < 4; i++) {
+        BOOST_CHECK_EQUAL(i, values[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testErase) {
+    SlotList<IntSPtr> list;
+    for (int i = 0; i < 5; i++) {
+        list.push_back(IntSPtr(new int(i)));
+    }
+    SlotList<IntSPtr>::iterator it_3 = list.begin();
+    std::advance(it_3, 3);
+    SlotList<IntSPtr>::iterator it_next = list.erase(0);
+    BOOST_CHECK_EQUAL(1, **it_next);
+    it_next = list.erase(2);
+    BOOST_CHECK_EQUAL(3, **it_next);
+    list.erase(4);
+    BOOST_CHECK_EQUAL(2u, list.size());
+    BOOST_CHECK_EQUAL(3u, list.numGaps());
+    BOOST_CHECK_EQUAL(1, *list.front());
+    BOOST_CHECK_EQUAL(3, *list.back());
+    BOOST_CHECK_EQUAL(3, **it_3);  // still valid
+    std::vector<int> values = toVector(list);
+    BOOST_REQUIRE_EQUAL(2u, values.size());
+    BOOST_CHECK_EQUAL(1, values[0]);
+    BOOST_CHECK_EQUAL(3, values[1]);
+    SlotList<IntSPtr>::reverse_iterator it_r = list.rbegin();
+    BOOST_CHECK_EQUAL(3, **it_r++);
+    BOOST_CHECK_EQUAL(1, **it_r++);
+    BOOST_CHECK(it_r == list.rend());
+}
+
+BOOST_AUTO_TEST_CASE(testMoveToBack) {
+    SlotList<IntSPtr> list;
+    for (int i = 0; i < 3; i++) {
+        list.push_back(IntSPtr(new int(i)));
+    }
+    BOOST_CHECK_EQUAL(3u, list.moveToBack(0));
+    BOOST_CHECK_EQUAL(3u, list.size());
+    BOOST_CHECK_EQUAL(1, *list.front());
+    BOOST_CHECK_EQUAL(0, *list.back());
+}
+
+BOOST_AUTO_TEST_CASE(testCompact) {
+    SlotList<IntSPtr> list;
+    for (int i = 0; i < 6; i++) {
+        list.push_back(IntSPtr(new int(i)));
+    }
+    list.erase(1);
+    list.erase(4);
+    moved_slots.clear();
+    list.compact(moved);
+    BOOST_CHECK_EQUAL(0u, list.numGaps());
+    BOOST_CHECK_EQUAL(4u, list.size());
+    // 2 -> 1, 3 -> 2, 5 -> 3
+    BOOST_REQUIRE_EQUAL(3u, moved_slots.size());
+    BOOST_CHECK_EQUAL(1u, moved_slots[0]);
+    BOOST_CHECK_EQUAL(2u, moved_slots[1]);
+    BOOST_CHECK_EQUAL(3u, moved_slots[2]);
+    std::vector<int> values = toVector(list);
+    BOOST_REQUIRE_EQUAL(4u, values.size());
+    BOOST_CHECK_EQUAL(0, values[0]);
+    BOOST_CHECK_EQUAL(2, values[1]);
+    BOOST_CHECK_EQUAL(3, values[2]);
+    BOOST_CHECK_EQUAL(5, values[3]);
+    BOOST_CHECK_EQUAL(5, *list.at(3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()